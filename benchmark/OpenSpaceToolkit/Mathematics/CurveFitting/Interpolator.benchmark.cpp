@@ -0,0 +1,73 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::VectorXd;
+
+static void OpenSpaceToolkit_Mathematics_CurveFitting_Interpolator_GenerateInterpolator(benchmark::State& aState)
+{
+    const Size sampleCount = aState.range(0);
+    const Interpolator::Type type = static_cast<Interpolator::Type>(aState.range(1));
+
+    const VectorXd x = VectorXd::LinSpaced(sampleCount, 0.0, 10.0);
+    const VectorXd y = x.array().sin();
+    const VectorXd dydx = x.array().cos();
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(Interpolator::GenerateInterpolator(type, x, y, dydx));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_CurveFitting_Interpolator_Evaluate(benchmark::State& aState)
+{
+    const Size sampleCount = aState.range(0);
+    const Interpolator::Type type = static_cast<Interpolator::Type>(aState.range(1));
+
+    const VectorXd x = VectorXd::LinSpaced(sampleCount, 0.0, 10.0);
+    const VectorXd y = x.array().sin();
+    const VectorXd dydx = x.array().cos();
+
+    const Shared<const Interpolator> interpolator = Interpolator::GenerateInterpolator(type, x, y, dydx);
+
+    const VectorXd queries = VectorXd::LinSpaced(1000, 0.005, 9.995);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(interpolator->evaluate(queries));
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * queries.size());
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_CurveFitting_Interpolator_GenerateInterpolator)
+    ->ArgNames({"sampleCount", "type"})
+    ->ArgsProduct({
+        {16, 256, 4096},
+        {static_cast<long>(Interpolator::Type::BarycentricRational),
+         static_cast<long>(Interpolator::Type::CubicSpline),
+         static_cast<long>(Interpolator::Type::Hermite),
+         static_cast<long>(Interpolator::Type::Linear),
+         static_cast<long>(Interpolator::Type::ZeroOrder)}
+    });
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_CurveFitting_Interpolator_Evaluate)
+    ->ArgNames({"sampleCount", "type"})
+    ->ArgsProduct({
+        {16, 256, 4096},
+        {static_cast<long>(Interpolator::Type::BarycentricRational),
+         static_cast<long>(Interpolator::Type::CubicSpline),
+         static_cast<long>(Interpolator::Type::Hermite),
+         static_cast<long>(Interpolator::Type::Linear),
+         static_cast<long>(Interpolator::Type::ZeroOrder)}
+    });
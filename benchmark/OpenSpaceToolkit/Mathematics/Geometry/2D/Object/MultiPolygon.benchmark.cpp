@@ -0,0 +1,95 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/MultiPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Polygon.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d2::object::MultiPolygon;
+using ostk::mathematics::geometry::d2::object::Point;
+using ostk::mathematics::geometry::d2::object::Polygon;
+
+// Coverage footprints: overlapping 16-gons along parallel swaths, in acquisition order
+
+static Array<Polygon> Footprints(const Size aFootprintCount)
+{
+    const Size swathLength = static_cast<Size>(std::sqrt(static_cast<double>(aFootprintCount)));
+
+    Array<Polygon> footprints = Array<Polygon>::Empty();
+
+    footprints.reserve(aFootprintCount);
+
+    for (Index footprintIndex = 0; footprintIndex < aFootprintCount; ++footprintIndex)
+    {
+        const Point center = {
+            0.7 * static_cast<double>(footprintIndex % swathLength),
+            1.5 * static_cast<double>(footprintIndex / swathLength) + 0.1 * std::sin(footprintIndex)
+        };
+
+        Array<Point> vertices = Array<Point>::Empty();
+
+        vertices.reserve(16);
+
+        for (Index vertexIndex = 0; vertexIndex < 16; ++vertexIndex)
+        {
+            const double angle_rad = -2.0 * M_PI * static_cast<double>(vertexIndex) / 16.0;
+
+            vertices.add({center.x() + std::cos(angle_rad), center.y() + std::sin(angle_rad)});
+        }
+
+        footprints.add(Polygon(vertices));
+    }
+
+    return footprints;
+}
+
+// Baseline: sequential pairwise union into a growing accumulator
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Object_MultiPolygon_UnionWith(benchmark::State& aState)
+{
+    const Array<Polygon> footprints = Footprints(aState.range(0));
+
+    for (auto _ : aState)
+    {
+        MultiPolygon multiPolygon = MultiPolygon::Polygon(footprints.accessFirst());
+
+        for (Index footprintIndex = 1; footprintIndex < footprints.size(); ++footprintIndex)
+        {
+            multiPolygon = multiPolygon.unionWith(MultiPolygon::Polygon(footprints[footprintIndex]));
+        }
+
+        benchmark::DoNotOptimize(multiPolygon);
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Object_MultiPolygon_Union(benchmark::State& aState)
+{
+    const Array<Polygon> footprints = Footprints(aState.range(0));
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(MultiPolygon::Union(footprints, aState.range(1)));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_MultiPolygon_UnionWith)
+    ->ArgName("footprintCount")
+    ->RangeMultiplier(4)
+    ->Range(64, 1024)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_MultiPolygon_Union)
+    ->ArgNames({"footprintCount", "threadCount"})
+    ->ArgsProduct({{64, 256, 1024, 4096}, {1, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,163 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/BoundingBox.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/MultiPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Polygon.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d2::BoundingBox;
+using ostk::mathematics::geometry::d2::object::Point;
+using ostk::mathematics::geometry::d2::object::Polygon;
+
+// Regular polygon approximating a circle
+
+static Polygon RegularPolygon(const Size aVertexCount, const Point& aCenter, const double aRadius)
+{
+    Array<Point> vertices = Array<Point>::Empty();
+
+    vertices.reserve(aVertexCount);
+
+    for (Index i = 0; i < aVertexCount; ++i)
+    {
+        const double angle_rad = -2.0 * M_PI * static_cast<double>(i) / static_cast<double>(aVertexCount);
+
+        vertices.add({aCenter.x() + aRadius * std::cos(angle_rad), aCenter.y() + aRadius * std::sin(angle_rad)});
+    }
+
+    return Polygon(vertices);
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_IntersectionWith(benchmark::State& aState)
+{
+    const Polygon firstPolygon = RegularPolygon(aState.range(0), {0.0, 0.0}, 1.0);
+    const Polygon secondPolygon = RegularPolygon(aState.range(0), {0.5, 0.25}, 1.0);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(firstPolygon.intersectionWith(secondPolygon));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_DifferenceWith(benchmark::State& aState)
+{
+    const Polygon firstPolygon = RegularPolygon(aState.range(0), {0.0, 0.0}, 1.0);
+    const Polygon secondPolygon = RegularPolygon(aState.range(0), {0.5, 0.25}, 1.0);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(firstPolygon.differenceWith(secondPolygon));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_UnionWith(benchmark::State& aState)
+{
+    const Polygon firstPolygon = RegularPolygon(aState.range(0), {0.0, 0.0}, 1.0);
+    const Polygon secondPolygon = RegularPolygon(aState.range(0), {0.5, 0.25}, 1.0);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(firstPolygon.unionWith(secondPolygon));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_ClipTo(benchmark::State& aState)
+{
+    const Polygon polygon = RegularPolygon(aState.range(0), {0.0, 0.0}, 1.0);
+
+    const BoundingBox boundingBox = {{-0.5, -0.25}, {1.5, 1.75}};
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(polygon.clipTo(boundingBox));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_ClipTo_IntersectionWith(benchmark::State& aState)
+{
+    const Polygon polygon = RegularPolygon(aState.range(0), {0.0, 0.0}, 1.0);
+
+    const Polygon boxPolygon = {{{-0.5, -0.25}, {1.5, -0.25}, {1.5, 1.75}, {-0.5, 1.75}}};
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(polygon.intersectionWith(boxPolygon));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_ContainsPoint(benchmark::State& aState)
+{
+    const Polygon polygon = RegularPolygon(aState.range(0), {0.0, 0.0}, 1.0);
+
+    const Point point = {0.25, -0.5};
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(polygon.contains(point));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_Simplify(benchmark::State& aState)
+{
+    const Polygon polygon = RegularPolygon(aState.range(0), {0.0, 0.0}, 1.0);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(polygon.simplify(1.0e-4));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_SimplifyTo(benchmark::State& aState)
+{
+    const Polygon polygon = RegularPolygon(aState.range(0), {0.0, 0.0}, 1.0);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(polygon.simplifyTo(aState.range(0) / 16));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_IntersectionWith)
+    ->ArgName("vertexCount")
+    ->RangeMultiplier(8)
+    ->Range(8, 4096);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_DifferenceWith)
+    ->ArgName("vertexCount")
+    ->RangeMultiplier(8)
+    ->Range(8, 4096);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_UnionWith)
+    ->ArgName("vertexCount")
+    ->RangeMultiplier(8)
+    ->Range(8, 4096);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_ContainsPoint)
+    ->ArgName("vertexCount")
+    ->RangeMultiplier(8)
+    ->Range(8, 4096);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_ClipTo)
+    ->ArgName("vertexCount")
+    ->RangeMultiplier(8)
+    ->Range(8, 4096);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_ClipTo_IntersectionWith)
+    ->ArgName("vertexCount")
+    ->RangeMultiplier(8)
+    ->Range(8, 4096);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_Simplify)
+    ->ArgName("vertexCount")
+    ->RangeMultiplier(8)
+    ->Range(64, 262144);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon_SimplifyTo)
+    ->ArgName("vertexCount")
+    ->RangeMultiplier(8)
+    ->Range(64, 262144);
@@ -0,0 +1,110 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/LineString.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Segment.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d2::object::LineString;
+using ostk::mathematics::geometry::d2::object::Point;
+using ostk::mathematics::geometry::d2::object::Segment;
+
+// Ground track like polyline: a sine wave wrapping around in longitude, crossing itself once per revolution
+
+static Array<Point> GroundTrackPoints(const Size aPointCount)
+{
+    Array<Point> points = Array<Point>::Empty();
+
+    points.reserve(aPointCount);
+
+    for (Index i = 0; i < aPointCount; ++i)
+    {
+        const double angle_rad = 16.0 * M_PI * static_cast<double>(i) / static_cast<double>(aPointCount);
+
+        points.add({std::fmod(angle_rad * 1.1, 2.0 * M_PI), std::sin(angle_rad)});
+    }
+
+    return points;
+}
+
+static Array<Segment> GroundTrackSegments(const Size aPointCount)
+{
+    const Array<Point> points = GroundTrackPoints(aPointCount);
+
+    Array<Segment> segments = Array<Segment>::Empty();
+
+    segments.reserve(points.getSize() - 1);
+
+    for (Index i = 0; (i + 1) < points.getSize(); ++i)
+    {
+        segments.add(Segment(points[i], points[i + 1]));
+    }
+
+    return segments;
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Segment_IntersectionPoints(benchmark::State& aState)
+{
+    const Array<Segment> segments = GroundTrackSegments(aState.range(0));
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(Segment::IntersectionPoints(segments));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Segment_IntersectionPoints_AllPairs(
+    benchmark::State& aState
+)
+{
+    const Array<Segment> segments = GroundTrackSegments(aState.range(0));
+
+    for (auto _ : aState)
+    {
+        Size count = 0;
+
+        for (Index i = 0; i < segments.getSize(); ++i)
+        {
+            for (Index j = i + 1; j < segments.getSize(); ++j)
+            {
+                count += Segment::IntersectionPoints({segments[i], segments[j]}).getSize();
+            }
+        }
+
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString_IsSimple(benchmark::State& aState)
+{
+    const LineString lineString = LineString(GroundTrackPoints(aState.range(0)));
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(lineString.isSimple());
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Segment_IntersectionPoints)
+    ->ArgName("pointCount")
+    ->RangeMultiplier(8)
+    ->Range(64, 262144);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Segment_IntersectionPoints_AllPairs)
+    ->ArgName("pointCount")
+    ->RangeMultiplier(8)
+    ->Range(64, 4096);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString_IsSimple)
+    ->ArgName("pointCount")
+    ->RangeMultiplier(8)
+    ->Range(64, 262144);
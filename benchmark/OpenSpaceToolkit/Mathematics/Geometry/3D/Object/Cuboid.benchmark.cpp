@@ -0,0 +1,132 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::container::Pair;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d3::object::Cuboid;
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::geometry::d3::object::Sphere;
+using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::Vector3d;
+
+// Randomly oriented cuboids spread in a cube whose side grows with the count, so that each cuboid overlaps a few others
+// (Eigen's Random is deterministic)
+
+static Array<Cuboid> RandomCuboids(const Size aCuboidCount)
+{
+    const double side = 4.0 * std::cbrt(static_cast<double>(aCuboidCount));
+
+    Array<Cuboid> cuboids = Array<Cuboid>::Empty();
+
+    cuboids.reserve(aCuboidCount);
+
+    for (Index cuboidIndex = 0; cuboidIndex < aCuboidCount; ++cuboidIndex)
+    {
+        const Matrix3d axes = Eigen::Quaterniond::UnitRandom().toRotationMatrix();
+        const Vector3d extent = 0.5 + 0.5 * Vector3d::Random().array();
+
+        cuboids.add(Cuboid(
+            Point::Vector(0.5 * side * Vector3d::Random()),
+            {Vector3d(axes.col(0)), Vector3d(axes.col(1)), Vector3d(axes.col(2))},
+            {extent(0), extent(1), extent(2)}
+        ));
+    }
+
+    return cuboids;
+}
+
+static Array<Sphere> RandomSpheres(const Size aSphereCount)
+{
+    const double side = 4.0 * std::cbrt(static_cast<double>(aSphereCount));
+
+    Array<Sphere> spheres = Array<Sphere>::Empty();
+
+    spheres.reserve(aSphereCount);
+
+    for (Index sphereIndex = 0; sphereIndex < aSphereCount; ++sphereIndex)
+    {
+        spheres.add(Sphere(Point::Vector(0.5 * side * Vector3d::Random()), 0.75 + 0.25 * Vector3d::Random()(0)));
+    }
+
+    return spheres;
+}
+
+// Baseline: pairwise oriented box tests
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cuboid_Intersects(benchmark::State& aState)
+{
+    const Array<Cuboid> firstCuboids = RandomCuboids(aState.range(0));
+    const Array<Cuboid> secondCuboids = RandomCuboids(aState.range(0));
+
+    for (auto _ : aState)
+    {
+        Array<Pair<Index, Index>> intersectingPairs = Array<Pair<Index, Index>>::Empty();
+
+        for (Index firstIndex = 0; firstIndex < firstCuboids.getSize(); ++firstIndex)
+        {
+            for (Index secondIndex = 0; secondIndex < secondCuboids.getSize(); ++secondIndex)
+            {
+                if (firstCuboids[firstIndex].intersects(secondCuboids[secondIndex]))
+                {
+                    intersectingPairs.add({firstIndex, secondIndex});
+                }
+            }
+        }
+
+        benchmark::DoNotOptimize(intersectingPairs);
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cuboid_IntersectingPairs_Cuboid(benchmark::State& aState)
+{
+    const Array<Cuboid> firstCuboids = RandomCuboids(aState.range(0));
+    const Array<Cuboid> secondCuboids = RandomCuboids(aState.range(0));
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(Cuboid::IntersectingPairs(firstCuboids, secondCuboids, aState.range(1)));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cuboid_IntersectingPairs_Sphere(benchmark::State& aState)
+{
+    const Array<Sphere> spheres = RandomSpheres(aState.range(0));
+    const Array<Cuboid> cuboids = RandomCuboids(aState.range(0));
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(Cuboid::IntersectingPairs(spheres, cuboids, aState.range(1)));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cuboid_Intersects)
+    ->ArgName("cuboidCount")
+    ->RangeMultiplier(4)
+    ->Range(256, 4096)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cuboid_IntersectingPairs_Cuboid)
+    ->ArgNames({"cuboidCount", "threadCount"})
+    ->ArgsProduct({{256, 4096, 65536}, {1, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cuboid_IntersectingPairs_Sphere)
+    ->ArgNames({"sphereCount", "threadCount"})
+    ->ArgsProduct({{256, 4096, 65536}, {1, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,117 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Cone.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Pyramid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+using ostk::mathematics::geometry::Angle;
+using ostk::mathematics::geometry::d3::object::Cone;
+using ostk::mathematics::geometry::d3::object::Ellipsoid;
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::geometry::d3::object::Polygon;
+using ostk::mathematics::geometry::d3::object::Pyramid;
+using ostk::mathematics::geometry::d3::object::Ray;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+
+// Earth-like ellipsoid, observed from a low Earth orbit
+
+static const Ellipsoid Earth = {{0.0, 0.0, 0.0}, 6378137.0, 6378137.0, 6356752.3};
+static const Point Observer = {7000000.0, 0.0, 0.0};
+
+// Argument 0: ray hits the ellipsoid (nadir), 1: ray misses the ellipsoid (zenith)
+
+static Vector3d ObserverDirection(const long aCase)
+{
+    return ((aCase == 0) ? Vector3d {-1.0, 0.0, 0.1} : Vector3d {1.0, 0.0, 0.1}).normalized();
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid_IntersectsRay(benchmark::State& aState)
+{
+    const Ray ray = {Observer, ObserverDirection(aState.range(0))};
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(Earth.intersects(ray));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid_IntersectionWithRay(benchmark::State& aState)
+{
+    const Ray ray = {Observer, ObserverDirection(aState.range(0))};
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(Earth.intersectionWith(ray, true));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid_PyramidIntersects(benchmark::State& aState)
+{
+    const Vector3d direction = ObserverDirection(aState.range(1));
+
+    const Polygon base = {
+        {{{-0.1, -0.1}, {+0.1, -0.1}, {+0.1, +0.1}, {-0.1, +0.1}}},
+        Observer + direction,
+        direction.cross(Vector3d::Z()).normalized(),
+        direction.cross(direction.cross(Vector3d::Z())).normalized()
+    };
+
+    const Pyramid pyramid = {base, Observer};
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(pyramid.intersects(Earth, aState.range(0)));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid_ConeIntersects(benchmark::State& aState)
+{
+    const Cone cone = {Observer, ObserverDirection(aState.range(1)), Angle::Degrees(10.0)};
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(cone.intersects(Earth, aState.range(0)));
+    }
+}
+
+// Points from below the surface to geostationary altitude, one per column
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid_ProjectPoints(benchmark::State& aState)
+{
+    const MatrixXd directions = MatrixXd::Random(3, aState.range(0)).colwise().normalized();
+    const MatrixXd altitudes = (MatrixXd::Random(1, aState.range(0)).array() + 1.0) * 2.0e7;
+
+    const MatrixXd points = directions.array().rowwise() * (altitudes.array() + 6.0e6).row(0);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(Earth.projectPoints(points, aState.range(1)));
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid_IntersectsRay)->ArgName("miss")->DenseRange(0, 1);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid_IntersectionWithRay)
+    ->ArgName("miss")
+    ->DenseRange(0, 1);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid_PyramidIntersects)
+    ->ArgNames({"rayCount", "miss"})
+    ->ArgsProduct({{4, 40, 400, 4000}, {0, 1}});
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid_ConeIntersects)
+    ->ArgNames({"rayCount", "miss"})
+    ->ArgsProduct({{4, 40, 400, 4000}, {0, 1}});
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid_ProjectPoints)
+    ->ArgNames({"pointCount", "threadCount"})
+    ->ArgsProduct({{1000, 100000}, {1, 4}})
+    ->UseRealTime();
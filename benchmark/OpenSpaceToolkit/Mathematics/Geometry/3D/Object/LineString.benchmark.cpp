@@ -0,0 +1,91 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/LineString.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+
+using ostk::core::container::Array;
+
+using ostk::mathematics::geometry::d3::object::LineString;
+using ostk::mathematics::geometry::d3::object::Point;
+
+// Ground-track-like polyline: a helix wrapping around the unit sphere, aPointCount vertices over 15 revolutions
+
+static LineString GroundTrack(const long aPointCount)
+{
+    Array<Point> points = Array<Point>::Empty();
+    points.reserve(aPointCount);
+
+    for (long pointIndex = 0; pointIndex < aPointCount; ++pointIndex)
+    {
+        const double longitude = 15.0 * 2.0 * M_PI * pointIndex / aPointCount;
+        const double latitude = 0.9 * std::sin(longitude / 15.0 * 7.0);
+
+        points.add(
+            {std::cos(latitude) * std::cos(longitude), std::cos(latitude) * std::sin(longitude), std::sin(latitude)}
+        );
+    }
+
+    return {points};
+}
+
+static const Point Query = {0.3, -0.6, 0.7};
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_LineString_ProjectPoint(benchmark::State& aState)
+{
+    LineString lineString = GroundTrack(aState.range(0));
+
+    if (aState.range(1) == 1)
+    {
+        lineString.buildIndex();
+    }
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(lineString.projectPoint(Query));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_LineString_GetPointClosestTo(benchmark::State& aState)
+{
+    LineString lineString = GroundTrack(aState.range(0));
+
+    if (aState.range(1) == 1)
+    {
+        lineString.buildIndex();
+    }
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(lineString.getPointClosestTo(Query));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_LineString_BuildIndex(benchmark::State& aState)
+{
+    const LineString lineString = GroundTrack(aState.range(0));
+
+    for (auto _ : aState)
+    {
+        LineString indexedLineString = lineString;
+        indexedLineString.buildIndex();
+
+        benchmark::DoNotOptimize(indexedLineString);
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_LineString_ProjectPoint)
+    ->ArgNames({"pointCount", "indexed"})
+    ->ArgsProduct({{1000, 100000, 1000000}, {0, 1}});
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_LineString_GetPointClosestTo)
+    ->ArgNames({"pointCount", "indexed"})
+    ->ArgsProduct({{1000, 100000, 1000000}, {0, 1}});
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_LineString_BuildIndex)
+    ->ArgName("pointCount")
+    ->RangeMultiplier(100)
+    ->Range(1000, 1000000);
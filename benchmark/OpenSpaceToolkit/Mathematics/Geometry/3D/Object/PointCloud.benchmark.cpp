@@ -0,0 +1,116 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/PointCloud.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
+using ostk::core::container::Array;
+
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::geometry::d3::object::PointCloud;
+using ostk::mathematics::geometry::d3::object::PointSet;
+using ostk::mathematics::object::MatrixXd;
+
+// Points uniformly spread in a 2 x 2 x 2 cube centered on the origin (Eigen's Random is deterministic)
+
+static MatrixXd RandomPoints(const long aCount)
+{
+    return MatrixXd::Random(aCount, 3);
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud_Build(benchmark::State& aState)
+{
+    const MatrixXd points = RandomPoints(aState.range(0));
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(PointCloud::Matrix(points));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud_FindNearestNeighbor(benchmark::State& aState)
+{
+    const PointCloud pointCloud = PointCloud::Matrix(RandomPoints(aState.range(0)));
+
+    const Point query = {0.1, -0.2, 0.3};
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(pointCloud.findNearestNeighbor(query));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud_FindNearestNeighbors(benchmark::State& aState)
+{
+    const PointCloud pointCloud = PointCloud::Matrix(RandomPoints(aState.range(0)));
+
+    const Point query = {0.1, -0.2, 0.3};
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(pointCloud.findNearestNeighbors(query, 16));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud_FindNearestNeighborBatch(
+    benchmark::State& aState
+)
+{
+    const PointCloud pointCloud = PointCloud::Matrix(RandomPoints(100000));
+
+    const MatrixXd queries = RandomPoints(10000);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(pointCloud.findNearestNeighbor(queries, aState.range(0)));
+    }
+}
+
+// Baseline: linear scan over the unordered point set
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointSet_GetPointClosestTo(benchmark::State& aState)
+{
+    const MatrixXd points = RandomPoints(aState.range(0));
+
+    Array<Point> pointArray = Array<Point>::Empty();
+    pointArray.reserve(points.rows());
+
+    for (long rowIndex = 0; rowIndex < points.rows(); ++rowIndex)
+    {
+        pointArray.add(Point::Vector(points.row(rowIndex).transpose()));
+    }
+
+    const PointSet pointSet = {pointArray};
+
+    const Point query = {0.1, -0.2, 0.3};
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(pointSet.getPointClosestTo(query));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud_Build)
+    ->ArgName("pointCount")
+    ->RangeMultiplier(100)
+    ->Range(100, 1000000);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud_FindNearestNeighbor)
+    ->ArgName("pointCount")
+    ->RangeMultiplier(100)
+    ->Range(100, 1000000);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud_FindNearestNeighbors)
+    ->ArgName("pointCount")
+    ->RangeMultiplier(100)
+    ->Range(100, 1000000);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud_FindNearestNeighborBatch)
+    ->ArgName("threadCount")
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointSet_GetPointClosestTo)
+    ->ArgName("pointCount")
+    ->RangeMultiplier(100)
+    ->Range(100, 1000000);
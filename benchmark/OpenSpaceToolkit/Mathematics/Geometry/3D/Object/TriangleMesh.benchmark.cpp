@@ -0,0 +1,149 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/TriangleMesh.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::geometry::d3::object::Ray;
+using ostk::mathematics::geometry::d3::object::TriangleMesh;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::MatrixXi;
+using ostk::mathematics::object::Vector3d;
+
+// Unit UV sphere with aBandCount latitude bands and 2 * aBandCount longitude sectors (4 * aBandCount^2 triangles,
+// some of them degenerate at the poles)
+
+static TriangleMesh UnitSphere(const Size aBandCount)
+{
+    const Size sectorCount = 2 * aBandCount;
+
+    MatrixXd vertices((aBandCount + 1) * sectorCount, 3);
+    MatrixXi triangles(2 * aBandCount * sectorCount, 3);
+
+    for (Index bandIndex = 0; bandIndex <= aBandCount; ++bandIndex)
+    {
+        const double latitude = M_PI * ((static_cast<double>(bandIndex) / aBandCount) - 0.5);
+
+        for (Index sectorIndex = 0; sectorIndex < sectorCount; ++sectorIndex)
+        {
+            const double longitude = 2.0 * M_PI * static_cast<double>(sectorIndex) / sectorCount;
+
+            vertices.row((bandIndex * sectorCount) + sectorIndex) << std::cos(latitude) * std::cos(longitude),
+                std::cos(latitude) * std::sin(longitude), std::sin(latitude);
+        }
+    }
+
+    for (Index bandIndex = 0; bandIndex < aBandCount; ++bandIndex)
+    {
+        for (Index sectorIndex = 0; sectorIndex < sectorCount; ++sectorIndex)
+        {
+            const int first = (bandIndex * sectorCount) + sectorIndex;
+            const int second = (bandIndex * sectorCount) + ((sectorIndex + 1) % sectorCount);
+
+            triangles.row(2 * first) << first, second, second + sectorCount;
+            triangles.row((2 * first) + 1) << first, second + sectorCount, first + sectorCount;
+        }
+    }
+
+    return {vertices, triangles};
+}
+
+// Rays from random points of a cube of side 4 toward random points of the unit cube, about half of which hit the
+// sphere (Eigen's Random is deterministic)
+
+static void RandomRays(const Size aRayCount, MatrixXd& anOriginMatrix, MatrixXd& aDirectionMatrix)
+{
+    anOriginMatrix = 2.0 * MatrixXd::Random(aRayCount, 3);
+    aDirectionMatrix = MatrixXd::Random(aRayCount, 3) - anOriginMatrix;
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh_Build(benchmark::State& aState)
+{
+    const TriangleMesh mesh = UnitSphere(aState.range(0));
+
+    const MatrixXd vertices = mesh.getVertices();
+    const MatrixXi triangles = mesh.getTriangles();
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(TriangleMesh(vertices, triangles));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh_CastRay(benchmark::State& aState)
+{
+    const TriangleMesh mesh = UnitSphere(aState.range(0));
+
+    const Ray ray = {{0.1, -0.2, 3.0}, {0.0, 0.1, -1.0}};
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(mesh.castRay(ray));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh_CastRays(benchmark::State& aState)
+{
+    const TriangleMesh mesh = UnitSphere(aState.range(0));
+
+    MatrixXd origins;
+    MatrixXd directions;
+
+    RandomRays(10000, origins, directions);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(mesh.castRays(origins, directions, aState.range(1)));
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * origins.rows());
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh_Intersects(benchmark::State& aState)
+{
+    const TriangleMesh mesh = UnitSphere(aState.range(0));
+
+    MatrixXd origins;
+    MatrixXd directions;
+
+    RandomRays(10000, origins, directions);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(mesh.intersects(origins, directions, aState.range(1)));
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * origins.rows());
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh_Build)
+    ->ArgName("bandCount")
+    ->RangeMultiplier(4)
+    ->Range(16, 256)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh_CastRay)
+    ->ArgName("bandCount")
+    ->RangeMultiplier(4)
+    ->Range(16, 256);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh_CastRays)
+    ->ArgNames({"bandCount", "threadCount"})
+    ->ArgsProduct({{16, 256}, {1, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh_Intersects)
+    ->ArgNames({"bandCount", "threadCount"})
+    ->ArgsProduct({{16, 256}, {1, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
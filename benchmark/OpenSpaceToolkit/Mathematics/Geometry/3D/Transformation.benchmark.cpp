@@ -0,0 +1,62 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationVector.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
+using ostk::mathematics::geometry::Angle;
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::geometry::d3::Transformation;
+using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
+using ostk::mathematics::object::MatrixXd;
+
+static const Transformation RigidTransformation =
+    Transformation::RotationAround({1.0, 2.0, 3.0}, RotationVector({0.0, 0.0, 1.0}, Angle::Degrees(30.0)));
+
+// Baseline: one homogeneous 4 x 4 product per point
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_ApplyTo(benchmark::State& aState)
+{
+    MatrixXd points = MatrixXd::Random(3, aState.range(0));
+
+    for (auto _ : aState)
+    {
+        for (Eigen::Index pointIndex = 0; pointIndex < points.cols(); ++pointIndex)
+        {
+            points.col(pointIndex) = RigidTransformation.applyTo(Point::Vector(points.col(pointIndex))).asVector();
+        }
+
+        benchmark::DoNotOptimize(points.data());
+        benchmark::ClobberMemory();
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_ApplyToPoints(benchmark::State& aState)
+{
+    MatrixXd points = MatrixXd::Random(3, aState.range(0));
+
+    for (auto _ : aState)
+    {
+        RigidTransformation.applyToPoints(points);
+
+        benchmark::DoNotOptimize(points.data());
+        benchmark::ClobberMemory();
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_ApplyTo)
+    ->ArgName("pointCount")
+    ->RangeMultiplier(100)
+    ->Range(100, 1000000);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_ApplyToPoints)
+    ->ArgName("pointCount")
+    ->RangeMultiplier(100)
+    ->Range(100, 1000000);
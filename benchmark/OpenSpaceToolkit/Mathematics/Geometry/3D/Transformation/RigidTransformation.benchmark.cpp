@@ -0,0 +1,116 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/RigidTransformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationVector.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+
+using ostk::core::container::Array;
+
+using ostk::mathematics::geometry::Angle;
+using ostk::mathematics::geometry::d3::Transformation;
+using ostk::mathematics::geometry::d3::transformation::RigidTransformation;
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
+using ostk::mathematics::object::Vector3d;
+
+// Frame chain: aFrameCount rigid transformations with varying axes, angles and offsets
+
+static Array<RigidTransformation> FrameChain(const long aFrameCount)
+{
+    Array<RigidTransformation> frames = Array<RigidTransformation>::Empty();
+    frames.reserve(aFrameCount);
+
+    for (long frameIndex = 0; frameIndex < aFrameCount; ++frameIndex)
+    {
+        const Vector3d axis = Vector3d(1.0, frameIndex % 3, 1.0 + frameIndex % 5).normalized();
+
+        frames.add(
+            {Quaternion::RotationVector(RotationVector(axis, Angle::Degrees(7.0 * frameIndex))),
+             Vector3d(0.1 * frameIndex, -0.2, 0.3)}
+        );
+    }
+
+    return frames;
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation_Compose(
+    benchmark::State& aState
+)
+{
+    const Array<RigidTransformation> frames = FrameChain(aState.range(0));
+
+    for (auto _ : aState)
+    {
+        RigidTransformation composition = RigidTransformation::Identity();
+
+        for (const RigidTransformation& frame : frames)
+        {
+            composition *= frame;
+        }
+
+        benchmark::DoNotOptimize(composition);
+    }
+}
+
+// Baseline: the same chain as general 4 x 4 transformations
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_Transformation_Compose(benchmark::State& aState)
+{
+    Array<Transformation> frames = Array<Transformation>::Empty();
+
+    for (const RigidTransformation& frame : FrameChain(aState.range(0)))
+    {
+        frames.add(frame.toTransformation());
+    }
+
+    for (auto _ : aState)
+    {
+        Transformation composition = Transformation::Identity();
+
+        for (const Transformation& frame : frames)
+        {
+            composition *= frame;
+        }
+
+        benchmark::DoNotOptimize(composition);
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation_GetInverse(
+    benchmark::State& aState
+)
+{
+    const RigidTransformation frame = FrameChain(2).accessLast();
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(frame.getInverse());
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_Transformation_GetInverse(benchmark::State& aState)
+{
+    const Transformation frame = FrameChain(2).accessLast().toTransformation();
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(frame.getInverse());
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation_Compose)
+    ->ArgName("frameCount")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_Transformation_Compose)
+    ->ArgName("frameCount")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation_GetInverse);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_Transformation_GetInverse);
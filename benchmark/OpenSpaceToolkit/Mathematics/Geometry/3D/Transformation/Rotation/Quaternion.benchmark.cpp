@@ -0,0 +1,63 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationVector.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+using ostk::mathematics::geometry::Angle;
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
+using ostk::mathematics::object::Vector3d;
+
+static const Quaternion FirstQuaternion =
+    Quaternion::RotationVector(RotationVector(Vector3d(1.0, 2.0, 3.0).normalized(), Angle::Degrees(30.0)));
+static const Quaternion SecondQuaternion =
+    Quaternion::RotationVector(RotationVector(Vector3d(-3.0, 1.0, 0.5).normalized(), Angle::Degrees(120.0)));
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_Rotation_Quaternion_Multiply(benchmark::State& aState)
+{
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(FirstQuaternion * SecondQuaternion);
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_Rotation_Quaternion_RotateVector(
+    benchmark::State& aState
+)
+{
+    const Vector3d vector = {1.0, -2.0, 0.5};
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(FirstQuaternion * vector);
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_Rotation_Quaternion_ToNormalized(
+    benchmark::State& aState
+)
+{
+    const Quaternion quaternion = FirstQuaternion * 1.000001;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(quaternion.toNormalized());
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_Rotation_Quaternion_SLERP(benchmark::State& aState)
+{
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(Quaternion::SLERP(FirstQuaternion, SecondQuaternion, 0.3));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_Rotation_Quaternion_Multiply);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_Rotation_Quaternion_RotateVector);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_Rotation_Quaternion_ToNormalized);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_Rotation_Quaternion_SLERP);
@@ -0,0 +1,86 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/WKB.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d2::Object;
+using ostk::mathematics::geometry::d2::object::Point;
+using ostk::mathematics::geometry::d2::object::Polygon;
+using ostk::mathematics::geometry::WKB;
+
+// Regular polygon approximating a circle
+
+static Polygon RegularPolygon(const Size aVertexCount)
+{
+    Array<Point> vertices = Array<Point>::Empty();
+
+    vertices.reserve(aVertexCount);
+
+    for (Index i = 0; i < aVertexCount; ++i)
+    {
+        const double angle_rad = -2.0 * M_PI * static_cast<double>(i) / static_cast<double>(aVertexCount);
+
+        vertices.add({std::cos(angle_rad), std::sin(angle_rad)});
+    }
+
+    return Polygon(vertices);
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_WKB_Encode(benchmark::State& aState)
+{
+    const Polygon polygon = RegularPolygon(aState.range(0));
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(WKB::Encode(polygon));
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_WKB_Decode(benchmark::State& aState)
+{
+    const WKB::Buffer buffer = WKB::Encode(RegularPolygon(aState.range(0)));
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(WKB::Reader(buffer).readPolygon2d());
+    }
+}
+
+// Text (WKT) serialization, for reference
+
+static void OpenSpaceToolkit_Mathematics_Geometry_WKB_ToStringWKT(benchmark::State& aState)
+{
+    const Polygon polygon = RegularPolygon(aState.range(0));
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(polygon.toString(Object::Format::WKT));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_WKB_Encode)
+    ->ArgName("vertexCount")
+    ->RangeMultiplier(8)
+    ->Range(8, 32768);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_WKB_Decode)
+    ->ArgName("vertexCount")
+    ->RangeMultiplier(8)
+    ->Range(8, 32768);
+BENCHMARK(OpenSpaceToolkit_Mathematics_Geometry_WKB_ToStringWKT)
+    ->ArgName("vertexCount")
+    ->RangeMultiplier(8)
+    ->Range(8, 32768);
@@ -0,0 +1,58 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolver.hpp>
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::solver::NumericalSolver;
+
+// Uncoupled harmonic oscillators, state size being twice the oscillator count
+
+static void HarmonicOscillators(const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double)
+{
+    for (Index i = 0; i < Size(x.size()); i += 2)
+    {
+        dxdt[i] = x[i + 1];
+        dxdt[i + 1] = -x[i];
+    }
+}
+
+static void OpenSpaceToolkit_Mathematics_Solver_NumericalSolver_IntegrateDuration(benchmark::State& aState)
+{
+    const Size stateSize = aState.range(0);
+    const NumericalSolver::StepperType stepperType = static_cast<NumericalSolver::StepperType>(aState.range(1));
+
+    NumericalSolver numericalSolver = {NumericalSolver::LogType::NoLog, stepperType, 5.0, 1.0e-12, 1.0e-12};
+
+    NumericalSolver::StateVector initialStateVector = NumericalSolver::StateVector::Zero(stateSize);
+
+    for (Index i = 0; i < stateSize; i += 2)
+    {
+        initialStateVector[i] = 1.0;
+    }
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(numericalSolver.integrateDuration(initialStateVector, 100.0, HarmonicOscillators));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver_IntegrateDuration)
+    ->ArgNames({"stateSize", "stepperType"})
+    ->ArgsProduct({
+        {2, 6, 60},
+        {static_cast<long>(NumericalSolver::StepperType::RungeKutta4),
+         static_cast<long>(NumericalSolver::StepperType::RungeKuttaCashKarp54),
+         static_cast<long>(NumericalSolver::StepperType::RungeKuttaFehlberg78),
+         static_cast<long>(NumericalSolver::StepperType::RungeKuttaDopri5),
+         static_cast<long>(NumericalSolver::StepperType::AdamsBashforthMoulton5),
+         static_cast<long>(NumericalSolver::StepperType::AdamsBashforthMoulton8),
+         static_cast<long>(NumericalSolver::StepperType::BulirschStoer)}
+    })
+    ->Unit(benchmark::kMicrosecond);
@@ -1,6 +1,7 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkitMathematicsPy/Utility/ArrayCasting.hpp>
+#include <OpenSpaceToolkitMathematicsPy/Utility/Pickling.hpp>
 #include <OpenSpaceToolkitMathematicsPy/Utility/ShiftToString.hpp>
 #include <pybind11/eigen.h>
 #include <pybind11/functional.h>
@@ -4,6 +4,7 @@
 
 #include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator/BarycentricRational.cpp>
 #include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator/CubicSpline.cpp>
+#include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator/Hermite.cpp>
 #include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator/Linear.cpp>
 #include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator/ZeroOrder.cpp>
 
@@ -51,6 +52,7 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator(pybind11::mo
 
         .value("BarycentricRational", Interpolator::Type::BarycentricRational)
         .value("CubicSpline", Interpolator::Type::CubicSpline)
+        .value("Hermite", Interpolator::Type::Hermite)
         .value("Linear", Interpolator::Type::Linear)
         .value("ZeroOrder", Interpolator::Type::ZeroOrder)
 
@@ -170,7 +172,9 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator(pybind11::mo
 
         .def_static(
             "generate_interpolator",
-            &Interpolator::GenerateInterpolator,
+            overload_cast<const Interpolator::Type&, const VectorXd&, const VectorXd&>(
+                &Interpolator::GenerateInterpolator
+            ),
             R"doc(
                 Generate an interpolator of specified type with data points.
 
@@ -193,6 +197,38 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator(pybind11::mo
             arg("x"),
             arg("y")
         )
+        .def_static(
+            "generate_interpolator",
+            overload_cast<const Interpolator::Type&, const VectorXd&, const VectorXd&, const VectorXd&>(
+                &Interpolator::GenerateInterpolator
+            ),
+            R"doc(
+                Generate an interpolator of specified type with data points and derivatives.
+
+                Derivatives are used by interpolators that support them (Hermite) and ignored by the others.
+
+                Args:
+                    interpolation_type (Interpolator.Type): The type of interpolation.
+                    x (np.array): The x-coordinates of data points.
+                    y (np.array): The y-coordinates of data points.
+                    dydx (np.array): The derivatives dy/dx at data points.
+
+                Returns:
+                    Interpolator: The created interpolator.
+
+                Example:
+                    >>> x = np.array([0.0, 1.0, 2.0])
+                    >>> y = np.array([0.0, 1.0, 4.0])
+                    >>> dydx = np.array([0.0, 2.0, 4.0])
+                    >>> interpolator = Interpolator.generate_interpolator(
+                    ...     Interpolator.Type.Hermite, x, y, dydx
+                    ... )
+            )doc",
+            arg("interpolation_type"),
+            arg("x"),
+            arg("y"),
+            arg("dydx")
+        )
 
         ;
 
@@ -202,6 +238,7 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator(pybind11::mo
     // Add object to python "interpolator" submodules
     OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_BarycentricRational(interpolator);
     OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_CubicSpline(interpolator);
+    OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_Hermite(interpolator);
     OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_Linear(interpolator);
     OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_ZeroOrder(interpolator);
 }
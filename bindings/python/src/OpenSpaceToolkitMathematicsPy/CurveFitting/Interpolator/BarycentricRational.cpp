@@ -33,6 +33,50 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_BarycentricR
             arg("y")
         )
 
+        .def(pickle(
+            [](const BarycentricRational& aBarycentricRational)
+            {
+                const VectorXd x = aBarycentricRational.getXVector();
+                const VectorXd y = aBarycentricRational.getYVector();
+
+                std::vector<double> values(x.data(), x.data() + x.size());
+                values.insert(values.end(), y.data(), y.data() + y.size());
+
+                return pickleStateFromValues(values);
+            },
+            [](const bytes& aState)
+            {
+                const std::vector<double> values = pickleValuesFromState(aState);
+                const Eigen::Index count = static_cast<Eigen::Index>(values.size() / 2);
+
+                return BarycentricRational(
+                    Eigen::Map<const VectorXd>(values.data(), count),
+                    Eigen::Map<const VectorXd>(values.data() + count, count)
+                );
+            }
+        ))
+
+        .def(
+            "get_x_vector",
+            &BarycentricRational::getXVector,
+            R"doc(
+                Get the x-coordinates of the data points.
+
+                Returns:
+                    (np.array): The x-coordinates.
+            )doc"
+        )
+        .def(
+            "get_y_vector",
+            &BarycentricRational::getYVector,
+            R"doc(
+                Get the y-coordinates of the data points.
+
+                Returns:
+                    (np.array): The y-coordinates.
+            )doc"
+        )
+
         .def(
             "evaluate",
             overload_cast<const VectorXd&>(&BarycentricRational::evaluate, const_),
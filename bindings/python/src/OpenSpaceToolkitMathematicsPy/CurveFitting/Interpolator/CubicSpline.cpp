@@ -52,6 +52,50 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_CubicSpline(
             arg("h")
         )
 
+        .def(pickle(
+            [](const CubicSpline& aCubicSpline)
+            {
+                const VectorXd x = aCubicSpline.getXVector();
+                const VectorXd y = aCubicSpline.getYVector();
+
+                std::vector<double> values(x.data(), x.data() + x.size());
+                values.insert(values.end(), y.data(), y.data() + y.size());
+
+                return pickleStateFromValues(values);
+            },
+            [](const bytes& aState)
+            {
+                const std::vector<double> values = pickleValuesFromState(aState);
+                const Eigen::Index count = static_cast<Eigen::Index>(values.size() / 2);
+
+                return CubicSpline(
+                    Eigen::Map<const VectorXd>(values.data(), count),
+                    Eigen::Map<const VectorXd>(values.data() + count, count)
+                );
+            }
+        ))
+
+        .def(
+            "get_x_vector",
+            &CubicSpline::getXVector,
+            R"doc(
+                Get the x-coordinates of the data points.
+
+                Returns:
+                    (np.array): The x-coordinates.
+            )doc"
+        )
+        .def(
+            "get_y_vector",
+            &CubicSpline::getYVector,
+            R"doc(
+                Get the y-coordinates of the data points.
+
+                Returns:
+                    (np.array): The y-coordinates.
+            )doc"
+        )
+
         .def(
             "evaluate",
             overload_cast<const VectorXd&>(&CubicSpline::evaluate, const_),
@@ -0,0 +1,195 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Hermite.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_Hermite(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::curvefitting::Interpolator;
+    using ostk::mathematics::object::VectorXd;
+
+    using ostk::mathematics::curvefitting::interpolator::Hermite;
+
+    class_<Hermite, Interpolator, Shared<Hermite>>(aModule, "Hermite")
+
+        .def(
+            init<const VectorXd&, const VectorXd&, const VectorXd&, const Size&>(),
+            R"doc(
+                Create a Hermite interpolator with data points and derivatives.
+
+                Each query is evaluated with the Hermite polynomial of degree 2n - 1 matching the values and
+                derivatives of a window of n consecutive data points. The default window of 2 data points gives a
+                piecewise cubic Hermite interpolator.
+
+                Args:
+                    x (np.array): The x-coordinates of data points, in strictly ascending order.
+                    y (np.array): The y-coordinates of data points.
+                    dydx (np.array): The derivatives dy/dx at data points.
+                    window_size (int): The number of data points used for each evaluation. Defaults to 2.
+
+                Example:
+                    >>> x = np.array([0.0, 1.0, 2.0])
+                    >>> y = np.array([0.0, 1.0, 4.0])
+                    >>> dydx = np.array([0.0, 2.0, 4.0])
+                    >>> interpolator = Hermite(x, y, dydx)
+            )doc",
+            arg("x"),
+            arg("y"),
+            arg("dydx"),
+            arg("window_size") = 2
+        )
+
+        .def(pickle(
+            [](const Hermite& aHermite)
+            {
+                const VectorXd x = aHermite.getXVector();
+                const VectorXd y = aHermite.getYVector();
+                const VectorXd dydx = aHermite.getDerivativeVector();
+
+                std::vector<double> values(x.data(), x.data() + x.size());
+                values.insert(values.end(), y.data(), y.data() + y.size());
+                values.insert(values.end(), dydx.data(), dydx.data() + dydx.size());
+                values.push_back(static_cast<double>(aHermite.getWindowSize()));
+
+                return pickleStateFromValues(values);
+            },
+            [](const bytes& aState)
+            {
+                const std::vector<double> values = pickleValuesFromState(aState);
+
+                if (values.size() % 3 != 1)
+                {
+                    throw std::runtime_error("Invalid pickled state.");
+                }
+
+                const Eigen::Index count = static_cast<Eigen::Index>(values.size() / 3);
+
+                return Hermite(
+                    Eigen::Map<const VectorXd>(values.data(), count),
+                    Eigen::Map<const VectorXd>(values.data() + count, count),
+                    Eigen::Map<const VectorXd>(values.data() + 2 * count, count),
+                    static_cast<Size>(values.back())
+                );
+            }
+        ))
+
+        .def(
+            "get_x_vector",
+            &Hermite::getXVector,
+            R"doc(
+                Get the x-coordinates of the data points.
+
+                Returns:
+                    (np.array): The x-coordinates.
+            )doc"
+        )
+        .def(
+            "get_y_vector",
+            &Hermite::getYVector,
+            R"doc(
+                Get the y-coordinates of the data points.
+
+                Returns:
+                    (np.array): The y-coordinates.
+            )doc"
+        )
+        .def(
+            "get_derivative_vector",
+            &Hermite::getDerivativeVector,
+            R"doc(
+                Get the derivatives dy/dx at the data points.
+
+                Returns:
+                    (np.array): The derivatives.
+            )doc"
+        )
+        .def(
+            "get_window_size",
+            &Hermite::getWindowSize,
+            R"doc(
+                Get the number of data points used for each evaluation.
+
+                Returns:
+                    int: The window size.
+            )doc"
+        )
+
+        .def(
+            "evaluate",
+            overload_cast<const VectorXd&>(&Hermite::evaluate, const_),
+            R"doc(
+                Evaluate the Hermite interpolation at multiple points.
+
+                Args:
+                    x (np.array): The x-coordinates to evaluate at.
+
+                Returns:
+                    (np.array): The interpolated y-values.
+
+                Example:
+                    >>> interpolator = Hermite([0.0, 1.0], [0.0, 1.0], [0.0, 2.0])
+                    >>> result = interpolator.evaluate([0.25, 0.5])
+            )doc",
+            arg("x")
+        )
+        .def(
+            "evaluate",
+            overload_cast<const double&>(&Hermite::evaluate, const_),
+            R"doc(
+                Evaluate the Hermite interpolation at a single point.
+
+                Args:
+                    x (float): The x-coordinate to evaluate at.
+
+                Returns:
+                    float: The interpolated y-value.
+
+                Example:
+                    >>> interpolator = Hermite([0.0, 1.0], [0.0, 1.0], [0.0, 2.0])
+                    >>> result = interpolator.evaluate(0.5)  # 0.25
+            )doc",
+            arg("x")
+        )
+        .def(
+            "compute_derivative",
+            overload_cast<const double&>(&Hermite::computeDerivative, const_),
+            R"doc(
+                Compute the derivative of the Hermite interpolation at a single point.
+
+                Args:
+                    x (float): The x-coordinate to compute derivative at.
+
+                Returns:
+                    float: The derivative value.
+
+                Example:
+                    >>> interpolator = Hermite([0.0, 1.0], [0.0, 1.0], [0.0, 2.0])
+                    >>> derivative = interpolator.compute_derivative(0.5)  # 1.0
+            )doc",
+            arg("x")
+        )
+        .def(
+            "compute_derivative",
+            overload_cast<const VectorXd&>(&Hermite::computeDerivative, const_),
+            R"doc(
+                Compute the derivative of the Hermite interpolation at multiple points.
+
+                Args:
+                    x (np.array): The x-coordinates to compute derivatives at.
+
+                Returns:
+                    (np.array): The derivative values.
+
+                Example:
+                    >>> interpolator = Hermite([0.0, 1.0], [0.0, 1.0], [0.0, 2.0])
+                    >>> derivatives = interpolator.compute_derivative([0.25, 0.5])
+            )doc",
+            arg("x")
+        )
+
+        ;
+}
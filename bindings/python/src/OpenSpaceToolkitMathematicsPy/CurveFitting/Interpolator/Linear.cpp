@@ -33,6 +33,50 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_Linear(pybin
             arg("y")
         )
 
+        .def(pickle(
+            [](const Linear& aLinear)
+            {
+                const VectorXd x = aLinear.getXVector();
+                const VectorXd y = aLinear.getYVector();
+
+                std::vector<double> values(x.data(), x.data() + x.size());
+                values.insert(values.end(), y.data(), y.data() + y.size());
+
+                return pickleStateFromValues(values);
+            },
+            [](const bytes& aState)
+            {
+                const std::vector<double> values = pickleValuesFromState(aState);
+                const Eigen::Index count = static_cast<Eigen::Index>(values.size() / 2);
+
+                return Linear(
+                    Eigen::Map<const VectorXd>(values.data(), count),
+                    Eigen::Map<const VectorXd>(values.data() + count, count)
+                );
+            }
+        ))
+
+        .def(
+            "get_x_vector",
+            &Linear::getXVector,
+            R"doc(
+                Get the x-coordinates of the data points.
+
+                Returns:
+                    (np.array): The x-coordinates.
+            )doc"
+        )
+        .def(
+            "get_y_vector",
+            &Linear::getYVector,
+            R"doc(
+                Get the y-coordinates of the data points.
+
+                Returns:
+                    (np.array): The y-coordinates.
+            )doc"
+        )
+
         .def(
             "evaluate",
             overload_cast<const VectorXd&>(&Linear::evaluate, const_),
@@ -38,6 +38,50 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_ZeroOrder(py
             arg("y")
         )
 
+        .def(pickle(
+            [](const ZeroOrder& aZeroOrder)
+            {
+                const VectorXd x = aZeroOrder.getXVector();
+                const VectorXd y = aZeroOrder.getYVector();
+
+                std::vector<double> values(x.data(), x.data() + x.size());
+                values.insert(values.end(), y.data(), y.data() + y.size());
+
+                return pickleStateFromValues(values);
+            },
+            [](const bytes& aState)
+            {
+                const std::vector<double> values = pickleValuesFromState(aState);
+                const Eigen::Index count = static_cast<Eigen::Index>(values.size() / 2);
+
+                return ZeroOrder(
+                    Eigen::Map<const VectorXd>(values.data(), count),
+                    Eigen::Map<const VectorXd>(values.data() + count, count)
+                );
+            }
+        ))
+
+        .def(
+            "get_x_vector",
+            &ZeroOrder::getXVector,
+            R"doc(
+                Get the x-coordinates of the data points.
+
+                Returns:
+                    (np.array): The x-coordinates.
+            )doc"
+        )
+        .def(
+            "get_y_vector",
+            &ZeroOrder::getYVector,
+            R"doc(
+                Get the y-coordinates of the data points.
+
+                Returns:
+                    (np.array): The y-coordinates.
+            )doc"
+        )
+
         .def(
             "evaluate",
             overload_cast<const VectorXd&>(&ZeroOrder::evaluate, const_),
@@ -1,5 +1,6 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkitMathematicsPy/Geometry/2D/BoundingBox.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/2D/Intersection.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/2D/Object.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/2D/Transformation.cpp>
@@ -11,6 +12,7 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D(pybind11::module& aModule)
 
     // Add object to python "d2" submodules
     OpenSpaceToolkitMathematicsPy_Geometry_2D_Object(d2);
+    OpenSpaceToolkitMathematicsPy_Geometry_2D_BoundingBox(d2);
     OpenSpaceToolkitMathematicsPy_Geometry_2D_Transformation(d2);
     OpenSpaceToolkitMathematicsPy_Geometry_2D_Intersection(d2);
 }
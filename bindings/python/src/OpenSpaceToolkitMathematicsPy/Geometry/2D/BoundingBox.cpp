@@ -0,0 +1,181 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/BoundingBox.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_BoundingBox(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::mathematics::geometry::d2::BoundingBox;
+    using ostk::mathematics::geometry::d2::object::Point;
+
+    class_<BoundingBox>(
+        aModule,
+        "BoundingBox",
+        R"doc(
+            Axis-aligned 2D bounding box.
+
+            Closed box spanned by a lower and an upper bound, used to cheaply cull queries. An undefined bounding box
+            stands for an unbounded object.
+        )doc"
+    )
+
+        .def(
+            init<const Point&, const Point&>(),
+            R"doc(
+                Create a bounding box from its lower and upper bounds.
+
+                Args:
+                    lower_bound (Point): The lower bound.
+                    upper_bound (Point): The upper bound.
+
+                Example:
+                    >>> bounding_box = BoundingBox(Point(0.0, 0.0), Point(1.0, 2.0))
+            )doc",
+            arg("lower_bound"),
+            arg("upper_bound")
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<BoundingBox>))
+        .def("__repr__", &(shiftToString<BoundingBox>))
+
+        .def(
+            "is_defined",
+            &BoundingBox::isDefined,
+            R"doc(
+                Check if the bounding box is defined.
+
+                Returns:
+                    bool: True if the bounding box is defined, False otherwise.
+            )doc"
+        )
+        .def(
+            "intersects",
+            &BoundingBox::intersects,
+            R"doc(
+                Check if the bounding box intersects another bounding box (boundaries included).
+
+                Args:
+                    bounding_box (BoundingBox): The other bounding box.
+
+                Returns:
+                    bool: True if the bounding boxes intersect, False otherwise.
+            )doc",
+            arg("bounding_box")
+        )
+        .def(
+            "contains",
+            overload_cast<const Point&>(&BoundingBox::contains, const_),
+            R"doc(
+                Check if the bounding box contains a point.
+
+                Args:
+                    point (Point): The point.
+
+                Returns:
+                    bool: True if the bounding box contains the point, False otherwise.
+            )doc",
+            arg("point")
+        )
+        .def(
+            "contains",
+            overload_cast<const BoundingBox&>(&BoundingBox::contains, const_),
+            R"doc(
+                Check if the bounding box contains another bounding box.
+
+                Args:
+                    bounding_box (BoundingBox): The other bounding box.
+
+                Returns:
+                    bool: True if the bounding box contains the other bounding box, False otherwise.
+            )doc",
+            arg("bounding_box")
+        )
+
+        .def(
+            "get_lower_bound",
+            &BoundingBox::getLowerBound,
+            R"doc(
+                Get the lower bound of the bounding box.
+
+                Returns:
+                    Point: The lower bound.
+            )doc"
+        )
+        .def(
+            "get_upper_bound",
+            &BoundingBox::getUpperBound,
+            R"doc(
+                Get the upper bound of the bounding box.
+
+                Returns:
+                    Point: The upper bound.
+            )doc"
+        )
+        .def(
+            "get_center",
+            &BoundingBox::getCenter,
+            R"doc(
+                Get the center of the bounding box.
+
+                Returns:
+                    Point: The center.
+            )doc"
+        )
+        .def(
+            "get_size",
+            &BoundingBox::getSize,
+            R"doc(
+                Get the size of the bounding box (upper bound minus lower bound).
+
+                Returns:
+                    numpy.ndarray: The size.
+            )doc"
+        )
+        .def(
+            "union_with",
+            &BoundingBox::unionWith,
+            R"doc(
+                Get the smallest bounding box enclosing both bounding boxes.
+
+                Undefined if either bounding box is undefined.
+
+                Args:
+                    bounding_box (BoundingBox): The other bounding box.
+
+                Returns:
+                    BoundingBox: The union bounding box.
+            )doc",
+            arg("bounding_box")
+        )
+
+        .def_static(
+            "undefined",
+            &BoundingBox::Undefined,
+            R"doc(
+                Create an undefined bounding box.
+
+                Returns:
+                    BoundingBox: An undefined bounding box.
+            )doc"
+        )
+        .def_static(
+            "points",
+            &BoundingBox::Points,
+            R"doc(
+                Create the smallest bounding box enclosing points.
+
+                Undefined if the list of points is empty.
+
+                Args:
+                    points (list[Point]): The points.
+
+                Returns:
+                    BoundingBox: The bounding box.
+            )doc",
+            arg("points")
+        );
+}
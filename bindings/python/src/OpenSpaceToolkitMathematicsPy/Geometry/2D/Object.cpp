@@ -3,6 +3,7 @@
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object.hpp>
 
 #include <OpenSpaceToolkitMathematicsPy/Geometry/2D/Object/Composite.cpp>
@@ -84,6 +85,20 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object(pybind11::module &a
                     >>> point.is_defined()  # True
             )doc"
         )
+        .def(
+            "get_bounding_box",
+            &Object::getBoundingBox,
+            R"doc(
+                Get the axis-aligned bounding box of the object.
+
+                Returns:
+                    BoundingBox: The bounding box, undefined if the object is unbounded.
+
+                Example:
+                    >>> object = Point(1.0, 2.0)
+                    >>> object.get_bounding_box()
+            )doc"
+        )
         .def(
             "intersects",
             &Object::intersects,
@@ -1,6 +1,7 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/LineString.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/WKB.hpp>
 
 inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_LineString(pybind11::module& aModule)
 {
@@ -9,6 +10,7 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_LineString(pybind11
     using ostk::core::container::Array;
     using ostk::core::type::Integer;
 
+    using ostk::mathematics::geometry::WKB;
     using ostk::mathematics::geometry::d2::Object;
     using ostk::mathematics::geometry::d2::object::LineString;
     using ostk::mathematics::geometry::d2::object::Point;
@@ -36,6 +38,17 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_LineString(pybind11
         .def("__str__", &(shiftToString<LineString>))
         .def("__repr__", &(shiftToString<LineString>))
 
+        .def(pickle(
+            [](const LineString& aLineString)
+            {
+                return pickleStateFromBuffer(WKB::Encode(aLineString));
+            },
+            [](const bytes& aState)
+            {
+                return WKB::Reader(pickleBufferFromState(aState)).readLineString2d();
+            }
+        ))
+
         .def(
             "is_defined",
             &LineString::isDefined,
@@ -65,6 +78,32 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_LineString(pybind11
                     >>> empty_line.is_empty()  # True
             )doc"
         )
+        .def(
+            "is_indexed",
+            &LineString::isIndexed,
+            R"doc(
+                Check if the line string holds a segment index.
+
+                Returns:
+                    bool: True if the line string holds a segment index.
+            )doc"
+        )
+        .def(
+            "is_simple",
+            &LineString::isSimple,
+            R"doc(
+                Check if the line string is simple, i.e. does not intersect itself.
+
+                Consecutive segments may only share their common vertex, and the first and last segments of a closed
+                line string their common end point. Repeated points are ignored.
+
+                Returns:
+                    bool: True if the line string is simple.
+
+                Example:
+                    >>> LineString([Point(0.0, 0.0), Point(1.0, 1.0), Point(1.0, 0.0), Point(0.0, 1.0)]).is_simple()  # False
+            )doc"
+        )
         .def(
             "is_near",
             &LineString::isNear,
@@ -120,6 +159,91 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_LineString(pybind11
             )doc",
             arg("point")
         )
+        .def(
+            "get_length",
+            &LineString::getLength,
+            R"doc(
+                Get the length of the line string.
+
+                Returns:
+                    float: The sum of the segment lengths.
+            )doc"
+        )
+        .def(
+            "distance_to",
+            &LineString::distanceTo,
+            R"doc(
+                Get the distance from the line string to a point.
+
+                Args:
+                    point (Point): The reference point.
+
+                Returns:
+                    float: The distance to the closest point lying on the line string.
+            )doc",
+            arg("point")
+        )
+        .def(
+            "project_point",
+            &LineString::projectPoint,
+            R"doc(
+                Project a point onto the line string.
+
+                Args:
+                    point (Point): The reference point.
+
+                Returns:
+                    tuple[Point, float]: The closest point lying on the line string, and its arc length from the
+                    first point.
+
+                Example:
+                    >>> line_string = LineString([Point(0.0, 0.0), Point(2.0, 0.0), Point(2.0, 2.0)])
+                    >>> line_string.project_point(Point(3.0, 1.0))  # (Point(2.0, 1.0), 3.0)
+            )doc",
+            arg("point")
+        )
+        .def(
+            "simplify",
+            &LineString::simplify,
+            R"doc(
+                Simplify the line string within a distance tolerance (Douglas-Peucker).
+
+                End points are kept, and every point lies within the tolerance of the simplified line string. The
+                line string does not become self-intersecting.
+
+                Args:
+                    tolerance (float): The distance tolerance.
+
+                Returns:
+                    LineString: The simplified line string.
+
+                Example:
+                    >>> line_string = LineString([Point(0.0, 0.0), Point(1.0, 0.1), Point(2.0, 0.0)])
+                    >>> line_string.simplify(0.5)  # LineString([Point(0.0, 0.0), Point(2.0, 0.0)])
+            )doc",
+            arg("tolerance")
+        )
+        .def(
+            "simplify_to",
+            &LineString::simplifyTo,
+            R"doc(
+                Simplify the line string down to a number of points (Visvalingam-Whyatt).
+
+                Points spanning the smallest area with their neighbors are removed first, end points are kept.
+                Points whose removal would make the line string self-intersecting are kept.
+
+                Args:
+                    point_count (int): The number of points (at least 2).
+
+                Returns:
+                    LineString: The simplified line string.
+
+                Example:
+                    >>> line_string = LineString([Point(0.0, 0.0), Point(1.0, 0.1), Point(2.0, 0.0)])
+                    >>> line_string.simplify_to(2)  # LineString([Point(0.0, 0.0), Point(2.0, 0.0)])
+            )doc",
+            arg("point_count")
+        )
         .def(
             "to_string",
             &LineString::toString,
@@ -158,6 +282,16 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_LineString(pybind11
             )doc",
             arg("transformation")
         )
+        .def(
+            "build_index",
+            &LineString::buildIndex,
+            R"doc(
+                Build a segment index over the line string.
+
+                Subsequent closest point, distance and projection queries only visit segments near the query point.
+                The index is rebuilt on transformation.
+            )doc"
+        )
 
         .def_static(
             "empty",
@@ -1,6 +1,7 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/MultiPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/WKB.hpp>
 
 inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_MultiPolygon(pybind11::module& aModule)
 {
@@ -9,6 +10,7 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_MultiPolygon(pybind
     using ostk::core::container::Array;
     using ostk::core::type::Integer;
 
+    using ostk::mathematics::geometry::WKB;
     using ostk::mathematics::geometry::d2::Object;
     using ostk::mathematics::geometry::d2::object::MultiPolygon;
     using ostk::mathematics::geometry::d2::object::Point;
@@ -40,6 +42,17 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_MultiPolygon(pybind
         .def("__str__", &(shiftToString<MultiPolygon>))
         .def("__repr__", &(shiftToString<MultiPolygon>))
 
+        .def(pickle(
+            [](const MultiPolygon& aMultiPolygon)
+            {
+                return pickleStateFromBuffer(WKB::Encode(aMultiPolygon));
+            },
+            [](const bytes& aState)
+            {
+                return WKB::Reader(pickleBufferFromState(aState)).readMultiPolygon2d();
+            }
+        ))
+
         .def(
             "is_defined",
             &MultiPolygon::isDefined,
@@ -145,6 +158,54 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_MultiPolygon(pybind
                     >>> convex_hull = multi_polygon.get_convex_hull()
             )doc"
         )
+        .def(
+            "simplify",
+            &MultiPolygon::simplify,
+            R"doc(
+                Simplify the rings of each polygon within a distance tolerance (Douglas-Peucker).
+
+                Polygons whose envelopes intersect are simplified together, so that adjacent polygons do not overlap
+                once simplified. Such groups are simplified in parallel when several threads are requested.
+
+                Args:
+                    tolerance (float): The distance tolerance.
+                    thread_count (int, optional): The number of threads. Defaults to 1.
+
+                Returns:
+                    MultiPolygon: The simplified multi-polygon.
+
+                Example:
+                    >>> points = [Point(0.0, 0.0), Point(1.0, 0.1), Point(2.0, 0.0), Point(2.0, 2.0), Point(0.0, 2.0)]
+                    >>> polygon = Polygon(points)
+                    >>> MultiPolygon([polygon]).simplify(0.5, 4)
+            )doc",
+            arg("tolerance"),
+            arg("thread_count") = 1
+        )
+        .def(
+            "simplify_to",
+            &MultiPolygon::simplifyTo,
+            R"doc(
+                Simplify the polygons down to a total number of vertices (Visvalingam-Whyatt).
+
+                Polygons are grouped as in simplify, and the vertex budget is shared among groups in proportion to
+                their vertex counts, each polygon keeping at least 3 vertices per ring.
+
+                Args:
+                    vertex_count (int): The total number of vertices (at least 3).
+                    thread_count (int, optional): The number of threads. Defaults to 1.
+
+                Returns:
+                    MultiPolygon: The simplified multi-polygon.
+
+                Example:
+                    >>> points = [Point(0.0, 0.0), Point(1.0, 0.1), Point(2.0, 0.0), Point(2.0, 2.0), Point(0.0, 2.0)]
+                    >>> polygon = Polygon(points)
+                    >>> MultiPolygon([polygon]).simplify_to(4, 4)
+            )doc",
+            arg("vertex_count"),
+            arg("thread_count") = 1
+        )
         .def(
             "union_with",
             &MultiPolygon::unionWith,
@@ -238,6 +299,31 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_MultiPolygon(pybind
             )doc",
             arg("polygon")
         )
+        .def_static(
+            "union",
+            &MultiPolygon::Union,
+            R"doc(
+                Compute the union of many polygons.
+
+                Polygons are ordered spatially and merged pairwise along a balanced tree (cascaded union), which is
+                much faster than a sequence of `union_with` calls. Independent subtrees can be merged concurrently.
+
+                Args:
+                    polygons (list[Polygon]): The polygons to merge.
+                    thread_count (int, optional): The number of threads. Defaults to 1.
+
+                Returns:
+                    MultiPolygon: The union of the polygons, undefined if the list is empty.
+
+                Example:
+                    >>> polygon1 = Polygon([Point(0.0, 0.0), Point(0.0, 1.0), Point(1.0, 1.0), Point(1.0, 0.0)])
+                    >>> polygon2 = Polygon([Point(0.5, 0.0), Point(0.5, 1.0), Point(1.5, 1.0), Point(1.5, 0.0)])
+                    >>> multi_polygon = MultiPolygon.union([polygon1, polygon2], 4)
+                    >>> multi_polygon.get_polygon_count()  # 1
+            )doc",
+            arg("polygons"),
+            arg("thread_count") = 1
+        )
 
         ;
 }
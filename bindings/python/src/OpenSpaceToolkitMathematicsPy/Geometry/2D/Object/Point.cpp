@@ -1,6 +1,7 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/WKB.hpp>
 
 using ostk::core::container::Array;
 using ostk::mathematics::geometry::d2::object::Point;
@@ -23,6 +24,7 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_Point(pybind11::mod
     using ostk::core::type::Integer;
     using ostk::core::type::Real;
 
+    using ostk::mathematics::geometry::WKB;
     using ostk::mathematics::geometry::d2::Object;
     using ostk::mathematics::geometry::d2::object::Point;
     using ostk::mathematics::object::Vector2d;
@@ -64,6 +66,43 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_Point(pybind11::mod
             }
         )
 
+        .def(pickle(
+            [](const Point& aPoint)
+            {
+                return pickleStateFromBuffer(WKB::Encode(aPoint));
+            },
+            [](const bytes& aState)
+            {
+                return WKB::Reader(pickleBufferFromState(aState)).readPoint2d();
+            }
+        ))
+        .def(
+            "__array__",
+            [](const Point& aPoint, const object& aDataType, const object& aCopy) -> object
+            {
+                (void)aCopy;  // Coordinates are not stored contiguously: always a copy
+
+                const object array = cast(aPoint.asVector());
+
+                return aDataType.is_none() ? array : array.attr("astype")(aDataType);
+            },
+            R"doc(
+                Convert the point to a NumPy array.
+
+                Args:
+                    dtype (np.dtype): The data type. Defaults to None.
+                    copy (bool): Ignored, a copy is always returned. Defaults to None.
+
+                Returns:
+                    np.array: The coordinates of the point.
+
+                Example:
+                    >>> np.asarray(Point(1.0, 2.0))  # np.array([1.0, 2.0])
+            )doc",
+            arg("dtype") = none(),
+            arg("copy") = none()
+        )
+
         .def(
             "is_defined",
             &Point::isDefined,
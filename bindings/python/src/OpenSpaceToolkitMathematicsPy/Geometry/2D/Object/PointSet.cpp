@@ -1,6 +1,7 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/WKB.hpp>
 
 inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_PointSet(pybind11::module& aModule)
 {
@@ -9,6 +10,7 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_PointSet(pybind11::
     using ostk::core::container::Array;
     using ostk::core::type::Integer;
 
+    using ostk::mathematics::geometry::WKB;
     using ostk::mathematics::geometry::d2::Object;
     using ostk::mathematics::geometry::d2::object::Point;
     using ostk::mathematics::geometry::d2::object::PointSet;
@@ -36,6 +38,17 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_PointSet(pybind11::
         .def("__str__", &(shiftToString<PointSet>))
         .def("__repr__", &(shiftToString<PointSet>))
 
+        .def(pickle(
+            [](const PointSet& aPointSet)
+            {
+                return pickleStateFromBuffer(WKB::Encode(aPointSet));
+            },
+            [](const bytes& aState)
+            {
+                return WKB::Reader(pickleBufferFromState(aState)).readPointSet2d();
+            }
+        ))
+
         .def(
             "is_defined",
             &PointSet::isDefined,
@@ -1,6 +1,8 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/WKB.hpp>
 
 inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_Polygon(pybind11::module& aModule)
 {
@@ -9,6 +11,8 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_Polygon(pybind11::m
     using ostk::core::container::Array;
     using ostk::core::type::Integer;
 
+    using ostk::mathematics::geometry::WKB;
+    using ostk::mathematics::geometry::d2::BoundingBox;
     using ostk::mathematics::geometry::d2::Object;
     using ostk::mathematics::geometry::d2::object::Point;
     using ostk::mathematics::geometry::d2::object::PointSet;
@@ -56,6 +60,17 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_Polygon(pybind11::m
         .def("__str__", &(shiftToString<Polygon>))
         .def("__repr__", &(shiftToString<Polygon>))
 
+        .def(pickle(
+            [](const Polygon& aPolygon)
+            {
+                return pickleStateFromBuffer(WKB::Encode(aPolygon));
+            },
+            [](const bytes& aState)
+            {
+                return WKB::Reader(pickleBufferFromState(aState)).readPolygon2d();
+            }
+        ))
+
         .def(
             "is_defined",
             &Polygon::isDefined,
@@ -337,6 +352,89 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_Polygon(pybind11::m
                     >>> polygon.get_convex_hull()
             )doc"
         )
+        .def(
+            "simplify",
+            &Polygon::simplify,
+            R"doc(
+                Simplify the polygon rings within a distance tolerance (Douglas-Peucker).
+
+                Every vertex lies within the tolerance of its simplified ring. Rings remain simple, do not cross one
+                another, and keep at least 3 vertices.
+
+                Args:
+                    tolerance (float): The distance tolerance.
+
+                Returns:
+                    Polygon: The simplified polygon.
+
+                Example:
+                    >>> points = [Point(0.0, 0.0), Point(1.0, 0.1), Point(2.0, 0.0), Point(2.0, 2.0), Point(0.0, 2.0)]
+                    >>> polygon = Polygon(points)
+                    >>> polygon.simplify(0.5).get_vertex_count()  # 4
+            )doc",
+            arg("tolerance")
+        )
+        .def(
+            "simplify_to",
+            &Polygon::simplifyTo,
+            R"doc(
+                Simplify the polygon rings down to a total number of vertices (Visvalingam-Whyatt).
+
+                Vertices spanning the smallest area with their neighbors are removed first. Vertices whose removal
+                would make rings cross are kept, so that the vertex count may remain above the requested one.
+
+                Args:
+                    vertex_count (int): The total number of vertices (at least 3).
+
+                Returns:
+                    Polygon: The simplified polygon.
+
+                Example:
+                    >>> points = [Point(0.0, 0.0), Point(1.0, 0.1), Point(2.0, 0.0), Point(2.0, 2.0), Point(0.0, 2.0)]
+                    >>> polygon = Polygon(points)
+                    >>> polygon.simplify_to(4).get_vertex_count()  # 4
+            )doc",
+            arg("vertex_count")
+        )
+        .def(
+            "clip_to",
+            overload_cast<const BoundingBox&>(&Polygon::clipTo, const_),
+            R"doc(
+                Clip the polygon to an axis-aligned box.
+
+                Rings are clipped one box side at a time, without validity checks. Results that split into several
+                polygons go through the general boolean intersection.
+
+                Args:
+                    bounding_box (BoundingBox): The clip box.
+
+                Returns:
+                    list[Polygon]: The polygons with a non-zero area covering the part of the polygon inside the box.
+
+                Example:
+                    >>> polygon = Polygon([Point(0.0, 0.0), Point(2.0, 0.0), Point(2.0, 2.0), Point(0.0, 2.0)])
+                    >>> polygon.clip_to(BoundingBox(Point(1.0, 1.0), Point(3.0, 3.0)))
+            )doc",
+            arg("bounding_box")
+        )
+        .def(
+            "clip_to",
+            overload_cast<const Polygon&>(&Polygon::clipTo, const_),
+            R"doc(
+                Clip the polygon to a convex polygon.
+
+                Non-convex clip polygons, or clip polygons with inner rings, go through the general boolean
+                intersection.
+
+                Args:
+                    polygon (Polygon): The clip polygon.
+
+                Returns:
+                    list[Polygon]: The polygons with a non-zero area covering the part of the polygon inside the clip
+                    polygon.
+            )doc",
+            arg("polygon")
+        )
         .def(
             "union_with",
             &Polygon::unionWith,
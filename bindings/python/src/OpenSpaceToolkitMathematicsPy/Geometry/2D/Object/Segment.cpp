@@ -242,6 +242,30 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Object_Segment(pybind11::m
                     >>> undefined_segment.is_defined()  # False
             )doc"
         )
+        .def_static(
+            "intersection_points",
+            &Segment::IntersectionPoints,
+            R"doc(
+                Find all intersection points among segments, with a sweep line.
+
+                Runs in O((n + k) log n) for n segments and k intersections. Touching segments intersect, a collinear
+                overlap is reported at both of its end points, and degenerate segments are ignored.
+
+                Args:
+                    segments (list[Segment]): The segments.
+
+                Returns:
+                    list[tuple[int, int, Point]]: The indices of the two segments (first < second) and their common
+                    point, sorted by indices then point.
+
+                Example:
+                    >>> Segment.intersection_points([
+                    ...     Segment(Point(0.0, 0.0), Point(2.0, 2.0)),
+                    ...     Segment(Point(0.0, 2.0), Point(2.0, 0.0)),
+                    ... ])  # [(0, 1, Point(1.0, 1.0))]
+            )doc",
+            arg("segments")
+        )
 
         ;
 }
@@ -134,6 +134,37 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_2D_Transformation(pybind11::m
         )
         // .def("apply_to", overload_cast<const Unique<Object>&>(&Transformation::applyTo, const_), arg("object"))
 
+        .def(
+            "apply_to_points",
+            &Transformation::applyToPoints,
+            arg("points"),
+            R"doc(
+                Apply the transformation in place to a 2 x N matrix of points, one point per column.
+
+                The array is modified in place, and must therefore be a writeable, Fortran-ordered float64 array.
+
+                Args:
+                    points (numpy.ndarray): The 2 x N point matrix.
+
+                Example:
+                    >>> points = numpy.asfortranarray(numpy.random.rand(2, 1000))
+                    >>> Transformation.identity().apply_to_points(points)
+            )doc"
+        )
+        .def(
+            "apply_to_vectors",
+            &Transformation::applyToVectors,
+            arg("vectors"),
+            R"doc(
+                Apply the transformation in place to a 2 x N matrix of vectors, one vector per column.
+
+                Vectors are not affected by translations. The array must be a writeable, Fortran-ordered float64 array.
+
+                Args:
+                    vectors (numpy.ndarray): The 2 x N vector matrix.
+            )doc"
+        )
+
         .def_static(
             "undefined",
             &Transformation::Undefined,
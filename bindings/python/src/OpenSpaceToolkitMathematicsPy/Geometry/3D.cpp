@@ -1,5 +1,6 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkitMathematicsPy/Geometry/3D/BoundingBox.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Intersection.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Object.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Transformation.cpp>
@@ -11,6 +12,7 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D(pybind11::module& aModule)
 
     // Add object to python "d3" submodules
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object(d3);
+    OpenSpaceToolkitMathematicsPy_Geometry_3D_BoundingBox(d3);
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformation(d3);
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Intersection(d3);
 }
@@ -1,5 +1,6 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
 
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Object/Composite.cpp>
@@ -10,12 +11,14 @@
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Object/LineString.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Object/Plane.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Object/Point.cpp>
+#include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Object/PointCloud.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Object/PointSet.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Object/Polygon.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Object/Pyramid.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Object/Ray.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Object/Segment.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Object/Sphere.cpp>
+#include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Object/TriangleMesh.cpp>
 
 inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object(pybind11::module& aModule)
 {
@@ -28,12 +31,14 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object(pybind11::module& a
     using ostk::mathematics::geometry::d3::object::LineString;
     using ostk::mathematics::geometry::d3::object::Plane;
     using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::PointCloud;
     using ostk::mathematics::geometry::d3::object::PointSet;
     using ostk::mathematics::geometry::d3::object::Polygon;
     using ostk::mathematics::geometry::d3::object::Pyramid;
     using ostk::mathematics::geometry::d3::object::Ray;
     using ostk::mathematics::geometry::d3::object::Segment;
     using ostk::mathematics::geometry::d3::object::Sphere;
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
 
     // class_<Object, boost::noncopyable>("Object", no_init)
     class_<Object>(
@@ -81,6 +86,20 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object(pybind11::module& a
                     >>> object.is_defined()  # True
             )doc"
         )
+        .def(
+            "get_bounding_box",
+            &Object::getBoundingBox,
+            R"doc(
+                Get the axis-aligned bounding box of the object.
+
+                Returns:
+                    BoundingBox: The bounding box, undefined if the object is unbounded.
+
+                Example:
+                    >>> object = Point(1.0, 2.0, 3.0)
+                    >>> object.get_bounding_box()
+            )doc"
+        )
         .def(
             "is_point",
             +[](const Object& anObject) -> bool
@@ -107,6 +126,19 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object(pybind11::module& a
                     bool: True if the object is a point set.
             )doc"
         )
+        .def(
+            "is_point_cloud",
+            +[](const Object& anObject) -> bool
+            {
+                return anObject.is<PointCloud>();
+            },
+            R"doc(
+                Check if the object is a point cloud.
+
+                Returns:
+                    bool: True if the object is a point cloud.
+            )doc"
+        )
         .def(
             "is_line",
             +[](const Object& anObject) -> bool
@@ -237,6 +269,19 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object(pybind11::module& a
                     bool: True if the object is a cone.
             )doc"
         )
+        .def(
+            "is_triangle_mesh",
+            +[](const Object& anObject) -> bool
+            {
+                return anObject.is<TriangleMesh>();
+            },
+            R"doc(
+                Check if the object is a triangle mesh.
+
+                Returns:
+                    bool: True if the object is a triangle mesh.
+            )doc"
+        )
         .def(
             "intersects",
             &Object::intersects,
@@ -300,6 +345,19 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object(pybind11::module& a
                     PointSet: The point set.
             )doc"
         )
+        .def(
+            "as_point_cloud",
+            +[](const Object& anObject) -> PointCloud
+            {
+                return anObject.as<PointCloud>();
+            },
+            R"doc(
+                Convert the object to a point cloud.
+
+                Returns:
+                    PointCloud: The point cloud.
+            )doc"
+        )
         .def(
             "as_line",
             +[](const Object& anObject) -> Line
@@ -430,6 +488,19 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object(pybind11::module& a
                     Cone: The cone.
             )doc"
         )
+        .def(
+            "as_triangle_mesh",
+            +[](const Object& anObject) -> TriangleMesh
+            {
+                return anObject.as<TriangleMesh>();
+            },
+            R"doc(
+                Convert the object to a triangle mesh.
+
+                Returns:
+                    TriangleMesh: The triangle mesh.
+            )doc"
+        )
 
         // .def("intersection_with", &Object::intersectionWith)
         .def(
@@ -452,6 +523,7 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object(pybind11::module& a
     // Add object to python "object" submodules
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Point(object);
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_PointSet(object);
+    OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_PointCloud(object);
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Line(object);
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Ray(object);
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Segment(object);
@@ -464,5 +536,6 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object(pybind11::module& a
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Ellipsoid(object);
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Pyramid(object);
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Cone(object);
+    OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_TriangleMesh(object);
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Composite(object);
 }
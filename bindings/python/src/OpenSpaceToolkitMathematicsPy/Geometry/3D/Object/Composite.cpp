@@ -86,6 +86,20 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Composite(pybind11:
                     >>> empty_composite.is_empty()  # True
             )doc"
         )
+        .def(
+            "is_indexed",
+            &Composite::isIndexed,
+            R"doc(
+                Check if the composite holds a bounding volume hierarchy.
+
+                Returns:
+                    bool: True if the composite holds a bounding volume hierarchy, False otherwise.
+
+                Example:
+                    >>> composite = Composite(Point(1.0, 2.0, 3.0))
+                    >>> composite.is_indexed()  # False
+            )doc"
+        )
 
         .def(
             "is_point",
@@ -755,6 +769,22 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Composite(pybind11:
             arg("composite")
         )
 
+        .def(
+            "build_index",
+            &Composite::buildIndex,
+            R"doc(
+                Build a bounding volume hierarchy over the objects of the composite.
+
+                Queries against a point, a segment or a ray then only evaluate objects whose axis-aligned bounding
+                box overlaps the query. The hierarchy is rebuilt when the composite is transformed.
+
+                Example:
+                    >>> composite = Composite(Sphere(Point(0.0, 0.0, 0.0), 1.0))
+                    >>> composite.build_index()
+                    >>> composite.is_indexed()  # True
+            )doc"
+        )
+
         .def(
             "apply_transformation",
             &Composite::applyTransformation,
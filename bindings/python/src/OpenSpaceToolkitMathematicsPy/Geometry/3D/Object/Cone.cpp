@@ -23,6 +23,7 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Cone(pybind11::modu
     using ostk::mathematics::geometry::d3::object::Ray;
     using ostk::mathematics::geometry::d3::object::Segment;
     using ostk::mathematics::geometry::d3::object::Sphere;
+    using ostk::mathematics::object::MatrixXd;
     using ostk::mathematics::object::Vector3d;
 
     class_<Cone, Object>(aModule, "Cone")
@@ -217,6 +218,26 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Cone(pybind11::modu
             )doc",
             arg("ellipsoid")
         )
+        .def(
+            "contains",
+            overload_cast<const MatrixXd&, const Size&>(&Cone::contains, const_),
+            R"doc(
+                Check if the cone contains each point of a batch.
+
+                Args:
+                    points (numpy.ndarray): The N x 3 matrix of points.
+                    thread_count (int): The number of threads. Defaults to 1.
+
+                Returns:
+                    list[bool]: True if the cone contains the point, for each row.
+
+                Example:
+                    >>> cone = Cone(Point(0.0, 0.0, 0.0), np.array([0.0, 0.0, 1.0]), Angle.degrees(30.0))
+                    >>> cone.contains(np.array([[0.1, 0.1, 1.0], [0.0, 0.0, -1.0]]))  # [True, False]
+            )doc",
+            arg("points"),
+            arg("thread_count") = 1
+        )
 
         .def(
             "get_apex",
@@ -7,7 +7,9 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Cuboid(pybind11::mo
 {
     using namespace pybind11;
 
+    using ostk::core::container::Array;
     using ostk::core::type::Real;
+    using ostk::core::type::Size;
 
     using ostk::mathematics::geometry::d3::Intersection;
     using ostk::mathematics::geometry::d3::Object;
@@ -338,6 +340,52 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Cuboid(pybind11::mo
             arg("center"),
             arg("extent")
         )
+        .def_static(
+            "intersecting_pairs",
+            overload_cast<const Array<Cuboid>&, const Array<Cuboid>&, const Size&>(&Cuboid::IntersectingPairs),
+            R"doc(
+                Find all intersecting pairs between two arrays of cuboids.
+
+                Args:
+                    first_cuboids (list[Cuboid]): The first array of cuboids.
+                    second_cuboids (list[Cuboid]): The second array of cuboids.
+                    thread_count (int): The number of threads. Defaults to 1.
+
+                Returns:
+                    list[tuple[int, int]]: The (first index, second index) pairs of intersecting cuboids, in
+                    lexicographic order.
+
+                Example:
+                    >>> cuboids = [Cuboid.cube(Point(0.0, 0.0, 0.0), 1.0), Cuboid.cube(Point(5.0, 0.0, 0.0), 1.0)]
+                    >>> Cuboid.intersecting_pairs(cuboids, [Cuboid.cube(Point(1.5, 0.0, 0.0), 1.0)])  # [(0, 0)]
+            )doc",
+            arg("first_cuboids"),
+            arg("second_cuboids"),
+            arg("thread_count") = 1
+        )
+        .def_static(
+            "intersecting_pairs",
+            overload_cast<const Array<Sphere>&, const Array<Cuboid>&, const Size&>(&Cuboid::IntersectingPairs),
+            R"doc(
+                Find all intersecting pairs between an array of spheres and an array of cuboids.
+
+                Args:
+                    spheres (list[Sphere]): The array of spheres.
+                    cuboids (list[Cuboid]): The array of cuboids.
+                    thread_count (int): The number of threads. Defaults to 1.
+
+                Returns:
+                    list[tuple[int, int]]: The (sphere index, cuboid index) pairs of intersecting objects, in
+                    lexicographic order.
+
+                Example:
+                    >>> cuboids = [Cuboid.cube(Point(0.0, 0.0, 0.0), 1.0)]
+                    >>> Cuboid.intersecting_pairs([Sphere(Point(0.0, 0.0, 2.0), 1.5)], cuboids)  # [(0, 0)]
+            )doc",
+            arg("spheres"),
+            arg("cuboids"),
+            arg("thread_count") = 1
+        )
 
         ;
 }
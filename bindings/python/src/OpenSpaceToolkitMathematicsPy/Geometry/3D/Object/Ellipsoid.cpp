@@ -253,6 +253,59 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Ellipsoid(pybind11:
             )doc",
             arg("segment")
         )
+        .def(
+            "distance_to",
+            &Ellipsoid::distanceTo,
+            R"doc(
+                Get the distance from a point to the surface of the ellipsoid.
+
+                Args:
+                    point (Point): The point.
+
+                Returns:
+                    float: The distance to the closest surface point.
+
+                Example:
+                    >>> ellipsoid = Ellipsoid(Point(0.0, 0.0, 0.0), 2.0, 1.5, 1.0)
+                    >>> ellipsoid.distance_to(Point(0.0, 0.0, 3.0))  # 2.0
+            )doc",
+            arg("point")
+        )
+        .def(
+            "project_point",
+            &Ellipsoid::projectPoint,
+            R"doc(
+                Project a point onto the surface of the ellipsoid.
+
+                Args:
+                    point (Point): The point.
+
+                Returns:
+                    tuple[Point, numpy.ndarray, float]: The closest surface point, the outward unit normal there, and
+                    the signed distance (negative inside the ellipsoid).
+
+                Example:
+                    >>> ellipsoid = Ellipsoid(Point(0.0, 0.0, 0.0), 2.0, 1.5, 1.0)
+                    >>> surface_point, normal, distance = ellipsoid.project_point(Point(0.0, 0.0, 3.0))
+            )doc",
+            arg("point")
+        )
+        .def(
+            "project_points",
+            &Ellipsoid::projectPoints,
+            R"doc(
+                Project the columns of a 3 x N point matrix onto the surface of the ellipsoid.
+
+                Args:
+                    points (numpy.ndarray): The 3 x N point matrix.
+                    thread_count (int): The number of threads. Defaults to 1.
+
+                Returns:
+                    list[tuple[Point, numpy.ndarray, float]]: The projection of each point, as in project_point.
+            )doc",
+            arg("points"),
+            arg("thread_count") = 1
+        )
 
         .def(
             "get_center",
@@ -3,6 +3,7 @@
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/WKB.hpp>
 
 using ostk::core::container::Array;
 
@@ -19,6 +20,7 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Point(pybind11::mod
     using ostk::core::type::Real;
     using ostk::core::type::Shared;
 
+    using ostk::mathematics::geometry::WKB;
     using ostk::mathematics::geometry::d3::Object;
     using ostk::mathematics::geometry::d3::object::Point;
     using ostk::mathematics::object::Vector3d;
@@ -57,6 +59,43 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Point(pybind11::mod
         .def("__str__", &(shiftToString<Point>))
         .def("__repr__", &(shiftToString<Point>))
 
+        .def(pickle(
+            [](const Point& aPoint)
+            {
+                return pickleStateFromBuffer(WKB::Encode(aPoint));
+            },
+            [](const bytes& aState)
+            {
+                return WKB::Reader(pickleBufferFromState(aState)).readPoint3d();
+            }
+        ))
+        .def(
+            "__array__",
+            [](const Point& aPoint, const object& aDataType, const object& aCopy) -> object
+            {
+                (void)aCopy;  // Coordinates are not stored contiguously: always a copy
+
+                const object array = cast(aPoint.asVector());
+
+                return aDataType.is_none() ? array : array.attr("astype")(aDataType);
+            },
+            R"doc(
+                Convert the point to a NumPy array.
+
+                Args:
+                    dtype (np.dtype): The data type. Defaults to None.
+                    copy (bool): Ignored, a copy is always returned. Defaults to None.
+
+                Returns:
+                    np.array: The coordinates of the point.
+
+                Example:
+                    >>> np.asarray(Point(1.0, 2.0, 3.0))  # np.array([1.0, 2.0, 3.0])
+            )doc",
+            arg("dtype") = none(),
+            arg("copy") = none()
+        )
+
         .def(
             "is_defined",
             &Point::isDefined,
@@ -0,0 +1,294 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/PointCloud.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_PointCloud(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+    using ostk::core::type::Index;
+    using ostk::core::type::Real;
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::geometry::d3::Object;
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+    using ostk::mathematics::object::MatrixXd;
+
+    class_<PointCloud, Object>(
+        aModule,
+        "PointCloud",
+        R"doc(
+                An indexed collection of 3D points.
+
+                A PointCloud keeps its points in insertion order and indexes them with a KD-tree, so that nearest
+                neighbor, k-nearest neighbors and radius queries run in logarithmic rather than linear time.
+            )doc"
+    )
+
+        .def(
+            init<const Array<Point>&>(),
+            R"doc(
+                Construct a point cloud from an array of points.
+
+                Args:
+                    points (list[Point]): Array of 3D points.
+
+                Example:
+                    >>> point_cloud = PointCloud([Point(0.0, 0.0, 0.0), Point(1.0, 1.0, 1.0)])
+                    >>> point_cloud.is_defined()  # True
+            )doc",
+            arg("points")
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<PointCloud>))
+        .def("__repr__", &(shiftToString<PointCloud>))
+
+        .def(
+            "is_defined",
+            &PointCloud::isDefined,
+            R"doc(
+                Check if the point cloud is defined.
+
+                Returns:
+                    bool: True if the point cloud contains at least one point.
+            )doc"
+        )
+        .def(
+            "is_empty",
+            &PointCloud::isEmpty,
+            R"doc(
+                Check if the point cloud is empty.
+
+                Returns:
+                    bool: True if the point cloud contains no points.
+            )doc"
+        )
+
+        .def(
+            "get_size",
+            &PointCloud::getSize,
+            R"doc(
+                Get the number of points in the cloud.
+
+                Returns:
+                    int: The number of points.
+            )doc"
+        )
+        .def(
+            "get_point_at",
+            &PointCloud::getPointAt,
+            R"doc(
+                Get the point at a given index.
+
+                Args:
+                    index (int): The point index, in insertion order.
+
+                Returns:
+                    Point: The point.
+            )doc",
+            arg("index")
+        )
+        .def(
+            "get_points",
+            &PointCloud::getPoints,
+            R"doc(
+                Get all points as an N x 3 matrix, in insertion order.
+
+                Returns:
+                    numpy.ndarray: The point matrix.
+            )doc"
+        )
+        .def(
+            "distance_to",
+            &PointCloud::distanceTo,
+            R"doc(
+                Calculate the minimum distance from the point cloud to a point.
+
+                Args:
+                    point (Point): The point to measure distance to.
+
+                Returns:
+                    float: The minimum distance to any point in the cloud.
+            )doc",
+            arg("point")
+        )
+        .def(
+            "get_point_closest_to",
+            &PointCloud::getPointClosestTo,
+            R"doc(
+                Get the point in the cloud closest to a given point.
+
+                Args:
+                    point (Point): The reference point.
+
+                Returns:
+                    Point: The closest point in the cloud.
+            )doc",
+            arg("point")
+        )
+        .def(
+            "find_nearest_neighbor",
+            overload_cast<const Point&>(&PointCloud::findNearestNeighbor, const_),
+            R"doc(
+                Find the index of the point closest to a given point.
+
+                Ties are broken toward the lowest index.
+
+                Args:
+                    point (Point): The query point.
+
+                Returns:
+                    int: The index of the closest point.
+
+                Example:
+                    >>> point_cloud = PointCloud([Point(0.0, 0.0, 0.0), Point(0.0, 0.0, 1.0)])
+                    >>> point_cloud.find_nearest_neighbor(Point(0.0, 0.0, 2.0))  # 1
+            )doc",
+            arg("point")
+        )
+        .def(
+            "find_nearest_neighbor",
+            overload_cast<const MatrixXd&, const Size&>(&PointCloud::findNearestNeighbor, const_),
+            R"doc(
+                Find the index of the closest point for each row of an N x 3 query matrix.
+
+                Args:
+                    points (numpy.ndarray): The N x 3 query matrix.
+                    thread_count (int): The number of threads. Defaults to 1.
+
+                Returns:
+                    list[int]: The index of the closest point, for each query.
+            )doc",
+            arg("points"),
+            arg("thread_count") = 1
+        )
+        .def(
+            "find_nearest_neighbors",
+            overload_cast<const Point&, const Size&>(&PointCloud::findNearestNeighbors, const_),
+            R"doc(
+                Find the indices of the k points closest to a given point, sorted by increasing distance.
+
+                Args:
+                    point (Point): The query point.
+                    neighbor_count (int): The number of neighbors.
+
+                Returns:
+                    list[int]: The indices of the closest points.
+            )doc",
+            arg("point"),
+            arg("neighbor_count")
+        )
+        .def(
+            "find_nearest_neighbors",
+            overload_cast<const MatrixXd&, const Size&, const Size&>(&PointCloud::findNearestNeighbors, const_),
+            R"doc(
+                Find the indices of the k closest points for each row of an N x 3 query matrix.
+
+                Args:
+                    points (numpy.ndarray): The N x 3 query matrix.
+                    neighbor_count (int): The number of neighbors.
+                    thread_count (int): The number of threads. Defaults to 1.
+
+                Returns:
+                    list[list[int]]: The indices of the closest points, for each query.
+            )doc",
+            arg("points"),
+            arg("neighbor_count"),
+            arg("thread_count") = 1
+        )
+        .def(
+            "find_neighbors_within_radius",
+            overload_cast<const Point&, const Real&>(&PointCloud::findNeighborsWithinRadius, const_),
+            R"doc(
+                Find the indices of the points within a radius of a given point, sorted by increasing distance.
+
+                Args:
+                    point (Point): The query point.
+                    radius (float): The search radius.
+
+                Returns:
+                    list[int]: The indices of the points within the radius.
+            )doc",
+            arg("point"),
+            arg("radius")
+        )
+        .def(
+            "find_neighbors_within_radius",
+            overload_cast<const MatrixXd&, const Real&, const Size&>(
+                &PointCloud::findNeighborsWithinRadius, const_
+            ),
+            R"doc(
+                Find the indices of the points within a radius for each row of an N x 3 query matrix.
+
+                Args:
+                    points (numpy.ndarray): The N x 3 query matrix.
+                    radius (float): The search radius.
+                    thread_count (int): The number of threads. Defaults to 1.
+
+                Returns:
+                    list[list[int]]: The indices of the points within the radius, for each query.
+            )doc",
+            arg("points"),
+            arg("radius"),
+            arg("thread_count") = 1
+        )
+        .def(
+            "apply_transformation",
+            &PointCloud::applyTransformation,
+            R"doc(
+                Apply a transformation to all points in the cloud, and rebuild the index.
+
+                Args:
+                    transformation (Transformation): The transformation to apply.
+            )doc",
+            arg("transformation")
+        )
+
+        .def_static(
+            "empty",
+            &PointCloud::Empty,
+            R"doc(
+                Create an empty point cloud.
+
+                Returns:
+                    PointCloud: An empty point cloud.
+            )doc"
+        )
+        .def_static(
+            "matrix",
+            &PointCloud::Matrix,
+            R"doc(
+                Create a point cloud from an N x 3 matrix.
+
+                Args:
+                    points (numpy.ndarray): The N x 3 point matrix.
+
+                Returns:
+                    PointCloud: The point cloud.
+
+                Example:
+                    >>> point_cloud = PointCloud.matrix(numpy.random.rand(1000, 3))
+            )doc",
+            arg("points")
+        )
+
+        .def("__len__", &PointCloud::getSize)
+        .def(
+            "__getitem__",
+            [](const PointCloud& aPointCloud, size_t index) -> Point
+            {
+                if (index >= aPointCloud.getSize())
+                {
+                    throw std::out_of_range("Index out of range");
+                }
+                return aPointCloud.getPointAt(index);
+            }
+        )
+
+        ;
+}
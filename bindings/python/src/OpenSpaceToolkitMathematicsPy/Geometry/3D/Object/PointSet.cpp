@@ -1,6 +1,7 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/WKB.hpp>
 
 inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_PointSet(pybind11::module& aModule)
 {
@@ -8,6 +9,7 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_PointSet(pybind11::
 
     using ostk::core::container::Array;
 
+    using ostk::mathematics::geometry::WKB;
     using ostk::mathematics::geometry::d3::Object;
     using ostk::mathematics::geometry::d3::object::Point;
     using ostk::mathematics::geometry::d3::object::PointSet;
@@ -44,6 +46,17 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_PointSet(pybind11::
         .def("__str__", &(shiftToString<PointSet>))
         .def("__repr__", &(shiftToString<PointSet>))
 
+        .def(pickle(
+            [](const PointSet& aPointSet)
+            {
+                return pickleStateFromBuffer(WKB::Encode(aPointSet));
+            },
+            [](const bytes& aState)
+            {
+                return WKB::Reader(pickleBufferFromState(aState)).readPointSet3d();
+            }
+        ))
+
         .def(
             "is_defined",
             &PointSet::isDefined,
@@ -23,6 +23,7 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Pyramid(pybind11::m
     using ostk::mathematics::geometry::d3::object::Segment;
     using ostk::mathematics::geometry::d3::object::Sphere;
     using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+    using ostk::mathematics::object::MatrixXd;
 
     class_<Pyramid, Object>(
         aModule,
@@ -170,6 +171,28 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_Pyramid(pybind11::m
                     >>> pyramid.contains(Ellipsoid(Point(0.0, 0.0, 0.0), 1.0, 1.0, 1.0))
             )doc"
         )
+        .def(
+            "contains",
+            overload_cast<const MatrixXd&, const Size&>(&Pyramid::contains, const_),
+            arg("points"),
+            arg("thread_count") = 1,
+            R"doc(
+                Check if the pyramid contains each point of a batch.
+
+                Args:
+                    points (numpy.ndarray): The N x 3 matrix of points.
+                    thread_count (int): The number of threads. Defaults to 1.
+
+                Returns:
+                    list[bool]: True if the pyramid contains the point, for each row.
+
+                Example:
+                    >>> base = Polygon([Point2d(0.0, 0.0), Point2d(1.0, 0.0), Point2d(1.0, 1.0), Point2d(0.0, 1.0)])
+                    >>> apex = Point(0.0, 0.0, 1.0)
+                    >>> pyramid = Pyramid(base, apex)
+                    >>> pyramid.contains(np.array([[0.5, 0.5, 0.5], [0.0, 0.0, 2.0]]))
+            )doc"
+        )
 
         .def(
             "get_base",
@@ -0,0 +1,218 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/TriangleMesh.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Object_TriangleMesh(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::geometry::d3::Object;
+    using ostk::mathematics::geometry::d3::object::Ray;
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
+    using ostk::mathematics::object::MatrixXd;
+    using ostk::mathematics::object::MatrixXi;
+
+    class_<TriangleMesh, Object>(
+        aModule,
+        "TriangleMesh",
+        R"doc(
+                An indexed triangle mesh.
+
+                A TriangleMesh stores a shared vertex buffer and a triangle index buffer, and indexes the triangles
+                with a bounding volume hierarchy, so that ray casts against detailed surfaces (spacecraft models,
+                terrain) run in logarithmic rather than linear time. Triangles are two-sided.
+            )doc"
+    )
+
+        .def(
+            init<const MatrixXd&, const MatrixXi&>(),
+            R"doc(
+                Construct a triangle mesh from vertices and triangles.
+
+                Args:
+                    vertices (numpy.ndarray): The N x 3 vertex matrix.
+                    triangles (numpy.ndarray): The M x 3 matrix of vertex indices, one triangle per row.
+
+                Example:
+                    >>> vertices = numpy.array([[0.0, 0.0, 0.0], [1.0, 0.0, 0.0], [0.0, 1.0, 0.0]])
+                    >>> triangles = numpy.array([[0, 1, 2]], dtype=numpy.int32)
+                    >>> mesh = TriangleMesh(vertices, triangles)
+            )doc",
+            arg("vertices"),
+            arg("triangles")
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<TriangleMesh>))
+        .def("__repr__", &(shiftToString<TriangleMesh>))
+
+        .def(
+            "is_defined",
+            &TriangleMesh::isDefined,
+            R"doc(
+                Check if the triangle mesh is defined.
+
+                Returns:
+                    bool: True if the triangle mesh contains at least one triangle.
+            )doc"
+        )
+        .def(
+            "intersects",
+            overload_cast<const Ray&>(&TriangleMesh::intersects, const_),
+            R"doc(
+                Check if a ray hits the triangle mesh.
+
+                Traversal stops at the first triangle found, which makes occlusion tests cheaper than a first hit
+                search.
+
+                Args:
+                    ray (Ray): The ray.
+
+                Returns:
+                    bool: True if the ray hits the triangle mesh.
+            )doc",
+            arg("ray")
+        )
+        .def(
+            "intersects",
+            overload_cast<const MatrixXd&, const MatrixXd&, const Size&>(&TriangleMesh::intersects, const_),
+            R"doc(
+                Check if each ray of a batch hits the triangle mesh.
+
+                Args:
+                    origins (numpy.ndarray): The M x 3 matrix of ray origins.
+                    directions (numpy.ndarray): The M x 3 matrix of non-zero ray directions.
+                    thread_count (int): The number of threads. Defaults to 1.
+
+                Returns:
+                    list[bool]: True if the ray hits the triangle mesh, for each row.
+            )doc",
+            arg("origins"),
+            arg("directions"),
+            arg("thread_count") = 1
+        )
+
+        .def(
+            "get_vertex_count",
+            &TriangleMesh::getVertexCount,
+            R"doc(
+                Get the number of vertices.
+
+                Returns:
+                    int: The number of vertices.
+            )doc"
+        )
+        .def(
+            "get_triangle_count",
+            &TriangleMesh::getTriangleCount,
+            R"doc(
+                Get the number of triangles.
+
+                Returns:
+                    int: The number of triangles.
+            )doc"
+        )
+        .def(
+            "get_vertices",
+            &TriangleMesh::getVertices,
+            R"doc(
+                Get the vertices as an N x 3 matrix.
+
+                Returns:
+                    numpy.ndarray: The vertex matrix.
+            )doc"
+        )
+        .def(
+            "get_triangles",
+            &TriangleMesh::getTriangles,
+            R"doc(
+                Get the triangles as an M x 3 matrix of vertex indices, in insertion order.
+
+                Returns:
+                    numpy.ndarray: The triangle matrix.
+            )doc"
+        )
+        .def(
+            "intersection_with",
+            overload_cast<const Ray&>(&TriangleMesh::intersectionWith, const_),
+            R"doc(
+                Compute the intersection of a ray with the triangle mesh.
+
+                Args:
+                    ray (Ray): The ray.
+
+                Returns:
+                    Intersection: A point intersection at the first hit, or an empty intersection.
+            )doc",
+            arg("ray")
+        )
+        .def(
+            "cast_ray",
+            &TriangleMesh::castRay,
+            R"doc(
+                Cast a ray onto the triangle mesh.
+
+                If the ray misses, the distance and point are undefined and the triangle index equals the triangle
+                count.
+
+                Args:
+                    ray (Ray): The ray.
+
+                Returns:
+                    tuple[int, Real, Point]: The triangle index, distance along the ray and point of the first hit.
+
+                Example:
+                    >>> triangle_index, distance, point = mesh.cast_ray(Ray(Point(0.2, 0.2, 1.0), [0.0, 0.0, -1.0]))
+            )doc",
+            arg("ray")
+        )
+        .def(
+            "cast_rays",
+            &TriangleMesh::castRays,
+            R"doc(
+                Cast each ray of a batch onto the triangle mesh.
+
+                Distances are expressed in units of the normalized ray directions.
+
+                Args:
+                    origins (numpy.ndarray): The M x 3 matrix of ray origins.
+                    directions (numpy.ndarray): The M x 3 matrix of non-zero ray directions.
+                    thread_count (int): The number of threads. Defaults to 1.
+
+                Returns:
+                    list[tuple[int, Real, Point]]: The first hit, for each row.
+            )doc",
+            arg("origins"),
+            arg("directions"),
+            arg("thread_count") = 1
+        )
+        .def(
+            "apply_transformation",
+            &TriangleMesh::applyTransformation,
+            R"doc(
+                Apply a transformation to the vertices, and rebuild the hierarchy.
+
+                Args:
+                    transformation (Transformation): The transformation to apply.
+            )doc",
+            arg("transformation")
+        )
+
+        .def_static(
+            "undefined",
+            &TriangleMesh::Undefined,
+            R"doc(
+                Create an undefined triangle mesh.
+
+                Returns:
+                    TriangleMesh: An undefined triangle mesh.
+            )doc"
+        )
+
+        ;
+}
@@ -2,6 +2,7 @@
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 
+#include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Transformation/RigidTransformation.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Transformation/Rotation.cpp>
 
 inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformation(pybind11::module& aModule)
@@ -145,6 +146,37 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformation(pybind11::m
             )doc"
         )
 
+        .def(
+            "apply_to_points",
+            &Transformation::applyToPoints,
+            arg("points"),
+            R"doc(
+                Apply the transformation in place to a 3 x N matrix of points, one point per column.
+
+                The array is modified in place, and must therefore be a writeable, Fortran-ordered float64 array.
+
+                Args:
+                    points (numpy.ndarray): The 3 x N point matrix.
+
+                Example:
+                    >>> points = numpy.asfortranarray(numpy.random.rand(3, 1000))
+                    >>> Transformation.identity().apply_to_points(points)
+            )doc"
+        )
+        .def(
+            "apply_to_vectors",
+            &Transformation::applyToVectors,
+            arg("vectors"),
+            R"doc(
+                Apply the transformation in place to a 3 x N matrix of vectors, one vector per column.
+
+                Vectors are not affected by translations. The array must be a writeable, Fortran-ordered float64 array.
+
+                Args:
+                    vectors (numpy.ndarray): The 3 x N vector matrix.
+            )doc"
+        )
+
         .def_static(
             "undefined",
             &Transformation::Undefined,
@@ -311,4 +343,5 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformation(pybind11::m
 
     // Add object to python "transformation" submodules
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformation_Rotation(transformation_module);
+    OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformation_RigidTransformation(transformation_module);
 }
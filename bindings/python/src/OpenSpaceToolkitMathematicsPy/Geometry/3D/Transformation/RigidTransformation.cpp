@@ -0,0 +1,246 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/RigidTransformation.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformation_RigidTransformation(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Real;
+
+    using ostk::mathematics::geometry::Angle;
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::Transformation;
+    using ostk::mathematics::geometry::d3::transformation::RigidTransformation;
+    using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+    using ostk::mathematics::object::Vector3d;
+
+    class_<RigidTransformation>(
+        aModule,
+        "RigidTransformation",
+        R"doc(
+            A 3D rigid transformation: a rotation followed by a translation, x' = q * x + t.
+
+            Stored as a unit quaternion and a translation vector, so that composition and inversion are cheaper
+            than with a general 4x4 Transformation.
+        )doc"
+    )
+
+        .def(
+            init<const Quaternion&, const Vector3d&>(),
+            R"doc(
+                Construct a rigid transformation from a rotation and a translation.
+
+                Args:
+                    rotation (Quaternion): The rotation quaternion, normalized on construction.
+                    translation (numpy.ndarray): The translation vector.
+
+                Example:
+                    >>> rigid_transformation = RigidTransformation(Quaternion.unit(), [1.0, 2.0, 3.0])
+            )doc",
+            arg("rotation"),
+            arg("translation")
+        )
+
+        .def(self == self)
+        .def(self != self)
+        .def(self * self)
+
+        .def("__str__", &(shiftToString<RigidTransformation>))
+        .def("__repr__", &(shiftToString<RigidTransformation>))
+
+        .def(
+            "is_defined",
+            &RigidTransformation::isDefined,
+            R"doc(
+                Check if the rigid transformation is defined.
+
+                Returns:
+                    bool: True if the rigid transformation is defined.
+            )doc"
+        )
+        .def(
+            "is_near",
+            &RigidTransformation::isNear,
+            R"doc(
+                Check if the rigid transformation is near another one.
+
+                Args:
+                    rigid_transformation (RigidTransformation): The other rigid transformation.
+                    angular_tolerance (Angle): The tolerance on the rotations.
+                    translation_tolerance (float): The tolerance on the translations.
+
+                Returns:
+                    bool: True if both the rotations and the translations are within tolerance.
+            )doc",
+            arg("rigid_transformation"),
+            arg("angular_tolerance"),
+            arg("translation_tolerance")
+        )
+        .def(
+            "get_rotation",
+            &RigidTransformation::getRotation,
+            R"doc(
+                Get the rotation.
+
+                Returns:
+                    Quaternion: The unit rotation quaternion.
+            )doc"
+        )
+        .def(
+            "get_translation",
+            &RigidTransformation::getTranslation,
+            R"doc(
+                Get the translation.
+
+                Returns:
+                    numpy.ndarray: The translation vector.
+            )doc"
+        )
+        .def(
+            "get_inverse",
+            &RigidTransformation::getInverse,
+            R"doc(
+                Get the inverse rigid transformation.
+
+                Returns:
+                    RigidTransformation: The inverse rigid transformation.
+            )doc"
+        )
+        .def(
+            "apply_to",
+            overload_cast<const Point&>(&RigidTransformation::applyTo, const_),
+            R"doc(
+                Apply the rigid transformation to a point.
+
+                Args:
+                    point (Point): The point to transform.
+
+                Returns:
+                    Point: The transformed point.
+            )doc",
+            arg("point")
+        )
+        .def(
+            "apply_to",
+            overload_cast<const Vector3d&>(&RigidTransformation::applyTo, const_),
+            R"doc(
+                Apply the rigid transformation to a vector (rotation only).
+
+                Args:
+                    vector (numpy.ndarray): The vector to transform.
+
+                Returns:
+                    numpy.ndarray: The rotated vector.
+            )doc",
+            arg("vector")
+        )
+        .def(
+            "apply_to_points",
+            &RigidTransformation::applyToPoints,
+            R"doc(
+                Apply the rigid transformation in place to a 3 x N matrix of points, one point per column.
+
+                The array must be a writeable, Fortran-ordered float64 array.
+
+                Args:
+                    points (numpy.ndarray): The 3 x N point matrix.
+            )doc",
+            arg("points")
+        )
+        .def(
+            "to_transformation",
+            &RigidTransformation::toTransformation,
+            R"doc(
+                Convert to a general transformation.
+
+                Returns:
+                    Transformation: The equivalent transformation.
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &RigidTransformation::Undefined,
+            R"doc(
+                Create an undefined rigid transformation.
+
+                Returns:
+                    RigidTransformation: An undefined rigid transformation.
+            )doc"
+        )
+        .def_static(
+            "identity",
+            &RigidTransformation::Identity,
+            R"doc(
+                Create an identity rigid transformation.
+
+                Returns:
+                    RigidTransformation: The identity rigid transformation.
+            )doc"
+        )
+        .def_static(
+            "translation",
+            &RigidTransformation::Translation,
+            R"doc(
+                Create a pure translation.
+
+                Args:
+                    translation (numpy.ndarray): The translation vector.
+
+                Returns:
+                    RigidTransformation: The rigid transformation.
+            )doc",
+            arg("translation")
+        )
+        .def_static(
+            "rotation",
+            &RigidTransformation::Rotation,
+            R"doc(
+                Create a pure rotation.
+
+                Args:
+                    rotation (Quaternion): The rotation quaternion.
+
+                Returns:
+                    RigidTransformation: The rigid transformation.
+            )doc",
+            arg("rotation")
+        )
+        .def_static(
+            "transformation",
+            &RigidTransformation::Transformation,
+            R"doc(
+                Create a rigid transformation from a general transformation.
+
+                Raises if the transformation is not a proper rigid transformation.
+
+                Args:
+                    transformation (Transformation): The transformation.
+
+                Returns:
+                    RigidTransformation: The rigid transformation.
+            )doc",
+            arg("transformation")
+        )
+        .def_static(
+            "interpolate",
+            &RigidTransformation::Interpolate,
+            R"doc(
+                Interpolate between two rigid transformations: SLERP on the rotation, linear on the translation.
+
+                Args:
+                    first_rigid_transformation (RigidTransformation): The rigid transformation at ratio 0.
+                    second_rigid_transformation (RigidTransformation): The rigid transformation at ratio 1.
+                    ratio (float): The ratio, in [0, 1].
+
+                Returns:
+                    RigidTransformation: The interpolated rigid transformation.
+            )doc",
+            arg("first_rigid_transformation"),
+            arg("second_rigid_transformation"),
+            arg("ratio")
+        )
+
+        ;
+}
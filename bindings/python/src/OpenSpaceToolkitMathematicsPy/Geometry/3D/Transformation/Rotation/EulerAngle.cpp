@@ -68,6 +68,44 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformation_Rotation_Eu
         .def("__str__", &(shiftToString<EulerAngle>))
         .def("__repr__", &(shiftToString<EulerAngle>))
 
+        .def(pickle(
+            [](const EulerAngle& anEulerAngle)
+            {
+                if (!anEulerAngle.isDefined())
+                {
+                    return pickleStateFromValues(std::vector<double>(7, std::numeric_limits<double>::quiet_NaN()));
+                }
+
+                std::vector<double> values;
+
+                for (const Angle& angle : {anEulerAngle.getPhi(), anEulerAngle.getTheta(), anEulerAngle.getPsi()})
+                {
+                    values.push_back(angle.in(angle.getUnit()));
+                    values.push_back(static_cast<double>(static_cast<int>(angle.getUnit())));
+                }
+
+                values.push_back(static_cast<double>(static_cast<int>(anEulerAngle.getAxisSequence())));
+
+                return pickleStateFromValues(values);
+            },
+            [](const bytes& aState)
+            {
+                const std::vector<double> values = pickleValuesFromState(aState, 7);
+
+                if (std::isnan(values[0]))
+                {
+                    return EulerAngle::Undefined();
+                }
+
+                return EulerAngle(
+                    Angle(values[0], static_cast<Angle::Unit>(static_cast<int>(values[1]))),
+                    Angle(values[2], static_cast<Angle::Unit>(static_cast<int>(values[3]))),
+                    Angle(values[4], static_cast<Angle::Unit>(static_cast<int>(values[5]))),
+                    static_cast<EulerAngle::AxisSequence>(static_cast<int>(values[6]))
+                );
+            }
+        ))
+
         .def(
             "is_defined",
             &EulerAngle::isDefined,
@@ -144,6 +144,57 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformation_Rotation_Qu
             }
         )
 
+        .def(pickle(
+            [](const Quaternion& aQuaternion)
+            {
+                if (!aQuaternion.isDefined())
+                {
+                    return pickleStateFromValues(std::vector<double>(4, std::numeric_limits<double>::quiet_NaN()));
+                }
+
+                const Vector4d vector = aQuaternion.toVector(Quaternion::Format::XYZS);
+
+                return pickleStateFromValues(vector.data(), 4);
+            },
+            [](const bytes& aState)
+            {
+                const std::vector<double> values = pickleValuesFromState(aState, 4);
+
+                if (std::isnan(values[0]))
+                {
+                    return Quaternion::Undefined();
+                }
+
+                return Quaternion(values[0], values[1], values[2], values[3], Quaternion::Format::XYZS);
+            }
+        ))
+        .def(
+            "__array__",
+            [](const Quaternion& aQuaternion, const object& aDataType, const object& aCopy) -> object
+            {
+                (void)aCopy;  // Components are not stored contiguously: always a copy
+
+                const object array = cast(aQuaternion.toVector(Quaternion::Format::XYZS));
+
+                return aDataType.is_none() ? array : array.attr("astype")(aDataType);
+            },
+            R"doc(
+                Convert the quaternion to a NumPy array, in XYZS format.
+
+                Args:
+                    dtype (np.dtype): The data type. Defaults to None.
+                    copy (bool): Ignored, a copy is always returned. Defaults to None.
+
+                Returns:
+                    np.array: The components of the quaternion.
+
+                Example:
+                    >>> np.asarray(Quaternion.unit())  # np.array([0.0, 0.0, 0.0, 1.0])
+            )doc",
+            arg("dtype") = none(),
+            arg("copy") = none()
+        )
+
         .def(
             "is_defined",
             &Quaternion::isDefined,
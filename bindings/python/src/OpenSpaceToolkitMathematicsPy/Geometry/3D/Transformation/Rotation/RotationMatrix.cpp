@@ -16,7 +16,7 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformation_Rotation_Ro
     using ostk::mathematics::object::Matrix3d;
     using ostk::mathematics::object::Vector3d;
 
-    class_<RotationMatrix>(aModule, "RotationMatrix")
+    class_<RotationMatrix>(aModule, "RotationMatrix", buffer_protocol())
 
         // Define constructors
         .def(
@@ -83,6 +83,47 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformation_Rotation_Ro
         .def("__str__", &(shiftToString<RotationMatrix>))
         .def("__repr__", &(shiftToString<RotationMatrix>))
 
+        .def(pickle(
+            [](const RotationMatrix& aRotationMatrix)
+            {
+                if (!aRotationMatrix.isDefined())
+                {
+                    return pickleStateFromValues(std::vector<double>(9, std::numeric_limits<double>::quiet_NaN()));
+                }
+
+                return pickleStateFromValues(aRotationMatrix.accessMatrix().data(), 9);
+            },
+            [](const bytes& aState)
+            {
+                const std::vector<double> values = pickleValuesFromState(aState, 9);
+
+                if (std::isnan(values[0]))
+                {
+                    return RotationMatrix::Undefined();
+                }
+
+                return RotationMatrix(Eigen::Map<const Matrix3d>(values.data()));
+            }
+        ))
+
+        // Read-only view of the (column-major) matrix, without copy
+        .def_buffer(
+            [](const RotationMatrix& aRotationMatrix) -> buffer_info
+            {
+                const Matrix3d& matrix = aRotationMatrix.accessMatrix();
+
+                return buffer_info(
+                    const_cast<double*>(matrix.data()),
+                    sizeof(double),
+                    format_descriptor<double>::format(),
+                    2,
+                    {3, 3},
+                    {sizeof(double), 3 * sizeof(double)},
+                    true
+                );
+            }
+        )
+
         .def(
             "is_defined",
             &RotationMatrix::isDefined,
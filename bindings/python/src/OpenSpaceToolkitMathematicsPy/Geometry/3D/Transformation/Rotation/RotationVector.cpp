@@ -60,6 +60,41 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformation_Rotation_Ro
         .def("__str__", &(shiftToString<RotationVector>))
         .def("__repr__", &(shiftToString<RotationVector>))
 
+        .def(pickle(
+            [](const RotationVector& aRotationVector)
+            {
+                if (!aRotationVector.isDefined())
+                {
+                    return pickleStateFromValues(std::vector<double>(5, std::numeric_limits<double>::quiet_NaN()));
+                }
+
+                const Vector3d axis = aRotationVector.getAxis();
+                const Angle angle = aRotationVector.getAngle();
+
+                return pickleStateFromValues(
+                    {axis.x(),
+                     axis.y(),
+                     axis.z(),
+                     angle.in(angle.getUnit()),
+                     static_cast<double>(static_cast<int>(angle.getUnit()))}
+                );
+            },
+            [](const bytes& aState)
+            {
+                const std::vector<double> values = pickleValuesFromState(aState, 5);
+
+                if (std::isnan(values[0]))
+                {
+                    return RotationVector::Undefined();
+                }
+
+                return RotationVector(
+                    Vector3d(values[0], values[1], values[2]),
+                    Angle(values[3], static_cast<Angle::Unit>(static_cast<int>(values[4])))
+                );
+            }
+        ))
+
         .def(
             "is_defined",
             &RotationVector::isDefined,
@@ -96,6 +96,31 @@ inline void OpenSpaceToolkitMathematicsPy_Geometry_Angle(pybind11::module& aModu
             }
         )
 
+        .def(pickle(
+            [](const Angle& anAngle)
+            {
+                if (!anAngle.isDefined())
+                {
+                    return pickleStateFromValues({std::numeric_limits<double>::quiet_NaN(), 0.0});
+                }
+
+                return pickleStateFromValues(
+                    {anAngle.in(anAngle.getUnit()), static_cast<double>(static_cast<int>(anAngle.getUnit()))}
+                );
+            },
+            [](const bytes& aState)
+            {
+                const std::vector<double> values = pickleValuesFromState(aState, 2);
+
+                if (std::isnan(values[0]))
+                {
+                    return Angle::Undefined();
+                }
+
+                return Angle(values[0], static_cast<Angle::Unit>(static_cast<int>(values[1])));
+            }
+        ))
+
         .def(
             "is_defined",
             &Angle::isDefined,
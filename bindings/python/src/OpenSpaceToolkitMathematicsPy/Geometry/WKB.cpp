@@ -0,0 +1,555 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/WKB.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_Geometry_WKB(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::mathematics::geometry::WKB;
+
+    using Point2d = ostk::mathematics::geometry::d2::object::Point;
+    using PointSet2d = ostk::mathematics::geometry::d2::object::PointSet;
+    using LineString2d = ostk::mathematics::geometry::d2::object::LineString;
+    using Polygon2d = ostk::mathematics::geometry::d2::object::Polygon;
+    using MultiPolygon2d = ostk::mathematics::geometry::d2::object::MultiPolygon;
+    using Point3d = ostk::mathematics::geometry::d3::object::Point;
+    using PointSet3d = ostk::mathematics::geometry::d3::object::PointSet;
+    using LineString3d = ostk::mathematics::geometry::d3::object::LineString;
+
+    const auto bytesFromBuffer = [](const WKB::Buffer& aBuffer) -> bytes
+    {
+        return bytes(reinterpret_cast<const char*>(aBuffer.data()), aBuffer.size());
+    };
+
+    class_<WKB> wkb(aModule, "WKB");
+
+    // Enumerations are registered first, as they are used as default arguments
+    enum_<WKB::ByteOrder>(wkb, "ByteOrder")
+
+        .value("BigEndian", WKB::ByteOrder::BigEndian)
+        .value("LittleEndian", WKB::ByteOrder::LittleEndian)
+
+        ;
+
+    enum_<WKB::Type>(wkb, "Type")
+
+        .value("Undefined", WKB::Type::Undefined)
+        .value("Point", WKB::Type::Point)
+        .value("LineString", WKB::Type::LineString)
+        .value("Polygon", WKB::Type::Polygon)
+        .value("MultiPoint", WKB::Type::MultiPoint)
+        .value("MultiPolygon", WKB::Type::MultiPolygon)
+
+        ;
+
+    wkb
+
+        .def_static(
+            "encode",
+            [bytesFromBuffer](const Point2d& aPoint, const WKB::ByteOrder& aByteOrder)
+            {
+                return bytesFromBuffer(WKB::Encode(aPoint, aByteOrder));
+            },
+            R"doc(
+                Encode a 2D point.
+
+                Args:
+                    geometry (Point): The point.
+                    byte_order (WKB.ByteOrder): The byte order. Defaults to WKB.ByteOrder.LittleEndian.
+
+                Returns:
+                    bytes: The WKB bytes.
+
+                Example:
+                    >>> data = WKB.encode(Point(1.0, 2.0))  # 21 bytes
+            )doc",
+            arg("geometry"),
+            arg("byte_order") = WKB::ByteOrder::LittleEndian
+        )
+        .def_static(
+            "encode",
+            [bytesFromBuffer](const PointSet2d& aPointSet, const WKB::ByteOrder& aByteOrder)
+            {
+                return bytesFromBuffer(WKB::Encode(aPointSet, aByteOrder));
+            },
+            R"doc(
+                Encode a 2D point set, as a multi-point.
+
+                Args:
+                    geometry (PointSet): The point set.
+                    byte_order (WKB.ByteOrder): The byte order. Defaults to WKB.ByteOrder.LittleEndian.
+
+                Returns:
+                    bytes: The WKB bytes.
+            )doc",
+            arg("geometry"),
+            arg("byte_order") = WKB::ByteOrder::LittleEndian
+        )
+        .def_static(
+            "encode",
+            [bytesFromBuffer](const LineString2d& aLineString, const WKB::ByteOrder& aByteOrder)
+            {
+                return bytesFromBuffer(WKB::Encode(aLineString, aByteOrder));
+            },
+            R"doc(
+                Encode a 2D line string.
+
+                Args:
+                    geometry (LineString): The line string.
+                    byte_order (WKB.ByteOrder): The byte order. Defaults to WKB.ByteOrder.LittleEndian.
+
+                Returns:
+                    bytes: The WKB bytes.
+            )doc",
+            arg("geometry"),
+            arg("byte_order") = WKB::ByteOrder::LittleEndian
+        )
+        .def_static(
+            "encode",
+            [bytesFromBuffer](const Polygon2d& aPolygon, const WKB::ByteOrder& aByteOrder)
+            {
+                return bytesFromBuffer(WKB::Encode(aPolygon, aByteOrder));
+            },
+            R"doc(
+                Encode a 2D polygon.
+
+                Args:
+                    geometry (Polygon): The polygon.
+                    byte_order (WKB.ByteOrder): The byte order. Defaults to WKB.ByteOrder.LittleEndian.
+
+                Returns:
+                    bytes: The WKB bytes.
+            )doc",
+            arg("geometry"),
+            arg("byte_order") = WKB::ByteOrder::LittleEndian
+        )
+        .def_static(
+            "encode",
+            [bytesFromBuffer](const MultiPolygon2d& aMultiPolygon, const WKB::ByteOrder& aByteOrder)
+            {
+                return bytesFromBuffer(WKB::Encode(aMultiPolygon, aByteOrder));
+            },
+            R"doc(
+                Encode a 2D multi-polygon.
+
+                Args:
+                    geometry (MultiPolygon): The multi-polygon.
+                    byte_order (WKB.ByteOrder): The byte order. Defaults to WKB.ByteOrder.LittleEndian.
+
+                Returns:
+                    bytes: The WKB bytes.
+            )doc",
+            arg("geometry"),
+            arg("byte_order") = WKB::ByteOrder::LittleEndian
+        )
+        .def_static(
+            "encode",
+            [bytesFromBuffer](const Point3d& aPoint, const WKB::ByteOrder& aByteOrder)
+            {
+                return bytesFromBuffer(WKB::Encode(aPoint, aByteOrder));
+            },
+            R"doc(
+                Encode a 3D point.
+
+                Args:
+                    geometry (Point): The point.
+                    byte_order (WKB.ByteOrder): The byte order. Defaults to WKB.ByteOrder.LittleEndian.
+
+                Returns:
+                    bytes: The WKB bytes.
+            )doc",
+            arg("geometry"),
+            arg("byte_order") = WKB::ByteOrder::LittleEndian
+        )
+        .def_static(
+            "encode",
+            [bytesFromBuffer](const PointSet3d& aPointSet, const WKB::ByteOrder& aByteOrder)
+            {
+                return bytesFromBuffer(WKB::Encode(aPointSet, aByteOrder));
+            },
+            R"doc(
+                Encode a 3D point set, as a multi-point.
+
+                Args:
+                    geometry (PointSet): The point set.
+                    byte_order (WKB.ByteOrder): The byte order. Defaults to WKB.ByteOrder.LittleEndian.
+
+                Returns:
+                    bytes: The WKB bytes.
+            )doc",
+            arg("geometry"),
+            arg("byte_order") = WKB::ByteOrder::LittleEndian
+        )
+        .def_static(
+            "encode",
+            [bytesFromBuffer](const LineString3d& aLineString, const WKB::ByteOrder& aByteOrder)
+            {
+                return bytesFromBuffer(WKB::Encode(aLineString, aByteOrder));
+            },
+            R"doc(
+                Encode a 3D line string.
+
+                Args:
+                    geometry (LineString): The line string.
+                    byte_order (WKB.ByteOrder): The byte order. Defaults to WKB.ByteOrder.LittleEndian.
+
+                Returns:
+                    bytes: The WKB bytes.
+            )doc",
+            arg("geometry"),
+            arg("byte_order") = WKB::ByteOrder::LittleEndian
+        )
+
+        .def_static(
+            "string_from_type",
+            &WKB::StringFromType,
+            R"doc(
+                Get the string representation of a WKB type.
+
+                Args:
+                    type (WKB.Type): The type.
+
+                Returns:
+                    str: String representation of the type.
+
+                Example:
+                    >>> WKB.string_from_type(WKB.Type.Polygon)  # "Polygon"
+            )doc",
+            arg("type")
+        )
+
+        ;
+
+    class_<WKB::Writer>(wkb, "Writer")
+
+        .def(
+            init<const WKB::ByteOrder&>(),
+            R"doc(
+                Create a WKB writer, appending geometries to a buffer.
+
+                Args:
+                    byte_order (WKB.ByteOrder): The byte order. Defaults to WKB.ByteOrder.LittleEndian.
+
+                Example:
+                    >>> writer = WKB.Writer()
+                    >>> writer.write(polygon)
+                    >>> data = writer.get_buffer()
+            )doc",
+            arg("byte_order") = WKB::ByteOrder::LittleEndian
+        )
+
+        .def(
+            "get_buffer",
+            [bytesFromBuffer](const WKB::Writer& aWriter)
+            {
+                return bytesFromBuffer(aWriter.accessBuffer());
+            },
+            R"doc(
+                Get the buffer.
+
+                Returns:
+                    bytes: The WKB bytes written so far.
+            )doc"
+        )
+        .def(
+            "reserve",
+            &WKB::Writer::reserve,
+            R"doc(
+                Reserve buffer capacity.
+
+                Args:
+                    byte_count (int): The number of bytes.
+            )doc",
+            arg("byte_count")
+        )
+        .def(
+            "write",
+            overload_cast<const Point2d&>(&WKB::Writer::write),
+            R"doc(
+                Write a 2D point.
+
+                Args:
+                    geometry (Point): The point.
+            )doc",
+            arg("geometry")
+        )
+        .def(
+            "write",
+            overload_cast<const PointSet2d&>(&WKB::Writer::write),
+            R"doc(
+                Write a 2D point set, as a multi-point.
+
+                Args:
+                    geometry (PointSet): The point set.
+            )doc",
+            arg("geometry")
+        )
+        .def(
+            "write",
+            overload_cast<const LineString2d&>(&WKB::Writer::write),
+            R"doc(
+                Write a 2D line string.
+
+                Args:
+                    geometry (LineString): The line string.
+            )doc",
+            arg("geometry")
+        )
+        .def(
+            "write",
+            overload_cast<const Polygon2d&>(&WKB::Writer::write),
+            R"doc(
+                Write a 2D polygon.
+
+                Args:
+                    geometry (Polygon): The polygon.
+            )doc",
+            arg("geometry")
+        )
+        .def(
+            "write",
+            overload_cast<const MultiPolygon2d&>(&WKB::Writer::write),
+            R"doc(
+                Write a 2D multi-polygon.
+
+                Args:
+                    geometry (MultiPolygon): The multi-polygon.
+            )doc",
+            arg("geometry")
+        )
+        .def(
+            "write",
+            overload_cast<const Point3d&>(&WKB::Writer::write),
+            R"doc(
+                Write a 3D point.
+
+                Args:
+                    geometry (Point): The point.
+            )doc",
+            arg("geometry")
+        )
+        .def(
+            "write",
+            overload_cast<const PointSet3d&>(&WKB::Writer::write),
+            R"doc(
+                Write a 3D point set, as a multi-point.
+
+                Args:
+                    geometry (PointSet): The point set.
+            )doc",
+            arg("geometry")
+        )
+        .def(
+            "write",
+            overload_cast<const LineString3d&>(&WKB::Writer::write),
+            R"doc(
+                Write a 3D line string.
+
+                Args:
+                    geometry (LineString): The line string.
+            )doc",
+            arg("geometry")
+        )
+        .def(
+            "clear",
+            &WKB::Writer::clear,
+            R"doc(
+                Clear the buffer.
+            )doc"
+        )
+
+        ;
+
+    class_<WKB::Reader>(wkb, "Reader")
+
+        .def(
+            init(
+                [](const bytes& aBytes)
+                {
+                    const std::string_view data = aBytes;
+
+                    WKB::Buffer buffer(data.begin(), data.end());
+
+                    return WKB::Reader(std::move(buffer));
+                }
+            ),
+            R"doc(
+                Create a WKB reader over a copy of the given bytes.
+
+                Args:
+                    data (bytes): The WKB bytes.
+
+                Example:
+                    >>> reader = WKB.Reader(data)
+                    >>> while not reader.is_end():
+                    ...     polygon = reader.read_polygon_2d()
+            )doc",
+            arg("data")
+        )
+
+        .def(
+            "is_end",
+            &WKB::Reader::isEnd,
+            R"doc(
+                Check if all geometries have been read.
+
+                Returns:
+                    bool: True if the reader is at the end of the data.
+            )doc"
+        )
+        .def(
+            "get_offset",
+            &WKB::Reader::getOffset,
+            R"doc(
+                Get the offset of the next geometry.
+
+                Returns:
+                    int: The offset (in bytes).
+            )doc"
+        )
+        .def(
+            "get_byte_count",
+            &WKB::Reader::getByteCount,
+            R"doc(
+                Get the number of bytes.
+
+                Returns:
+                    int: The number of bytes.
+            )doc"
+        )
+        .def(
+            "get_next_type",
+            &WKB::Reader::getNextType,
+            R"doc(
+                Get the type of the next geometry, without reading it.
+
+                Returns:
+                    WKB.Type: The type of the next geometry.
+            )doc"
+        )
+        .def(
+            "get_next_dimension",
+            &WKB::Reader::getNextDimension,
+            R"doc(
+                Get the dimension (2 or 3) of the next geometry, without reading it.
+
+                Returns:
+                    int: The dimension of the next geometry.
+            )doc"
+        )
+        .def(
+            "read_point_2d",
+            &WKB::Reader::readPoint2d,
+            R"doc(
+                Read a 2D point.
+
+                Returns:
+                    Point: The point.
+            )doc"
+        )
+        .def(
+            "read_point_set_2d",
+            &WKB::Reader::readPointSet2d,
+            R"doc(
+                Read a 2D point set, from a multi-point.
+
+                Returns:
+                    PointSet: The point set.
+            )doc"
+        )
+        .def(
+            "read_line_string_2d",
+            &WKB::Reader::readLineString2d,
+            R"doc(
+                Read a 2D line string.
+
+                Returns:
+                    LineString: The line string.
+            )doc"
+        )
+        .def(
+            "read_polygon_2d",
+            &WKB::Reader::readPolygon2d,
+            R"doc(
+                Read a 2D polygon.
+
+                Returns:
+                    Polygon: The polygon.
+            )doc"
+        )
+        .def(
+            "read_multi_polygon_2d",
+            &WKB::Reader::readMultiPolygon2d,
+            R"doc(
+                Read a 2D multi-polygon, or a polygon as a multi-polygon.
+
+                Returns:
+                    MultiPolygon: The multi-polygon.
+            )doc"
+        )
+        .def(
+            "read_point_3d",
+            &WKB::Reader::readPoint3d,
+            R"doc(
+                Read a 3D point.
+
+                Returns:
+                    Point: The point.
+            )doc"
+        )
+        .def(
+            "read_point_set_3d",
+            &WKB::Reader::readPointSet3d,
+            R"doc(
+                Read a 3D point set, from a multi-point.
+
+                Returns:
+                    PointSet: The point set.
+            )doc"
+        )
+        .def(
+            "read_line_string_3d",
+            &WKB::Reader::readLineString3d,
+            R"doc(
+                Read a 3D line string.
+
+                Returns:
+                    LineString: The line string.
+            )doc"
+        )
+        .def(
+            "skip",
+            &WKB::Reader::skip,
+            R"doc(
+                Skip the next geometry.
+            )doc"
+        )
+        .def(
+            "rewind",
+            &WKB::Reader::rewind,
+            R"doc(
+                Rewind to the first geometry.
+            )doc"
+        )
+
+        .def_static(
+            "map",
+            &WKB::Reader::Map,
+            R"doc(
+                Create a WKB reader over a memory-mapped file.
+
+                Args:
+                    file (File): The file.
+
+                Returns:
+                    WKB.Reader: The reader.
+
+                Example:
+                    >>> reader = WKB.Reader.map(File.path(Path.parse("/path/to/file.wkb")))
+            )doc",
+            arg("file")
+        )
+
+        ;
+}
@@ -42,6 +42,37 @@ inline void OpenSpaceToolkitMathematicsPy_Object_Interval(pybind11::module& aMod
         .def("__str__", &(shiftToString<Interval<Real>>))
         .def("__repr__", &(shiftToString<Interval<Real>>))
 
+        .def(pickle(
+            [](const Interval<Real>& anInterval)
+            {
+                if (!anInterval.isDefined())
+                {
+                    return pickleStateFromValues(std::vector<double>(3, std::numeric_limits<double>::quiet_NaN()));
+                }
+
+                return pickleStateFromValues(
+                    {pickleValueFromReal(anInterval.getLowerBound()),
+                     pickleValueFromReal(anInterval.getUpperBound()),
+                     static_cast<double>(static_cast<int>(anInterval.getType()))}
+                );
+            },
+            [](const bytes& aState)
+            {
+                const std::vector<double> values = pickleValuesFromState(aState, 3);
+
+                if (std::isnan(values[2]))
+                {
+                    return Interval<Real>::Undefined();
+                }
+
+                return Interval<Real>(
+                    pickleRealFromValue(values[0]),
+                    pickleRealFromValue(values[1]),
+                    static_cast<Interval<Real>::Type>(static_cast<int>(values[2]))
+                );
+            }
+        ))
+
         .def(
             "is_defined",
             &Interval<Real>::isDefined,
@@ -0,0 +1,78 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkitMathematicsPy_Utility_Pickling__
+#define __OpenSpaceToolkitMathematicsPy_Utility_Pickling__
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+
+/// @brief                      Pickling Helper Functions
+///
+///                             Compact binary state for __getstate__ and __setstate__ methods on classes exposed in
+///                             python: values are stored as raw native doubles, undefined reals as NaN.
+
+inline pybind11::bytes pickleStateFromValues(const double* aValuePtr, const std::size_t aValueCount)
+{
+    return pybind11::bytes(reinterpret_cast<const char*>(aValuePtr), aValueCount * sizeof(double));
+}
+
+inline pybind11::bytes pickleStateFromValues(const std::vector<double>& aValueArray)
+{
+    return pickleStateFromValues(aValueArray.data(), aValueArray.size());
+}
+
+/// @brief                      Read values from a state, checking the value count (if non zero)
+
+inline std::vector<double> pickleValuesFromState(const pybind11::bytes& aState, const std::size_t aValueCount = 0)
+{
+    const std::string_view state = aState;
+
+    if ((state.size() % sizeof(double) != 0) ||
+        ((aValueCount != 0) && (state.size() != aValueCount * sizeof(double))))
+    {
+        throw std::runtime_error("Invalid pickled state.");
+    }
+
+    std::vector<double> values(state.size() / sizeof(double));
+
+    if (!values.empty())
+    {
+        std::memcpy(values.data(), state.data(), state.size());
+    }
+
+    return values;
+}
+
+inline double pickleValueFromReal(const ostk::core::type::Real& aReal)
+{
+    return aReal.isDefined() ? static_cast<double>(aReal) : std::numeric_limits<double>::quiet_NaN();
+}
+
+inline ostk::core::type::Real pickleRealFromValue(const double aValue)
+{
+    return std::isnan(aValue) ? ostk::core::type::Real::Undefined() : ostk::core::type::Real(aValue);
+}
+
+inline pybind11::bytes pickleStateFromBuffer(const ostk::core::container::Array<std::uint8_t>& aBuffer)
+{
+    return pybind11::bytes(reinterpret_cast<const char*>(aBuffer.data()), aBuffer.size());
+}
+
+inline ostk::core::container::Array<std::uint8_t> pickleBufferFromState(const pybind11::bytes& aState)
+{
+    const std::string_view state = aState;
+
+    return ostk::core::container::Array<std::uint8_t>(state.begin(), state.end());
+}
+
+#endif
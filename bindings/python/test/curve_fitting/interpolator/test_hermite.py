@@ -0,0 +1,73 @@
+# Apache License 2.0
+
+import pickle
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.curve_fitting import Interpolator
+from ostk.mathematics.curve_fitting.interpolator import Hermite
+
+
+@pytest.fixture
+def x() -> np.ndarray:
+    return np.array([-1.0, 0.2, 0.5, 1.7, 3.0])
+
+
+@pytest.fixture
+def interpolator(x: np.ndarray) -> Hermite:
+    return Hermite(x=x, y=x**3 - 2.0 * x**2 + 1.0, dydx=3.0 * x**2 - 4.0 * x)
+
+
+class TestHermite:
+    def test_constructor_success(self, interpolator: Hermite):
+        assert interpolator is not None
+        assert isinstance(interpolator, Interpolator)
+        assert isinstance(interpolator, Hermite)
+        assert interpolator.get_interpolation_type() == Interpolator.Type.Hermite
+        assert interpolator.get_window_size() == 2
+
+    def test_constructor_failure(self):
+        with pytest.raises(RuntimeError):
+            Hermite(x=[0.0, 1.0, 2.0], y=[0.0, 1.0, 4.0], dydx=[0.0, 2.0])
+
+        with pytest.raises(RuntimeError):
+            Hermite(
+                x=[0.0, 1.0, 2.0], y=[0.0, 1.0, 4.0], dydx=[0.0, 2.0, 4.0], window_size=4
+            )
+
+    def test_getters(self, interpolator: Hermite, x: np.ndarray):
+        assert np.array_equal(interpolator.get_x_vector(), x)
+        assert np.array_equal(interpolator.get_y_vector(), x**3 - 2.0 * x**2 + 1.0)
+        assert np.array_equal(interpolator.get_derivative_vector(), 3.0 * x**2 - 4.0 * x)
+
+    def test_evaluate(self, interpolator: Hermite):
+        query = np.linspace(-1.0, 3.0, 20)
+
+        assert interpolator.evaluate(1.0) == pytest.approx(0.0)
+        assert np.allclose(interpolator.evaluate(query), query**3 - 2.0 * query**2 + 1.0)
+
+    def test_evaluate_window_size(self):
+        x = np.array([0.0, 0.4, 1.0, 1.3, 2.1, 3.0])
+
+        interpolator = Hermite(x=x, y=x**5 - x, dydx=5.0 * x**4 - 1.0, window_size=3)
+
+        query = np.linspace(0.0, 3.0, 20)
+
+        assert np.allclose(interpolator.evaluate(query), query**5 - query)
+
+    def test_compute_derivative(self, interpolator: Hermite):
+        assert interpolator.compute_derivative(2.5) == pytest.approx(8.75)
+        assert np.allclose(
+            interpolator.compute_derivative([-0.5, 1.0, 2.5]), [2.75, -1.0, 8.75]
+        )
+
+    def test_pickle(self, interpolator: Hermite):
+        unpickled_interpolator: Hermite = pickle.loads(pickle.dumps(interpolator))
+
+        assert np.array_equal(
+            unpickled_interpolator.get_x_vector(), interpolator.get_x_vector()
+        )
+        assert unpickled_interpolator.get_window_size() == interpolator.get_window_size()
+        assert unpickled_interpolator.evaluate(1.1) == interpolator.evaluate(1.1)
@@ -69,3 +69,34 @@ class TestInterpolator:
         assert interpolator is not None
         assert isinstance(interpolator, Interpolator)
         assert interpolator.get_interpolation_type() == parametrized_interpolation_type
+
+    @pytest.mark.parametrize(
+        "parametrized_interpolation_type",
+        [
+            Interpolator.Type.BarycentricRational,
+            Interpolator.Type.Hermite,
+            Interpolator.Type.Linear,
+        ],
+    )
+    def test_generate_interpolators_with_derivatives(
+        self,
+        parametrized_interpolation_type: Interpolator.Type,
+    ):
+        interpolator: Interpolator = Interpolator.generate_interpolator(
+            interpolation_type=parametrized_interpolation_type,
+            x=[0.0, 1.0, 2.0, 4.0, 5.0, 6.0],
+            y=[0.0, 3.0, 6.0, 9.0, 17.0, 5.0],
+            dydx=[3.0, 3.0, 2.0, 4.0, 0.0, -12.0],
+        )
+
+        assert interpolator is not None
+        assert isinstance(interpolator, Interpolator)
+        assert interpolator.get_interpolation_type() == parametrized_interpolation_type
+
+    def test_generate_interpolator_hermite_without_derivatives_failure(self):
+        with pytest.raises(RuntimeError):
+            Interpolator.generate_interpolator(
+                interpolation_type=Interpolator.Type.Hermite,
+                x=[0.0, 1.0, 2.0],
+                y=[0.0, 3.0, 6.0],
+            )
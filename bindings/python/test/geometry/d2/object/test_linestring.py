@@ -171,4 +171,43 @@ class TestLineString:
 
     # def test_to_string_success(self):
 
+    def test_project_point_success(self):
+        linestring: LineString = LineString(
+            [Point(0.0, 0.0), Point(2.0, 0.0), Point(2.0, 2.0)]
+        )
+
+        assert linestring.get_length() == 4.0
+        assert linestring.distance_to(Point(1.0, 1.0)) == 1.0
+        assert linestring.project_point(Point(3.0, 1.0)) == (Point(2.0, 1.0), 3.0)
+
+        assert linestring.is_indexed() is False
+
+        linestring.build_index()
+
+        assert linestring.is_indexed() is True
+        assert linestring.project_point(Point(3.0, 1.0)) == (Point(2.0, 1.0), 3.0)
+
+    def test_is_simple_success(self):
+        assert LineString(
+            [Point(0.0, 0.0), Point(1.0, 0.0), Point(1.0, 1.0), Point(0.0, 0.0)]
+        ).is_simple()
+        assert not LineString(
+            [Point(0.0, 0.0), Point(1.0, 1.0), Point(1.0, 0.0), Point(0.0, 1.0)]
+        ).is_simple()
+
+    def test_simplify_success(self):
+        linestring: LineString = LineString(
+            [Point(0.0, 0.0), Point(1.0, 0.1), Point(2.0, 0.0), Point(3.0, 1.0), Point(4.0, 0.0)]
+        )
+
+        assert linestring.simplify(0.5) == LineString(
+            [Point(0.0, 0.0), Point(2.0, 0.0), Point(3.0, 1.0), Point(4.0, 0.0)]
+        )
+        assert linestring.simplify(tolerance=0.05) == linestring
+
+        assert linestring.simplify_to(4) == linestring.simplify(0.5)
+        assert linestring.simplify_to(point_count=2) == LineString(
+            [Point(0.0, 0.0), Point(4.0, 0.0)]
+        )
+
     # def test_apply_transformation_success(self):
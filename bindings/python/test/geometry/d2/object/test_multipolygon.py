@@ -87,6 +87,44 @@ class TestMultipolygon:
         assert multipolygon.get_polygons()[0] == square_1
         assert multipolygon.get_convex_hull() == square_1
 
+    def test_union_success(
+        self,
+        square_1: Polygon,
+        square_2: Polygon,
+        square_3: Polygon,
+    ):
+        for thread_count in (1, 2):
+            multipolygon: MultiPolygon = MultiPolygon.union(
+                [square_1, square_2, square_3], thread_count
+            )
+
+            assert isinstance(multipolygon, MultiPolygon)
+            assert multipolygon.is_defined()
+            assert multipolygon.get_polygon_count() == 2
+
+        assert MultiPolygon.union([]).is_defined() is False
+
+    def test_simplify_success(
+        self,
+        square_1: Polygon,
+        square_2: Polygon,
+    ):
+        multipolygon: MultiPolygon = MultiPolygon([square_1, square_2])
+
+        for thread_count in (1, 2):
+            assert multipolygon.simplify(0.1, thread_count) == multipolygon
+            assert (
+                multipolygon.simplify(tolerance=0.1, thread_count=thread_count)
+                == multipolygon
+            )
+
+            simplified_multipolygon: MultiPolygon = multipolygon.simplify_to(
+                vertex_count=6, thread_count=thread_count
+            )
+
+            assert simplified_multipolygon.get_polygon_count() == 2
+            assert simplified_multipolygon.get_polygons()[0].get_vertex_count() == 3
+
     # def test_union_with_success (self) :
 
     # def test_to_string_success (self):
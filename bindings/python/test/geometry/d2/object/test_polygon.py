@@ -15,6 +15,7 @@ MultiPolygon = mathematics.geometry.d2.object.MultiPolygon
 LineString = mathematics.geometry.d2.object.LineString
 Segment = mathematics.geometry.d2.object.Segment
 Intersection = mathematics.geometry.d2.Intersection
+BoundingBox = mathematics.geometry.d2.BoundingBox
 
 
 class TestPolygon:
@@ -368,3 +369,35 @@ class TestPolygon:
             [Point(0.0, 0.5), Point(-0.5, 0.5), Point(-0.5, -0.5), Point(0.0, -0.5)]
         )
         assert difference_2.get_type() == Intersection.Type.Polygon
+
+    def test_clip_to(
+        self,
+        square_1: Polygon,
+        square_3: Polygon,
+    ):
+        assert square_1.clip_to(BoundingBox(Point(0.0, -1.0), Point(1.0, 1.0))) == [
+            Polygon(
+                [Point(0.0, 0.5), Point(0.5, 0.5), Point(0.5, -0.5), Point(0.0, -0.5)]
+            )
+        ]
+        assert square_1.clip_to(BoundingBox(Point(2.0, 2.0), Point(3.0, 3.0))) == []
+
+        assert square_1.clip_to(square_3) == [
+            Polygon(
+                [Point(0.0, 0.5), Point(0.5, 0.5), Point(0.5, -0.5), Point(0.0, -0.5)]
+            )
+        ]
+
+    def test_simplify(self):
+        polygon: Polygon = Polygon(
+            [Point(0.0, 0.0), Point(1.0, 0.1), Point(2.0, 0.0), Point(2.0, 2.0), Point(0.0, 2.0)]
+        )
+        square: Polygon = Polygon(
+            [Point(0.0, 0.0), Point(2.0, 0.0), Point(2.0, 2.0), Point(0.0, 2.0)]
+        )
+
+        assert polygon.simplify(0.5) == square
+        assert polygon.simplify(tolerance=0.05) == polygon
+
+        assert polygon.simplify_to(4) == square
+        assert polygon.simplify_to(vertex_count=3).get_vertex_count() == 3
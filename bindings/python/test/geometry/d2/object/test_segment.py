@@ -99,6 +99,15 @@ class TestSegment:
     ):
         assert segment.to_line() == Line(Point(0.0, 0.0), np.array((0.0, 1.0)))
 
+    def test_intersection_points_success(self):
+        assert Segment.intersection_points(
+            [
+                Segment(Point(0.0, 0.0), Point(2.0, 2.0)),
+                Segment(Point(0.0, 2.0), Point(2.0, 0.0)),
+                Segment(Point(3.0, 0.0), Point(3.0, 1.0)),
+            ]
+        ) == [(0, 1, Point(1.0, 1.0))]
+
     # def test_to_string_success (self):
 
     # def test_apply_transformation_success (self):
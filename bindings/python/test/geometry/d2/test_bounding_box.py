@@ -0,0 +1,40 @@
+# Apache License 2.0
+
+import numpy as np
+
+import ostk.mathematics as mathematics
+
+
+BoundingBox = mathematics.geometry.d2.BoundingBox
+Point = mathematics.geometry.d2.object.Point
+Segment = mathematics.geometry.d2.object.Segment
+Line = mathematics.geometry.d2.object.Line
+
+
+def test_geometry_d2_bounding_box():
+    bounding_box = BoundingBox(Point(0.0, 0.0), Point(1.0, 2.0))
+
+    assert bounding_box.is_defined()
+    assert bounding_box == BoundingBox.points([Point(1.0, 2.0), Point(0.0, 0.0)])
+    assert not BoundingBox.undefined().is_defined()
+
+    assert bounding_box.get_lower_bound() == Point(0.0, 0.0)
+    assert bounding_box.get_upper_bound() == Point(1.0, 2.0)
+    assert bounding_box.get_center() == Point(0.5, 1.0)
+    assert np.array_equal(bounding_box.get_size(), np.array((1.0, 2.0)))
+
+    assert bounding_box.contains(Point(0.5, 1.0))
+    assert not bounding_box.contains(Point(2.0, 3.0))
+    assert bounding_box.contains(BoundingBox(Point(0.5, 1.0), Point(1.0, 2.0)))
+
+    other_bounding_box = BoundingBox(Point(1.5, 2.5), Point(2.0, 3.0))
+
+    assert not bounding_box.intersects(other_bounding_box)
+    assert bounding_box.union_with(other_bounding_box) == BoundingBox(Point(0.0, 0.0), Point(2.0, 3.0))
+
+
+def test_geometry_d2_object_get_bounding_box():
+    segment = Segment(Point(1.0, 2.0), Point(0.0, 0.0))
+
+    assert segment.get_bounding_box() == BoundingBox(Point(0.0, 0.0), Point(1.0, 2.0))
+    assert not Line(Point(0.0, 0.0), np.array((0.0, 1.0))).get_bounding_box().is_defined()
@@ -73,6 +73,21 @@ def test_geometry_d2_transformation_defined():
     assert transformation.is_defined() is False
 
 
+
+def test_geometry_d2_transformation_apply_to_points():
+    points = np.asfortranarray([[0.0, 1.0, 2.0], [0.0, 0.0, 1.0]])
+
+    Transformation.translation([1.0, 2.0]).apply_to_points(points)
+
+    assert np.array_equal(points, [[1.0, 2.0, 3.0], [2.0, 2.0, 3.0]])
+
+    Transformation.translation([1.0, 2.0]).apply_to_vectors(points)
+
+    assert np.array_equal(points, [[1.0, 2.0, 3.0], [2.0, 2.0, 3.0]])
+
+    with pytest.raises(TypeError):
+        Transformation.identity().apply_to_points(np.zeros((2, 3)))
+
 # def test_geometry_d2_transformation_getters ():
 
 # def test_geometry_d2_transformation_identity ():
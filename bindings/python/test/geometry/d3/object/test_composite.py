@@ -144,6 +144,19 @@ class Test3DComposite:
         assert composite.is_defined()
         assert composite.is_empty()
 
+    def test_geometry_d3_object_composite_build_index(self):
+        composite: Composite = Composite(Sphere(Point(0.0, 0.0, 0.0), 1.0)) + Composite(
+            Sphere(Point(4.0, 0.0, 0.0), 1.0)
+        )
+
+        assert not composite.is_indexed()
+
+        composite.build_index()
+
+        assert composite.is_indexed()
+        assert composite.intersects(Ray(Point(4.0, -5.0, 0.0), np.array([0.0, 1.0, 0.0])))
+        assert not composite.intersects(Ray(Point(2.0, -5.0, 0.0), np.array([0.0, 1.0, 0.0])))
+
     def test_geometry_d3_object_composite_comparators(self):
         point_1: Point = Point(1.0, 2.0, 1.0)
         point_2: Point = Point(1.0, 1.0, 1.0)
@@ -15,6 +15,39 @@ Polygon3d = mathematics.geometry.d3.object.Polygon
 Object3d = mathematics.geometry.d3.Object
 Polygon2d = mathematics.geometry.d2.object.Polygon
 Transformation = mathematics.geometry.d3.Transformation
+Cuboid = mathematics.geometry.d3.object.Cuboid
+Sphere = mathematics.geometry.d3.object.Sphere
 
 
 # def test_geometry_d3_object_cuboid ():
+
+
+class TestCuboid:
+    def test_intersecting_pairs_cuboid_success(self):
+        first_cuboids = [
+            Cuboid.cube(Point3d(0.0, 0.0, 0.0), 1.0),
+            Cuboid.cube(Point3d(10.0, 0.0, 0.0), 1.0),
+        ]
+        second_cuboids = [
+            Cuboid.cube(Point3d(1.5, 0.0, 0.0), 1.0),
+            Cuboid.cube(Point3d(5.0, 0.0, 0.0), 1.0),
+            Cuboid.cube(Point3d(10.5, 0.5, 0.5), 1.0),
+        ]
+
+        assert Cuboid.intersecting_pairs(first_cuboids, second_cuboids) == [
+            (0, 0),
+            (1, 2),
+        ]
+        assert Cuboid.intersecting_pairs(
+            first_cuboids, second_cuboids, thread_count=2
+        ) == [(0, 0), (1, 2)]
+        assert Cuboid.intersecting_pairs([], second_cuboids) == []
+
+    def test_intersecting_pairs_sphere_success(self):
+        cuboids = [Cuboid.cube(Point3d(0.0, 0.0, 0.0), 1.0)]
+        spheres = [
+            Sphere(Point3d(0.0, 0.0, 2.0), 1.5),
+            Sphere(Point3d(0.0, 0.0, 5.0), 1.5),
+        ]
+
+        assert Cuboid.intersecting_pairs(spheres, cuboids) == [(0, 0)]
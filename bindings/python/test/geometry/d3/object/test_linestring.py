@@ -165,4 +165,46 @@ class TestLineString:
         assert isinstance(iter(linestring), Iterator)
         assert isinstance(iter(linestring), Iterable)
 
+    def test_project_point_success(self):
+        linestring: LineString = LineString(
+            [Point(0.0, 0.0, 0.0), Point(2.0, 0.0, 0.0), Point(2.0, 2.0, 0.0)]
+        )
+
+        assert linestring.get_length() == 4.0
+        assert linestring.distance_to(Point(1.0, 1.0, 0.0)) == 1.0
+        assert linestring.project_point(Point(3.0, 1.0, 0.0)) == (Point(2.0, 1.0, 0.0), 3.0)
+
+        assert linestring.is_indexed() is False
+
+        linestring.build_index()
+
+        assert linestring.is_indexed() is True
+        assert linestring.project_point(Point(3.0, 1.0, 0.0)) == (Point(2.0, 1.0, 0.0), 3.0)
+
+    def test_simplify_success(self):
+        linestring: LineString = LineString(
+            [
+                Point(0.0, 0.0, 0.0),
+                Point(1.0, 0.1, 0.0),
+                Point(2.0, 0.0, 0.0),
+                Point(3.0, 1.0, 0.0),
+                Point(4.0, 0.0, 0.0),
+            ]
+        )
+
+        assert linestring.simplify(0.5) == LineString(
+            [
+                Point(0.0, 0.0, 0.0),
+                Point(2.0, 0.0, 0.0),
+                Point(3.0, 1.0, 0.0),
+                Point(4.0, 0.0, 0.0),
+            ]
+        )
+        assert linestring.simplify(tolerance=0.05) == linestring
+
+        assert linestring.simplify_to(4) == linestring.simplify(0.5)
+        assert linestring.simplify_to(point_count=2) == LineString(
+            [Point(0.0, 0.0, 0.0), Point(4.0, 0.0, 0.0)]
+        )
+
     # def test_apply_transformation_success(self):
@@ -0,0 +1,81 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.geometry.d3 import Object
+from ostk.mathematics.geometry.d3 import Transformation
+from ostk.mathematics.geometry.d3.object import Point
+from ostk.mathematics.geometry.d3.object import PointCloud
+
+
+@pytest.fixture
+def point_cloud() -> PointCloud:
+    return PointCloud(
+        [
+            Point(0.0, 0.0, 0.0),
+            Point(0.0, 0.0, 1.0),
+            Point(0.0, 0.0, 2.0),
+        ]
+    )
+
+
+class TestPointCloud:
+    def test_constructor_success(self, point_cloud: PointCloud):
+        assert isinstance(point_cloud, PointCloud)
+        assert isinstance(point_cloud, Object)
+        assert point_cloud.is_defined()
+        assert point_cloud.get_size() == 3
+        assert len(point_cloud) == 3
+
+    def test_empty_success(self):
+        point_cloud: PointCloud = PointCloud.empty()
+
+        assert point_cloud.is_defined() is False
+        assert point_cloud.is_empty()
+
+    def test_matrix_success(self):
+        points: np.ndarray = np.array([[0.0, 0.0, 0.0], [1.0, 2.0, 3.0]])
+
+        point_cloud: PointCloud = PointCloud.matrix(points)
+
+        assert point_cloud == PointCloud([Point(0.0, 0.0, 0.0), Point(1.0, 2.0, 3.0)])
+        assert np.array_equal(point_cloud.get_points(), points)
+        assert point_cloud[1] == Point(1.0, 2.0, 3.0)
+
+        with pytest.raises(IndexError):
+            point_cloud[2]
+
+    def test_find_nearest_neighbor_success(self, point_cloud: PointCloud):
+        assert point_cloud.find_nearest_neighbor(Point(0.0, 0.0, 10.0)) == 2
+        assert point_cloud.find_nearest_neighbor(
+            np.array([[0.0, 0.0, -1.0], [0.0, 1.0, 1.1]]), thread_count=2
+        ) == [0, 1]
+
+    def test_find_nearest_neighbors_success(self, point_cloud: PointCloud):
+        assert point_cloud.find_nearest_neighbors(Point(0.0, 0.0, 3.0), 2) == [2, 1]
+        assert point_cloud.find_nearest_neighbors(
+            np.array([[0.0, 0.0, -1.0]]), 2
+        ) == [[0, 1]]
+
+    def test_find_neighbors_within_radius_success(self, point_cloud: PointCloud):
+        assert point_cloud.find_neighbors_within_radius(Point(0.0, 0.0, 0.9), 1.5) == [
+            1,
+            0,
+            2,
+        ]
+        assert point_cloud.find_neighbors_within_radius(
+            np.array([[0.0, 0.0, 2.0], [5.0, 0.0, 0.0]]), 1.0
+        ) == [[2, 1], []]
+
+    def test_distance_to_success(self, point_cloud: PointCloud):
+        assert point_cloud.distance_to(Point(0.0, 0.0, 3.0)) == 1.0
+        assert point_cloud.get_point_closest_to(Point(0.0, 0.0, 3.0)) == Point(
+            0.0, 0.0, 2.0
+        )
+
+    def test_apply_transformation_success(self, point_cloud: PointCloud):
+        point_cloud.apply_transformation(Transformation.identity())
+
+        assert point_cloud.get_point_at(2) == Point(0.0, 0.0, 2.0)
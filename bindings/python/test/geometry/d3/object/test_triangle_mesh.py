@@ -0,0 +1,119 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.geometry.d3 import Object
+from ostk.mathematics.geometry.d3 import Transformation
+from ostk.mathematics.geometry.d3.object import Point
+from ostk.mathematics.geometry.d3.object import Ray
+from ostk.mathematics.geometry.d3.object import TriangleMesh
+
+
+@pytest.fixture
+def vertices() -> np.ndarray:
+    return np.array(
+        [
+            [-1.0, -1.0, 0.0],
+            [1.0, -1.0, 0.0],
+            [1.0, 1.0, 0.0],
+            [-1.0, 1.0, 0.0],
+        ]
+    )
+
+
+@pytest.fixture
+def triangles() -> np.ndarray:
+    return np.array([[0, 1, 2], [0, 2, 3]], dtype=np.int32)
+
+
+@pytest.fixture
+def triangle_mesh(vertices: np.ndarray, triangles: np.ndarray) -> TriangleMesh:
+    return TriangleMesh(vertices, triangles)
+
+
+class TestTriangleMesh:
+    def test_constructor_success(self, triangle_mesh: TriangleMesh):
+        assert isinstance(triangle_mesh, TriangleMesh)
+        assert isinstance(triangle_mesh, Object)
+        assert triangle_mesh.is_defined()
+        assert triangle_mesh.get_vertex_count() == 4
+        assert triangle_mesh.get_triangle_count() == 2
+
+    def test_undefined_success(self):
+        assert TriangleMesh.undefined().is_defined() is False
+
+    def test_getters_success(
+        self,
+        triangle_mesh: TriangleMesh,
+        vertices: np.ndarray,
+        triangles: np.ndarray,
+    ):
+        assert np.array_equal(triangle_mesh.get_vertices(), vertices)
+        assert np.array_equal(triangle_mesh.get_triangles(), triangles)
+
+    def test_cast_ray_success(self, triangle_mesh: TriangleMesh):
+        triangle_index, distance, point = triangle_mesh.cast_ray(
+            Ray(Point(0.5, -0.5, 2.0), np.array([0.0, 0.0, -1.0]))
+        )
+
+        assert triangle_index == 0
+        assert distance == pytest.approx(2.0)
+        assert point.is_near(Point(0.5, -0.5, 0.0), 1e-12)
+
+        triangle_index, distance, point = triangle_mesh.cast_ray(
+            Ray(Point(5.0, 0.0, 2.0), np.array([0.0, 0.0, -1.0]))
+        )
+
+        assert triangle_index == 2
+        assert distance.is_defined() is False
+        assert point.is_defined() is False
+
+    def test_cast_rays_success(self, triangle_mesh: TriangleMesh):
+        hits = triangle_mesh.cast_rays(
+            np.array([[-0.5, 0.5, 2.0], [5.0, 0.0, 2.0]]),
+            np.array([[0.0, 0.0, -2.0], [0.0, 0.0, -1.0]]),
+            thread_count=2,
+        )
+
+        assert len(hits) == 2
+        assert hits[0][0] == 1
+        assert hits[0][1] == pytest.approx(2.0)
+        assert hits[1][0] == 2
+
+    def test_intersects_success(self, triangle_mesh: TriangleMesh):
+        assert triangle_mesh.intersects(
+            Ray(Point(0.0, 0.0, -2.0), np.array([0.0, 0.0, 1.0]))
+        )
+        assert (
+            triangle_mesh.intersects(Ray(Point(0.0, 0.0, 2.0), np.array([0.0, 0.0, 1.0])))
+            is False
+        )
+        assert triangle_mesh.intersects(
+            np.array([[0.0, 0.0, 2.0], [0.0, 0.0, 2.0]]),
+            np.array([[0.0, 0.0, -1.0], [0.0, 0.0, 1.0]]),
+        ) == [True, False]
+
+    def test_intersection_with_success(self, triangle_mesh: TriangleMesh):
+        intersection = triangle_mesh.intersection_with(
+            Ray(Point(0.5, 0.5, 2.0), np.array([0.0, 0.0, -1.0]))
+        )
+
+        assert intersection.is_point()
+        assert intersection.as_point().is_near(Point(0.5, 0.5, 0.0), 1e-12)
+
+    def test_object_success(self, triangle_mesh: TriangleMesh):
+        object: Object = triangle_mesh
+
+        assert object.is_triangle_mesh()
+        assert object.as_triangle_mesh() == triangle_mesh
+
+    def test_apply_transformation_success(self, triangle_mesh: TriangleMesh):
+        triangle_mesh.apply_transformation(Transformation.translation([0.0, 0.0, 1.0]))
+
+        _, distance, _ = triangle_mesh.cast_ray(
+            Ray(Point(0.5, -0.5, 2.0), np.array([0.0, 0.0, -1.0]))
+        )
+
+        assert distance == pytest.approx(1.0)
@@ -1,3 +1,20 @@
 # Apache License 2.0
 
+import numpy as np
+
 import ostk.mathematics as mathematics
+
+
+Transformation = mathematics.geometry.d3.Transformation
+
+
+def test_geometry_d3_transformation_apply_to_points():
+    points = np.asfortranarray([[0.0, 1.0], [0.0, 0.0], [0.0, 1.0]])
+
+    Transformation.translation([1.0, 2.0, 3.0]).apply_to_points(points)
+
+    assert np.array_equal(points, [[1.0, 2.0], [2.0, 2.0], [3.0, 4.0]])
+
+    Transformation.translation([1.0, 2.0, 3.0]).apply_to_vectors(points)
+
+    assert np.array_equal(points, [[1.0, 2.0], [2.0, 2.0], [3.0, 4.0]])
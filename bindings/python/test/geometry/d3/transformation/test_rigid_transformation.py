@@ -0,0 +1,66 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.geometry import Angle
+from ostk.mathematics.geometry.d3 import Transformation
+from ostk.mathematics.geometry.d3.object import Point
+from ostk.mathematics.geometry.d3.transformation import RigidTransformation
+from ostk.mathematics.geometry.d3.transformation.rotation import Quaternion
+from ostk.mathematics.geometry.d3.transformation.rotation import RotationVector
+
+
+@pytest.fixture
+def rigid_transformation() -> RigidTransformation:
+    return RigidTransformation(
+        Quaternion.rotation_vector(
+            RotationVector(np.array([0.0, 0.0, 1.0]), Angle.degrees(90.0))
+        ),
+        np.array([1.0, 2.0, 3.0]),
+    )
+
+
+class TestRigidTransformation:
+    def test_constructor_success(self, rigid_transformation: RigidTransformation):
+        assert isinstance(rigid_transformation, RigidTransformation)
+        assert rigid_transformation.is_defined()
+        assert RigidTransformation.undefined().is_defined() is False
+
+    def test_composition_success(self, rigid_transformation: RigidTransformation):
+        assert (rigid_transformation * rigid_transformation.get_inverse()).is_near(
+            RigidTransformation.identity(), Angle.radians(1e-12), 1e-12
+        )
+
+    def test_apply_to_success(self, rigid_transformation: RigidTransformation):
+        point: Point = Point(1.0, 0.0, 0.0)
+
+        assert rigid_transformation.apply_to(point).is_near(
+            rigid_transformation.to_transformation().apply_to(point), 1e-12
+        )
+
+        points: np.ndarray = np.asfortranarray([[1.0], [0.0], [0.0]])
+
+        rigid_transformation.apply_to_points(points)
+
+        assert np.allclose(
+            points[:, 0], rigid_transformation.apply_to(point).as_vector(), atol=1e-12
+        )
+
+    def test_transformation_success(self, rigid_transformation: RigidTransformation):
+        assert RigidTransformation.transformation(
+            rigid_transformation.to_transformation()
+        ).is_near(rigid_transformation, Angle.radians(1e-12), 1e-12)
+
+        assert (
+            RigidTransformation.transformation(Transformation.identity())
+            == RigidTransformation.identity()
+        )
+
+    def test_interpolate_success(self, rigid_transformation: RigidTransformation):
+        halfway: RigidTransformation = RigidTransformation.interpolate(
+            RigidTransformation.identity(), rigid_transformation, 0.5
+        )
+
+        assert np.allclose(halfway.get_translation(), [0.5, 1.0, 1.5])
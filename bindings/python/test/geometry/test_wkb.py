@@ -0,0 +1,125 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.core.filesystem import File
+from ostk.core.filesystem import Path
+
+from ostk.mathematics.geometry import WKB
+from ostk.mathematics.geometry.d2.object import Point as Point2d
+from ostk.mathematics.geometry.d2.object import PointSet as PointSet2d
+from ostk.mathematics.geometry.d2.object import LineString as LineString2d
+from ostk.mathematics.geometry.d2.object import Polygon as Polygon2d
+from ostk.mathematics.geometry.d2.object import MultiPolygon as MultiPolygon2d
+from ostk.mathematics.geometry.d3.object import Point as Point3d
+from ostk.mathematics.geometry.d3.object import LineString as LineString3d
+
+
+@pytest.fixture
+def polygon() -> Polygon2d:
+    return Polygon2d(
+        [Point2d(0.0, 0.0), Point2d(10.0, 0.0), Point2d(10.0, 10.0), Point2d(0.0, 10.0)],
+        [[Point2d(1.0, 1.0), Point2d(2.0, 1.0), Point2d(2.0, 2.0), Point2d(1.0, 2.0)]],
+    )
+
+
+@pytest.fixture
+def line_string_3d() -> LineString3d:
+    return LineString3d(
+        [Point3d(0.0, 0.0, 0.0), Point3d(1.0, 0.0, 1.0), Point3d(1.0, 1.0, 2.0)]
+    )
+
+
+class TestWKB:
+    def test_encode_success(self):
+        assert WKB.encode(Point2d(1.0, 2.0)) == bytes(
+            [1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 0, 64]
+        )
+        assert WKB.encode(Point2d(1.0, 2.0), WKB.ByteOrder.BigEndian) == bytes(
+            [0, 0, 0, 0, 1, 63, 240, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0]
+        )
+
+    @pytest.mark.parametrize(
+        "byte_order", [WKB.ByteOrder.LittleEndian, WKB.ByteOrder.BigEndian]
+    )
+    def test_decode_success(
+        self,
+        byte_order: WKB.ByteOrder,
+        polygon: Polygon2d,
+        line_string_3d: LineString3d,
+    ):
+        point_set: PointSet2d = PointSet2d([Point2d(1.0, 2.0), Point2d(3.0, 4.0)])
+        line_string: LineString2d = LineString2d(
+            [Point2d(0.0, 0.0), Point2d(1.0, 0.0), Point2d(1.0, 1.0)]
+        )
+        multi_polygon: MultiPolygon2d = MultiPolygon2d([polygon])
+
+        assert (
+            WKB.Reader(WKB.encode(point_set, byte_order)).read_point_set_2d() == point_set
+        )
+        assert (
+            WKB.Reader(WKB.encode(line_string, byte_order)).read_line_string_2d()
+            == line_string
+        )
+        assert WKB.Reader(WKB.encode(polygon, byte_order)).read_polygon_2d() == polygon
+        assert (
+            WKB.Reader(WKB.encode(multi_polygon, byte_order)).read_multi_polygon_2d()
+            == multi_polygon
+        )
+        assert (
+            WKB.Reader(WKB.encode(line_string_3d, byte_order)).read_line_string_3d()
+            == line_string_3d
+        )
+
+    def test_decode_failure(self):
+        with pytest.raises(RuntimeError):
+            WKB.Reader(WKB.encode(Point2d(1.0, 2.0))).read_line_string_2d()
+
+        with pytest.raises(RuntimeError):
+            WKB.Reader(WKB.encode(Point2d(1.0, 2.0))[:-1]).read_point_2d()
+
+    def test_writer_reader_success(
+        self, polygon: Polygon2d, line_string_3d: LineString3d
+    ):
+        writer: WKB.Writer = WKB.Writer()
+
+        writer.write(polygon)
+        writer.write(line_string_3d)
+        writer.write(Point2d(1.0, 2.0))
+
+        reader: WKB.Reader = WKB.Reader(writer.get_buffer())
+
+        assert reader.get_byte_count() == len(writer.get_buffer())
+        assert reader.get_next_type() == WKB.Type.Polygon
+        assert reader.get_next_dimension() == 2
+
+        reader.skip()
+
+        assert reader.get_next_type() == WKB.Type.LineString
+        assert reader.get_next_dimension() == 3
+        assert reader.read_line_string_3d() == line_string_3d
+        assert reader.read_point_2d() == Point2d(1.0, 2.0)
+        assert reader.is_end()
+
+        reader.rewind()
+
+        assert reader.get_offset() == 0
+        assert reader.read_polygon_2d() == polygon
+
+        writer.clear()
+
+        assert writer.get_buffer() == b""
+
+    def test_reader_map_success(self, tmp_path, polygon: Polygon2d):
+        file_path = tmp_path / "polygons.wkb"
+        file_path.write_bytes(WKB.encode(polygon) + WKB.encode(polygon))
+
+        reader: WKB.Reader = WKB.Reader.map(File.path(Path.parse(str(file_path))))
+
+        assert reader.read_polygon_2d() == polygon
+        assert reader.read_polygon_2d() == polygon
+        assert reader.is_end()
+
+    def test_string_from_type_success(self):
+        assert WKB.string_from_type(WKB.Type.Polygon) == "Polygon"
+        assert WKB.string_from_type(WKB.Type.MultiPoint) == "MultiPoint"
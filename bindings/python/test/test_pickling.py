@@ -0,0 +1,109 @@
+# Apache License 2.0
+
+import pickle
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.curve_fitting.interpolator import Linear
+from ostk.mathematics.geometry import Angle
+from ostk.mathematics.geometry.d2.object import Point as Point2d
+from ostk.mathematics.geometry.d2.object import Polygon as Polygon2d
+from ostk.mathematics.geometry.d3.object import Point as Point3d
+from ostk.mathematics.geometry.d3.transformation.rotation import EulerAngle
+from ostk.mathematics.geometry.d3.transformation.rotation import Quaternion
+from ostk.mathematics.geometry.d3.transformation.rotation import RotationMatrix
+from ostk.mathematics.geometry.d3.transformation.rotation import RotationVector
+from ostk.mathematics.object import RealInterval
+
+
+def round_trip(value):
+    return pickle.loads(pickle.dumps(value))
+
+
+class TestPickling:
+    def test_geometry_success(self):
+        polygon = Polygon2d(
+            [
+                Point2d(0.0, 0.0),
+                Point2d(10.0, 0.0),
+                Point2d(10.0, 10.0),
+                Point2d(0.0, 10.0),
+            ],
+            [
+                [
+                    Point2d(1.0, 1.0),
+                    Point2d(2.0, 1.0),
+                    Point2d(2.0, 2.0),
+                    Point2d(1.0, 2.0),
+                ]
+            ],
+        )
+
+        assert round_trip(Point2d(1.0, 2.0)) == Point2d(1.0, 2.0)
+        assert round_trip(Point3d(1.0, 2.0, 3.0)) == Point3d(1.0, 2.0, 3.0)
+        assert round_trip(polygon) == polygon
+
+    def test_rotation_success(self):
+        quaternion = Quaternion(0.0, 0.0, 0.0, 1.0, Quaternion.Format.XYZS)
+        rotation_matrix = RotationMatrix.rx(Angle.degrees(30.0))
+        rotation_vector = RotationVector([0.0, 0.0, 1.0], Angle.degrees(45.0))
+        euler_angle = EulerAngle(
+            Angle.degrees(10.0),
+            Angle.degrees(20.0),
+            Angle.degrees(30.0),
+            EulerAngle.AxisSequence.ZYX,
+        )
+
+        assert round_trip(quaternion) == quaternion
+        assert round_trip(rotation_matrix) == rotation_matrix
+        assert round_trip(rotation_vector) == rotation_vector
+        assert round_trip(euler_angle) == euler_angle
+
+        assert not round_trip(Quaternion.undefined()).is_defined()
+
+    def test_angle_success(self):
+        assert round_trip(Angle.degrees(45.0)) == Angle.degrees(45.0)
+        assert round_trip(Angle.degrees(45.0)).get_unit() == Angle.Unit.Degree
+        assert not round_trip(Angle.undefined()).is_defined()
+
+    def test_interval_success(self):
+        interval = RealInterval(-1.0, 2.0, RealInterval.Type.HalfOpenLeft)
+
+        assert round_trip(interval) == interval
+        assert not round_trip(RealInterval.undefined()).is_defined()
+
+    def test_interpolator_success(self):
+        interpolator = Linear([0.0, 1.0, 2.0], [0.0, 3.0, 5.0])
+
+        unpickled_interpolator = round_trip(interpolator)
+
+        assert np.array_equal(unpickled_interpolator.get_x_vector(), [0.0, 1.0, 2.0])
+        assert np.array_equal(unpickled_interpolator.get_y_vector(), [0.0, 3.0, 5.0])
+        assert unpickled_interpolator.evaluate(1.5) == pytest.approx(4.0)
+
+    def test_invalid_state_failure(self):
+        with pytest.raises(RuntimeError):
+            Quaternion.__new__(Quaternion).__setstate__(b"\x00")
+
+
+class TestNumPy:
+    def test_array_success(self):
+        assert np.array_equal(np.asarray(Point2d(1.0, 2.0)), [1.0, 2.0])
+        assert np.array_equal(np.asarray(Point3d(1.0, 2.0, 3.0)), [1.0, 2.0, 3.0])
+        assert np.array_equal(
+            np.asarray(Quaternion(0.0, 0.0, 0.0, 1.0, Quaternion.Format.XYZS)),
+            [0.0, 0.0, 0.0, 1.0],
+        )
+        assert np.asarray(Point2d(1.0, 2.0), dtype=np.float32).dtype == np.float32
+
+    def test_buffer_success(self):
+        rotation_matrix = RotationMatrix.rx(Angle.degrees(30.0))
+
+        array = np.asarray(rotation_matrix)
+
+        assert array.shape == (3, 3)
+        assert not array.flags.writeable
+        assert np.array_equal(array, rotation_matrix.get_matrix())
+        assert memoryview(rotation_matrix).readonly
@@ -39,6 +39,7 @@ class Interpolator
     {
         BarycentricRational,
         CubicSpline,
+        Hermite,
         Linear,
         ZeroOrder
     };
@@ -122,6 +123,24 @@ class Interpolator
         const Type& aType, const VectorXd& anXVector, const VectorXd& aYVector
     );
 
+    /// @brief Generate an interpolator using derivative values
+    ///
+    /// Derivative values are used by interpolators that support them (Hermite) and ignored by the others.
+    ///
+    /// @code{.cpp}
+    ///                     auto interpolator =
+    ///                         Interpolator::GenerateInterpolator(Interpolator::Type::Hermite, x, y, dydx);
+    /// @endcode
+    ///
+    /// @param aType Interpolation type
+    /// @param anXVector A vector of x values
+    /// @param aYVector A vector of y values
+    /// @param aDerivativeVector A vector of dy/dx values
+    /// @return Shared pointer to correct Interpolator
+    static const Shared<const Interpolator> GenerateInterpolator(
+        const Type& aType, const VectorXd& anXVector, const VectorXd& aYVector, const VectorXd& aDerivativeVector
+    );
+
    private:
     const Type type_;
 };
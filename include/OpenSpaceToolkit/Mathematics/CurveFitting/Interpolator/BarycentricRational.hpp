@@ -63,6 +63,24 @@ class BarycentricRational : public Interpolator
     /// @endcode
     virtual ~BarycentricRational() override;
 
+    /// @brief Get x values
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd x = barycentricRational.getXVector() ;
+    /// @endcode
+    ///
+    /// @return Vector of x values
+    VectorXd getXVector() const;
+
+    /// @brief Get y values
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd y = barycentricRational.getYVector() ;
+    /// @endcode
+    ///
+    /// @return Vector of y values
+    VectorXd getYVector() const;
+
     /// @brief Evaluate the spline
     ///
     /// @code{.cpp}
@@ -105,6 +123,8 @@ class BarycentricRational : public Interpolator
 
    private:
     barycentric_rational<double> interpolator_;
+    VectorXd x_;
+    VectorXd y_;
 };
 
 }  // namespace interpolator
@@ -79,6 +79,24 @@ class CubicSpline : public Interpolator
     /// @endcode
     virtual ~CubicSpline() override;
 
+    /// @brief Get x values
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd x = cubicSpline.getXVector() ;
+    /// @endcode
+    ///
+    /// @return Vector of x values
+    VectorXd getXVector() const;
+
+    /// @brief Get y values
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd y = cubicSpline.getYVector() ;
+    /// @endcode
+    ///
+    /// @return Vector of y values
+    VectorXd getYVector() const;
+
     /// @brief Evaluate the cubic spline interpolator
     ///
     /// @code{.cpp}
@@ -121,6 +139,8 @@ class CubicSpline : public Interpolator
 
    private:
     cardinal_cubic_b_spline<double> interpolator_;
+    VectorXd x_;
+    VectorXd y_;
 };
 
 }  // namespace interpolator
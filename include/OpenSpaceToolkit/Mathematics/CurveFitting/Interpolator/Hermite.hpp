@@ -0,0 +1,170 @@
+/// Apache License 2.0
+#ifndef __OpenSpaceToolkit_Mathematics_Interpolator_Hermite__
+#define __OpenSpaceToolkit_Mathematics_Interpolator_Hermite__
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+namespace interpolator
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+/// @brief                      Hermite
+///
+///                             Hermite interpolation matches both the values and the first derivatives of a function
+///                             at a set of (possibly non-uniformly spaced) nodes. Each query is evaluated with the
+///                             Lagrange-Hermite polynomial of degree 2n - 1 built on a window of n consecutive nodes
+///                             around the query. With the default window of 2 nodes, this reduces to the classic
+///                             piecewise cubic Hermite interpolator, which is continuous up to the first derivative.
+///
+///                             Typical use is the interpolation of state histories (positions and velocities), where
+///                             using the derivative samples allows for a much coarser sampling at equal accuracy.
+///
+/// @code{.cpp}
+///                             VectorXd x = {{0.0, 1.0, 2.0, 3.0}};
+///                             VectorXd y = {{0.0, 1.0, 4.0, 9.0}};
+///                             VectorXd dydx = {{0.0, 2.0, 4.0, 6.0}};
+///                             Hermite interpolator(x, y, dydx);
+///                             double value = interpolator.evaluate(1.5);
+/// @endcode
+///
+/// @ref https://en.wikipedia.org/wiki/Hermite_interpolation
+class Hermite : public Interpolator
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///                     Hermite hermite(x, y, dydx);
+    ///                     Hermite hermite(x, y, dydx, 4);  // Degree 7 polynomial on a window of 4 nodes
+    /// @endcode
+    ///
+    /// @param anXVector A vector of x values
+    /// @param aYVector A vector of y values
+    /// @param aDerivativeVector A vector of dy/dx values
+    /// @param aWindowSize Number of nodes used for each evaluation (defaults to 2: piecewise cubic)
+    ///
+    /// @warning The x values must be sorted in strictly ascending order
+    Hermite(
+        const VectorXd& anXVector,
+        const VectorXd& aYVector,
+        const VectorXd& aDerivativeVector,
+        const Size& aWindowSize = 2
+    );
+
+    /// @brief Destructor
+    ///
+    /// @code{.cpp}
+    ///                     // Called automatically when the Hermite interpolator goes out of scope
+    /// @endcode
+    virtual ~Hermite() override;
+
+    /// @brief Get x values
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd x = hermite.getXVector() ;
+    /// @endcode
+    ///
+    /// @return Vector of x values
+    VectorXd getXVector() const;
+
+    /// @brief Get y values
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd y = hermite.getYVector() ;
+    /// @endcode
+    ///
+    /// @return Vector of y values
+    VectorXd getYVector() const;
+
+    /// @brief Get dy/dx values
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd dydx = hermite.getDerivativeVector() ;
+    /// @endcode
+    ///
+    /// @return Vector of dy/dx values
+    VectorXd getDerivativeVector() const;
+
+    /// @brief Get window size
+    ///
+    /// @code{.cpp}
+    ///                     Size windowSize = hermite.getWindowSize() ;
+    /// @endcode
+    ///
+    /// @return Number of nodes used for each evaluation
+    Size getWindowSize() const;
+
+    /// @brief Evaluate the Hermite interpolator
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd values = hermite.evaluate({1.0, 5.0, 6.0}) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @return Vector of y values
+    virtual VectorXd evaluate(const VectorXd& aQueryVector) const override;
+
+    /// @brief Evaluate the Hermite interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double value = hermite.evaluate(5.0) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @return y value
+    virtual double evaluate(const double& aQueryValue) const override;
+
+    /// @brief Get the derivative of the Hermite interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double derivative = hermite.computeDerivative(5.0) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @return Derivative of the interpolator at the given x value
+    virtual double computeDerivative(const double& aQueryValue) const override;
+
+    /// @brief Get the derivative of the Hermite interpolator
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd derivatives = hermite.computeDerivative({1.0, 5.0, 6.0}) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @return Vector of derivatives of the interpolator at the given x values
+    virtual VectorXd computeDerivative(const VectorXd& aQueryVector) const override;
+
+   private:
+    VectorXd x_;
+    VectorXd y_;
+    VectorXd dydx_;
+    Size windowSize_;
+
+    /// Newton coefficients (over doubled nodes) of the polynomial of each window, one column per window
+    MatrixXd coefficients_;
+
+    Index findWindowIndex(const double& aQueryValue) const;
+};
+
+}  // namespace interpolator
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
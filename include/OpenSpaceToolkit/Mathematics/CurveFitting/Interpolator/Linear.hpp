@@ -64,6 +64,24 @@ class Linear : public Interpolator
     /// @endcode
     virtual ~Linear() override;
 
+    /// @brief Get x values
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd x = linear.getXVector() ;
+    /// @endcode
+    ///
+    /// @return Vector of x values
+    VectorXd getXVector() const;
+
+    /// @brief Get y values
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd y = linear.getYVector() ;
+    /// @endcode
+    ///
+    /// @return Vector of y values
+    VectorXd getYVector() const;
+
     /// @brief Evaluate the linear interpolator
     ///
     /// @code{.cpp}
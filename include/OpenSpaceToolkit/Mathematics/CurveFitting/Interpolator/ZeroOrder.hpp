@@ -61,6 +61,24 @@ class ZeroOrder : public Interpolator
     /// @endcode
     virtual ~ZeroOrder() override;
 
+    /// @brief Get x values
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd x = zeroOrder.getXVector() ;
+    /// @endcode
+    ///
+    /// @return Vector of x values
+    VectorXd getXVector() const;
+
+    /// @brief Get y values
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd y = zeroOrder.getYVector() ;
+    /// @endcode
+    ///
+    /// @return Vector of y values
+    VectorXd getYVector() const;
+
     /// @brief Evaluate the zero-order hold interpolator
     ///
     /// @code{.cpp}
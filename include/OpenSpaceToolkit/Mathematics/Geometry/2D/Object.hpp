@@ -16,6 +16,7 @@ namespace d2
 
 class Transformation;
 class Intersection;
+class BoundingBox;
 
 using ostk::core::type::Integer;
 using ostk::core::type::String;
@@ -100,6 +101,17 @@ class Object
     /// @return             True if object is defined
     virtual bool isDefined() const = 0;
 
+    /// @brief              Get axis-aligned bounding box of object
+    ///
+    ///                     Undefined for unbounded objects (e.g. lines).
+    ///
+    /// @code{.cpp}
+    ///                     BoundingBox boundingBox = Segment({ 0.0, 0.0 }, { 1.0, 2.0 }).getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const;
+
     /// @brief              Check if object intersects another object
     ///
     /// @code
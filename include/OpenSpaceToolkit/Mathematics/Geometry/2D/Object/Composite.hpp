@@ -149,6 +149,18 @@ class Composite : public Object
     /// @return             True if composite is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of composite
+    ///
+    ///                     Union of the object bounding boxes, undefined if any object is unbounded or if the
+    ///                     composite is empty.
+    ///
+    /// @code{.cpp}
+    ///                     Composite(...).getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if composite is empty
     ///
     /// @code
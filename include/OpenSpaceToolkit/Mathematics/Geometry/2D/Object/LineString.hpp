@@ -3,9 +3,11 @@
 #define __OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString__
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Point.hpp>
 
@@ -21,9 +23,11 @@ namespace object
 {
 
 using ostk::core::container::Array;
+using ostk::core::container::Pair;
 using ostk::core::type::Index;
 using ostk::core::type::Size;
 
+using ostk::mathematics::geometry::d2::BoundingBox;
 using ostk::mathematics::geometry::d2::Object;
 using ostk::mathematics::geometry::d2::object::Point;
 using ostk::mathematics::object::Vector2d;
@@ -43,6 +47,7 @@ class LineString : public Object
 {
    public:
     typedef Array<Point>::ConstIterator ConstIterator;
+    typedef Pair<Point, Real> Projection;  // Closest point on the line string, and its arc length from the first point
 
     /// @brief              Constructor
     ///
@@ -93,6 +98,17 @@ class LineString : public Object
     /// @return             True if line string is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of line string
+    ///
+    ///                     Computed upon construction and transformation.
+    ///
+    /// @code{.cpp}
+    ///                     LineString({ { 0.0, 0.0 }, { 1.0, 2.0 } }).getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if line string is empty
     ///
     /// @code
@@ -102,6 +118,28 @@ class LineString : public Object
     /// @return             True if line string is empty
     bool isEmpty() const;
 
+    /// @brief              Check if line string holds a segment index
+    ///
+    /// @code{.cpp}
+    ///                     LineString(...).isIndexed() ;
+    /// @endcode
+    ///
+    /// @return             True if line string holds a segment index
+    bool isIndexed() const;
+
+    /// @brief              Check if line string is simple, i.e. does not intersect itself
+    ///
+    ///                     Consecutive segments may only share their common vertex, and the first and last
+    ///                     segments of a closed line string their common end point. Repeated points are
+    ///                     ignored. Segment intersections are found with a sweep line, in O((n + k) log n).
+    ///
+    /// @code
+    ///                     LineString({ { 0.0, 0.0 }, { 1.0, 1.0 }, { 1.0, 0.0 }, { 0.0, 1.0 } }).isSimple() ; // False
+    /// @endcode
+    ///
+    /// @return             True if line string is simple
+    bool isSimple() const;
+
     /// @brief              Check if line string contains a point
     ///
     /// @code
@@ -162,6 +200,70 @@ class LineString : public Object
     /// @return             Closest point
     Point getPointClosestTo(const Point& aPoint) const;
 
+    /// @brief              Get length
+    ///
+    /// @code{.cpp}
+    ///                     LineString({ { 0.0, 0.0 }, { 1.0, 0.0 }, { 1.0, 2.0 } }).getLength() ; // 3.0
+    /// @endcode
+    ///
+    /// @return             Length
+    Real getLength() const;
+
+    /// @brief              Get distance to point
+    ///
+    /// @code{.cpp}
+    ///                     LineString({ { 0.0, 0.0 }, { 2.0, 0.0 } }).distanceTo({ 1.0, 1.0 }) ; // 1.0
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @return             Distance to point
+    Real distanceTo(const Point& aPoint) const;
+
+    /// @brief              Project point onto line string
+    ///
+    ///                     Returns the closest point lying on the line string (not only among its vertices), along
+    ///                     with its arc length from the first point. Ties resolve to the lowest segment index.
+    ///
+    /// @code{.cpp}
+    ///                     LineString lineString = { { { 0.0, 0.0 }, { 2.0, 0.0 }, { 2.0, 2.0 } } } ;
+    ///                     lineString.projectPoint({ 3.0, 1.0 }) ; // [2.0, 1.0], 3.0
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @return             Projection
+    LineString::Projection projectPoint(const Point& aPoint) const;
+
+    /// @brief              Simplify line string within a distance tolerance (Douglas-Peucker)
+    ///
+    ///                     End points are kept, and every point lies within the tolerance of the simplified line
+    ///                     string. Shortcuts that would make the line string intersect itself are refined further, so
+    ///                     that simple line strings remain simple. Runs in O(n log n) on average.
+    ///
+    /// @code{.cpp}
+    ///                     LineString({ { 0.0, 0.0 }, { 1.0, 0.1 }, { 2.0, 0.0 } }).simplify(0.5) ;
+    ///                     // [0.0, 0.0], [2.0, 0.0]
+    /// @endcode
+    ///
+    /// @param              [in] aTolerance A distance tolerance
+    /// @return             Simplified line string
+    LineString simplify(const Real& aTolerance) const;
+
+    /// @brief              Simplify line string down to a number of points (Visvalingam-Whyatt)
+    ///
+    ///                     Points spanning the smallest area with their neighbors are removed first, end points are
+    ///                     kept. Points whose removal would make the line string intersect itself are kept as well,
+    ///                     so that the simplified line string may hold more points than requested. Runs in
+    ///                     O(n log n).
+    ///
+    /// @code{.cpp}
+    ///                     LineString({ { 0.0, 0.0 }, { 1.0, 0.1 }, { 2.0, 0.0 } }).simplifyTo(2) ;
+    ///                     // [0.0, 0.0], [2.0, 0.0]
+    /// @endcode
+    ///
+    /// @param              [in] aPointCount A number of points (at least 2)
+    /// @return             Simplified line string
+    LineString simplifyTo(const Size& aPointCount) const;
+
     /// @brief              Get string representation
     ///
     /// @code{.cpp}
@@ -204,6 +306,20 @@ class LineString : public Object
     /// @return             End const iterator
     LineString::ConstIterator end() const;
 
+    /// @brief              Build a segment index over the line string
+    ///
+    ///                     Consecutive segments are grouped into a balanced hierarchy of axis-aligned bounding
+    ///                     boxes, so that contains, getPointClosestTo, distanceTo and projectPoint only visit
+    ///                     segments near the query instead of scanning the whole line string. The index is rebuilt
+    ///                     on transformation.
+    ///
+    /// @code{.cpp}
+    ///                     LineString lineString = { ... } ;
+    ///                     lineString.buildIndex() ;
+    ///                     lineString.contains(point) ;
+    /// @endcode
+    void buildIndex();
+
     /// @brief              Apply transformation to line string
     ///
     /// @code{.cpp}
@@ -234,7 +350,21 @@ class LineString : public Object
     static LineString Segment(const object::Segment& aSegment);
 
    private:
+    struct IndexNode
+    {
+        Vector2d lowerBound;
+        Vector2d upperBound;
+        Index offset;  ///< Leaf: first segment index, branch: index of second child node
+        Size count;    ///< Leaf: number of segments, branch: 0
+    };
+
     Array<Point> points_;
+
+    BoundingBox boundingBox_;
+
+    bool indexed_;
+    Array<IndexNode> indexNodes_;
+    Array<double> indexArcLengths_;
 };
 
 }  // namespace object
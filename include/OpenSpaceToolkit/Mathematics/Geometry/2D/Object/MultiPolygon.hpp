@@ -34,6 +34,7 @@ using ostk::mathematics::geometry::d2::Object;
 using ostk::mathematics::geometry::d2::object::LineString;
 using ostk::mathematics::geometry::d2::object::Point;
 using ostk::mathematics::geometry::d2::object::Segment;
+using ostk::mathematics::object::MatrixXd;
 
 using Polygon2d = ostk::mathematics::geometry::d2::object::Polygon;
 
@@ -120,6 +121,15 @@ class MultiPolygon : public Object
     /// @return             True if multi-polygon is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of multi-polygon
+    ///
+    /// @code{.cpp}
+    ///                     multiPolygon.getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if multi-polygon contains point
     ///
     /// @code
@@ -144,6 +154,22 @@ class MultiPolygon : public Object
     /// @return             True if multi-polygon contains point set
     bool contains(const PointSet& aPointSet) const;
 
+    /// @brief              Locate points with respect to multi-polygon (bulk classification)
+    ///
+    ///                     Each polygon is prepared once (see PreparedPolygon) and points are only tested against the
+    ///                     polygons whose envelope covers them. A point is inside if it lies in the interior of any
+    ///                     polygon, on the boundary if it lies on the boundary of any polygon and in no interior.
+    ///
+    /// @code
+    ///                     MatrixXd points = ... ; // N x 2
+    ///                     Array<Polygon2d::Location> locations = multiPolygon.locate(points, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPointMatrix A N x 2 matrix of points (one point per row)
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             Array of locations (one per row)
+    Array<Polygon2d::Location> locate(const MatrixXd& aPointMatrix, const Size& aThreadCount = 1) const;
+
     /// @brief              Get number of polygons
     ///
     /// @code{.cpp}
@@ -173,6 +199,36 @@ class MultiPolygon : public Object
     /// @return             Multi-polygon convex hull
     Polygon2d getConvexHull() const;
 
+    /// @brief              Simplify multi-polygon within a distance tolerance (Douglas-Peucker)
+    ///
+    ///                     Polygons whose envelopes intersect, directly or through other polygons, are simplified
+    ///                     together (see Polygon::simplify), so that polygons sharing or approaching edges do not
+    ///                     overlap once simplified. Such groups of polygons are simplified concurrently.
+    ///
+    /// @code{.cpp}
+    ///                     MultiPolygon simplifiedMultiPolygon = multiPolygon.simplify(1e-3, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] aTolerance A distance tolerance
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             Simplified multi-polygon
+    MultiPolygon simplify(const Real& aTolerance, const Size& aThreadCount = 1) const;
+
+    /// @brief              Simplify multi-polygon down to a number of vertices (Visvalingam-Whyatt)
+    ///
+    ///                     Polygons are grouped as in simplify, and the vertex count is shared among groups in
+    ///                     proportion to their own vertex count. Each group is then simplified (see
+    ///                     Polygon::simplifyTo), possibly concurrently, and polygons keep at least 3 vertices.
+    ///
+    /// @code{.cpp}
+    ///                     MultiPolygon simplifiedMultiPolygon = multiPolygon.simplifyTo(1000, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] aVertexCount A total number of vertices (at least 3)
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             Simplified multi-polygon
+    MultiPolygon simplifyTo(const Size& aVertexCount, const Size& aThreadCount = 1) const;
+
     /// @brief              Compute intersection of multi-polygon with multi-polygon
     ///
     /// @code{.cpp}
@@ -250,6 +306,22 @@ class MultiPolygon : public Object
     /// @return             Multi-polygon
     static MultiPolygon Polygon(const Polygon2d& aPolygon);
 
+    /// @brief              Compute union of many polygons (cascaded union)
+    ///
+    ///                     Polygons are ordered along a space-filling curve of their envelope centers, then merged
+    ///                     pairwise along a balanced binary tree, so that each overlay operates on two spatially
+    ///                     compact operands instead of an ever-growing accumulator. Subtrees with disjoint envelopes
+    ///                     are concatenated without overlay, and independent subtrees are merged concurrently.
+    ///
+    /// @code
+    ///                     MultiPolygon multiPolygon = MultiPolygon::Union({ polygonA, polygonB, polygonC }, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPolygonArray An array of polygons
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             Multi-polygon (undefined if the array is empty)
+    static MultiPolygon Union(const Array<Polygon2d>& aPolygonArray, const Size& aThreadCount = 1);
+
    private:
     class Impl;
 
@@ -12,6 +12,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Point.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/PointSet.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Segment.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 namespace ostk
 {
@@ -36,6 +37,7 @@ using ostk::mathematics::geometry::d2::Object;
 using ostk::mathematics::geometry::d2::object::LineString;
 using ostk::mathematics::geometry::d2::object::Point;
 using ostk::mathematics::geometry::d2::object::Segment;
+using ostk::mathematics::object::MatrixXd;
 
 /// @brief                      Polygon
 ///
@@ -55,6 +57,15 @@ class Polygon : public Object
     typedef Segment Edge;
     typedef LineString Ring;
 
+    enum class Location
+    {
+
+        Outside,   ///< Point lies outside of the polygon
+        Boundary,  ///< Point lies on the boundary of the polygon
+        Inside     ///< Point lies in the interior of the polygon
+
+    };
+
     /// @brief              Constructor
     ///
     /// @code{.cpp}
@@ -144,6 +155,17 @@ class Polygon : public Object
     /// @return             True if polygon is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of polygon
+    ///
+    ///                     Computed upon construction and transformation, from the outer ring vertices.
+    ///
+    /// @code{.cpp}
+    ///                     polygon.getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if polygon is near another polygon
     ///
     /// @code{.cpp}
@@ -203,6 +225,23 @@ class Polygon : public Object
     /// @return             True if polygon contains line string
     bool contains(const LineString& aLineString) const;
 
+    /// @brief              Locate points with respect to polygon (bulk classification)
+    ///
+    ///                     Prepares the polygon once (see PreparedPolygon), then classifies each point, optionally
+    ///                     splitting the points across several threads.
+    ///
+    /// @code
+    ///                     MatrixXd points(2, 2) ;
+    ///                     points << 0.5, 0.5,
+    ///                               2.0, 2.0 ;
+    ///                     polygon.locate(points) ; // [Inside, Outside]
+    /// @endcode
+    ///
+    /// @param              [in] aPointMatrix A N x 2 matrix of points (one point per row)
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             Array of locations (one per row)
+    Array<Polygon::Location> locate(const MatrixXd& aPointMatrix, const Size& aThreadCount = 1) const;
+
     /// @brief              Get number of inner rings
     ///
     /// @code{.cpp}
@@ -297,6 +336,35 @@ class Polygon : public Object
     /// @return             Polygon convex hull
     Polygon getConvexHull() const;
 
+    /// @brief              Simplify polygon within a distance tolerance (Douglas-Peucker)
+    ///
+    ///                     Every vertex lies within the tolerance of its simplified ring, and rings keep at least 3
+    ///                     vertices. Shortcuts that would make rings intersect themselves or each other, or move an
+    ///                     inner ring out of the outer ring, are refined further: valid polygons remain valid. Runs in
+    ///                     O(n log n) on average.
+    ///
+    /// @code{.cpp}
+    ///                     Polygon simplifiedPolygon = polygon.simplify(1e-3) ;
+    /// @endcode
+    ///
+    /// @param              [in] aTolerance A distance tolerance
+    /// @return             Simplified polygon
+    Polygon simplify(const Real& aTolerance) const;
+
+    /// @brief              Simplify polygon down to a number of vertices (Visvalingam-Whyatt)
+    ///
+    ///                     Vertices spanning the smallest area with their neighbors are removed first, over all rings.
+    ///                     Vertices whose removal would alter the topology of the polygon are kept (see simplify), so
+    ///                     that the simplified polygon may hold more vertices than requested. Runs in O(n log n).
+    ///
+    /// @code{.cpp}
+    ///                     Polygon simplifiedPolygon = polygon.simplifyTo(100) ;
+    /// @endcode
+    ///
+    /// @param              [in] aVertexCount A number of vertices (at least 3)
+    /// @return             Simplified polygon
+    Polygon simplifyTo(const Size& aVertexCount) const;
+
     /// @brief              Compute intersection of polygon with polygon
     ///
     /// @code{.cpp}
@@ -317,6 +385,35 @@ class Polygon : public Object
     /// @return             Difference (leveraging Intersection class) of polygon with polygon
     Intersection differenceWith(const Polygon& aPolygon) const;
 
+    /// @brief              Clip polygon to an axis-aligned box
+    ///
+    ///                     Fast path for tiling: rings are clipped one box side at a time (Sutherland-Hodgman),
+    ///                     without validity checks nor point or line string outputs. Results that split into
+    ///                     several polygons, or inner rings crossing the box boundary, go through the general
+    ///                     boolean intersection instead.
+    ///
+    /// @code{.cpp}
+    ///                     Array<Polygon> polygons = polygon.clipTo(BoundingBox({ 0.0, 0.0 }, { 1.0, 1.0 })) ;
+    /// @endcode
+    ///
+    /// @param              [in] aBoundingBox A bounding box
+    /// @return             Polygons with a non-zero area, covering the part of the polygon inside the box
+    Array<Polygon> clipTo(const BoundingBox& aBoundingBox) const;
+
+    /// @brief              Clip polygon to a convex polygon
+    ///
+    ///                     Same as clipping to a box, with the half-planes bounding a convex clip polygon. Non
+    ///                     convex clip polygons, or clip polygons with inner rings, go through the general boolean
+    ///                     intersection.
+    ///
+    /// @code{.cpp}
+    ///                     Array<Polygon> polygons = polygon.clipTo(convexPolygon) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPolygon A (convex) clip polygon
+    /// @return             Polygons with a non-zero area, covering the part of the polygon inside the clip polygon
+    Array<Polygon> clipTo(const Polygon& aPolygon) const;
+
     /// @brief              Compute union of polygon with polygon
     ///
     /// @code{.cpp}
@@ -371,6 +468,24 @@ class Polygon : public Object
     class Impl;
 
     Unique<Polygon::Impl> implUPtr_;
+
+    friend class PreparedPolygon;
+
+    /// @brief              Compute intersection of polygon with polygon
+    ///
+    /// @param              [in] aPolygon A polygon
+    /// @param              [in] isFirstPolygonValidated True to skip validation of this polygon, when it has already
+    ///                     been validated (e.g. by a prepared polygon)
+    /// @return             Intersection of polygon with polygon
+    Intersection intersectionWith(const Polygon& aPolygon, const bool isFirstPolygonValidated) const;
+
+    /// @brief              Compute difference of polygon with polygon
+    ///
+    /// @param              [in] aPolygon A polygon
+    /// @param              [in] isFirstPolygonValidated True to skip validation of this polygon, when it has already
+    ///                     been validated (e.g. by a prepared polygon)
+    /// @return             Difference of polygon with polygon
+    Intersection differenceWith(const Polygon& aPolygon, const bool isFirstPolygonValidated) const;
 };
 
 }  // namespace object
@@ -0,0 +1,201 @@
+/// Apache License 2.0
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_2D_Object_PreparedPolygon__
+#define __OpenSpaceToolkit_Mathematics_Geometry_2D_Object_PreparedPolygon__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/Unique.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/LineString.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+namespace d2
+{
+namespace object
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Size;
+using ostk::core::type::Unique;
+
+using ostk::mathematics::geometry::d2::Intersection;
+using ostk::mathematics::geometry::d2::object::LineString;
+using ostk::mathematics::geometry::d2::object::Point;
+using ostk::mathematics::geometry::d2::object::PointSet;
+using ostk::mathematics::geometry::d2::object::Polygon;
+using ostk::mathematics::object::MatrixXd;
+
+/// @brief                      Prepared polygon
+///
+///                             Immutable wrapper around a polygon, caching its validity, its envelope (axis-aligned
+///                             bounding box) and a spatial index (R-tree) of its edges upon construction.
+///
+///                             Meant for polygons tested many times against other geometries (e.g. an area of
+///                             interest): point containment runs in O(log n + k), k being the number of edges crossed
+///                             by a ray cast from the point, and geometries lying outside of the envelope are rejected
+///                             in O(1).
+///
+/// @code{.cpp}
+///                             Polygon polygon = ... ;
+///                             PreparedPolygon preparedPolygon(polygon) ;
+///                             preparedPolygon.contains(Point(0.5, 0.5)) ;
+/// @endcode
+class PreparedPolygon
+{
+   public:
+    /// @brief              Constructor
+    ///
+    /// @code{.cpp}
+    ///                     PreparedPolygon preparedPolygon(polygon) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPolygon A polygon
+    PreparedPolygon(const Polygon& aPolygon);
+
+    /// @brief              Copy constructor
+    ///
+    /// @param              [in] aPreparedPolygon A prepared polygon
+    PreparedPolygon(const PreparedPolygon& aPreparedPolygon);
+
+    /// @brief              Destructor
+    ~PreparedPolygon();
+
+    /// @brief              Copy assignment operator
+    ///
+    /// @param              [in] aPreparedPolygon A prepared polygon
+    /// @return             Reference to prepared polygon
+    PreparedPolygon& operator=(const PreparedPolygon& aPreparedPolygon);
+
+    /// @brief              Check if prepared polygon is valid (e.g. not self-intersecting)
+    ///
+    /// @code{.cpp}
+    ///                     PreparedPolygon(polygon).isValid() ;
+    /// @endcode
+    ///
+    /// @return             True if prepared polygon is valid
+    bool isValid() const;
+
+    /// @brief              Check if prepared polygon intersects polygon
+    ///
+    /// @code{.cpp}
+    ///                     preparedPolygon.intersects(polygon) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPolygon A polygon
+    /// @return             True if prepared polygon intersects polygon
+    bool intersects(const Polygon& aPolygon) const;
+
+    /// @brief              Check if prepared polygon contains point
+    ///
+    ///                     Points lying on the boundary are considered contained, consistently with
+    ///                     Polygon::contains.
+    ///
+    /// @code{.cpp}
+    ///                     preparedPolygon.contains(Point(0.5, 0.5)) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @return             True if prepared polygon contains point
+    bool contains(const Point& aPoint) const;
+
+    /// @brief              Check if prepared polygon contains point set
+    ///
+    /// @code{.cpp}
+    ///                     preparedPolygon.contains(pointSet) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPointSet A point set
+    /// @return             True if prepared polygon contains point set
+    bool contains(const PointSet& aPointSet) const;
+
+    /// @brief              Check if prepared polygon contains line string
+    ///
+    /// @code{.cpp}
+    ///                     preparedPolygon.contains(lineString) ;
+    /// @endcode
+    ///
+    /// @param              [in] aLineString A line string
+    /// @return             True if prepared polygon contains line string
+    bool contains(const LineString& aLineString) const;
+
+    /// @brief              Locate point with respect to prepared polygon
+    ///
+    /// @code{.cpp}
+    ///                     preparedPolygon.locate(Point(0.5, 0.5)) ; // Polygon::Location::Inside
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @return             Location of point
+    Polygon::Location locate(const Point& aPoint) const;
+
+    /// @brief              Locate points with respect to prepared polygon (bulk classification)
+    ///
+    ///                     Rows are split into contiguous chunks, one per thread.
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd points = ... ; // N x 2
+    ///                     Array<Polygon::Location> locations = preparedPolygon.locate(points, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPointMatrix A N x 2 matrix of points (one point per row)
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             Array of locations (one per row)
+    Array<Polygon::Location> locate(const MatrixXd& aPointMatrix, const Size& aThreadCount = 1) const;
+
+    /// @brief              Access underlying polygon
+    ///
+    /// @code{.cpp}
+    ///                     const Polygon& polygon = preparedPolygon.accessPolygon() ;
+    /// @endcode
+    ///
+    /// @return             Reference to underlying polygon
+    const Polygon& accessPolygon() const;
+
+    /// @brief              Compute intersection of prepared polygon with polygon
+    ///
+    ///                     Validity of the prepared polygon is not recomputed.
+    ///
+    /// @code{.cpp}
+    ///                     Intersection intersection = preparedPolygon.intersectionWith(polygon) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPolygon A polygon
+    /// @return             Intersection of prepared polygon with polygon
+    Intersection intersectionWith(const Polygon& aPolygon) const;
+
+    /// @brief              Compute difference of prepared polygon with polygon
+    ///
+    ///                     Validity of the prepared polygon is not recomputed.
+    ///
+    /// @code{.cpp}
+    ///                     Intersection difference = preparedPolygon.differenceWith(polygon) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPolygon A polygon
+    /// @return             Difference (leveraging Intersection class) of prepared polygon with polygon
+    Intersection differenceWith(const Polygon& aPolygon) const;
+
+   private:
+    class Impl;
+
+    Polygon polygon_;
+    Unique<PreparedPolygon::Impl> implUPtr_;
+};
+
+}  // namespace object
+}  // namespace d2
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
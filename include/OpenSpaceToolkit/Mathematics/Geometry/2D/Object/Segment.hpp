@@ -2,6 +2,9 @@
 #ifndef __OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Segment__
 #define __OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Segment__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object.hpp>
@@ -19,6 +22,9 @@ namespace d2
 namespace object
 {
 
+using ostk::core::container::Array;
+using ostk::core::container::Tuple;
+using ostk::core::type::Index;
 using ostk::core::type::Real;
 
 using ostk::mathematics::geometry::d2::Object;
@@ -40,6 +46,8 @@ class PointSet;
 class Segment : public Object
 {
    public:
+    typedef Tuple<Index, Index, Point> IntersectionPoint;  // Indices of two segments (first < second), common point
+
     /// @brief              Constructor
     ///
     /// @code
@@ -88,6 +96,15 @@ class Segment : public Object
     /// @return             True if segment is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of segment
+    ///
+    /// @code{.cpp}
+    ///                     Segment({ 0.0, 0.0 }, { 1.0, 2.0 }).getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if segment is degenerate, i.e. its length is zero
     ///
     /// @code
@@ -236,6 +253,30 @@ class Segment : public Object
     /// @return             Undefined segment
     static Segment Undefined();
 
+    /// @brief              Find all intersection points among segments (sweep line)
+    ///
+    ///                     Bentley-Ottmann sweep: segments are kept ordered along a vertical line sweeping the
+    ///                     plane, and only neighbors in that order are tested, so that the cost is
+    ///                     O((n + k) log n) for n segments and k intersections instead of O(n^2). Segments
+    ///                     meeting at an intersection are reordered by slope only, which keeps the sweep order
+    ///                     consistent in floating point.
+    ///
+    ///                     Touching segments (shared end points, end point on another segment) intersect. A
+    ///                     collinear overlap is reported at both of its end points. Degenerate segments are
+    ///                     ignored. Results are sorted by segment indices, then by point.
+    ///
+    /// @code{.cpp}
+    ///                     const Segment first = { { 0.0, 0.0 }, { 2.0, 2.0 } } ;
+    ///                     const Segment second = { { 0.0, 2.0 }, { 2.0, 0.0 } } ;
+    ///                     Segment::IntersectionPoints({ first, second }) ; // [(0, 1, [1.0, 1.0])]
+    /// @endcode
+    ///
+    /// @ref                https://en.wikipedia.org/wiki/Bentley%E2%80%93Ottmann_algorithm
+    ///
+    /// @param              [in] aSegmentArray An array of segments
+    /// @return             Intersection points
+    static Array<Segment::IntersectionPoint> IntersectionPoints(const Array<Segment>& aSegmentArray);
+
    private:
     Point firstPoint_;
     Point secondPoint_;
@@ -26,6 +26,7 @@ using ostk::mathematics::geometry::Angle;
 using ostk::mathematics::geometry::d2::Object;
 using ostk::mathematics::geometry::d2::object::Point;
 using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::Vector2d;
 using ostk::mathematics::object::Vector3d;
 
@@ -207,6 +208,33 @@ class Transformation
     /// @return             The transformed vector
     Vector2d applyTo(const Vector2d& aVector) const;
 
+    /// @brief              Apply the transformation to points, in place
+    ///
+    ///                     Each column of the 2 x N matrix is a point. The kernel is picked from the transformation
+    ///                     type: nothing is done for the identity, a translation only adds an offset, and other
+    ///                     types apply the 2x2 linear part plus the translation, instead of a homogeneous product.
+    ///                     Blocks and maps over external buffers are accepted, as long as columns are contiguous.
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd points = ... ; // 2 x N
+    ///                     Transformation::Translation({1.0, 2.0}).applyToPoints(points) ;
+    /// @endcode
+    ///
+    /// @param              [in, out] aPointMatrix A 2 x N point matrix
+    void applyToPoints(Eigen::Ref<MatrixXd> aPointMatrix) const;
+
+    /// @brief              Apply the transformation to vectors, in place
+    ///
+    ///                     Each column of the 2 x N matrix is a vector. Vectors are not translated.
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd velocities = ... ; // 2 x N
+    ///                     Transformation::Rotation(Angle::Degrees(45.0)).applyToVectors(velocities) ;
+    /// @endcode
+    ///
+    /// @param              [in, out] aVectorMatrix A 2 x N vector matrix
+    void applyToVectors(Eigen::Ref<MatrixXd> aVectorMatrix) const;
+
     /// @brief              Apply the transformation to a 2D object
     ///
     /// @code{.cpp}
@@ -0,0 +1,191 @@
+/// Apache License 2.0
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_3D_BoundingBox__
+#define __OpenSpaceToolkit_Mathematics_Geometry_3D_BoundingBox__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+namespace d3
+{
+
+using ostk::core::container::Array;
+
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::object::Vector3d;
+
+/// @brief                      Axis-aligned bounding box
+///
+///                             Closed box spanned by a lower and an upper bound, used to cheaply cull queries before
+///                             running exact intersection or containment routines. An undefined bounding box stands
+///                             for an unbounded (or empty) object, and never rejects anything.
+///
+/// @code{.cpp}
+///                             BoundingBox boundingBox = { { 0.0, 0.0, 0.0 }, { 1.0, 2.0, 3.0 } } ;
+/// @endcode
+class BoundingBox
+{
+   public:
+    /// @brief              Constructor
+    ///
+    /// @code{.cpp}
+    ///                     BoundingBox boundingBox = { { 0.0, 0.0, 0.0 }, { 1.0, 2.0, 3.0 } } ;
+    /// @endcode
+    ///
+    /// @param              [in] aLowerBound A lower bound
+    /// @param              [in] anUpperBound An upper bound
+    BoundingBox(const Point& aLowerBound, const Point& anUpperBound);
+
+    /// @brief              Equal to operator
+    ///
+    /// @param              [in] aBoundingBox A bounding box
+    /// @return             True if bounding boxes are equal
+    bool operator==(const BoundingBox& aBoundingBox) const;
+
+    /// @brief              Not equal to operator
+    ///
+    /// @param              [in] aBoundingBox A bounding box
+    /// @return             True if bounding boxes are not equal
+    bool operator!=(const BoundingBox& aBoundingBox) const;
+
+    /// @brief              Output stream operator
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] aBoundingBox A bounding box
+    /// @return             A reference to output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const BoundingBox& aBoundingBox);
+
+    /// @brief              Check if bounding box is defined
+    ///
+    /// @code{.cpp}
+    ///                     BoundingBox(...).isDefined() ;
+    /// @endcode
+    ///
+    /// @return             True if bounding box is defined
+    bool isDefined() const;
+
+    /// @brief              Check if bounding box intersects bounding box
+    ///
+    ///                     Boxes touching along a face, an edge or a corner intersect.
+    ///
+    /// @code{.cpp}
+    ///                     boundingBox.intersects(anotherBoundingBox) ;
+    /// @endcode
+    ///
+    /// @param              [in] aBoundingBox A bounding box
+    /// @return             True if bounding box intersects bounding box
+    bool intersects(const BoundingBox& aBoundingBox) const;
+
+    /// @brief              Check if bounding box contains point
+    ///
+    /// @code{.cpp}
+    ///                     boundingBox.contains(Point(0.5, 0.5, 0.5)) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @return             True if bounding box contains point
+    bool contains(const Point& aPoint) const;
+
+    /// @brief              Check if bounding box contains bounding box
+    ///
+    /// @code{.cpp}
+    ///                     boundingBox.contains(anotherBoundingBox) ;
+    /// @endcode
+    ///
+    /// @param              [in] aBoundingBox A bounding box
+    /// @return             True if bounding box contains bounding box
+    bool contains(const BoundingBox& aBoundingBox) const;
+
+    /// @brief              Get lower bound
+    ///
+    /// @code{.cpp}
+    ///                     BoundingBox({ 0.0, 0.0, 0.0 }, { 1.0, 2.0, 3.0 }).getLowerBound() ; // [0.0, 0.0, 0.0]
+    /// @endcode
+    ///
+    /// @return             Lower bound
+    Point getLowerBound() const;
+
+    /// @brief              Get upper bound
+    ///
+    /// @code{.cpp}
+    ///                     BoundingBox({ 0.0, 0.0, 0.0 }, { 1.0, 2.0, 3.0 }).getUpperBound() ; // [1.0, 2.0, 3.0]
+    /// @endcode
+    ///
+    /// @return             Upper bound
+    Point getUpperBound() const;
+
+    /// @brief              Get center
+    ///
+    /// @code{.cpp}
+    ///                     BoundingBox({ 0.0, 0.0, 0.0 }, { 1.0, 2.0, 3.0 }).getCenter() ; // [0.5, 1.0, 1.5]
+    /// @endcode
+    ///
+    /// @return             Center
+    Point getCenter() const;
+
+    /// @brief              Get size (upper bound minus lower bound)
+    ///
+    /// @code{.cpp}
+    ///                     BoundingBox({ 0.0, 0.0, 0.0 }, { 1.0, 2.0, 3.0 }).getSize() ; // [1.0, 2.0, 3.0]
+    /// @endcode
+    ///
+    /// @return             Size
+    Vector3d getSize() const;
+
+    /// @brief              Get smallest bounding box enclosing both bounding boxes
+    ///
+    ///                     Undefined if either bounding box is undefined.
+    ///
+    /// @code{.cpp}
+    ///                     boundingBox.unionWith(anotherBoundingBox) ;
+    /// @endcode
+    ///
+    /// @param              [in] aBoundingBox A bounding box
+    /// @return             Union bounding box
+    BoundingBox unionWith(const BoundingBox& aBoundingBox) const;
+
+    /// @brief              Print bounding box
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] (optional) displayDecorators If true, display decorators
+    void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
+
+    /// @brief              Constructs an undefined bounding box
+    ///
+    /// @code{.cpp}
+    ///                     BoundingBox boundingBox = BoundingBox::Undefined() ; // Undefined
+    /// @endcode
+    ///
+    /// @return             Undefined bounding box
+    static BoundingBox Undefined();
+
+    /// @brief              Constructs the smallest bounding box enclosing points
+    ///
+    ///                     Undefined if the point array is empty.
+    ///
+    /// @code{.cpp}
+    ///                     BoundingBox boundingBox = BoundingBox::Points({ { 0.0, 0.0, 0.0 }, { 1.0, 2.0, 3.0 } }) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPointArray An array of points
+    /// @return             Bounding box
+    static BoundingBox Points(const Array<Point>& aPointArray);
+
+   private:
+    Point lowerBound_;
+    Point upperBound_;
+};
+
+}  // namespace d3
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
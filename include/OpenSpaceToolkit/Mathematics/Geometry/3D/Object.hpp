@@ -15,6 +15,7 @@ namespace d3
 
 class Transformation;
 class Intersection;
+class BoundingBox;
 
 /// @brief                      3D object
 ///
@@ -104,8 +105,22 @@ class Object
         return dynamic_cast<const Type*>(this) != nullptr;
     }
 
+    /// @brief              Get axis-aligned bounding box of object
+    ///
+    ///                     Undefined for unbounded objects (e.g. lines, rays, planes, pyramids and cones).
+    ///
+    /// @code{.cpp}
+    ///                     BoundingBox boundingBox = Segment({ 0.0, 0.0, 0.0 }, { 1.0, 2.0, 3.0 }).getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const;
+
     /// @brief              Check if object intersects another object
     ///
+    ///                     Supported pairs of objects with disjoint bounding boxes are rejected before any exact
+    ///                     test. Unsupported pairs throw, wherever they lie.
+    ///
     /// @code
     ///                     Unique<Object> objectUPtr = ... ;
     ///                     Unique<Object> anotherObjectUPtr = ... ;
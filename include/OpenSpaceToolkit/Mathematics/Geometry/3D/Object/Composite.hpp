@@ -9,6 +9,7 @@
 #include <OpenSpaceToolkit/Core/Type/Unique.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 namespace ostk
 {
@@ -27,6 +28,7 @@ using ostk::core::type::Size;
 using ostk::core::type::Unique;
 
 using ostk::mathematics::geometry::d3::Object;
+using ostk::mathematics::object::Vector3d;
 
 /// @brief                      Composite object
 ///
@@ -125,7 +127,8 @@ class Composite : public Object
 
     /// @brief              Addition operator (composite concatenation)
     ///
-    ///                     Concatenate (merge) composite with another composite.
+    ///                     Concatenate (merge) composite with another composite. The result is indexed if any of
+    ///                     the two composites is indexed.
     ///
     /// @code{.cpp}
     ///                     Composite compositeA = Composite(Point(0.0, 0.0, 0.0)) ;
@@ -160,6 +163,18 @@ class Composite : public Object
     /// @return             True if composite is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of composite
+    ///
+    ///                     Union of the object bounding boxes, undefined if any object is unbounded or if the
+    ///                     composite is empty.
+    ///
+    /// @code{.cpp}
+    ///                     Composite(...).getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if composite is empty
     ///
     /// @code{.cpp}
@@ -169,6 +184,15 @@ class Composite : public Object
     /// @return             True if composite is empty
     bool isEmpty() const;
 
+    /// @brief              Check if composite holds a bounding volume hierarchy
+    ///
+    /// @code{.cpp}
+    ///                     Composite(...).isIndexed() ;
+    /// @endcode
+    ///
+    /// @return             True if composite holds a bounding volume hierarchy
+    bool isIndexed() const;
+
     /// @brief              Returns true if composite can be converted to underlying object
     ///
     ///                     Only valid if the composite only contains one object.
@@ -346,6 +370,20 @@ class Composite : public Object
     /// @return             Const iterator to end
     Composite::ConstIterator end() const;
 
+    /// @brief              Build a bounding volume hierarchy over the composite objects
+    ///
+    ///                     Objects with a finite extent are grouped by axis-aligned bounding box (SAH split).
+    ///                     Queries against a point, a segment or a ray then only evaluate objects whose box
+    ///                     overlaps the query; unbounded objects (lines, rays, planes, pyramids, cones) are
+    ///                     always evaluated. The hierarchy is rebuilt on transformation and concatenation.
+    ///
+    /// @code{.cpp}
+    ///                     Composite composite = { ... } ;
+    ///                     composite.buildIndex() ;
+    ///                     composite.intersects(ray) ;
+    /// @endcode
+    void buildIndex();
+
     /// @brief              Print composite
     ///
     /// @code{.cpp}
@@ -386,8 +424,23 @@ class Composite : public Object
     static Composite Empty();
 
    private:
+    struct IndexNode
+    {
+        Vector3d lowerBound;
+        Vector3d upperBound;
+        Index offset;  ///< Leaf: first entry in indexedObjectIndices_, branch: index of second child node
+        Size count;    ///< Leaf: number of objects, branch: 0
+    };
+
     bool defined_;
     Array<Unique<Object>> objects_;
+
+    bool indexed_;
+    Array<IndexNode> indexNodes_;
+    Array<Index> indexedObjectIndices_;
+    Array<Index> unindexedObjectIndices_;
+
+    Array<Index> getCandidateObjectIndices(const Object& anObject) const;
 };
 
 }  // namespace object
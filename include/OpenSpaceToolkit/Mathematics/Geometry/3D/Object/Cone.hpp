@@ -9,6 +9,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ray.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 namespace ostk
 {
@@ -30,6 +31,7 @@ using ostk::mathematics::geometry::d3::Intersection;
 using ostk::mathematics::geometry::d3::Object;
 using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::geometry::d3::object::Ray;
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::Vector3d;
 
 #define DEFAULT_RAY_COUNT 0
@@ -173,6 +175,18 @@ class Cone : public Object
     /// @return             True if cone contains segment
     bool contains(const Segment& aSegment) const;
 
+    /// @brief              Check if cone contains points (bulk containment)
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd points = ... ; // N x 3
+    ///                     Array<bool> mask = cone.contains(points, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPointMatrix A N x 3 matrix of points (one point per row)
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             True if cone contains point, for each row
+    Array<bool> contains(const MatrixXd& aPointMatrix, const Size& aThreadCount = 1) const;
+
     /// @brief              Check if cone contains ray
     ///
     /// @code{.cpp}
@@ -331,6 +345,12 @@ class Cone : public Object
     Point apex_;
     Vector3d axis_;
     Angle angle_;
+
+    Vector3d unitAxis_;
+    Real cosineOfAngle_;
+    Vector3d referenceDirection_;
+
+    void updateFrame();
 };
 
 }  // namespace object
@@ -3,7 +3,10 @@
 #define __OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cuboid__
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Segment.hpp>
@@ -21,12 +24,16 @@ namespace object
 {
 
 using ostk::core::container::Array;
+using ostk::core::container::Pair;
+using ostk::core::type::Index;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 
 using ostk::mathematics::geometry::d3::Intersection;
 using ostk::mathematics::geometry::d3::Object;
 using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::geometry::d3::object::Segment;
+using ostk::mathematics::object::Matrix3d;
 using ostk::mathematics::object::Vector3d;
 
 class PointSet;
@@ -102,6 +109,15 @@ class Cuboid : public Object
     /// @return             True if cuboid is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of cuboid
+    ///
+    /// @code{.cpp}
+    ///                     cuboid.getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if cuboid is near another cuboid
     ///
     /// @code{.cpp}
@@ -438,10 +454,51 @@ class Cuboid : public Object
     /// @return             Cube
     static Cuboid Cube(const Point& aCenter, const Real& anExtent);
 
+    /// @brief              Find the intersecting pairs between two sets of cuboids (batch collision test)
+    ///
+    ///                     Candidate pairs are found by sweep and prune on the axis-aligned bounds of the
+    ///                     cuboids, then confirmed by separating axis tests evaluated over blocks of pairs. The
+    ///                     result is that of Cuboid::intersects on every pair.
+    ///
+    /// @code{.cpp}
+    ///                     Array<Pair<Index, Index>> pairs = Cuboid::IntersectingPairs(debris, spacecraft, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] aFirstCuboidArray An array of cuboids
+    /// @param              [in] aSecondCuboidArray An array of cuboids
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             Index pairs (first, second) of intersecting cuboids, in lexicographic order
+    static Array<Pair<Index, Index>> IntersectingPairs(
+        const Array<Cuboid>& aFirstCuboidArray, const Array<Cuboid>& aSecondCuboidArray, const Size& aThreadCount = 1
+    );
+
+    /// @brief              Find the intersecting pairs between a set of spheres and a set of cuboids (batch
+    ///                     collision test)
+    ///
+    ///                     Solid spheres and cuboids intersect when the closest point of the cuboid to the center
+    ///                     of the sphere lies within the radius.
+    ///
+    /// @code{.cpp}
+    ///                     Array<Pair<Index, Index>> pairs = Cuboid::IntersectingPairs(keepOutZones, spacecraft) ;
+    /// @endcode
+    ///
+    /// @param              [in] aSphereArray An array of spheres
+    /// @param              [in] aCuboidArray An array of cuboids
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             Index pairs (sphere, cuboid) of intersecting spheres and cuboids, in lexicographic order
+    static Array<Pair<Index, Index>> IntersectingPairs(
+        const Array<Sphere>& aSphereArray, const Array<Cuboid>& aCuboidArray, const Size& aThreadCount = 1
+    );
+
    private:
     Point center_;
     std::array<Vector3d, 3> axes_;
     std::array<Real, 3> extent_;
+
+    Matrix3d axisMatrix_;
+    Vector3d extentVector_;
+
+    void updateFrame();
 };
 
 }  // namespace object
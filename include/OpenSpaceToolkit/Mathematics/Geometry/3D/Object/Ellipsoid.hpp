@@ -2,7 +2,10 @@
 #ifndef __OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid__
 #define __OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
@@ -19,13 +22,18 @@ namespace d3
 namespace object
 {
 
+using ostk::core::container::Array;
+using ostk::core::container::Tuple;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 
 using ostk::mathematics::geometry::d3::Intersection;
 using ostk::mathematics::geometry::d3::Object;
 using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
 using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
 
 #define DEFAULT_ORIENTATION Quaternion::Unit()
 
@@ -49,6 +57,8 @@ class Cone;
 class Ellipsoid : public Object
 {
    public:
+    typedef Tuple<Point, Vector3d, Real> Projection;  // Closest surface point, outward unit normal, signed distance
+
     /// @brief              Constructor
     ///
     /// @code{.cpp}
@@ -107,6 +117,17 @@ class Ellipsoid : public Object
     /// @return             True if ellipsoid is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of ellipsoid
+    ///
+    ///                     Tight box of the oriented ellipsoid.
+    ///
+    /// @code{.cpp}
+    ///                     Ellipsoid(Point::Origin(), 1.0, 2.0, 3.0).getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if ellipsoid intersects point
     ///
     /// @code{.cpp}
@@ -263,6 +284,46 @@ class Ellipsoid : public Object
     /// @return             True if ellipsoid contains segment
     bool contains(const Segment& aSegment) const;
 
+    /// @brief              Compute distance of ellipsoid surface to point
+    ///
+    /// @code{.cpp}
+    ///                     Ellipsoid ellipsoid = Ellipsoid(Point::Origin(), 1.0, 2.0, 3.0) ;
+    ///                     ellipsoid.distanceTo({ 0.0, 0.0, 5.0 }) ; // 2.0
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @return             Distance of ellipsoid surface to point
+    Real distanceTo(const Point& aPoint) const;
+
+    /// @brief              Project point onto ellipsoid surface
+    ///
+    ///                     Solves for the closest surface point in the principal frame, with Newton iterations
+    ///                     safeguarded by bisection on the root of the secular equation (Eberly). The signed
+    ///                     distance is positive outside the ellipsoid and negative inside.
+    ///
+    /// @code{.cpp}
+    ///                     Ellipsoid ellipsoid = Ellipsoid(Point::Origin(), 1.0, 2.0, 3.0) ;
+    ///                     ellipsoid.projectPoint({ 0.0, 0.0, 5.0 }) ; // [0.0, 0.0, 3.0], [0.0, 0.0, 1.0], 2.0
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @return             Projection
+    Ellipsoid::Projection projectPoint(const Point& aPoint) const;
+
+    /// @brief              Project points onto ellipsoid surface (bulk projection)
+    ///
+    ///                     The principal frame is computed once for all points.
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd points = ... ; // 3 x N
+    ///                     Array<Ellipsoid::Projection> projections = ellipsoid.projectPoints(points, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPointMatrix A 3 x N matrix of points (one point per column)
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             Array of projections (one per column)
+    Array<Ellipsoid::Projection> projectPoints(const MatrixXd& aPointMatrix, const Size& aThreadCount = 1) const;
+
     /// @brief              Get ellipsoid center
     ///
     /// @code{.cpp}
@@ -450,6 +511,11 @@ class Ellipsoid : public Object
     Real c_;
 
     Quaternion q_;
+
+    Matrix3d axes_;
+    Matrix3d matrix_;
+
+    void updateFrame();
 };
 
 }  // namespace object
@@ -3,9 +3,11 @@
 #define __OpenSpaceToolkit_Mathematics_Geometry_3D_Object_LineString__
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
 
@@ -21,9 +23,11 @@ namespace object
 {
 
 using ostk::core::container::Array;
+using ostk::core::container::Pair;
 using ostk::core::type::Index;
 using ostk::core::type::Size;
 
+using ostk::mathematics::geometry::d3::BoundingBox;
 using ostk::mathematics::geometry::d3::Object;
 using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::object::Vector3d;
@@ -39,6 +43,7 @@ class LineString : public Object
 {
    public:
     typedef Array<Point>::ConstIterator ConstIterator;
+    typedef Pair<Point, Real> Projection;  // Closest point on the line string, and its arc length from the first point
 
     /// @brief              Constructor
     ///
@@ -90,6 +95,17 @@ class LineString : public Object
     /// @return             True if line string is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of line string
+    ///
+    ///                     Computed upon construction and transformation.
+    ///
+    /// @code{.cpp}
+    ///                     LineString({ { 0.0, 0.0, 0.0 }, { 1.0, 2.0, 3.0 } }).getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if line string is empty
     ///
     /// @code{.cpp}
@@ -99,6 +115,15 @@ class LineString : public Object
     /// @return             True if line string is empty
     bool isEmpty() const;
 
+    /// @brief              Check if line string holds a segment index
+    ///
+    /// @code{.cpp}
+    ///                     LineString(...).isIndexed() ;
+    /// @endcode
+    ///
+    /// @return             True if line string holds a segment index
+    bool isIndexed() const;
+
     /// @brief              Check if line string is near another line string
     ///
     /// @code{.cpp}
@@ -143,6 +168,67 @@ class LineString : public Object
     /// @return             Closest point
     Point getPointClosestTo(const Point& aPoint) const;
 
+    /// @brief              Get length
+    ///
+    /// @code{.cpp}
+    ///                     LineString({ { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 1.0, 2.0, 0.0 } }).getLength() ; // 3.0
+    /// @endcode
+    ///
+    /// @return             Length
+    Real getLength() const;
+
+    /// @brief              Get distance to point
+    ///
+    /// @code{.cpp}
+    ///                     LineString({ { 0.0, 0.0, 0.0 }, { 2.0, 0.0, 0.0 } }).distanceTo({ 1.0, 1.0, 0.0 }) ; // 1.0
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @return             Distance to point
+    Real distanceTo(const Point& aPoint) const;
+
+    /// @brief              Project point onto line string
+    ///
+    ///                     Returns the closest point lying on the line string (not only among its vertices), along
+    ///                     with its arc length from the first point. Ties resolve to the lowest segment index.
+    ///
+    /// @code{.cpp}
+    ///                     LineString lineString = { { { 0.0, 0.0, 0.0 }, { 2.0, 0.0, 0.0 }, { 2.0, 2.0, 0.0 } } } ;
+    ///                     lineString.projectPoint({ 3.0, 1.0, 0.0 }) ; // [2.0, 1.0, 0.0], 3.0
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @return             Projection
+    LineString::Projection projectPoint(const Point& aPoint) const;
+
+    /// @brief              Simplify line string within a distance tolerance (Douglas-Peucker)
+    ///
+    ///                     End points are kept, and every point lies within the tolerance of the simplified line
+    ///                     string. Runs in O(n log n) on average.
+    ///
+    /// @code{.cpp}
+    ///                     LineString({ { 0.0, 0.0, 0.0 }, { 1.0, 0.1, 0.0 }, { 2.0, 0.0, 0.0 } }).simplify(0.5) ;
+    ///                     // [0.0, 0.0, 0.0], [2.0, 0.0, 0.0]
+    /// @endcode
+    ///
+    /// @param              [in] aTolerance A distance tolerance
+    /// @return             Simplified line string
+    LineString simplify(const Real& aTolerance) const;
+
+    /// @brief              Simplify line string down to a number of points (Visvalingam-Whyatt)
+    ///
+    ///                     Points spanning the smallest area with their neighbors are removed first, end points are
+    ///                     kept. Runs in O(n log n).
+    ///
+    /// @code{.cpp}
+    ///                     LineString({ { 0.0, 0.0, 0.0 }, { 1.0, 0.1, 0.0 }, { 2.0, 0.0, 0.0 } }).simplifyTo(2) ;
+    ///                     // [0.0, 0.0, 0.0], [2.0, 0.0, 0.0]
+    /// @endcode
+    ///
+    /// @param              [in] aPointCount A number of points (at least 2)
+    /// @return             Simplified line string
+    LineString simplifyTo(const Size& aPointCount) const;
+
     /// @brief              Print point
     ///
     /// @code{.cpp}
@@ -174,6 +260,20 @@ class LineString : public Object
     /// @return             End const iterator
     LineString::ConstIterator end() const;
 
+    /// @brief              Build a segment index over the line string
+    ///
+    ///                     Consecutive segments are grouped into a balanced hierarchy of axis-aligned bounding
+    ///                     boxes, so that getPointClosestTo, distanceTo and projectPoint only visit segments near
+    ///                     the query instead of scanning the whole line string. The index is rebuilt on
+    ///                     transformation.
+    ///
+    /// @code{.cpp}
+    ///                     LineString lineString = { ... } ;
+    ///                     lineString.buildIndex() ;
+    ///                     lineString.projectPoint(point) ;
+    /// @endcode
+    void buildIndex();
+
     /// @brief              Apply transformation to line string
     ///
     /// @code{.cpp}
@@ -204,7 +304,21 @@ class LineString : public Object
     static LineString Segment(const object::Segment& aSegment);
 
    private:
+    struct IndexNode
+    {
+        Vector3d lowerBound;
+        Vector3d upperBound;
+        Index offset;  ///< Leaf: first segment index, branch: index of second child node
+        Size count;    ///< Leaf: number of segments, branch: 0
+    };
+
     Array<Point> points_;
+
+    BoundingBox boundingBox_;
+
+    bool indexed_;
+    Array<IndexNode> indexNodes_;
+    Array<double> indexArcLengths_;
 };
 
 }  // namespace object
@@ -118,6 +118,15 @@ class Point : public Object
     /// @return             True if point is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of point
+    ///
+    /// @code{.cpp}
+    ///                     Point(1.0, 2.0, 3.0).getBoundingBox() ; // [1.0, 2.0, 3.0] - [1.0, 2.0, 3.0]
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if point is near another point
     ///
     /// @code
@@ -0,0 +1,318 @@
+/// Apache License 2.0
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud__
+#define __OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+namespace d3
+{
+namespace object
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d3::BoundingBox;
+using ostk::mathematics::geometry::d3::Object;
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+
+/// @brief                      Point cloud
+///
+///                             Packed point container indexed by a KD-tree, for nearest neighbor, k-nearest neighbors
+///                             and radius queries over large catalogues. Unlike PointSet, points keep their insertion
+///                             order (queries return indices into it) and duplicates are preserved.
+///
+///                             Coordinates are stored column-wise (all x, then all y, then all z) and permuted so that
+///                             the points of each tree leaf are contiguous in memory.
+///
+/// @code{.cpp}
+///                             PointCloud pointCloud({ { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 } }) ;
+///                             Index index = pointCloud.findNearestNeighbor({ 0.9, 0.0, 0.0 }) ; // 1
+/// @endcode
+class PointCloud : public Object
+{
+   public:
+    /// @brief              Constructor
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud pointCloud({ { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 } }) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPointArray A point array
+    PointCloud(const Array<Point>& aPointArray);
+
+    /// @brief              Clone point cloud
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud* pointCloudPtr = PointCloud({ { 0.0, 0.0, 0.0 } }).clone() ;
+    /// @endcode
+    ///
+    /// @return             Pointer to cloned point cloud
+    virtual PointCloud* clone() const override;
+
+    /// @brief              Equal to operator
+    ///
+    ///                     Point clouds are equal if they hold the same points in the same order.
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud({ { 0.0, 0.0, 0.0 } }) == PointCloud({ { 0.0, 0.0, 0.0 } }) ; // True
+    /// @endcode
+    ///
+    /// @param              [in] aPointCloud A point cloud
+    /// @return             True if point clouds are equal
+    bool operator==(const PointCloud& aPointCloud) const;
+
+    /// @brief              Not equal to operator
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud({ { 0.0, 0.0, 0.0 } }) != PointCloud({ { 1.0, 0.0, 0.0 } }) ; // True
+    /// @endcode
+    ///
+    /// @param              [in] aPointCloud A point cloud
+    /// @return             True if point clouds are not equal
+    bool operator!=(const PointCloud& aPointCloud) const;
+
+    /// @brief              Check if point cloud is defined
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud({ { 0.0, 0.0, 0.0 } }).isDefined() ; // True
+    /// @endcode
+    ///
+    /// @return             True if point cloud is defined
+    virtual bool isDefined() const override;
+
+    /// @brief              Get axis-aligned bounding box of point cloud
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud({ { 0.0, 0.0, 0.0 }, { 1.0, 2.0, 3.0 } }).getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
+    /// @brief              Check if point cloud is empty
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud::Empty().isEmpty() ; // True
+    /// @endcode
+    ///
+    /// @return             True if point cloud is empty
+    bool isEmpty() const;
+
+    /// @brief              Get number of points
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud({ { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 } }).getSize() ; // 2
+    /// @endcode
+    ///
+    /// @return             Number of points
+    Size getSize() const;
+
+    /// @brief              Get point at index
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud({ { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 } }).getPointAt(1) ; // [1.0, 0.0, 0.0]
+    /// @endcode
+    ///
+    /// @param              [in] anIndex An index (in insertion order)
+    /// @return             Point
+    Point getPointAt(const Index& anIndex) const;
+
+    /// @brief              Get points as a matrix
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd points = pointCloud.getPoints() ; // N x 3
+    /// @endcode
+    ///
+    /// @return             N x 3 matrix of points (one point per row, in insertion order)
+    MatrixXd getPoints() const;
+
+    /// @brief              Get distance to point
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud({ { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 } }).distanceTo({ 2.0, 0.0, 0.0 }) ; // 1.0
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @return             Distance to closest point of point cloud
+    Real distanceTo(const Point& aPoint) const;
+
+    /// @brief              Get point closest to another point
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud({ { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 } }).getPointClosestTo({ 0.9, 0.0, 0.0 }) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @return             Closest point
+    Point getPointClosestTo(const Point& aPoint) const;
+
+    /// @brief              Find nearest neighbor of point
+    ///
+    ///                     Ties are broken in favor of the lowest index.
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud({ { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 } }).findNearestNeighbor({ 0.9, 0.0, 0.0 }) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @return             Index of nearest point
+    Index findNearestNeighbor(const Point& aPoint) const;
+
+    /// @brief              Find nearest neighbors of points (bulk query)
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd points = ... ; // M x 3
+    ///                     Array<Index> indices = pointCloud.findNearestNeighbor(points, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPointMatrix A M x 3 matrix of points (one point per row)
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             Index of nearest point, for each row
+    Array<Index> findNearestNeighbor(const MatrixXd& aPointMatrix, const Size& aThreadCount = 1) const;
+
+    /// @brief              Find k nearest neighbors of point
+    ///
+    /// @code{.cpp}
+    ///                     Array<Index> indices = pointCloud.findNearestNeighbors({ 0.0, 0.0, 0.0 }, 8) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @param              [in] aNeighborCount A number of neighbors
+    /// @return             Indices of the min(k, N) nearest points, by increasing distance
+    Array<Index> findNearestNeighbors(const Point& aPoint, const Size& aNeighborCount) const;
+
+    /// @brief              Find k nearest neighbors of points (bulk query)
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd points = ... ; // M x 3
+    ///                     Array<Array<Index>> indices = pointCloud.findNearestNeighbors(points, 8, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPointMatrix A M x 3 matrix of points (one point per row)
+    /// @param              [in] aNeighborCount A number of neighbors
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             Indices of the nearest points by increasing distance, for each row
+    Array<Array<Index>> findNearestNeighbors(
+        const MatrixXd& aPointMatrix, const Size& aNeighborCount, const Size& aThreadCount = 1
+    ) const;
+
+    /// @brief              Find neighbors of point within radius
+    ///
+    /// @code{.cpp}
+    ///                     Array<Index> indices = pointCloud.findNeighborsWithinRadius({ 0.0, 0.0, 0.0 }, 10.0) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @param              [in] aRadius A radius
+    /// @return             Indices of the points at distance lower than or equal to radius, by increasing distance
+    Array<Index> findNeighborsWithinRadius(const Point& aPoint, const Real& aRadius) const;
+
+    /// @brief              Find neighbors of points within radius (bulk query)
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd points = ... ; // M x 3
+    ///                     Array<Array<Index>> indices = pointCloud.findNeighborsWithinRadius(points, 10.0, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPointMatrix A M x 3 matrix of points (one point per row)
+    /// @param              [in] aRadius A radius
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             Indices of the points within radius by increasing distance, for each row
+    Array<Array<Index>> findNeighborsWithinRadius(
+        const MatrixXd& aPointMatrix, const Real& aRadius, const Size& aThreadCount = 1
+    ) const;
+
+    /// @brief              Print point cloud
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud({ { 0.0, 0.0, 0.0 } }).print(std::cout, true) ;
+    /// @endcode
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] (optional) displayDecorators If true, display decorators
+    virtual void print(std::ostream& anOutputStream, bool displayDecorators = true) const override;
+
+    /// @brief              Apply transformation to point cloud
+    ///
+    ///                     The KD-tree is rebuilt.
+    ///
+    /// @code{.cpp}
+    ///                     pointCloud.applyTransformation(Transformation::Identity()) ;
+    /// @endcode
+    ///
+    /// @param              [in] aTransformation A transformation
+    virtual void applyTransformation(const Transformation& aTransformation) override;
+
+    /// @brief              Constructs an empty point cloud
+    ///
+    /// @code{.cpp}
+    ///                     PointCloud pointCloud = PointCloud::Empty() ;
+    /// @endcode
+    ///
+    /// @return             Empty point cloud
+    static PointCloud Empty();
+
+    /// @brief              Constructs a point cloud from a matrix of points
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd points = ... ; // N x 3
+    ///                     PointCloud pointCloud = PointCloud::Matrix(points) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPointMatrix A N x 3 matrix of points (one point per row)
+    /// @return             Point cloud
+    static PointCloud Matrix(const MatrixXd& aPointMatrix);
+
+   private:
+    // KD-tree node: a leaf (count > 0) spans [offset, offset + count) in tree order, a branch (count == 0) has its
+    // first child at the next node and its second child at offset
+
+    struct Node
+    {
+        Vector3d lowerBound;
+        Vector3d upperBound;
+        Index offset;
+        Size count;
+    };
+
+    MatrixXd points_;
+    Array<Index> indices_;
+    Array<Index> positions_;
+    Array<PointCloud::Node> nodes_;
+
+    void build(const MatrixXd& aPointMatrix);
+
+    void searchNearest(const Vector3d& aPoint, Index& aPosition, double& aSquaredDistance) const;
+
+    void searchNearest(const Vector3d& aPoint, const Size& aNeighborCount, Array<Index>& anIndexArray) const;
+
+    void searchWithinRadius(const Vector3d& aPoint, const double aSquaredRadius, Array<Index>& anIndexArray) const;
+};
+
+}  // namespace object
+}  // namespace d3
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
@@ -8,6 +8,7 @@
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
 
@@ -26,6 +27,7 @@ using ostk::core::container::Array;
 using ostk::core::type::Index;
 using ostk::core::type::Size;
 
+using ostk::mathematics::geometry::d3::BoundingBox;
 using ostk::mathematics::geometry::d3::Object;
 using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::object::Vector3d;
@@ -113,6 +115,17 @@ class PointSet : public Object
     /// @return             True if point set is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of point set
+    ///
+    ///                     Computed upon construction and transformation.
+    ///
+    /// @code{.cpp}
+    ///                     PointSet({ { 0.0, 0.0, 0.0 }, { 1.0, 2.0, 3.0 } }).getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if point set is empty
     ///
     /// @code
@@ -216,6 +229,8 @@ class PointSet : public Object
 
    private:
     PointSet::Container points_;
+
+    BoundingBox boundingBox_;
 };
 
 }  // namespace object
@@ -7,6 +7,7 @@
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/LineString.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Plane.hpp>
@@ -29,6 +30,7 @@ using ostk::core::container::Index;
 using ostk::core::container::Size;
 
 using Polygon2d = ostk::mathematics::geometry::d2::object::Polygon;
+using ostk::mathematics::geometry::d3::BoundingBox;
 using ostk::mathematics::geometry::d3::Object;
 using ostk::mathematics::geometry::d3::object::LineString;
 using ostk::mathematics::geometry::d3::object::Plane;
@@ -111,6 +113,17 @@ class Polygon : public Object
     /// @return             True if polygon is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of polygon
+    ///
+    ///                     Computed upon construction and transformation, from the outer ring vertices.
+    ///
+    /// @code{.cpp}
+    ///                     polygon.getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if polygon is near another polygon
     ///
     /// @code{.cpp}
@@ -279,6 +292,8 @@ class Polygon : public Object
 
     Vector3d xAxis_;
     Vector3d yAxis_;
+
+    BoundingBox boundingBox_;
 };
 
 }  // namespace object
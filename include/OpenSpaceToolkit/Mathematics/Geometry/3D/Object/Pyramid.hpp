@@ -10,6 +10,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Polygon.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 namespace ostk
 {
@@ -31,6 +32,7 @@ using ostk::mathematics::geometry::d3::Object;
 using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::geometry::d3::object::Polygon;
 using ostk::mathematics::geometry::d3::object::Ray;
+using ostk::mathematics::object::MatrixXd;
 
 #define DEFAULT_ONLY_IN_SIGHT false
 #define DEFAULT_DISCRETIZATION_LEVEL 40
@@ -172,6 +174,18 @@ class Pyramid : public Object
     /// @return             True if pyramid contains segment
     bool contains(const Segment& aSegment) const;
 
+    /// @brief              Check if pyramid contains points (bulk containment)
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd points = ... ; // N x 3
+    ///                     Array<bool> mask = pyramid.contains(points, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] aPointMatrix A N x 3 matrix of points (one point per row)
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             True if pyramid contains point, for each row
+    Array<bool> contains(const MatrixXd& aPointMatrix, const Size& aThreadCount = 1) const;
+
     /// @brief              Check if pyramid contains ellipsoid
     ///
     /// @code{.cpp}
@@ -317,6 +331,11 @@ class Pyramid : public Object
    private:
     Polygon base_;
     Point apex_;
+
+    Vector3d baseDirection_;
+    Array<Vector3d> lateralFaceNormals_;
+
+    void updateLateralFaceNormals();
 };
 
 }  // namespace object
@@ -94,6 +94,15 @@ class Segment : public Object
     /// @return             True if segment is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of segment
+    ///
+    /// @code{.cpp}
+    ///                     Segment({ 0.0, 0.0, 0.0 }, { 1.0, 2.0, 3.0 }).getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if segment is degenerate, i.e. its length is zero
     ///
     /// @code
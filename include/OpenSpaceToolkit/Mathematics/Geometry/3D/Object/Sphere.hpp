@@ -96,6 +96,15 @@ class Sphere : public Object
     /// @return             True if sphere is defined
     virtual bool isDefined() const override;
 
+    /// @brief              Get axis-aligned bounding box of sphere
+    ///
+    /// @code{.cpp}
+    ///                     Sphere(Point::Origin(), 1.0).getBoundingBox() ; // [-1.0, -1.0, -1.0] - [1.0, 1.0, 1.0]
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
     /// @brief              Check if sphere is unitary, i.e. its radius is equal to 1.0
     ///
     /// @code
@@ -0,0 +1,298 @@
+/// Apache License 2.0
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh__
+#define __OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+namespace d3
+{
+namespace object
+{
+
+using ostk::core::container::Array;
+using ostk::core::container::Tuple;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d3::BoundingBox;
+using ostk::mathematics::geometry::d3::Intersection;
+using ostk::mathematics::geometry::d3::Object;
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::MatrixXi;
+using ostk::mathematics::object::Vector3d;
+
+class Ray;
+
+/// @brief                      Triangle mesh
+///
+///                             Indexed triangle mesh (shared vertex buffer plus index buffer) with a bounding volume
+///                             hierarchy, for ray casting against detailed surfaces such as spacecraft models or
+///                             terrain. Triangles are two-sided.
+///
+///                             The hierarchy is built top-down with the surface area heuristic (SAH) over binned
+///                             triangle centroids, and the triangles are permuted so that those of each leaf are
+///                             contiguous in memory.
+///
+/// @code{.cpp}
+///                             MatrixXd vertices = ... ; // N x 3
+///                             MatrixXi triangles = ... ; // M x 3
+///                             TriangleMesh mesh = { vertices, triangles } ;
+///                             bool isShadowed = mesh.intersects(Ray(point, sunDirection)) ;
+/// @endcode
+///
+/// @ref                        https://en.wikipedia.org/wiki/Bounding_volume_hierarchy
+class TriangleMesh : public Object
+{
+   public:
+    typedef Tuple<Index, Real, Point> Hit;  // Triangle index, distance along the ray and point of the first hit
+
+    /// @brief              Constructor
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd vertices(3, 3) ;
+    ///                     vertices << 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0 ;
+    ///                     MatrixXi triangles(1, 3) ;
+    ///                     triangles << 0, 1, 2 ;
+    ///                     TriangleMesh mesh = { vertices, triangles } ;
+    /// @endcode
+    ///
+    /// @param              [in] aVertexMatrix A N x 3 matrix of vertices (one vertex per row)
+    /// @param              [in] aTriangleMatrix A M x 3 matrix of vertex indices (one triangle per row)
+    TriangleMesh(const MatrixXd& aVertexMatrix, const MatrixXi& aTriangleMatrix);
+
+    /// @brief              Clone triangle mesh
+    ///
+    /// @code{.cpp}
+    ///                     TriangleMesh* meshPtr = mesh.clone() ;
+    /// @endcode
+    ///
+    /// @return             Pointer to cloned triangle mesh
+    virtual TriangleMesh* clone() const override;
+
+    /// @brief              Equal to operator
+    ///
+    ///                     Triangle meshes are equal if they hold the same vertices and triangles in the same order.
+    ///
+    /// @code{.cpp}
+    ///                     TriangleMesh(vertices, triangles) == TriangleMesh(vertices, triangles) ; // True
+    /// @endcode
+    ///
+    /// @param              [in] aTriangleMesh A triangle mesh
+    /// @return             True if triangle meshes are equal
+    bool operator==(const TriangleMesh& aTriangleMesh) const;
+
+    /// @brief              Not equal to operator
+    ///
+    /// @code{.cpp}
+    ///                     TriangleMesh(vertices, triangles) != TriangleMesh::Undefined() ; // True
+    /// @endcode
+    ///
+    /// @param              [in] aTriangleMesh A triangle mesh
+    /// @return             True if triangle meshes are not equal
+    bool operator!=(const TriangleMesh& aTriangleMesh) const;
+
+    /// @brief              Check if triangle mesh is defined
+    ///
+    ///                     A triangle mesh is defined if it holds at least one triangle.
+    ///
+    /// @code{.cpp}
+    ///                     TriangleMesh(vertices, triangles).isDefined() ; // True
+    /// @endcode
+    ///
+    /// @return             True if triangle mesh is defined
+    virtual bool isDefined() const override;
+
+    /// @brief              Get axis-aligned bounding box of triangle mesh
+    ///
+    /// @code{.cpp}
+    ///                     TriangleMesh(vertices, triangles).getBoundingBox() ;
+    /// @endcode
+    ///
+    /// @return             Bounding box
+    virtual BoundingBox getBoundingBox() const override;
+
+    /// @brief              Check if triangle mesh intersects ray (any hit)
+    ///
+    ///                     Traversal stops at the first triangle found, which makes occlusion tests cheaper than a
+    ///                     first hit search. The ray origin belongs to the ray.
+    ///
+    /// @code{.cpp}
+    ///                     mesh.intersects(Ray({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 })) ;
+    /// @endcode
+    ///
+    /// @param              [in] aRay A ray
+    /// @return             True if triangle mesh intersects ray
+    bool intersects(const Ray& aRay) const;
+
+    /// @brief              Check if triangle mesh intersects rays (bulk any hit)
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd origins = ... ; // M x 3
+    ///                     MatrixXd directions = ... ; // M x 3
+    ///                     Array<bool> hits = mesh.intersects(origins, directions, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] anOriginMatrix A M x 3 matrix of ray origins (one ray per row)
+    /// @param              [in] aDirectionMatrix A M x 3 matrix of non-zero ray directions (one ray per row)
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             True if triangle mesh intersects ray, for each row
+    Array<bool> intersects(
+        const MatrixXd& anOriginMatrix, const MatrixXd& aDirectionMatrix, const Size& aThreadCount = 1
+    ) const;
+
+    /// @brief              Get number of vertices
+    ///
+    /// @code{.cpp}
+    ///                     TriangleMesh(vertices, triangles).getVertexCount() ;
+    /// @endcode
+    ///
+    /// @return             Number of vertices
+    Size getVertexCount() const;
+
+    /// @brief              Get number of triangles
+    ///
+    /// @code{.cpp}
+    ///                     TriangleMesh(vertices, triangles).getTriangleCount() ;
+    /// @endcode
+    ///
+    /// @return             Number of triangles
+    Size getTriangleCount() const;
+
+    /// @brief              Get vertices
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd vertices = mesh.getVertices() ; // N x 3
+    /// @endcode
+    ///
+    /// @return             N x 3 matrix of vertices (one vertex per row)
+    MatrixXd getVertices() const;
+
+    /// @brief              Get triangles
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXi triangles = mesh.getTriangles() ; // M x 3
+    /// @endcode
+    ///
+    /// @return             M x 3 matrix of vertex indices (one triangle per row, in insertion order)
+    MatrixXi getTriangles() const;
+
+    /// @brief              Compute intersection of triangle mesh with ray (first hit)
+    ///
+    /// @code{.cpp}
+    ///                     Intersection intersection = mesh.intersectionWith(ray) ;
+    /// @endcode
+    ///
+    /// @param              [in] aRay A ray
+    /// @return             Point intersection at the first hit, empty intersection if ray misses triangle mesh
+    Intersection intersectionWith(const Ray& aRay) const;
+
+    /// @brief              Cast ray onto triangle mesh (first hit)
+    ///
+    ///                     If the ray misses the triangle mesh, the distance and point are undefined and the triangle
+    ///                     index equals the triangle count.
+    ///
+    /// @code{.cpp}
+    ///                     const auto [triangleIndex, distance, point] = mesh.castRay(ray) ;
+    /// @endcode
+    ///
+    /// @param              [in] aRay A ray
+    /// @return             Hit
+    TriangleMesh::Hit castRay(const Ray& aRay) const;
+
+    /// @brief              Cast rays onto triangle mesh (bulk first hit)
+    ///
+    ///                     Distances are expressed in units of the normalized ray directions, as for Ray.
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd origins = ... ; // M x 3
+    ///                     MatrixXd directions = ... ; // M x 3
+    ///                     Array<TriangleMesh::Hit> hits = mesh.castRays(origins, directions, 4) ;
+    /// @endcode
+    ///
+    /// @param              [in] anOriginMatrix A M x 3 matrix of ray origins (one ray per row)
+    /// @param              [in] aDirectionMatrix A M x 3 matrix of non-zero ray directions (one ray per row)
+    /// @param              [in] (optional) aThreadCount A number of threads
+    /// @return             Hit, for each row
+    Array<TriangleMesh::Hit> castRays(
+        const MatrixXd& anOriginMatrix, const MatrixXd& aDirectionMatrix, const Size& aThreadCount = 1
+    ) const;
+
+    /// @brief              Print triangle mesh
+    ///
+    /// @code{.cpp}
+    ///                     TriangleMesh(vertices, triangles).print(std::cout, true) ;
+    /// @endcode
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] (optional) displayDecorators If true, display decorators
+    virtual void print(std::ostream& anOutputStream, bool displayDecorators = true) const override;
+
+    /// @brief              Apply transformation to triangle mesh
+    ///
+    ///                     The vertices are transformed and the hierarchy is rebuilt.
+    ///
+    /// @code{.cpp}
+    ///                     mesh.applyTransformation(Transformation::Identity()) ;
+    /// @endcode
+    ///
+    /// @param              [in] aTransformation A transformation
+    virtual void applyTransformation(const Transformation& aTransformation) override;
+
+    /// @brief              Constructs an undefined triangle mesh
+    ///
+    /// @code{.cpp}
+    ///                     TriangleMesh mesh = TriangleMesh::Undefined() ; // Undefined
+    /// @endcode
+    ///
+    /// @return             Undefined triangle mesh
+    static TriangleMesh Undefined();
+
+   private:
+    // Hierarchy node: a leaf (count > 0) spans [offset, offset + count) in hierarchy order, a branch (count == 0) has
+    // its first child at the next node and its second child at offset
+
+    struct Node
+    {
+        Vector3d lowerBound;
+        Vector3d upperBound;
+        Index offset;
+        Size count;
+    };
+
+    MatrixXd vertices_;
+    MatrixXi triangles_;
+    MatrixXd faces_;
+    Array<Index> indices_;
+    Array<TriangleMesh::Node> nodes_;
+
+    void build();
+
+    bool cast(
+        const Vector3d& anOrigin, const Vector3d& aDirection, const bool isAnyHit, Index& aPosition, double& aDistance
+    ) const;
+};
+
+}  // namespace object
+}  // namespace d3
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
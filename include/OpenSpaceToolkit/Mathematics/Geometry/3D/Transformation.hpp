@@ -31,6 +31,7 @@ using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
 using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
 using ostk::mathematics::object::Matrix4d;
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::Vector4d;
 
@@ -214,6 +215,33 @@ class Transformation
     /// @return             The transformed vector
     Vector3d applyTo(const Vector3d& aVector) const;
 
+    /// @brief              Apply the transformation to points, in place
+    ///
+    ///                     Each column of the 3 x N matrix is a point. The kernel is picked from the transformation
+    ///                     type: nothing is done for the identity, a translation only adds an offset, and other
+    ///                     types apply the 3x3 linear part plus the translation, instead of a homogeneous product.
+    ///                     Blocks and maps over external buffers are accepted, as long as columns are contiguous.
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd points = ... ; // 3 x N
+    ///                     Transformation::Translation({1.0, 2.0, 3.0}).applyToPoints(points) ;
+    /// @endcode
+    ///
+    /// @param              [in, out] aPointMatrix A 3 x N point matrix
+    void applyToPoints(Eigen::Ref<MatrixXd> aPointMatrix) const;
+
+    /// @brief              Apply the transformation to vectors, in place
+    ///
+    ///                     Each column of the 3 x N matrix is a vector. Vectors are not translated.
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd velocities = ... ; // 3 x N
+    ///                     Transformation::Rotation(...).applyToVectors(velocities) ;
+    /// @endcode
+    ///
+    /// @param              [in, out] aVectorMatrix A 3 x N vector matrix
+    void applyToVectors(Eigen::Ref<MatrixXd> aVectorMatrix) const;
+
     /// @brief              Print transformation
     ///
     /// @code{.cpp}
@@ -0,0 +1,231 @@
+/// Apache License 2.0
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation__
+#define __OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation__
+
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+namespace d3
+{
+namespace transformation
+{
+
+using ostk::core::type::Real;
+
+using ostk::mathematics::geometry::Angle;
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::Vector4d;
+
+/// @brief                      3D rigid transformation
+///
+/// @details                    A proper rigid transformation (rotation followed by translation), stored as a unit
+///                             quaternion and a translation vector: x' = q * x + t, with q * x the rotation of x
+///                             by the quaternion (Quaternion::rotateVector).
+///
+///                             Compared to a general Transformation, composition and inversion never touch a 4x4
+///                             matrix and never reclassify the result, which keeps long frame chains cheap.
+///
+/// @code{.cpp}
+///                             RigidTransformation t = {Quaternion::Unit(), {1.0, 0.0, 0.0}};
+///                             Point p = (t * t.getInverse()).applyTo(Point(1.0, 2.0, 3.0));  // (1.0, 2.0, 3.0)
+/// @endcode
+class RigidTransformation
+{
+   public:
+    /// @brief              Constructor
+    ///
+    /// @code{.cpp}
+    ///                     RigidTransformation t = {Quaternion::Unit(), {1.0, 2.0, 3.0}};
+    /// @endcode
+    ///
+    /// @param              [in] aRotation A rotation quaternion, normalized on construction
+    /// @param              [in] aTranslation A translation vector
+    RigidTransformation(const Quaternion& aRotation, const Vector3d& aTranslation);
+
+    /// @brief              Equality operator
+    ///
+    /// @param              [in] aRigidTransformation A rigid transformation
+    /// @return             True if rigid transformations are equal
+    bool operator==(const RigidTransformation& aRigidTransformation) const;
+
+    /// @brief              Inequality operator
+    ///
+    /// @param              [in] aRigidTransformation A rigid transformation
+    /// @return             True if rigid transformations are not equal
+    bool operator!=(const RigidTransformation& aRigidTransformation) const;
+
+    /// @brief              Composition operator
+    ///
+    /// @details            (a * b).applyTo(x) == a.applyTo(b.applyTo(x))
+    ///
+    /// @code{.cpp}
+    ///                     RigidTransformation t = a * b;
+    /// @endcode
+    ///
+    /// @param              [in] aRigidTransformation A rigid transformation, applied first
+    /// @return             The composed rigid transformation
+    RigidTransformation operator*(const RigidTransformation& aRigidTransformation) const;
+
+    /// @brief              Composition assignment operator
+    ///
+    /// @param              [in] aRigidTransformation A rigid transformation, applied first
+    /// @return             Reference to the modified rigid transformation
+    RigidTransformation& operator*=(const RigidTransformation& aRigidTransformation);
+
+    /// @brief              Output stream operator
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] aRigidTransformation A rigid transformation
+    /// @return             Reference to the output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const RigidTransformation& aRigidTransformation);
+
+    /// @brief              Check if the rigid transformation is defined
+    ///
+    /// @return             True if defined
+    bool isDefined() const;
+
+    /// @brief              Check if the rigid transformation is near another one
+    ///
+    /// @code{.cpp}
+    ///                     a.isNear(b, Angle::Arcseconds(1.0), 1e-9);
+    /// @endcode
+    ///
+    /// @param              [in] aRigidTransformation A rigid transformation
+    /// @param              [in] anAngularTolerance An angular tolerance on the rotations
+    /// @param              [in] aTranslationTolerance A tolerance on the translation norm difference
+    /// @return             True if both the rotations and the translations are within tolerance
+    bool isNear(
+        const RigidTransformation& aRigidTransformation,
+        const Angle& anAngularTolerance,
+        const Real& aTranslationTolerance
+    ) const;
+
+    /// @brief              Get rotation
+    ///
+    /// @return             The unit rotation quaternion
+    Quaternion getRotation() const;
+
+    /// @brief              Get translation
+    ///
+    /// @return             The translation vector
+    Vector3d getTranslation() const;
+
+    /// @brief              Get inverse, in constant time
+    ///
+    /// @code{.cpp}
+    ///                     RigidTransformation inverse = t.getInverse();
+    /// @endcode
+    ///
+    /// @return             The inverse rigid transformation
+    RigidTransformation getInverse() const;
+
+    /// @brief              Apply rigid transformation to a point
+    ///
+    /// @param              [in] aPoint A point
+    /// @return             The transformed point
+    Point applyTo(const Point& aPoint) const;
+
+    /// @brief              Apply rigid transformation to a vector (rotation only)
+    ///
+    /// @param              [in] aVector A vector
+    /// @return             The rotated vector
+    Vector3d applyTo(const Vector3d& aVector) const;
+
+    /// @brief              Apply rigid transformation in place to a 3 x N matrix of points (one per column)
+    ///
+    /// @param              [in, out] aPointMatrix A 3 x N point matrix
+    void applyToPoints(Eigen::Ref<MatrixXd> aPointMatrix) const;
+
+    /// @brief              Convert to a general transformation
+    ///
+    /// @code{.cpp}
+    ///                     Transformation transformation = t.toTransformation();
+    /// @endcode
+    ///
+    /// @return             The equivalent transformation
+    d3::Transformation toTransformation() const;
+
+    /// @brief              Print rigid transformation
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] (optional) displayDecorators If true, display decorators
+    void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
+
+    /// @brief              Constructs an undefined rigid transformation
+    ///
+    /// @return             Undefined rigid transformation
+    static RigidTransformation Undefined();
+
+    /// @brief              Constructs an identity rigid transformation
+    ///
+    /// @return             Identity rigid transformation
+    static RigidTransformation Identity();
+
+    /// @brief              Constructs a pure translation
+    ///
+    /// @param              [in] aTranslation A translation vector
+    /// @return             Rigid transformation
+    static RigidTransformation Translation(const Vector3d& aTranslation);
+
+    /// @brief              Constructs a pure rotation
+    ///
+    /// @param              [in] aRotation A rotation quaternion
+    /// @return             Rigid transformation
+    static RigidTransformation Rotation(const Quaternion& aRotation);
+
+    /// @brief              Constructs a rigid transformation from a general transformation
+    ///
+    /// @details            Throws if the transformation is not rigid, or if it is a reflection.
+    ///
+    /// @code{.cpp}
+    ///                     RigidTransformation t = RigidTransformation::Transformation(Transformation::Identity());
+    /// @endcode
+    ///
+    /// @param              [in] aTransformation A transformation
+    /// @return             Rigid transformation
+    static RigidTransformation Transformation(const d3::Transformation& aTransformation);
+
+    /// @brief              Interpolate between two rigid transformations
+    ///
+    /// @details            The rotation is interpolated with SLERP, and the translation linearly.
+    ///
+    /// @code{.cpp}
+    ///                     RigidTransformation t = RigidTransformation::Interpolate(a, b, 0.5);
+    /// @endcode
+    ///
+    /// @param              [in] aFirstRigidTransformation A first rigid transformation (ratio 0)
+    /// @param              [in] aSecondRigidTransformation A second rigid transformation (ratio 1)
+    /// @param              [in] aRatio A ratio, in [0, 1]
+    /// @return             Interpolated rigid transformation
+    static RigidTransformation Interpolate(
+        const RigidTransformation& aFirstRigidTransformation,
+        const RigidTransformation& aSecondRigidTransformation,
+        const Real& aRatio
+    );
+
+   private:
+    Vector4d rotation_;  ///< Unit quaternion, in XYZS format
+    Vector3d translation_;
+};
+
+}  // namespace transformation
+}  // namespace d3
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
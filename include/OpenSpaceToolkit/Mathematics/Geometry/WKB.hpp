@@ -0,0 +1,364 @@
+/// Apache License 2.0
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_WKB__
+#define __OpenSpaceToolkit_Mathematics_Geometry_WKB__
+
+#include <cstdint>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/LineString.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/MultiPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/LineString.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/PointSet.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+/// @brief                      Well-Known Binary (WKB) encoding of 2D and 3D geometries
+///
+///                             2D points, point sets (as multi-points), line strings, polygons and multi-polygons, and
+///                             3D points, point sets and line strings (as ISO Z geometries) are supported. Undefined
+///                             points are encoded with NaN coordinates, undefined or empty geometries without any
+///                             element.
+///
+///                             Geometries are appended to a writer buffer, and read back one after the other by a
+///                             reader, either over memory owned by the caller or over a memory-mapped file. Readers do
+///                             not copy the underlying bytes.
+///
+/// @code{.cpp}
+///                             WKB::Buffer buffer = WKB::Encode(polygon) ;
+///                             Polygon decodedPolygon = WKB::Reader(buffer).readPolygon2d() ;
+/// @endcode
+///
+/// @ref                        https://libgeos.org/specifications/wkb/
+class WKB
+{
+   public:
+    typedef Array<std::uint8_t> Buffer;
+
+    enum class ByteOrder
+    {
+
+        BigEndian,    ///< Big endian (XDR)
+        LittleEndian  ///< Little endian (NDR)
+
+    };
+
+    enum class Type
+    {
+
+        Undefined,    ///< Undefined type
+        Point,        ///< Point
+        LineString,   ///< Line string
+        Polygon,      ///< Polygon
+        MultiPoint,   ///< Multi-point
+        MultiPolygon  ///< Multi-polygon
+
+    };
+
+    /// @brief                  WKB writer, appending geometries to a buffer
+    ///
+    /// @code{.cpp}
+    ///                         WKB::Writer writer ;
+    ///                         writer.write(firstPolygon) ;
+    ///                         writer.write(secondPolygon) ;
+    ///                         const WKB::Buffer& buffer = writer.accessBuffer() ;
+    /// @endcode
+    class Writer
+    {
+       public:
+        /// @brief              Constructor
+        ///
+        /// @param              [in] aByteOrder A byte order
+        Writer(const WKB::ByteOrder& aByteOrder = WKB::ByteOrder::LittleEndian);
+
+        /// @brief              Access buffer
+        ///
+        /// @return             Reference to buffer
+        const WKB::Buffer& accessBuffer() const;
+
+        /// @brief              Get buffer
+        ///
+        /// @return             Buffer
+        WKB::Buffer getBuffer() const;
+
+        /// @brief              Reserve buffer capacity
+        ///
+        /// @param              [in] aByteCount A number of bytes
+        void reserve(const Size& aByteCount);
+
+        /// @brief              Write 2D point
+        ///
+        /// @param              [in] aPoint A point
+        void write(const d2::object::Point& aPoint);
+
+        /// @brief              Write 2D point set, as a multi-point
+        ///
+        /// @param              [in] aPointSet A point set
+        void write(const d2::object::PointSet& aPointSet);
+
+        /// @brief              Write 2D line string
+        ///
+        /// @param              [in] aLineString A line string
+        void write(const d2::object::LineString& aLineString);
+
+        /// @brief              Write 2D polygon, with closed rings
+        ///
+        /// @param              [in] aPolygon A polygon
+        void write(const d2::object::Polygon& aPolygon);
+
+        /// @brief              Write 2D multi-polygon
+        ///
+        /// @param              [in] aMultiPolygon A multi-polygon
+        void write(const d2::object::MultiPolygon& aMultiPolygon);
+
+        /// @brief              Write 3D point
+        ///
+        /// @param              [in] aPoint A point
+        void write(const d3::object::Point& aPoint);
+
+        /// @brief              Write 3D point set, as a multi-point
+        ///
+        /// @param              [in] aPointSet A point set
+        void write(const d3::object::PointSet& aPointSet);
+
+        /// @brief              Write 3D line string
+        ///
+        /// @param              [in] aLineString A line string
+        void write(const d3::object::LineString& aLineString);
+
+        /// @brief              Clear buffer
+        void clear();
+
+       private:
+        WKB::ByteOrder byteOrder_;
+        WKB::Buffer buffer_;
+    };
+
+    /// @brief                  WKB reader, decoding consecutive geometries without copying the underlying bytes
+    ///
+    ///                         Both byte orders are read, with ISO (type code + 1000) or extended (0x80000000 flag)
+    ///                         Z geometries.
+    ///
+    /// @code{.cpp}
+    ///                         WKB::Reader reader = WKB::Reader::Map(File::Path(Path::Parse("/path/to/file.wkb"))) ;
+    ///                         while (!reader.isEnd())
+    ///                         {
+    ///                             const Polygon polygon = reader.readPolygon2d() ;
+    ///                         }
+    /// @endcode
+    class Reader
+    {
+       public:
+        /// @brief              Constructor, viewing memory owned by the caller
+        ///
+        /// @param              [in] aDataPtr A pointer to data
+        /// @param              [in] aByteCount A number of bytes
+        Reader(const std::uint8_t* aDataPtr, const Size& aByteCount);
+
+        /// @brief              Constructor, viewing a buffer owned by the caller
+        ///
+        /// @param              [in] aBuffer A buffer
+        Reader(const WKB::Buffer& aBuffer);
+
+        /// @brief              Constructor, taking ownership of a buffer
+        ///
+        /// @param              [in] aBuffer A buffer
+        Reader(WKB::Buffer&& aBuffer);
+
+        /// @brief              Check if all geometries have been read
+        ///
+        /// @return             True if reader is at the end of the data
+        bool isEnd() const;
+
+        /// @brief              Get offset of next geometry
+        ///
+        /// @return             Offset (in bytes)
+        Size getOffset() const;
+
+        /// @brief              Get number of bytes
+        ///
+        /// @return             Number of bytes
+        Size getByteCount() const;
+
+        /// @brief              Get type of next geometry, without reading it
+        ///
+        /// @return             Type of next geometry
+        WKB::Type getNextType() const;
+
+        /// @brief              Get dimension of next geometry (2 or 3), without reading it
+        ///
+        /// @return             Dimension of next geometry
+        Size getNextDimension() const;
+
+        /// @brief              Read 2D point
+        ///
+        /// @return             Point
+        d2::object::Point readPoint2d();
+
+        /// @brief              Read 2D point set, from a multi-point
+        ///
+        /// @return             Point set
+        d2::object::PointSet readPointSet2d();
+
+        /// @brief              Read 2D line string
+        ///
+        /// @return             Line string
+        d2::object::LineString readLineString2d();
+
+        /// @brief              Read 2D polygon
+        ///
+        /// @return             Polygon
+        d2::object::Polygon readPolygon2d();
+
+        /// @brief              Read 2D multi-polygon, or a polygon as a multi-polygon
+        ///
+        /// @return             Multi-polygon
+        d2::object::MultiPolygon readMultiPolygon2d();
+
+        /// @brief              Read 3D point
+        ///
+        /// @return             Point
+        d3::object::Point readPoint3d();
+
+        /// @brief              Read 3D point set, from a multi-point
+        ///
+        /// @return             Point set
+        d3::object::PointSet readPointSet3d();
+
+        /// @brief              Read 3D line string
+        ///
+        /// @return             Line string
+        d3::object::LineString readLineString3d();
+
+        /// @brief              Skip next geometry
+        void skip();
+
+        /// @brief              Rewind to the first geometry
+        void rewind();
+
+        /// @brief              Constructor, memory-mapping a file
+        ///
+        /// @param              [in] aFile A file
+        /// @return             Reader
+        static WKB::Reader Map(const File& aFile);
+
+       private:
+        Shared<const void> storageSPtr_;
+        const std::uint8_t* dataPtr_;
+        Size byteCount_;
+        Size offset_;
+
+        Reader(const Shared<const void>& aStorageSPtr, const std::uint8_t* aDataPtr, const Size& aByteCount);
+    };
+
+    /// @brief              Encode 2D point
+    ///
+    /// @code{.cpp}
+    ///                     WKB::Buffer buffer = WKB::Encode(Point(0.0, 1.0)) ; // 21 bytes
+    /// @endcode
+    ///
+    /// @param              [in] aPoint A point
+    /// @param              [in] aByteOrder A byte order
+    /// @return             Buffer
+    static WKB::Buffer Encode(
+        const d2::object::Point& aPoint, const WKB::ByteOrder& aByteOrder = WKB::ByteOrder::LittleEndian
+    );
+
+    /// @brief              Encode 2D point set, as a multi-point
+    ///
+    /// @param              [in] aPointSet A point set
+    /// @param              [in] aByteOrder A byte order
+    /// @return             Buffer
+    static WKB::Buffer Encode(
+        const d2::object::PointSet& aPointSet, const WKB::ByteOrder& aByteOrder = WKB::ByteOrder::LittleEndian
+    );
+
+    /// @brief              Encode 2D line string
+    ///
+    /// @param              [in] aLineString A line string
+    /// @param              [in] aByteOrder A byte order
+    /// @return             Buffer
+    static WKB::Buffer Encode(
+        const d2::object::LineString& aLineString, const WKB::ByteOrder& aByteOrder = WKB::ByteOrder::LittleEndian
+    );
+
+    /// @brief              Encode 2D polygon
+    ///
+    /// @param              [in] aPolygon A polygon
+    /// @param              [in] aByteOrder A byte order
+    /// @return             Buffer
+    static WKB::Buffer Encode(
+        const d2::object::Polygon& aPolygon, const WKB::ByteOrder& aByteOrder = WKB::ByteOrder::LittleEndian
+    );
+
+    /// @brief              Encode 2D multi-polygon
+    ///
+    /// @param              [in] aMultiPolygon A multi-polygon
+    /// @param              [in] aByteOrder A byte order
+    /// @return             Buffer
+    static WKB::Buffer Encode(
+        const d2::object::MultiPolygon& aMultiPolygon, const WKB::ByteOrder& aByteOrder = WKB::ByteOrder::LittleEndian
+    );
+
+    /// @brief              Encode 3D point
+    ///
+    /// @param              [in] aPoint A point
+    /// @param              [in] aByteOrder A byte order
+    /// @return             Buffer
+    static WKB::Buffer Encode(
+        const d3::object::Point& aPoint, const WKB::ByteOrder& aByteOrder = WKB::ByteOrder::LittleEndian
+    );
+
+    /// @brief              Encode 3D point set, as a multi-point
+    ///
+    /// @param              [in] aPointSet A point set
+    /// @param              [in] aByteOrder A byte order
+    /// @return             Buffer
+    static WKB::Buffer Encode(
+        const d3::object::PointSet& aPointSet, const WKB::ByteOrder& aByteOrder = WKB::ByteOrder::LittleEndian
+    );
+
+    /// @brief              Encode 3D line string
+    ///
+    /// @param              [in] aLineString A line string
+    /// @param              [in] aByteOrder A byte order
+    /// @return             Buffer
+    static WKB::Buffer Encode(
+        const d3::object::LineString& aLineString, const WKB::ByteOrder& aByteOrder = WKB::ByteOrder::LittleEndian
+    );
+
+    /// @brief              Convert type to string
+    ///
+    /// @code{.cpp}
+    ///                     WKB::StringFromType(WKB::Type::Polygon) ; // "Polygon"
+    /// @endcode
+    ///
+    /// @param              [in] aType A type
+    /// @return             String
+    static String StringFromType(const WKB::Type& aType);
+};
+
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
@@ -2,6 +2,9 @@
 #ifndef __OpenSpaceToolkit_Mathematics_Object_Interval__
 #define __OpenSpaceToolkit_Mathematics_Object_Interval__
 
+#include <cstddef>
+#include <iterator>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
@@ -53,6 +56,155 @@ template <class T>
 class Interval : public IntervalBase
 {
    public:
+    /// @brief              Lazy grid of values generated from a step, respecting the openness of the interval
+    ///
+    ///                     Values are computed on the fly while iterating, and are identical to the ones returned
+    ///                     by Interval::generateArrayWithStep. The range holds a copy of the interval bounds, so it
+    ///                     can outlive the interval it was generated from.
+    ///
+    /// @code
+    ///                     for (const Real& value : Interval<Real>::Closed(0.0, 1.0).generateRangeWithStep(0.5))
+    ///                     {
+    ///                         // 0.0, 0.5, 1.0
+    ///                     }
+    /// @endcode
+    template <class U>
+    class StepRange
+    {
+       public:
+        class ConstIterator
+        {
+           public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T* pointer;
+            typedef const T& reference;
+
+            ConstIterator();
+
+            bool operator==(const ConstIterator& anIterator) const;
+
+            bool operator!=(const ConstIterator& anIterator) const;
+
+            const T& operator*() const;
+
+            const T* operator->() const;
+
+            ConstIterator& operator++();
+
+            ConstIterator operator++(int);
+
+           private:
+            friend class StepRange;
+
+            const StepRange* rangePtr_;
+            T value_;
+            types::Size index_;
+            bool isBound_;
+            bool isEnd_;
+
+            ConstIterator(const StepRange* aRangePtr);
+        };
+
+        /// @brief      Get iterator to first value
+        ///
+        /// @return     Iterator to first value
+        ConstIterator begin() const;
+
+        /// @brief      Get iterator past last value
+        ///
+        /// @return     Iterator past last value
+        ConstIterator end() const;
+
+       private:
+        friend class Interval;
+
+        T firstValue_;
+        U step_;
+        T bound_;
+        bool isAscending_;
+        bool includesBound_;
+
+        StepRange(
+            const T& aFirstValue, const U& aStep, const T& aBound, const bool isAscending, const bool includesBound
+        );
+
+        bool isBeyondBound(const T& aValue) const;
+    };
+
+    /// @brief              Lazy grid of a given number of values, respecting the openness of the interval
+    ///
+    ///                     Values are computed on the fly while iterating, and are identical to the ones returned
+    ///                     by Interval::generateArrayWithSize.
+    ///
+    /// @code
+    ///                     for (const Real& value : Interval<Real>::Closed(0.0, 1.0).generateRangeWithSize(3))
+    ///                     {
+    ///                         // 0.0, 0.5, 1.0
+    ///                     }
+    /// @endcode
+    class SizeRange
+    {
+       public:
+        class ConstIterator
+        {
+           public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T* pointer;
+            typedef const T& reference;
+
+            ConstIterator();
+
+            bool operator==(const ConstIterator& anIterator) const;
+
+            bool operator!=(const ConstIterator& anIterator) const;
+
+            const T& operator*() const;
+
+            const T* operator->() const;
+
+            ConstIterator& operator++();
+
+            ConstIterator operator++(int);
+
+           private:
+            friend class SizeRange;
+
+            const SizeRange* rangePtr_;
+            T value_;
+            types::Size index_;
+
+            ConstIterator(const SizeRange* aRangePtr, const types::Size& anIndex);
+        };
+
+        /// @brief      Get number of values
+        ///
+        /// @return     Number of values
+        types::Size getSize() const;
+
+        /// @brief      Get iterator to first value
+        ///
+        /// @return     Iterator to first value
+        ConstIterator begin() const;
+
+        /// @brief      Get iterator past last value
+        ///
+        /// @return     Iterator past last value
+        ConstIterator end() const;
+
+       private:
+        friend class Interval;
+
+        T firstValue_;
+        T step_;
+        types::Size size_;
+
+        SizeRange(const T& aFirstValue, const T& aStep, const types::Size& aSize);
+    };
+
     /// @brief              Constructor
     ///
     /// @code
@@ -243,6 +395,33 @@ class Interval : public IntervalBase
     /// @return             Array of values
     ctnr::Array<T> generateArrayWithSize(const types::Size& anArraySize) const;
 
+    /// @brief              Generate lazy range from a given step, respecting the openness of the interval.
+    ///
+    ///                     Same values as Interval::generateArrayWithStep, without materializing them.
+    ///
+    /// @code
+    ///                     Interval<Real> interval = Interval<Real>::Closed(0.0, 1.0) ;
+    ///                     for (const Real& value : interval.generateRangeWithStep(0.5)) { ... } // 0.0, 0.5, 1.0
+    /// @endcode
+    ///
+    /// @param              [in] aStep A step
+    /// @return             Range of values
+    template <class U>
+    StepRange<U> generateRangeWithStep(const U& aStep) const;
+
+    /// @brief              Generate lazy range with a given size, respecting the openness of the interval.
+    ///
+    ///                     Same values as Interval::generateArrayWithSize, without materializing them.
+    ///
+    /// @code
+    ///                     Interval<Real> interval = Interval<Real>::Closed(0.0, 1.0) ;
+    ///                     for (const Real& value : interval.generateRangeWithSize(3)) { ... } // 0.0, 0.5, 1.0
+    /// @endcode
+    ///
+    /// @param              [in] aSize A range size
+    /// @return             Range of values
+    SizeRange generateRangeWithSize(const types::Size& aSize) const;
+
     /// @brief              Get serialized interval
     ///
     /// @code
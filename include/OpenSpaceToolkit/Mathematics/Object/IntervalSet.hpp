@@ -0,0 +1,257 @@
+/// Apache License 2.0
+#ifndef __OpenSpaceToolkit_Mathematics_Object_IntervalSet__
+#define __OpenSpaceToolkit_Mathematics_Object_IntervalSet__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace object
+{
+
+namespace types = ostk::core::type;
+namespace ctnr = ostk::core::container;
+
+/// @brief                      Normalized set of intervals
+///
+///                             Intervals are kept sorted by lower bound, pairwise disjoint and non-adjacent (i.e.
+///                             any two intervals whose union is connected are merged). This invariant allows point
+///                             queries in O(log n) and set operations (union, intersection, difference) as linear
+///                             sweeps, without any re-sorting.
+///
+/// @code{.cpp}
+///                             IntervalSet<Real> intervalSet = {
+///                                 Interval<Real>::Closed(0.0, 1.0),
+///                                 Interval<Real>::Closed(0.5, 2.0),
+///                                 Interval<Real>::Open(3.0, 4.0)
+///                             }; // {[0.0, 2.0], ]3.0, 4.0[}
+/// @endcode
+template <class T>
+class IntervalSet
+{
+   public:
+    typedef typename ctnr::Array<Interval<T>>::ConstIterator ConstIterator;
+
+    /// @brief              Constructor
+    ///
+    /// @code
+    ///                     IntervalSet<Real> intervalSet({Interval<Real>::Closed(0.0, 1.0)}) ;
+    /// @endcode
+    ///
+    /// @param              [in] anIntervalArray An array of intervals (in any order, possibly overlapping)
+    IntervalSet(const ctnr::Array<Interval<T>>& anIntervalArray);
+
+    /// @brief              Constructor
+    ///
+    /// @code
+    ///                     IntervalSet<Real> intervalSet = {Interval<Real>::Closed(0.0, 1.0)} ;
+    /// @endcode
+    ///
+    /// @param              [in] anIntervalList A list of intervals (in any order, possibly overlapping)
+    IntervalSet(std::initializer_list<Interval<T>> anIntervalList);
+
+    /// @brief              Equal to operator
+    ///
+    /// @param              [in] anIntervalSet An interval set
+    /// @return             True if interval sets are equal
+    bool operator==(const IntervalSet& anIntervalSet) const;
+
+    /// @brief              Not equal to operator
+    ///
+    /// @param              [in] anIntervalSet An interval set
+    /// @return             True if interval sets are not equal
+    bool operator!=(const IntervalSet& anIntervalSet) const;
+
+    /// @brief              Output stream operator
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] anIntervalSet An interval set
+    /// @return             A reference to output stream
+    template <class U>
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const IntervalSet<U>& anIntervalSet);
+
+    /// @brief              Check if interval set is empty
+    ///
+    /// @code
+    ///                     IntervalSet<Real>::Empty().isEmpty() ; // True
+    /// @endcode
+    ///
+    /// @return             True if interval set is empty
+    bool isEmpty() const;
+
+    /// @brief              Check if interval set contains value
+    ///
+    ///                     Runs in O(log n).
+    ///
+    /// @code
+    ///                     IntervalSet<Real>({Interval<Real>::Closed(0.0, 1.0)}).contains(0.5) ; // True
+    /// @endcode
+    ///
+    /// @param              [in] aValue A value
+    /// @return             True if interval set contains value
+    bool contains(const T& aValue) const;
+
+    /// @brief              Check if interval set contains an interval
+    ///
+    ///                     Runs in O(log n).
+    ///
+    /// @code
+    ///                     IntervalSet<Real>({Interval<Real>::Closed(0.0, 1.0)}).contains(Interval<Real>::Open(0.2,
+    ///                     0.8)) ; // True
+    /// @endcode
+    ///
+    /// @param              [in] anInterval An interval
+    /// @return             True if interval set contains interval
+    bool contains(const Interval<T>& anInterval) const;
+
+    /// @brief              Check if interval set intersects an interval
+    ///
+    ///                     Runs in O(log n).
+    ///
+    /// @code
+    ///                     IntervalSet<Real>({Interval<Real>::Closed(0.0, 1.0)}).intersects(Interval<Real>::Open(0.5,
+    ///                     1.5)) ; // True
+    /// @endcode
+    ///
+    /// @param              [in] anInterval An interval
+    /// @return             True if interval set intersects interval
+    bool intersects(const Interval<T>& anInterval) const;
+
+    /// @brief              Get number of (disjoint) intervals
+    ///
+    /// @return             Number of intervals
+    types::Size getSize() const;
+
+    /// @brief              Get reference to the normalized intervals, sorted by lower bound
+    ///
+    /// @return             Reference to intervals
+    const ctnr::Array<Interval<T>>& accessIntervals() const;
+
+    /// @brief              Get the normalized intervals, sorted by lower bound
+    ///
+    /// @return             Intervals
+    ctnr::Array<Interval<T>> getIntervals() const;
+
+    /// @brief              Get index of the interval containing a value
+    ///
+    ///                     Runs in O(log n).
+    ///
+    /// @code
+    ///                     IntervalSet<Real> intervalSet = {Interval<Real>::Closed(0.0, 1.0),
+    ///                     Interval<Real>::Closed(2.0, 3.0)} ; intervalSet.findIndexOf(2.5) ; // 1
+    /// @endcode
+    ///
+    /// @param              [in] aValue A value
+    /// @return             Index of the containing interval, or the interval set size if no interval contains value
+    types::Index findIndexOf(const T& aValue) const;
+
+    /// @brief              Get the smallest interval containing the whole interval set
+    ///
+    /// @code
+    ///                     IntervalSet<Real> intervalSet = {Interval<Real>::Closed(0.0, 1.0),
+    ///                     Interval<Real>::Open(2.0, 3.0)} ; intervalSet.getSpan() ; // [0.0, 3.0[
+    /// @endcode
+    ///
+    /// @return             Span interval (undefined if interval set is empty)
+    Interval<T> getSpan() const;
+
+    /// @brief              Get intersection with an interval (clipping)
+    ///
+    ///                     Runs in O(log n + k), where k is the number of intervals intersecting the interval.
+    ///
+    /// @param              [in] anInterval An interval
+    /// @return             Clipped interval set
+    IntervalSet<T> getIntersectionWith(const Interval<T>& anInterval) const;
+
+    /// @brief              Get union with another interval set (linear sweep)
+    ///
+    /// @param              [in] anIntervalSet An interval set
+    /// @return             Union interval set
+    IntervalSet<T> getUnionWith(const IntervalSet& anIntervalSet) const;
+
+    /// @brief              Get intersection with another interval set (linear sweep)
+    ///
+    /// @param              [in] anIntervalSet An interval set
+    /// @return             Intersection interval set
+    IntervalSet<T> getIntersectionWith(const IntervalSet& anIntervalSet) const;
+
+    /// @brief              Get difference with another interval set, i.e. the values contained in this set and
+    ///                     not in the other one (linear sweep)
+    ///
+    /// @param              [in] anIntervalSet An interval set
+    /// @return             Difference interval set
+    IntervalSet<T> getDifferenceWith(const IntervalSet& anIntervalSet) const;
+
+    /// @brief              Get gaps between intervals. If an interval is actually defined, the gaps are computed
+    ///                     within it, including potential leading and trailing gaps w.r.t. its boundaries.
+    ///
+    /// @code
+    ///                     IntervalSet<Real> intervalSet = {Interval<Real>::Closed(-1.0, 1.0),
+    ///                     Interval<Real>::Closed(2.0, 4.0)} ; intervalSet.getGaps(Interval<Real>::Closed(1.5, 4.5)) ;
+    ///                     // {[1.5, 2.0[, ]4.0, 4.5]}
+    /// @endcode
+    ///
+    /// @param              [in] anInterval A bounding interval (optional)
+    /// @return             Gaps interval set
+    IntervalSet<T> getGaps(const Interval<T>& anInterval = Interval<T>::Undefined()) const;
+
+    /// @brief              Insert an interval in place, merging it with overlapping or adjacent intervals
+    ///
+    ///                     Overlapping intervals are located in O(log n).
+    ///
+    /// @code
+    ///                     IntervalSet<Real> intervalSet = {Interval<Real>::Closed(0.0, 1.0)} ;
+    ///                     intervalSet.insert(Interval<Real>::Closed(1.0, 2.0)) ; // {[0.0, 2.0]}
+    /// @endcode
+    ///
+    /// @param              [in] anInterval An interval
+    void insert(const Interval<T>& anInterval);
+
+    /// @brief              Get iterator to first interval
+    ///
+    /// @return             Iterator to first interval
+    ConstIterator begin() const;
+
+    /// @brief              Get iterator past last interval
+    ///
+    /// @return             Iterator past last interval
+    ConstIterator end() const;
+
+    /// @brief              Constructs an empty interval set
+    ///
+    /// @return             Empty interval set
+    static IntervalSet<T> Empty();
+
+   private:
+    ctnr::Array<Interval<T>> intervals_;
+
+    IntervalSet();
+
+    static ctnr::Array<Interval<T>> MergeSorted(const ctnr::Array<Interval<T>>& aSortedIntervalArray);
+
+    static bool LowerBoundComparator(const Interval<T>& anInterval, const Interval<T>& anotherInterval);
+
+    static bool AreConnected(const Interval<T>& aLowerInterval, const Interval<T>& anUpperInterval);
+
+    static Interval<T> BuildInterval(
+        const T& aLowerBound, const bool isLowerBoundOpen, const T& anUpperBound, const bool isUpperBoundOpen
+    );
+
+    static bool IsLowerBoundOpen(const Interval<T>& anInterval);
+
+    static bool IsUpperBoundOpen(const Interval<T>& anInterval);
+};
+
+}  // namespace object
+}  // namespace mathematics
+}  // namespace ostk
+
+#include <OpenSpaceToolkit/Mathematics/Object/IntervalSet.tpp>
+
+#endif
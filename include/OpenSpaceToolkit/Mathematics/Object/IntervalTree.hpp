@@ -0,0 +1,152 @@
+/// Apache License 2.0
+#ifndef __OpenSpaceToolkit_Mathematics_Object_IntervalTree__
+#define __OpenSpaceToolkit_Mathematics_Object_IntervalTree__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace object
+{
+
+namespace types = ostk::core::type;
+namespace ctnr = ostk::core::container;
+
+/// @brief                      Immutable stabbing index over a collection of (possibly overlapping) intervals
+///
+///                             Intervals are sorted by lower bound and laid out as an implicit balanced binary search
+///                             tree, each node being augmented with the greatest upper bound of its subtree. Point
+///                             and interval queries run in O(log n + k), where k is the number of reported intervals.
+///                             Batches of sorted query values are answered with a single sweep in O(n + m + K).
+///
+///                             Queries return indices into the array the tree was built from, ordered by increasing
+///                             lower bound (ties broken by index).
+///
+/// @code{.cpp}
+///                             IntervalTree<Real> intervalTree = {
+///                                 Interval<Real>::Closed(0.0, 2.0),
+///                                 Interval<Real>::Closed(1.0, 3.0),
+///                                 Interval<Real>::Closed(4.0, 5.0)
+///                             };
+///                             intervalTree.getIndicesContaining(1.5); // {0, 1}
+/// @endcode
+///
+/// @ref                        https://en.wikipedia.org/wiki/Interval_tree#Augmented_tree
+template <class T>
+class IntervalTree
+{
+   public:
+    /// @brief              Constructor
+    ///
+    /// @code
+    ///                     IntervalTree<Real> intervalTree({Interval<Real>::Closed(0.0, 1.0)}) ;
+    /// @endcode
+    ///
+    /// @param              [in] anIntervalArray An array of intervals
+    IntervalTree(const ctnr::Array<Interval<T>>& anIntervalArray);
+
+    /// @brief              Constructor
+    ///
+    /// @param              [in] anIntervalList A list of intervals
+    IntervalTree(std::initializer_list<Interval<T>> anIntervalList);
+
+    /// @brief              Check if interval tree is empty
+    ///
+    /// @return             True if interval tree is empty
+    bool isEmpty() const;
+
+    /// @brief              Check if any interval contains value
+    ///
+    ///                     Runs in O(log n), exiting on the first containing interval.
+    ///
+    /// @param              [in] aValue A value
+    /// @return             True if any interval contains value
+    bool contains(const T& aValue) const;
+
+    /// @brief              Check if any interval intersects another interval
+    ///
+    ///                     Runs in O(log n), exiting on the first intersecting interval.
+    ///
+    /// @param              [in] anInterval An interval
+    /// @return             True if any interval intersects interval
+    bool intersects(const Interval<T>& anInterval) const;
+
+    /// @brief              Get number of intervals
+    ///
+    /// @return             Number of intervals
+    types::Size getSize() const;
+
+    /// @brief              Get reference to interval at index (in the original array order)
+    ///
+    /// @param              [in] anIndex An index
+    /// @return             Reference to interval
+    const Interval<T>& accessIntervalAt(const types::Index& anIndex) const;
+
+    /// @brief              Get indices of intervals containing a value (stabbing query)
+    ///
+    /// @code
+    ///                     intervalTree.getIndicesContaining(1.5) ;
+    /// @endcode
+    ///
+    /// @param              [in] aValue A value
+    /// @return             Array of indices
+    ctnr::Array<types::Index> getIndicesContaining(const T& aValue) const;
+
+    /// @brief              Get indices of intervals intersecting an interval (window query)
+    ///
+    /// @code
+    ///                     intervalTree.getIndicesIntersecting(Interval<Real>::Closed(0.5, 1.5)) ;
+    /// @endcode
+    ///
+    /// @param              [in] anInterval An interval
+    /// @return             Array of indices
+    ctnr::Array<types::Index> getIndicesIntersecting(const Interval<T>& anInterval) const;
+
+    /// @brief              Get indices of intervals containing each value of a sorted batch (batched stabbing query)
+    ///
+    ///                     Values are processed with a single sweep over the intervals, which is much faster than
+    ///                     repeated point queries when the batch is large.
+    ///
+    /// @code
+    ///                     intervalTree.getIndicesContaining(Array<Real>({0.5, 1.5, 4.5})) ; // {{0}, {0, 1}, {2}}
+    /// @endcode
+    ///
+    /// @param              [in] aValueArray An array of values, sorted in ascending order
+    /// @return             Array of arrays of indices (one per value)
+    ctnr::Array<ctnr::Array<types::Index>> getIndicesContaining(const ctnr::Array<T>& aValueArray) const;
+
+   private:
+    ctnr::Array<Interval<T>> intervals_;
+    ctnr::Array<types::Index> sortedIndices_;
+    ctnr::Array<T> maxUpperBounds_;
+
+    const T& accessSortedLowerBound(const types::Index& aSortedIndex) const;
+
+    const T& accessSortedUpperBound(const types::Index& aSortedIndex) const;
+
+    T buildNode(const types::Index& aBeginIndex, const types::Index& anEndIndex);
+
+    template <class Predicate, class Visitor>
+    bool searchNode(
+        const types::Index& aBeginIndex,
+        const types::Index& anEndIndex,
+        const T& aLowerBound,
+        const T& anUpperBound,
+        const Predicate& aPredicate,
+        const Visitor& aVisitor
+    ) const;
+};
+
+}  // namespace object
+}  // namespace mathematics
+}  // namespace ostk
+
+#include <OpenSpaceToolkit/Mathematics/Object/IntervalTree.tpp>
+
+#endif
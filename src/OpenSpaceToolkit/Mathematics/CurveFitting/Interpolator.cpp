@@ -5,6 +5,7 @@
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/BarycentricRational.hpp>
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/CubicSpline.hpp>
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Hermite.hpp>
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Linear.hpp>
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/ZeroOrder.hpp>
 
@@ -17,6 +18,7 @@ namespace curvefitting
 
 using ostk::mathematics::curvefitting::interpolator::BarycentricRational;
 using ostk::mathematics::curvefitting::interpolator::CubicSpline;
+using ostk::mathematics::curvefitting::interpolator::Hermite;
 using ostk::mathematics::curvefitting::interpolator::Linear;
 using ostk::mathematics::curvefitting::interpolator::ZeroOrder;
 
@@ -42,6 +44,8 @@ const Shared<const Interpolator> Interpolator::GenerateInterpolator(
             return std::make_shared<BarycentricRational>(anXVector, aYVector);
         case Type::CubicSpline:
             return std::make_shared<CubicSpline>(anXVector, aYVector);
+        case Type::Hermite:
+            throw ostk::core::error::runtime::Wrong("Hermite interpolation requires derivative values.");
         case Type::Linear:
             return std::make_shared<Linear>(anXVector, aYVector);
         case Type::ZeroOrder:
@@ -51,6 +55,18 @@ const Shared<const Interpolator> Interpolator::GenerateInterpolator(
     }
 }
 
+const Shared<const Interpolator> Interpolator::GenerateInterpolator(
+    const Type& aType, const VectorXd& anXVector, const VectorXd& aYVector, const VectorXd& aDerivativeVector
+)
+{
+    if (aType == Type::Hermite)
+    {
+        return std::make_shared<Hermite>(anXVector, aYVector, aDerivativeVector);
+    }
+
+    return GenerateInterpolator(aType, anXVector, aYVector);
+}
+
 }  // namespace curvefitting
 }  // namespace mathematics
 }  // namespace ostk
@@ -15,7 +15,9 @@ namespace interpolator
 
 BarycentricRational::BarycentricRational(const VectorXd& anXVector, const VectorXd& aYVector)
     : Interpolator(Interpolator::Type::BarycentricRational),
-      interpolator_(anXVector.begin(), anXVector.end(), aYVector.begin())
+      interpolator_(anXVector.begin(), anXVector.end(), aYVector.begin()),
+      x_(anXVector),
+      y_(aYVector)
 {
     if (anXVector.size() != aYVector.size())
     {
@@ -25,6 +27,16 @@ BarycentricRational::BarycentricRational(const VectorXd& anXVector, const Vector
 
 BarycentricRational::~BarycentricRational() {}
 
+VectorXd BarycentricRational::getXVector() const
+{
+    return x_;
+}
+
+VectorXd BarycentricRational::getYVector() const
+{
+    return y_;
+}
+
 VectorXd BarycentricRational::evaluate(const VectorXd& aQueryVector) const
 {
     VectorXd yOutput(aQueryVector.size());
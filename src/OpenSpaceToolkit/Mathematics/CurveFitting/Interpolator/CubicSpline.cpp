@@ -14,7 +14,9 @@ namespace interpolator
 {
 
 CubicSpline::CubicSpline(const VectorXd& anXVector, const VectorXd& aYVector)
-    : Interpolator(Interpolator::Type::CubicSpline)
+    : Interpolator(Interpolator::Type::CubicSpline),
+      x_(anXVector),
+      y_(aYVector)
 {
     if (aYVector.size() < 5)
     {
@@ -40,19 +42,36 @@ CubicSpline::CubicSpline(const VectorXd& anXVector, const VectorXd& aYVector)
 }
 
 CubicSpline::CubicSpline(const VectorXd& aYVector, const Real& x0, const Real& h)
-    : Interpolator(Interpolator::Type::CubicSpline)
+    : Interpolator(Interpolator::Type::CubicSpline),
+      x_(aYVector.size()),
+      y_(aYVector)
 {
     if (aYVector.size() < 5)
     {
         throw ostk::core::error::runtime::Wrong("y");
     }
 
+    for (int i = 0; i < x_.size(); ++i)
+    {
+        x_(i) = static_cast<double>(x0) + static_cast<double>(i) * static_cast<double>(h);
+    }
+
     interpolator_ =
         boost::math::interpolators::cardinal_cubic_b_spline<double>(aYVector.begin(), aYVector.end(), x0, h);
 }
 
 CubicSpline::~CubicSpline() {}
 
+VectorXd CubicSpline::getXVector() const
+{
+    return x_;
+}
+
+VectorXd CubicSpline::getYVector() const
+{
+    return y_;
+}
+
 VectorXd CubicSpline::evaluate(const VectorXd& aQueryVector) const
 {
     VectorXd yOutput(aQueryVector.size());
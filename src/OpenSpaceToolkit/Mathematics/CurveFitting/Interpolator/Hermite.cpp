@@ -0,0 +1,187 @@
+/// Apache License 2.0
+
+#include <algorithm>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Hermite.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+namespace interpolator
+{
+
+Hermite::Hermite(
+    const VectorXd& anXVector, const VectorXd& aYVector, const VectorXd& aDerivativeVector, const Size& aWindowSize
+)
+    : Interpolator(Interpolator::Type::Hermite),
+      x_(anXVector),
+      y_(aYVector),
+      dydx_(aDerivativeVector),
+      windowSize_(aWindowSize),
+      coefficients_()
+{
+    if (aYVector.size() < 2)
+    {
+        throw ostk::core::error::runtime::Wrong("y");
+    }
+
+    if ((anXVector.size() != aYVector.size()) || (aDerivativeVector.size() != aYVector.size()))
+    {
+        throw ostk::core::error::runtime::Wrong("x, y and dy/dx");
+    }
+
+    if ((aWindowSize < 2) || (aWindowSize > Size(aYVector.size())))
+    {
+        throw ostk::core::error::runtime::Wrong("Window size");
+    }
+
+    for (Index i = 1; i < Index(anXVector.size()); ++i)
+    {
+        if (!(anXVector(i) > anXVector(i - 1)))
+        {
+            throw ostk::core::error::runtime::Wrong("x must be strictly ascending");
+        }
+    }
+
+    // Precompute the Newton divided differences over the doubled nodes [x_s, x_s, x_s+1, x_s+1, ...] of each window,
+    // so that evaluation only costs a lookup and a Horner pass
+
+    const Index nodeCount = 2 * windowSize_;
+    const Index windowCount = x_.size() - windowSize_ + 1;
+
+    coefficients_.resize(nodeCount, windowCount);
+
+    for (Index windowIndex = 0; windowIndex < windowCount; ++windowIndex)
+    {
+        auto coefficients = coefficients_.col(windowIndex);
+
+        for (Index k = 0; k < nodeCount; ++k)
+        {
+            coefficients(k) = y_(windowIndex + k / 2);
+        }
+
+        for (Index order = 1; order < nodeCount; ++order)
+        {
+            for (Index k = nodeCount - 1; k >= order; --k)
+            {
+                const Index upperNodeIndex = windowIndex + k / 2;
+                const Index lowerNodeIndex = windowIndex + (k - order) / 2;
+
+                if (upperNodeIndex == lowerNodeIndex)
+                {
+                    coefficients(k) = dydx_(upperNodeIndex);
+                }
+                else
+                {
+                    coefficients(k) =
+                        (coefficients(k) - coefficients(k - 1)) / (x_(upperNodeIndex) - x_(lowerNodeIndex));
+                }
+            }
+        }
+    }
+}
+
+Hermite::~Hermite() {}
+
+VectorXd Hermite::getXVector() const
+{
+    return x_;
+}
+
+VectorXd Hermite::getYVector() const
+{
+    return y_;
+}
+
+VectorXd Hermite::getDerivativeVector() const
+{
+    return dydx_;
+}
+
+Size Hermite::getWindowSize() const
+{
+    return windowSize_;
+}
+
+VectorXd Hermite::evaluate(const VectorXd& aQueryVector) const
+{
+    VectorXd yOutput(aQueryVector.size());
+
+    for (int i = 0; i < aQueryVector.size(); ++i)
+    {
+        yOutput(i) = evaluate(aQueryVector(i));
+    }
+
+    return yOutput;
+}
+
+double Hermite::evaluate(const double& aQueryValue) const
+{
+    const Index windowIndex = findWindowIndex(aQueryValue);
+    const auto coefficients = coefficients_.col(windowIndex);
+
+    double value = coefficients(coefficients.size() - 1);
+
+    for (Index k = coefficients.size() - 1; k-- > 0;)
+    {
+        value = value * (aQueryValue - x_(windowIndex + k / 2)) + coefficients(k);
+    }
+
+    return value;
+}
+
+double Hermite::computeDerivative(const double& aQueryValue) const
+{
+    const Index windowIndex = findWindowIndex(aQueryValue);
+    const auto coefficients = coefficients_.col(windowIndex);
+
+    double value = coefficients(coefficients.size() - 1);
+    double derivative = 0.0;
+
+    for (Index k = coefficients.size() - 1; k-- > 0;)
+    {
+        const double delta = aQueryValue - x_(windowIndex + k / 2);
+
+        derivative = derivative * delta + value;
+        value = value * delta + coefficients(k);
+    }
+
+    return derivative;
+}
+
+VectorXd Hermite::computeDerivative(const VectorXd& aQueryVector) const
+{
+    VectorXd yOutput(aQueryVector.size());
+
+    for (int i = 0; i < aQueryVector.size(); ++i)
+    {
+        yOutput(i) = computeDerivative(aQueryVector(i));
+    }
+
+    return yOutput;
+}
+
+Index Hermite::findWindowIndex(const double& aQueryValue) const
+{
+    // Interval [x_i, x_i+1] containing the query (first or last interval when extrapolating)
+
+    const Eigen::Index upperIndex = std::distance(x_.begin(), std::upper_bound(x_.begin(), x_.end(), aQueryValue));
+    const Eigen::Index intervalIndex = std::clamp<Eigen::Index>(upperIndex - 1, 0, x_.size() - 2);
+
+    // Window of nodes centered on this interval, shifted inwards at the edges
+
+    const Eigen::Index windowSize = windowSize_;
+    const Eigen::Index windowIndex = intervalIndex + 1 - (windowSize + 1) / 2;
+
+    return std::clamp<Eigen::Index>(windowIndex, 0, x_.size() - windowSize);
+}
+
+}  // namespace interpolator
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
@@ -33,6 +33,16 @@ Linear::Linear(const VectorXd& anXVector, const VectorXd& aYVector)
 
 Linear::~Linear() {}
 
+VectorXd Linear::getXVector() const
+{
+    return x_;
+}
+
+VectorXd Linear::getYVector() const
+{
+    return y_;
+}
+
 VectorXd Linear::evaluate(const VectorXd& aQueryVector) const
 {
     VectorXd yOutput(aQueryVector.size());
@@ -31,6 +31,16 @@ ZeroOrder::ZeroOrder(const VectorXd& anXVector, const VectorXd& aYVector)
 
 ZeroOrder::~ZeroOrder() {}
 
+VectorXd ZeroOrder::getXVector() const
+{
+    return x_;
+}
+
+VectorXd ZeroOrder::getYVector() const
+{
+    return y_;
+}
+
 VectorXd ZeroOrder::evaluate(const VectorXd& aQueryVector) const
 {
     VectorXd yOutput(aQueryVector.size());
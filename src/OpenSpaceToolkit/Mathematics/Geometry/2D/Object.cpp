@@ -3,6 +3,7 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/MultiPolygon.hpp>
@@ -76,6 +77,11 @@ std::ostream& operator<<(std::ostream& anOutputStream, const Object& anObject)
     return anOutputStream;
 }
 
+BoundingBox Object::getBoundingBox() const
+{
+    return BoundingBox::Undefined();
+}
+
 bool Object::intersects(const Object& anObject) const
 {
     using ostk::mathematics::geometry::d2::object::Point;
@@ -5,6 +5,7 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Composite.hpp>
 
 namespace ostk
@@ -204,6 +205,33 @@ bool Composite::isDefined() const
                        );
 }
 
+BoundingBox Composite::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Composite");
+    }
+
+    if (objects_.isEmpty())
+    {
+        return BoundingBox::Undefined();
+    }
+
+    BoundingBox boundingBox = objects_.accessFirst()->getBoundingBox();
+
+    for (const auto& objectUPtr : objects_)
+    {
+        if (!boundingBox.isDefined())
+        {
+            break;
+        }
+
+        boundingBox = boundingBox.unionWith(objectUPtr->getBoundingBox());
+    }
+
+    return boundingBox;
+}
+
 bool Composite::isEmpty() const
 {
     if (!this->isDefined())
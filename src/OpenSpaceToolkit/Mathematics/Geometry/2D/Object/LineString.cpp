@@ -1,11 +1,17 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/LineString.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Segment.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Simplifier.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/BoundingVolumeHierarchy.hpp>
 
 namespace ostk
 {
@@ -18,9 +24,53 @@ namespace d2
 namespace object
 {
 
+using ostk::mathematics::utility::SquaredDistanceToBox;
+using ostk::mathematics::utility::VisitLeavesClosestFirst;
+
+BoundingBox LineStringBoundingBoxOf(const Array<Point>& aPointArray)
+{
+    const bool allPointsDefined = std::all_of(
+        aPointArray.begin(),
+        aPointArray.end(),
+        [](const Point& aPoint) -> bool
+        {
+            return aPoint.isDefined();
+        }
+    );
+
+    return allPointsDefined ? BoundingBox::Points(aPointArray) : BoundingBox::Undefined();
+}
+
+// Maximum number of segments per index leaf
+
+static constexpr Size LineStringLeafSize = 8;
+
+// Upper bound on the index depth (ranges are halved at each level), plus room for siblings
+
+static constexpr Size LineStringStackSize = 128;
+
+// Parameter in [0, 1] of the point of segment [aFirstPoint, aSecondPoint] closest to a point
+
+double LineStringSegmentParameter(const Vector2d& aFirstPoint, const Vector2d& aSecondPoint, const Vector2d& aPoint)
+{
+    const Vector2d direction = aSecondPoint - aFirstPoint;
+    const double squaredLength = direction.squaredNorm();
+
+    if (squaredLength == 0.0)
+    {
+        return 0.0;
+    }
+
+    return std::max(0.0, std::min(1.0, (aPoint - aFirstPoint).dot(direction) / squaredLength));
+}
+
 LineString::LineString(const Array<Point>& aPointArray)
     : Object(),
-      points_(aPointArray)
+      points_(aPointArray),
+      boundingBox_(LineStringBoundingBoxOf(points_)),
+      indexed_(false),
+      indexNodes_(Array<LineString::IndexNode>::Empty()),
+      indexArcLengths_(Array<double>::Empty())
 {
 }
 
@@ -44,11 +94,85 @@ bool LineString::isDefined() const
     return !points_.isEmpty();
 }
 
+BoundingBox LineString::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    return boundingBox_;
+}
+
 bool LineString::isEmpty() const
 {
     return points_.isEmpty();
 }
 
+bool LineString::isIndexed() const
+{
+    return indexed_;
+}
+
+bool LineString::isSimple() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    Array<Point> points = Array<Point>::Empty();
+
+    points.reserve(points_.getSize());
+
+    for (const Point& point : points_)
+    {
+        if (points.isEmpty() || (point != points.accessLast()))
+        {
+            points.add(point);
+        }
+    }
+
+    if (points.getSize() < 3)
+    {
+        return true;
+    }
+
+    Array<object::Segment> segments = Array<object::Segment>::Empty();
+
+    segments.reserve(points.getSize() - 1);
+
+    for (Index pointIndex = 0; pointIndex < (points.getSize() - 1); ++pointIndex)
+    {
+        segments.add(object::Segment(points[pointIndex], points[pointIndex + 1]));
+    }
+
+    const Index lastSegmentIndex = segments.getSize() - 1;
+    const bool isClosed = (points.getSize() > 3) && (points.accessFirst() == points.accessLast());
+
+    for (const object::Segment::IntersectionPoint& intersectionPoint : object::Segment::IntersectionPoints(segments))
+    {
+        const Index& firstSegmentIndex = std::get<0>(intersectionPoint);
+        const Index& secondSegmentIndex = std::get<1>(intersectionPoint);
+        const Point& point = std::get<2>(intersectionPoint);
+
+        if ((secondSegmentIndex == (firstSegmentIndex + 1)) && (point == points[secondSegmentIndex]))
+        {
+            continue;
+        }
+
+        if (isClosed && (firstSegmentIndex == 0) && (secondSegmentIndex == lastSegmentIndex) &&
+            (point == points.accessFirst()))
+        {
+            continue;
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
 bool LineString::contains(const Point& aPoint) const
 {
     if (!aPoint.isDefined())
@@ -68,19 +192,50 @@ bool LineString::contains(const Point& aPoint) const
         return (this->accessPointAt(0) == aPoint);
     }
 
-    else
+    if (indexed_)
     {
-        for (int index = 0; index < (pointCount - 1); index++)
-        {
-            Point firstPoint = this->accessPointAt(index);
-            Point secondPoint = this->accessPointAt(index + 1);
+        // Only leaves whose box contains the point are visited, and the search stops at the first hit
+
+        const Vector2d point = aPoint.asVector();
 
-            object::Segment segment = object::Segment(firstPoint, secondPoint);
+        bool contained = false;
 
-            if (segment.contains(aPoint))
+        VisitLeavesClosestFirst<LineStringStackSize>(
+            indexNodes_,
+            [&point](const LineString::IndexNode& aNode) -> double
             {
+                return SquaredDistanceToBox(point, aNode.lowerBound, aNode.upperBound);
+            },
+            0.0,
+            [this, &aPoint, &contained](const Index aBeginIndex, const Index anEndIndex) -> bool
+            {
+                for (Index segmentIndex = aBeginIndex; segmentIndex < anEndIndex; ++segmentIndex)
+                {
+                    if (object::Segment(points_[segmentIndex], points_[segmentIndex + 1]).contains(aPoint))
+                    {
+                        contained = true;
+
+                        return false;
+                    }
+                }
+
                 return true;
             }
+        );
+
+        return contained;
+    }
+
+    for (int index = 0; index < (pointCount - 1); index++)
+    {
+        Point firstPoint = this->accessPointAt(index);
+        Point secondPoint = this->accessPointAt(index + 1);
+
+        object::Segment segment = object::Segment(firstPoint, secondPoint);
+
+        if (segment.contains(aPoint))
+        {
+            return true;
         }
     }
 
@@ -142,6 +297,44 @@ Point LineString::getPointClosestTo(const Point& aPoint) const
         throw ostk::core::error::runtime::Undefined("Line string");
     }
 
+    if (indexed_)
+    {
+        const Vector2d point = aPoint.asVector();
+
+        Index closestPointIndex = 0;
+        double minSquaredDistance = std::numeric_limits<double>::infinity();
+
+        // A leaf spanning segments [begin, end) also bounds vertices begin to end
+
+        VisitLeavesClosestFirst<LineStringStackSize>(
+            indexNodes_,
+            [&point](const LineString::IndexNode& aNode) -> double
+            {
+                return SquaredDistanceToBox(point, aNode.lowerBound, aNode.upperBound);
+            },
+            minSquaredDistance,
+            [this, &point, &closestPointIndex, &minSquaredDistance](const Index aBeginIndex, const Index anEndIndex
+            ) -> bool
+            {
+                for (Index pointIndex = aBeginIndex; pointIndex <= anEndIndex; ++pointIndex)
+                {
+                    const double squaredDistance = (points_[pointIndex].asVector() - point).squaredNorm();
+
+                    if ((squaredDistance < minSquaredDistance) ||
+                        ((squaredDistance == minSquaredDistance) && (pointIndex < closestPointIndex)))
+                    {
+                        closestPointIndex = pointIndex;
+                        minSquaredDistance = squaredDistance;
+                    }
+                }
+
+                return true;
+            }
+        );
+
+        return points_[closestPointIndex];
+    }
+
     Point const* pointPtr = nullptr;
     Real minDistance = Real::Undefined();
 
@@ -160,6 +353,163 @@ Point LineString::getPointClosestTo(const Point& aPoint) const
     return *pointPtr;
 }
 
+Real LineString::getLength() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    if (indexed_)
+    {
+        return indexArcLengths_.accessLast();
+    }
+
+    double length = 0.0;
+
+    for (Index pointIndex = 1; pointIndex < points_.getSize(); ++pointIndex)
+    {
+        length += (points_[pointIndex].asVector() - points_[pointIndex - 1].asVector()).norm();
+    }
+
+    return length;
+}
+
+Real LineString::distanceTo(const Point& aPoint) const
+{
+    return aPoint.distanceTo(this->projectPoint(aPoint).first);
+}
+
+LineString::Projection LineString::projectPoint(const Point& aPoint) const
+{
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    if (this->isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    if (points_.getSize() == 1)
+    {
+        return {points_.accessFirst(), 0.0};
+    }
+
+    const Vector2d point = aPoint.asVector();
+
+    Index closestSegmentIndex = 0;
+    double closestParameter = 0.0;
+    double minSquaredDistance = std::numeric_limits<double>::infinity();
+
+    const auto visitSegment = [this, &point, &closestSegmentIndex, &closestParameter, &minSquaredDistance](
+                                  const Index aSegmentIndex
+                              )
+    {
+        const Vector2d firstPoint = points_[aSegmentIndex].asVector();
+        const Vector2d secondPoint = points_[aSegmentIndex + 1].asVector();
+
+        const double parameter = LineStringSegmentParameter(firstPoint, secondPoint, point);
+        const double squaredDistance = (firstPoint + parameter * (secondPoint - firstPoint) - point).squaredNorm();
+
+        if ((squaredDistance < minSquaredDistance) ||
+            ((squaredDistance == minSquaredDistance) && (aSegmentIndex < closestSegmentIndex)))
+        {
+            closestSegmentIndex = aSegmentIndex;
+            closestParameter = parameter;
+            minSquaredDistance = squaredDistance;
+        }
+    };
+
+    if (indexed_)
+    {
+        VisitLeavesClosestFirst<LineStringStackSize>(
+            indexNodes_,
+            [&point](const LineString::IndexNode& aNode) -> double
+            {
+                return SquaredDistanceToBox(point, aNode.lowerBound, aNode.upperBound);
+            },
+            minSquaredDistance,
+            [&visitSegment](const Index aBeginIndex, const Index anEndIndex) -> bool
+            {
+                for (Index segmentIndex = aBeginIndex; segmentIndex < anEndIndex; ++segmentIndex)
+                {
+                    visitSegment(segmentIndex);
+                }
+
+                return true;
+            }
+        );
+    }
+    else
+    {
+        for (Index segmentIndex = 0; segmentIndex < (points_.getSize() - 1); ++segmentIndex)
+        {
+            visitSegment(segmentIndex);
+        }
+    }
+
+    const Vector2d firstPoint = points_[closestSegmentIndex].asVector();
+    const Vector2d secondPoint = points_[closestSegmentIndex + 1].asVector();
+
+    // Same summation order as the index, so that both paths return identical arc lengths
+
+    double arcLength = 0.0;
+
+    if (indexed_)
+    {
+        arcLength = indexArcLengths_[closestSegmentIndex];
+    }
+    else
+    {
+        for (Index pointIndex = 1; pointIndex <= closestSegmentIndex; ++pointIndex)
+        {
+            arcLength += (points_[pointIndex].asVector() - points_[pointIndex - 1].asVector()).norm();
+        }
+    }
+
+    return {
+        Point::Vector(firstPoint + closestParameter * (secondPoint - firstPoint)),
+        arcLength + closestParameter * (secondPoint - firstPoint).norm()
+    };
+}
+
+LineString LineString::simplify(const Real& aTolerance) const
+{
+    if (!aTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tolerance");
+    }
+
+    if (aTolerance < 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    return {Simplifier::DouglasPeucker({points_}, false, aTolerance).accessFirst()};
+}
+
+LineString LineString::simplifyTo(const Size& aPointCount) const
+{
+    if (aPointCount < 2)
+    {
+        throw ostk::core::error::runtime::Wrong("Point count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    return {Simplifier::VisvalingamWhyatt({points_}, false, aPointCount).accessFirst()};
+}
+
 String LineString::toString(const Object::Format& aFormat, const Integer& aPrecision) const
 {
     switch (aFormat)
@@ -255,10 +605,100 @@ void LineString::applyTransformation(const Transformation& aTransformation)
         throw ostk::core::error::runtime::Undefined("Line string");
     }
 
-    for (auto& point : points_)
+    MatrixXd pointMatrix(2, points_.getSize());
+
+    for (Index pointIndex = 0; pointIndex < points_.getSize(); ++pointIndex)
+    {
+        pointMatrix.col(pointIndex) = points_[pointIndex].asVector();
+    }
+
+    aTransformation.applyToPoints(pointMatrix);
+
+    for (Index pointIndex = 0; pointIndex < points_.getSize(); ++pointIndex)
+    {
+        points_[pointIndex] = Point::Vector(pointMatrix.col(pointIndex));
+    }
+
+    boundingBox_ = LineStringBoundingBoxOf(points_);
+
+    if (indexed_)
+    {
+        this->buildIndex();
+    }
+}
+
+void LineString::buildIndex()
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    if (!boundingBox_.isDefined())
     {
-        point = aTransformation.applyTo(point);
+        throw ostk::core::error::runtime::Undefined("Point");
     }
+
+    const Size segmentCount = points_.getSize() - 1;
+
+    indexNodes_.clear();
+    indexNodes_.reserve((2 * segmentCount) / LineStringLeafSize + 1);
+
+    indexArcLengths_ = Array<double>(points_.getSize(), 0.0);
+
+    for (Index pointIndex = 1; pointIndex < points_.getSize(); ++pointIndex)
+    {
+        indexArcLengths_[pointIndex] = indexArcLengths_[pointIndex - 1] +
+                                       (points_[pointIndex].asVector() - points_[pointIndex - 1].asVector()).norm();
+    }
+
+    // Consecutive segments are spatially coherent, so halving index ranges yields tight boxes without reordering.
+    // Nodes are stored in depth-first order: the first child of a branch immediately follows it.
+
+    const auto buildNode = [this](const auto& aBuildNode, const Index aBeginIndex, const Index anEndIndex) -> void
+    {
+        const Index nodeIndex = indexNodes_.getSize();
+
+        indexNodes_.add({points_[aBeginIndex].asVector(), points_[aBeginIndex].asVector(), aBeginIndex, 0});
+
+        const Size segmentCount = anEndIndex - aBeginIndex;
+
+        if (segmentCount <= LineStringLeafSize)
+        {
+            LineString::IndexNode& node = indexNodes_[nodeIndex];
+
+            for (Index pointIndex = aBeginIndex + 1; pointIndex <= anEndIndex; ++pointIndex)
+            {
+                node.lowerBound = node.lowerBound.cwiseMin(points_[pointIndex].asVector());
+                node.upperBound = node.upperBound.cwiseMax(points_[pointIndex].asVector());
+            }
+
+            node.count = segmentCount;
+
+            return;
+        }
+
+        const Index middleIndex = aBeginIndex + (segmentCount / 2);
+
+        aBuildNode(aBuildNode, aBeginIndex, middleIndex);
+
+        const Index secondChildIndex = indexNodes_.getSize();
+
+        aBuildNode(aBuildNode, middleIndex, anEndIndex);
+
+        LineString::IndexNode& node = indexNodes_[nodeIndex];
+
+        node.lowerBound = indexNodes_[nodeIndex + 1].lowerBound.cwiseMin(indexNodes_[secondChildIndex].lowerBound);
+        node.upperBound = indexNodes_[nodeIndex + 1].upperBound.cwiseMax(indexNodes_[secondChildIndex].upperBound);
+        node.offset = secondChildIndex;
+    };
+
+    if (segmentCount > 0)
+    {
+        buildNode(buildNode, 0, segmentCount);
+    }
+
+    indexed_ = true;
 }
 
 LineString LineString::Empty()
@@ -1,21 +1,31 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+
 #include <boost/geometry.hpp>
+#include <boost/geometry/geometries/box.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #include <boost/geometry/io/wkt/wkt.hpp>
 #include <boost/geometry/strategies/transform.hpp>
-#include <boost/geometry/strategies/transform/matrix_transformers.hpp>
-#include <boost/numeric/ublas/matrix.hpp>
 
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/MultiPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/PreparedPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Simplifier.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/Parallel.hpp>
 
 namespace ostk
 {
@@ -29,11 +39,13 @@ namespace object
 {
 
 using boost::geometry::cs::cartesian;
+using boost::geometry::model::box;
 using boost::geometry::model::multi_polygon;
 using boost::geometry::model::point;
 using boost::geometry::model::polygon;
 using boost::geometry::model::ring;
 
+using ostk::core::container::Pair;
 using ostk::core::type::Index;
 using ostk::core::type::Size;
 using ostk::core::type::String;
@@ -51,33 +63,51 @@ class MultiPolygon::Impl
 
     bool isDefined() const;
 
+    BoundingBox getBoundingBox() const;
+
     bool contains(const Point& aPoint) const;
 
     bool contains(const PointSet& aPointSet) const;
 
+    Array<Polygon2d::Location> locate(const MatrixXd& aPointMatrix, const Size& aThreadCount) const;
+
     Size getPolygonCount() const;
 
     Array<Polygon2d> getPolygons() const;
 
     Polygon2d getConvexHull() const;
 
+    Array<Polygon2d> simplify(const Real& aTolerance, const Size& aThreadCount) const;
+
+    Array<Polygon2d> simplifyTo(const Size& aVertexCount, const Size& aThreadCount) const;
+
     MultiPolygon::Impl unionWith(const MultiPolygon::Impl& aMultiPolygon) const;
 
     String toString(const Object::Format& aFormat, const Integer& aPrecision) const;
 
     void applyTransformation(const Transformation& aTransformation);
 
+    static MultiPolygon::Impl Union(const Array<Polygon2d>& aPolygonArray, const Size& aThreadCount);
+
    private:
     typedef point<double, 2, cartesian> BoostPoint;
     typedef ring<Impl::BoostPoint> BoostRing;
     typedef polygon<Impl::BoostPoint> BoostPolygon;
     typedef multi_polygon<Impl::BoostPolygon> BoostMultiPolygon;
+    typedef box<Impl::BoostPoint> BoostBox;
 
     Impl::BoostMultiPolygon multiPolygon_;
 
     static Impl::BoostMultiPolygon BoostMultiPolygonFromPolygons(const Array<Polygon2d>& aPolygonArray);
 
     static Polygon2d PolygonFromBoostPolygon(const MultiPolygon::Impl::BoostPolygon& aPolygon);
+
+    static Impl::BoostMultiPolygon CascadedUnion(
+        Array<Impl::BoostMultiPolygon>& aMultiPolygonArray,
+        const Index aBeginIndex,
+        const Index anEndIndex,
+        const Size aThreadCount
+    );
 };
 
 MultiPolygon::Impl::Impl()
@@ -100,6 +130,19 @@ bool MultiPolygon::Impl::isDefined() const
     return !multiPolygon_.empty();
 }
 
+BoundingBox MultiPolygon::Impl::getBoundingBox() const
+{
+    const MultiPolygon::Impl::BoostBox envelope =
+        boost::geometry::return_envelope<MultiPolygon::Impl::BoostBox>(multiPolygon_);
+
+    return {
+        {boost::geometry::get<boost::geometry::min_corner, 0>(envelope),
+         boost::geometry::get<boost::geometry::min_corner, 1>(envelope)},
+        {boost::geometry::get<boost::geometry::max_corner, 0>(envelope),
+         boost::geometry::get<boost::geometry::max_corner, 1>(envelope)},
+    };
+}
+
 bool MultiPolygon::Impl::contains(const Point& aPoint) const
 {
     try
@@ -125,6 +168,69 @@ bool MultiPolygon::Impl::contains(const PointSet& aPointSet) const
     return false;
 }
 
+Array<Polygon2d::Location> MultiPolygon::Impl::locate(const MatrixXd& aPointMatrix, const Size& aThreadCount) const
+{
+    typedef Pair<MultiPolygon::Impl::BoostBox, Index> EnvelopeTreeValue;
+    typedef boost::geometry::index::rtree<EnvelopeTreeValue, boost::geometry::index::rstar<16>> EnvelopeTree;
+
+    // Prepare each polygon once, and index their envelopes so that points are only tested against candidate polygons
+
+    Array<PreparedPolygon> preparedPolygons = Array<PreparedPolygon>::Empty();
+    Array<EnvelopeTreeValue> envelopeTreeValues = Array<EnvelopeTreeValue>::Empty();
+
+    preparedPolygons.reserve(multiPolygon_.size());
+    envelopeTreeValues.reserve(multiPolygon_.size());
+
+    for (const Polygon2d& polygon : this->getPolygons())
+    {
+        envelopeTreeValues.add(
+            {boost::geometry::return_envelope<MultiPolygon::Impl::BoostBox>(multiPolygon_.at(preparedPolygons.size())),
+             preparedPolygons.size()}
+        );
+
+        preparedPolygons.add(PreparedPolygon(polygon));
+    }
+
+    const EnvelopeTree envelopeTree(envelopeTreeValues.begin(), envelopeTreeValues.end());
+
+    const Size pointCount = aPointMatrix.rows();
+
+    Array<Polygon2d::Location> locations(pointCount, Polygon2d::Location::Outside);
+
+    const auto locateRange =
+        [&aPointMatrix, &locations, &preparedPolygons, &envelopeTree](const Index aBeginIndex, const Index anEndIndex)
+    {
+        for (Index pointIndex = aBeginIndex; pointIndex < anEndIndex; ++pointIndex)
+        {
+            const Point point = {aPointMatrix(pointIndex, 0), aPointMatrix(pointIndex, 1)};
+            const MultiPolygon::Impl::BoostPoint boostPoint = {point.x(), point.y()};
+
+            for (auto envelopeTreeIt = envelopeTree.qbegin(boost::geometry::index::intersects(boostPoint));
+                 envelopeTreeIt != envelopeTree.qend();
+                 ++envelopeTreeIt)
+            {
+                const Polygon2d::Location location = preparedPolygons[envelopeTreeIt->second].locate(point);
+
+                if (location != Polygon2d::Location::Outside)
+                {
+                    locations[pointIndex] = location;
+                }
+
+                if (location == Polygon2d::Location::Inside)
+                {
+                    break;
+                }
+            }
+        }
+    };
+
+    // Prepared polygons and envelope tree are only read by the threads, which write disjoint output ranges
+
+    ostk::mathematics::utility::ForEachRange(pointCount, aThreadCount, locateRange);
+
+    return locations;
+}
+
 Size MultiPolygon::Impl::getPolygonCount() const
 {
     return multiPolygon_.size();
@@ -184,6 +290,196 @@ Polygon2d MultiPolygon::Impl::getConvexHull() const
     return MultiPolygon::Impl::PolygonFromBoostPolygon(convexHull);
 }
 
+// Groups of polygons whose envelopes intersect, directly or through other polygons of the group
+
+Array<Array<Index>> MultiPolygonEnvelopeGroups(const Array<Polygon2d>& aPolygonArray)
+{
+    typedef box<point<double, 2, cartesian>> EnvelopeBox;
+    typedef Pair<EnvelopeBox, Index> EnvelopeTreeValue;
+    typedef boost::geometry::index::rtree<EnvelopeTreeValue, boost::geometry::index::rstar<16>> EnvelopeTree;
+
+    const Size polygonCount = aPolygonArray.getSize();
+
+    Array<EnvelopeTreeValue> envelopeTreeValues = Array<EnvelopeTreeValue>::Empty();
+    Array<Index> parentIndices = Array<Index>::Empty();
+
+    envelopeTreeValues.reserve(polygonCount);
+    parentIndices.reserve(polygonCount);
+
+    for (Index polygonIndex = 0; polygonIndex < polygonCount; ++polygonIndex)
+    {
+        const BoundingBox boundingBox = aPolygonArray[polygonIndex].getBoundingBox();
+
+        envelopeTreeValues.add(
+            {{{boundingBox.getLowerBound().x(), boundingBox.getLowerBound().y()},
+              {boundingBox.getUpperBound().x(), boundingBox.getUpperBound().y()}},
+             polygonIndex}
+        );
+
+        parentIndices.add(polygonIndex);
+    }
+
+    const EnvelopeTree envelopeTree(envelopeTreeValues.begin(), envelopeTreeValues.end());
+
+    // Disjoint sets of polygons, merged along intersecting envelopes
+
+    const auto findRootIndex = [&parentIndices](Index aPolygonIndex) -> Index
+    {
+        while (parentIndices[aPolygonIndex] != aPolygonIndex)
+        {
+            parentIndices[aPolygonIndex] = parentIndices[parentIndices[aPolygonIndex]];
+            aPolygonIndex = parentIndices[aPolygonIndex];
+        }
+
+        return aPolygonIndex;
+    };
+
+    for (const EnvelopeTreeValue& envelopeTreeValue : envelopeTreeValues)
+    {
+        for (auto envelopeTreeIt = envelopeTree.qbegin(boost::geometry::index::intersects(envelopeTreeValue.first));
+             envelopeTreeIt != envelopeTree.qend();
+             ++envelopeTreeIt)
+        {
+            parentIndices[findRootIndex(envelopeTreeIt->second)] = findRootIndex(envelopeTreeValue.second);
+        }
+    }
+
+    Array<Array<Index>> groups = Array<Array<Index>>::Empty();
+    Array<Index> groupIndices(polygonCount, polygonCount);
+
+    for (Index polygonIndex = 0; polygonIndex < polygonCount; ++polygonIndex)
+    {
+        const Index rootIndex = findRootIndex(polygonIndex);
+
+        if (groupIndices[rootIndex] == polygonCount)
+        {
+            groupIndices[rootIndex] = groups.getSize();
+            groups.add(Array<Index>::Empty());
+        }
+
+        groups[groupIndices[rootIndex]].add(polygonIndex);
+    }
+
+    return groups;
+}
+
+// Simplify the rings of each group of polygons together, over threads processing disjoint group ranges: polygons
+// sharing or approaching edges thus constrain each other, while simplified rings remain within the envelope of their
+// original ring, so that distinct groups cannot
+
+template <typename RingFunction>
+Array<Polygon2d> MultiPolygonSimplifyGroups(
+    const Array<Polygon2d>& aPolygonArray,
+    const Array<Array<Index>>& aGroupArray,
+    const Size& aThreadCount,
+    const RingFunction& aRingFunction
+)
+{
+    Array<Polygon2d> polygons = aPolygonArray;
+
+    ostk::mathematics::utility::ForEachRange(
+        aGroupArray.getSize(),
+        aThreadCount,
+        [&polygons, &aGroupArray, &aRingFunction](const Index aBeginIndex, const Index anEndIndex)
+        {
+            for (Index groupIndex = aBeginIndex; groupIndex < anEndIndex; ++groupIndex)
+            {
+                Array<Array<Point>> rings = Array<Array<Point>>::Empty();
+
+                for (const Index polygonIndex : aGroupArray[groupIndex])
+                {
+                    const Polygon2d& polygon = polygons[polygonIndex];
+                    const LineString outerRing = polygon.getOuterRing();
+
+                    rings.add(Array<Point>(outerRing.begin(), outerRing.end()));
+
+                    for (Index innerRingIndex = 0; innerRingIndex < polygon.getInnerRingCount(); ++innerRingIndex)
+                    {
+                        const LineString innerRing = polygon.getInnerRingAt(innerRingIndex);
+
+                        rings.add(Array<Point>(innerRing.begin(), innerRing.end()));
+                    }
+                }
+
+                const Array<Array<Point>> simplifiedRings = aRingFunction(rings, groupIndex);
+
+                Index ringIndex = 0;
+
+                for (const Index polygonIndex : aGroupArray[groupIndex])
+                {
+                    const Size innerRingCount = polygons[polygonIndex].getInnerRingCount();
+
+                    Array<Array<Point>> innerRings = Array<Array<Point>>::Empty();
+
+                    for (Index innerRingIndex = 0; innerRingIndex < innerRingCount; ++innerRingIndex)
+                    {
+                        innerRings.add(simplifiedRings[ringIndex + 1 + innerRingIndex]);
+                    }
+
+                    polygons[polygonIndex] = Polygon2d(simplifiedRings[ringIndex], innerRings);
+
+                    ringIndex += 1 + innerRingCount;
+                }
+            }
+        }
+    );
+
+    return polygons;
+}
+
+Array<Polygon2d> MultiPolygon::Impl::simplify(const Real& aTolerance, const Size& aThreadCount) const
+{
+    const Array<Polygon2d> polygons = this->getPolygons();
+
+    return MultiPolygonSimplifyGroups(
+        polygons,
+        MultiPolygonEnvelopeGroups(polygons),
+        aThreadCount,
+        [&aTolerance](const Array<Array<Point>>& aRingArray, const Index) -> Array<Array<Point>>
+        {
+            return Simplifier::DouglasPeucker(aRingArray, true, aTolerance);
+        }
+    );
+}
+
+Array<Polygon2d> MultiPolygon::Impl::simplifyTo(const Size& aVertexCount, const Size& aThreadCount) const
+{
+    const Array<Polygon2d> polygons = this->getPolygons();
+    const Array<Array<Index>> groups = MultiPolygonEnvelopeGroups(polygons);
+
+    // The vertex budget is shared among groups in proportion to their vertex count
+
+    Size totalVertexCount = 0;
+    Array<Size> groupVertexCounts(groups.getSize(), 0);
+
+    for (Index groupIndex = 0; groupIndex < groups.getSize(); ++groupIndex)
+    {
+        for (const Index polygonIndex : groups[groupIndex])
+        {
+            groupVertexCounts[groupIndex] += polygons[polygonIndex].getVertexCount();
+        }
+
+        totalVertexCount += groupVertexCounts[groupIndex];
+    }
+
+    return MultiPolygonSimplifyGroups(
+        polygons,
+        groups,
+        aThreadCount,
+        [aVertexCount, totalVertexCount, &groupVertexCounts](
+            const Array<Array<Point>>& aRingArray, const Index aGroupIndex
+        ) -> Array<Array<Point>>
+        {
+            const double vertexCountRatio =
+                static_cast<double>(groupVertexCounts[aGroupIndex]) / static_cast<double>(totalVertexCount);
+
+            return Simplifier::VisvalingamWhyatt(
+                aRingArray, true, static_cast<Size>(std::round(vertexCountRatio * static_cast<double>(aVertexCount)))
+            );
+        }
+    );
+}
+
 MultiPolygon::Impl MultiPolygon::Impl::unionWith(const MultiPolygon::Impl& aMultiPolygon) const
 {
     try
@@ -229,29 +525,206 @@ String MultiPolygon::Impl::toString(const Object::Format& aFormat, const Integer
     return String::Empty();
 }
 
+// Transform the coordinates of a Boost ring in place, viewed as a contiguous 2 x N matrix
+
+template <typename BoostRing>
+void MultiPolygonTransformRing(BoostRing& aRing, const Transformation& aTransformation)
+{
+    static_assert(sizeof(typename BoostRing::value_type) == (2 * sizeof(double)), "Unexpected Boost point layout.");
+
+    if (aRing.empty())
+    {
+        return;
+    }
+
+    aTransformation.applyToPoints(
+        Eigen::Map<MatrixXd>(reinterpret_cast<double*>(aRing.data()), 2, static_cast<Eigen::Index>(aRing.size()))
+    );
+}
+
 void MultiPolygon::Impl::applyTransformation(const Transformation& aTransformation)
 {
-    using ostk::mathematics::object::Matrix3d;
+    for (auto& polygon : multiPolygon_)
+    {
+        MultiPolygonTransformRing(polygon.outer(), aTransformation);
+
+        for (auto& innerRing : polygon.inners())
+        {
+            MultiPolygonTransformRing(innerRing, aTransformation);
+        }
+    }
+}
 
-    MultiPolygon::Impl::BoostMultiPolygon transformedMultiPolygon;
+// Interleave the bits of two 16-bit coordinates (Morton code): sorting by code orders points along a Z-order curve
 
-    const Matrix3d transformationMatrix = aTransformation.getMatrix();
+std::uint32_t MultiPolygonMortonCode(const std::uint32_t anX, const std::uint32_t aY)
+{
+    const auto spreadBits = [](std::uint32_t aValue) -> std::uint32_t
+    {
+        aValue = (aValue | (aValue << 8)) & 0x00FF00FF;
+        aValue = (aValue | (aValue << 4)) & 0x0F0F0F0F;
+        aValue = (aValue | (aValue << 2)) & 0x33333333;
+        aValue = (aValue | (aValue << 1)) & 0x55555555;
 
-    const boost::geometry::strategy::transform::matrix_transformer<double, 2, 2> transform = {
-        transformationMatrix(0, 0),
-        transformationMatrix(0, 1),
-        transformationMatrix(0, 2),
-        transformationMatrix(1, 0),
-        transformationMatrix(1, 1),
-        transformationMatrix(1, 2),
-        transformationMatrix(2, 0),
-        transformationMatrix(2, 1),
-        transformationMatrix(2, 2),
+        return aValue;
     };
 
-    boost::geometry::transform(multiPolygon_, transformedMultiPolygon, transform);
+    return spreadBits(anX) | (spreadBits(aY) << 1);
+}
 
-    multiPolygon_ = transformedMultiPolygon;
+MultiPolygon::Impl MultiPolygon::Impl::Union(const Array<Polygon2d>& aPolygonArray, const Size& aThreadCount)
+{
+    if (aPolygonArray.isEmpty())
+    {
+        return {};
+    }
+
+    // Order the polygons along a Z-order curve of their envelope centers, so that any range of consecutive polygons
+    // is spatially compact and the cascade merges neighbours first
+
+    Array<MultiPolygon::Impl::BoostMultiPolygon> multiPolygons = Array<MultiPolygon::Impl::BoostMultiPolygon>::Empty();
+    Array<MultiPolygon::Impl::BoostPoint> centers = Array<MultiPolygon::Impl::BoostPoint>::Empty();
+
+    multiPolygons.reserve(aPolygonArray.size());
+    centers.reserve(aPolygonArray.size());
+
+    MultiPolygon::Impl::BoostBox envelope;
+
+    boost::geometry::assign_inverse(envelope);
+
+    for (const Polygon2d& polygon : aPolygonArray)
+    {
+        multiPolygons.add(MultiPolygon::Impl::BoostMultiPolygonFromPolygons({polygon}));
+
+        MultiPolygon::Impl::BoostPoint center;
+
+        boost::geometry::centroid(
+            boost::geometry::return_envelope<MultiPolygon::Impl::BoostBox>(multiPolygons.accessLast()), center
+        );
+
+        boost::geometry::expand(envelope, center);
+
+        centers.add(center);
+    }
+
+    const double width = boost::geometry::get<boost::geometry::max_corner, 0>(envelope) -
+                         boost::geometry::get<boost::geometry::min_corner, 0>(envelope);
+    const double height = boost::geometry::get<boost::geometry::max_corner, 1>(envelope) -
+                          boost::geometry::get<boost::geometry::min_corner, 1>(envelope);
+
+    const auto quantize = [](const double aValue, const double aMinimum, const double aRange) -> std::uint32_t
+    {
+        return (aRange > 0.0) ? static_cast<std::uint32_t>(65535.0 * ((aValue - aMinimum) / aRange)) : 0;
+    };
+
+    Array<Pair<std::uint32_t, Index>> mortonCodes = Array<Pair<std::uint32_t, Index>>::Empty();
+
+    mortonCodes.reserve(centers.size());
+
+    for (Index polygonIndex = 0; polygonIndex < centers.size(); ++polygonIndex)
+    {
+        const MultiPolygon::Impl::BoostPoint& center = centers[polygonIndex];
+
+        mortonCodes.add(
+            {MultiPolygonMortonCode(
+                 quantize(center.get<0>(), boost::geometry::get<boost::geometry::min_corner, 0>(envelope), width),
+                 quantize(center.get<1>(), boost::geometry::get<boost::geometry::min_corner, 1>(envelope), height)
+             ),
+             polygonIndex}
+        );
+    }
+
+    std::sort(mortonCodes.begin(), mortonCodes.end());
+
+    Array<MultiPolygon::Impl::BoostMultiPolygon> sortedMultiPolygons =
+        Array<MultiPolygon::Impl::BoostMultiPolygon>::Empty();
+
+    sortedMultiPolygons.reserve(multiPolygons.size());
+
+    for (const auto& mortonCode : mortonCodes)
+    {
+        sortedMultiPolygons.add(std::move(multiPolygons[mortonCode.second]));
+    }
+
+    try
+    {
+        MultiPolygon::Impl multiPolygonUnion;
+
+        multiPolygonUnion.multiPolygon_ = MultiPolygon::Impl::CascadedUnion(
+            sortedMultiPolygons, 0, sortedMultiPolygons.size(), std::min(aThreadCount, sortedMultiPolygons.size())
+        );
+
+        return multiPolygonUnion;
+    }
+    catch (const std::exception& anException)
+    {
+        throw ostk::core::error::RuntimeError("Cannot compute union of polygons: [{}].", anException.what());
+    }
+}
+
+MultiPolygon::Impl::BoostMultiPolygon MultiPolygon::Impl::CascadedUnion(
+    Array<MultiPolygon::Impl::BoostMultiPolygon>& aMultiPolygonArray,
+    const Index aBeginIndex,
+    const Index anEndIndex,
+    const Size aThreadCount
+)
+{
+    if ((anEndIndex - aBeginIndex) == 1)
+    {
+        return std::move(aMultiPolygonArray[aBeginIndex]);
+    }
+
+    const Index middleIndex = aBeginIndex + ((anEndIndex - aBeginIndex) / 2);
+
+    // Both halves read and write disjoint ranges, and may be merged concurrently: the available threads are split
+    // between them
+
+    Array<MultiPolygon::Impl::BoostMultiPolygon> halfUnions(2, MultiPolygon::Impl::BoostMultiPolygon());
+
+    ostk::mathematics::utility::ForEachRange(
+        2,
+        aThreadCount,
+        [&aMultiPolygonArray, &halfUnions, aBeginIndex, middleIndex, anEndIndex, aThreadCount](
+            const Index aBeginHalfIndex, const Index anEndHalfIndex
+        )
+        {
+            for (Index halfIndex = aBeginHalfIndex; halfIndex < anEndHalfIndex; ++halfIndex)
+            {
+                const Size halfThreadCount =
+                    (halfIndex == 0) ? (aThreadCount / 2) : (aThreadCount - (aThreadCount / 2));
+
+                halfUnions[halfIndex] = MultiPolygon::Impl::CascadedUnion(
+                    aMultiPolygonArray,
+                    (halfIndex == 0) ? aBeginIndex : middleIndex,
+                    (halfIndex == 0) ? middleIndex : anEndIndex,
+                    std::max<Size>(halfThreadCount, 1)
+                );
+            }
+        }
+    );
+
+    MultiPolygon::Impl::BoostMultiPolygon& firstUnion = halfUnions[0];
+    MultiPolygon::Impl::BoostMultiPolygon& secondUnion = halfUnions[1];
+
+    // Disjoint envelopes imply disjoint polygons: the union is then a concatenation, which skips the overlay
+
+    if (boost::geometry::disjoint(
+            boost::geometry::return_envelope<MultiPolygon::Impl::BoostBox>(firstUnion),
+            boost::geometry::return_envelope<MultiPolygon::Impl::BoostBox>(secondUnion)
+        ))
+    {
+        firstUnion.insert(
+            firstUnion.end(), std::make_move_iterator(secondUnion.begin()), std::make_move_iterator(secondUnion.end())
+        );
+
+        return std::move(firstUnion);
+    }
+
+    MultiPolygon::Impl::BoostMultiPolygon multiPolygonUnion;
+
+    boost::geometry::union_(firstUnion, secondUnion, multiPolygonUnion);
+
+    return multiPolygonUnion;
 }
 
 MultiPolygon::Impl::BoostMultiPolygon MultiPolygon::Impl::BoostMultiPolygonFromPolygons(
@@ -379,6 +852,16 @@ bool MultiPolygon::isDefined() const
     return (implUPtr_ != nullptr) && implUPtr_->isDefined();
 }
 
+BoundingBox MultiPolygon::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon");
+    }
+
+    return implUPtr_->getBoundingBox();
+}
+
 bool MultiPolygon::contains(const Point& aPoint) const
 {
     if (!aPoint.isDefined())
@@ -409,6 +892,26 @@ bool MultiPolygon::contains(const PointSet& aPointSet) const
     return implUPtr_->contains(aPointSet);
 }
 
+Array<Polygon2d::Location> MultiPolygon::locate(const MatrixXd& aPointMatrix, const Size& aThreadCount) const
+{
+    if ((aPointMatrix.rows() > 0) && (aPointMatrix.cols() != 2))
+    {
+        throw ostk::core::error::runtime::Wrong("Point matrix");
+    }
+
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon");
+    }
+
+    return implUPtr_->locate(aPointMatrix, aThreadCount);
+}
+
 Size MultiPolygon::getPolygonCount() const
 {
     if (!this->isDefined())
@@ -439,6 +942,51 @@ Polygon2d MultiPolygon::getConvexHull() const
     return implUPtr_->getConvexHull();
 }
 
+MultiPolygon MultiPolygon::simplify(const Real& aTolerance, const Size& aThreadCount) const
+{
+    if (!aTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tolerance");
+    }
+
+    if (aTolerance < 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
+
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon");
+    }
+
+    return {implUPtr_->simplify(aTolerance, aThreadCount)};
+}
+
+MultiPolygon MultiPolygon::simplifyTo(const Size& aVertexCount, const Size& aThreadCount) const
+{
+    if (aVertexCount < 3)
+    {
+        throw ostk::core::error::runtime::Wrong("Vertex count");
+    }
+
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon");
+    }
+
+    return {implUPtr_->simplifyTo(aVertexCount, aThreadCount)};
+}
+
 MultiPolygon MultiPolygon::unionWith(const MultiPolygon& aMultiPolygon) const
 {
     if (!aMultiPolygon.isDefined())
@@ -524,6 +1072,29 @@ MultiPolygon MultiPolygon::Polygon(const Polygon2d& aPolygon)
     return {Array<Polygon2d> {aPolygon}};
 }
 
+MultiPolygon MultiPolygon::Union(const Array<Polygon2d>& aPolygonArray, const Size& aThreadCount)
+{
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    for (const Polygon2d& polygon : aPolygonArray)
+    {
+        if (!polygon.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Polygon");
+        }
+    }
+
+    MultiPolygon multiPolygon = MultiPolygon::Undefined();
+
+    multiPolygon.implUPtr_ =
+        std::make_unique<MultiPolygon::Impl>(MultiPolygon::Impl::Union(aPolygonArray, aThreadCount));
+
+    return multiPolygon;
+}
+
 }  // namespace object
 }  // namespace d2
 }  // namespace geometry
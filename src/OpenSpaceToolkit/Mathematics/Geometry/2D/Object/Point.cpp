@@ -3,6 +3,7 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Point.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Transformation.hpp>
 
@@ -94,6 +95,16 @@ bool Point::isDefined() const
     return x_.isDefined() && y_.isDefined();
 }
 
+BoundingBox Point::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    return {*this, *this};
+}
+
 bool Point::isNear(const Point& aPoint, const Real& aTolerance) const
 {
     if (!aTolerance.isDefined())
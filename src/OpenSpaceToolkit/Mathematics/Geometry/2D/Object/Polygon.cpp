@@ -1,12 +1,16 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
 #include <boost/geometry.hpp>
+#include <boost/geometry/geometries/box.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
 #include <boost/geometry/io/wkt/wkt.hpp>
 #include <boost/geometry/strategies/transform.hpp>
-#include <boost/geometry/strategies/transform/matrix_transformers.hpp>
-#include <boost/numeric/ublas/matrix.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
@@ -14,9 +18,12 @@
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/MultiPolygon.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/PreparedPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Simplifier.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Transformation.hpp>
 
 namespace ostk
@@ -31,6 +38,7 @@ namespace object
 {
 
 using boost::geometry::cs::cartesian;
+using boost::geometry::model::box;
 using boost::geometry::model::d2::point_xy;
 using boost::geometry::model::linestring;
 using boost::geometry::model::polygon;
@@ -51,6 +59,8 @@ class Polygon::Impl
 
     bool isDefined() const;
 
+    BoundingBox getBoundingBox() const;
+
     bool intersects(const Polygon& aPolygon) const;
 
     bool contains(const Point& aPoint) const;
@@ -65,6 +75,8 @@ class Polygon::Impl
 
     Array<Polygon::Vertex> getInnerRingVerticesAt(const Index& aRingIndex) const;
 
+    Array<Array<Polygon::Vertex>> getRingVertices() const;
+
     Size getEdgeCount() const;
 
     Size getOuterRingEdgeCount() const;
@@ -85,9 +97,17 @@ class Polygon::Impl
 
     Polygon getConvexHull() const;
 
-    Intersection intersectionWith(const Polygon& aPolygon) const;
+    Polygon simplify(const Real& aTolerance) const;
+
+    Polygon simplifyTo(const Size& aVertexCount) const;
+
+    Intersection intersectionWith(const Polygon& aPolygon, const bool isFirstPolygonValidated) const;
+
+    Intersection differenceWith(const Polygon& aPolygon, const bool isFirstPolygonValidated) const;
 
-    Intersection differenceWith(const Polygon& aPolygon) const;
+    Array<Polygon> clipTo(const BoundingBox& aBoundingBox) const;
+
+    Array<Polygon> clipTo(const Polygon& aPolygon) const;
 
     String toString(const Object::Format& aFormat, const Integer& aPrecision) const;
 
@@ -98,14 +118,25 @@ class Polygon::Impl
     typedef linestring<Impl::BoostPoint> BoostLineString;
     typedef ring<Impl::BoostPoint> BoostRing;
     typedef polygon<Impl::BoostPoint> BoostPolygon;
+    typedef box<Impl::BoostPoint> BoostBox;
 
     Impl::BoostPolygon polygon_;
 
+    Impl::BoostBox envelope_;
+
     static Impl::BoostPolygon BoostPolygonFromPoints(const Array<Point>& aPointArray);
 
     static Impl::BoostLineString BoostLineStringFromPoints(const Array<Point>& aPointArray);
 
     static Polygon PolygonFromBoostPolygon(const Polygon::Impl::BoostPolygon& aPolygon);
+
+    static void ValidateBoostPolygons(
+        const Polygon::Impl::BoostPolygon& aPolygon,
+        const Polygon::Impl::BoostPolygon& anotherPolygon,
+        const bool isFirstPolygonValidated
+    );
+
+    Array<Polygon> clipToBoostPolygon(const Polygon::Impl::BoostPolygon& aClipPolygon) const;
 };
 
 Polygon::Impl::Impl(const Array<Point>& anOuterRing, const Array<Array<Point>>& anInnerRingArray)
@@ -129,6 +160,11 @@ Polygon::Impl::Impl(const Array<Point>& anOuterRing, const Array<Array<Point>>&
 
         boost::geometry::correct(polygon_);
     }
+
+    if (this->isDefined())
+    {
+        envelope_ = boost::geometry::return_envelope<Polygon::Impl::BoostBox>(polygon_);
+    }
 }
 
 bool Polygon::Impl::operator==(const Polygon::Impl& aPolygon) const
@@ -141,8 +177,23 @@ bool Polygon::Impl::isDefined() const
     return polygon_.outer().size() >= 3;
 }
 
+BoundingBox Polygon::Impl::getBoundingBox() const
+{
+    return {
+        {envelope_.min_corner().x(), envelope_.min_corner().y()},
+        {envelope_.max_corner().x(), envelope_.max_corner().y()},
+    };
+}
+
 bool Polygon::Impl::intersects(const Polygon& aPolygon) const
 {
+    // Polygons with disjoint envelopes cannot intersect
+
+    if (boost::geometry::disjoint(envelope_, aPolygon.implUPtr_->envelope_))
+    {
+        return false;
+    }
+
     try
     {
         return boost::geometry::intersects(polygon_, aPolygon.implUPtr_->polygon_);
@@ -159,9 +210,16 @@ bool Polygon::Impl::intersects(const Polygon& aPolygon) const
 
 bool Polygon::Impl::contains(const Point& aPoint) const
 {
+    const Polygon::Impl::BoostPoint point(aPoint.x(), aPoint.y());
+
+    if (!boost::geometry::covered_by(point, envelope_))
+    {
+        return false;
+    }
+
     try
     {
-        return boost::geometry::covered_by(Polygon::Impl::BoostPoint(aPoint.x(), aPoint.y()), polygon_);
+        return boost::geometry::covered_by(point, polygon_);
     }
     catch (const std::exception& anException)
     {
@@ -256,6 +314,18 @@ Array<Polygon::Vertex> Polygon::Impl::getInnerRingVerticesAt(const Index& aRingI
     return innerRingVertices;
 }
 
+Array<Array<Polygon::Vertex>> Polygon::Impl::getRingVertices() const
+{
+    Array<Array<Point>> ringVertices = {this->getOuterRingVertices()};
+
+    for (Index innerRingIndex = 0; innerRingIndex < this->getInnerRingCount(); ++innerRingIndex)
+    {
+        ringVertices.add(this->getInnerRingVerticesAt(innerRingIndex));
+    }
+
+    return ringVertices;
+}
+
 Size Polygon::Impl::getEdgeCount() const
 {
     Size edgeCount = boost::geometry::num_points(polygon_.outer()) - 1;
@@ -389,7 +459,31 @@ Polygon Polygon::Impl::getConvexHull() const
     return Polygon::Impl::PolygonFromBoostPolygon(convexHull);
 }
 
-Intersection Polygon::Impl::intersectionWith(const Polygon& aPolygon) const
+// Polygon from rings without closing points, the first one being the outer ring
+
+Polygon PolygonFromRings(const Array<Array<Point>>& aRingArray)
+{
+    Array<Array<Point>> innerRings = Array<Array<Point>>::Empty();
+
+    for (Index ringIndex = 1; ringIndex < aRingArray.getSize(); ++ringIndex)
+    {
+        innerRings.add(aRingArray[ringIndex]);
+    }
+
+    return {aRingArray.accessFirst(), innerRings};
+}
+
+Polygon Polygon::Impl::simplify(const Real& aTolerance) const
+{
+    return PolygonFromRings(Simplifier::DouglasPeucker(this->getRingVertices(), true, aTolerance));
+}
+
+Polygon Polygon::Impl::simplifyTo(const Size& aVertexCount) const
+{
+    return PolygonFromRings(Simplifier::VisvalingamWhyatt(this->getRingVertices(), true, aVertexCount));
+}
+
+Intersection Polygon::Impl::intersectionWith(const Polygon& aPolygon, const bool isFirstPolygonValidated) const
 {
     // https://www.boost.org/doc/libs/1_69_0/libs/geometry/doc/html/geometry/reference/algorithms/intersection/intersection_3.html
     // First implementation computing all possible types of intersections (points, linestrings, polygons). Could be
@@ -403,20 +497,13 @@ Intersection Polygon::Impl::intersectionWith(const Polygon& aPolygon) const
 
     // Initial check on input polygons boost geometries
 
-    boost::geometry::validity_failure_type failurePolygon1;
-    boost::geometry::validity_failure_type failurePolygon2;
-
-    bool polygon1IsValid = boost::geometry::is_valid(polygon_, failurePolygon1);
-    bool polygon2IsValid = boost::geometry::is_valid(aPolygon.implUPtr_->polygon_, failurePolygon2);
+    Polygon::Impl::ValidateBoostPolygons(polygon_, aPolygon.implUPtr_->polygon_, isFirstPolygonValidated);
 
-    if (!polygon1IsValid)
-    {
-        throw ostk::core::error::RuntimeError("Polygon 1 is not valid: [{}]", failurePolygon1);
-    }
+    // Polygons with disjoint envelopes cannot intersect
 
-    if (!polygon2IsValid)
+    if (boost::geometry::disjoint(envelope_, aPolygon.implUPtr_->envelope_))
     {
-        throw ostk::core::error::RuntimeError("Polygon 2 is not valid: [{}]", failurePolygon2);
+        return intersection;
     }
 
     // Obtain the polygon intersection output if any
@@ -526,7 +613,7 @@ Intersection Polygon::Impl::intersectionWith(const Polygon& aPolygon) const
     return intersection;
 }
 
-Intersection Polygon::Impl::differenceWith(const Polygon& aPolygon) const
+Intersection Polygon::Impl::differenceWith(const Polygon& aPolygon, const bool isFirstPolygonValidated) const
 {
     // https://www.boost.org/doc/libs/1_69_0/libs/geometry/doc/html/geometry/reference/algorithms/difference/difference_3.html
 
@@ -536,20 +623,13 @@ Intersection Polygon::Impl::differenceWith(const Polygon& aPolygon) const
 
     // Initial check on input polygons boost geometries
 
-    boost::geometry::validity_failure_type failurePolygon1;
-    boost::geometry::validity_failure_type failurePolygon2;
-
-    bool polygon1IsValid = boost::geometry::is_valid(polygon_, failurePolygon1);
-    bool polygon2IsValid = boost::geometry::is_valid(aPolygon.implUPtr_->polygon_, failurePolygon2);
+    Polygon::Impl::ValidateBoostPolygons(polygon_, aPolygon.implUPtr_->polygon_, isFirstPolygonValidated);
 
-    if (!polygon1IsValid)
-    {
-        throw ostk::core::error::RuntimeError("Polygon 1 is not valid: [{}]", failurePolygon1);
-    }
+    // Polygons with disjoint envelopes leave this polygon untouched
 
-    if (!polygon2IsValid)
+    if (boost::geometry::disjoint(envelope_, aPolygon.implUPtr_->envelope_))
     {
-        throw ostk::core::error::RuntimeError("Polygon 2 is not valid: [{}]", failurePolygon2);
+        return Intersection::Polygon(Polygon::Impl::PolygonFromBoostPolygon(polygon_));
     }
 
     // Obtain the polygon difference output if any
@@ -587,6 +667,328 @@ Intersection Polygon::Impl::differenceWith(const Polygon& aPolygon) const
     return difference;
 }
 
+// Half-plane { p | normal . (p - anchor) <= 0 }, one of the half-planes bounding a convex clip window
+
+struct PolygonClipHalfPlane
+{
+    Vector2d anchor;
+    Vector2d normal;
+
+    double distanceTo(const Vector2d& aPoint) const
+    {
+        return normal.dot(aPoint - anchor);
+    }
+
+    // Point where segment [aFirstPoint, aSecondPoint] crosses the boundary line, snapped onto axis-aligned lines
+
+    Vector2d intersectionWith(
+        const Vector2d& aFirstPoint,
+        const Vector2d& aSecondPoint,
+        const double aFirstDistance,
+        const double aSecondDistance
+    ) const
+    {
+        const double ratio = aFirstDistance / (aFirstDistance - aSecondDistance);
+
+        Vector2d point = aFirstPoint + (ratio * (aSecondPoint - aFirstPoint));
+
+        if (normal.y() == 0.0)
+        {
+            point.x() = anchor.x();
+        }
+        else if (normal.x() == 0.0)
+        {
+            point.y() = anchor.y();
+        }
+
+        return point;
+    }
+};
+
+// Half-planes bounding a convex clockwise closed Boost ring. Returns false if the ring is not convex.
+
+template <typename BoostRing>
+bool PolygonClipHalfPlanesOf(const BoostRing& aRing, std::vector<PolygonClipHalfPlane>& aHalfPlaneArray)
+{
+    aHalfPlaneArray.clear();
+
+    for (std::size_t pointIndex = 0; (pointIndex + 1) < aRing.size(); ++pointIndex)
+    {
+        const Vector2d firstPoint = {
+            boost::geometry::get<0>(aRing[pointIndex]), boost::geometry::get<1>(aRing[pointIndex])
+        };
+        const Vector2d secondPoint = {
+            boost::geometry::get<0>(aRing[pointIndex + 1]), boost::geometry::get<1>(aRing[pointIndex + 1])
+        };
+
+        if (firstPoint != secondPoint)
+        {
+            // The interior of a clockwise ring lies on the right of each edge
+
+            const Vector2d direction = secondPoint - firstPoint;
+
+            aHalfPlaneArray.push_back({firstPoint, {-direction.y(), direction.x()}});
+        }
+    }
+
+    if (aHalfPlaneArray.size() < 3)
+    {
+        return false;
+    }
+
+    // Consecutive edges of a convex clockwise ring never turn left
+
+    for (std::size_t halfPlaneIndex = 0; halfPlaneIndex < aHalfPlaneArray.size(); ++halfPlaneIndex)
+    {
+        const PolygonClipHalfPlane& halfPlane = aHalfPlaneArray[halfPlaneIndex];
+        const PolygonClipHalfPlane& nextHalfPlane = aHalfPlaneArray[(halfPlaneIndex + 1) % aHalfPlaneArray.size()];
+
+        const Vector2d nextDirection = {nextHalfPlane.normal.y(), -nextHalfPlane.normal.x()};
+
+        if (halfPlane.normal.dot(nextDirection) > 0.0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Clip a ring (without closing point) by a half-plane, Sutherland-Hodgman style. Returns false if the clipped ring
+// runs back over itself along the boundary line, i.e. if the result should be split into several polygons.
+
+bool PolygonClipRing(
+    const std::vector<Vector2d>& aRing,
+    const PolygonClipHalfPlane& aHalfPlane,
+    std::vector<Vector2d>& aClippedRing,
+    std::vector<char>& aBoundaryFlagArray
+)
+{
+    aClippedRing.clear();
+    aBoundaryFlagArray.clear();
+
+    if (aRing.empty())
+    {
+        return true;
+    }
+
+    Vector2d previousPoint = aRing.back();
+    double previousDistance = aHalfPlane.distanceTo(previousPoint);
+
+    Size boundaryPointCount = 0;
+
+    for (const Vector2d& point : aRing)
+    {
+        const double distance = aHalfPlane.distanceTo(point);
+
+        if (((previousDistance < 0.0) && (distance > 0.0)) || ((previousDistance > 0.0) && (distance < 0.0)))
+        {
+            aClippedRing.push_back(aHalfPlane.intersectionWith(previousPoint, point, previousDistance, distance));
+            aBoundaryFlagArray.push_back(1);
+            ++boundaryPointCount;
+        }
+
+        if (distance <= 0.0)
+        {
+            aClippedRing.push_back(point);
+            aBoundaryFlagArray.push_back(distance == 0.0);
+            boundaryPointCount += (distance == 0.0) ? 1 : 0;
+        }
+
+        previousPoint = point;
+        previousDistance = distance;
+    }
+
+    // A single piece has at most one run of boundary edges per crossing pair, and these never overlap
+
+    if (boundaryPointCount <= 2)
+    {
+        return true;
+    }
+
+    const Vector2d tangent = {-aHalfPlane.normal.y(), aHalfPlane.normal.x()};
+
+    std::vector<std::pair<double, double>> boundaryIntervals;
+
+    for (std::size_t pointIndex = 0; pointIndex < aClippedRing.size(); ++pointIndex)
+    {
+        const std::size_t nextPointIndex = (pointIndex + 1) % aClippedRing.size();
+
+        if (aBoundaryFlagArray[pointIndex] && aBoundaryFlagArray[nextPointIndex])
+        {
+            const double firstAbscissa = tangent.dot(aClippedRing[pointIndex]);
+            const double secondAbscissa = tangent.dot(aClippedRing[nextPointIndex]);
+
+            boundaryIntervals.push_back(
+                {std::min(firstAbscissa, secondAbscissa), std::max(firstAbscissa, secondAbscissa)}
+            );
+        }
+    }
+
+    std::sort(boundaryIntervals.begin(), boundaryIntervals.end());
+
+    double boundaryEnd = -std::numeric_limits<double>::infinity();
+
+    for (const auto& boundaryInterval : boundaryIntervals)
+    {
+        if (boundaryInterval.first < boundaryEnd)
+        {
+            return false;
+        }
+
+        boundaryEnd = std::max(boundaryEnd, boundaryInterval.second);
+    }
+
+    return true;
+}
+
+// Points of a closed Boost ring, without the closing point
+
+template <typename BoostRing>
+std::vector<Vector2d> PolygonClipPointsOf(const BoostRing& aRing)
+{
+    std::vector<Vector2d> points;
+
+    points.reserve(aRing.size());
+
+    for (std::size_t pointIndex = 0; (pointIndex + 1) < aRing.size(); ++pointIndex)
+    {
+        points.push_back({boost::geometry::get<0>(aRing[pointIndex]), boost::geometry::get<1>(aRing[pointIndex])});
+    }
+
+    return points;
+}
+
+// Clip a Boost polygon to a convex window. The outer ring is left empty if nothing remains. Returns false if the
+// result is not a single polygon with clipped rings (several pieces, inner ring crossing the window boundary).
+
+template <typename BoostPolygon>
+bool PolygonClipToHalfPlanes(
+    const BoostPolygon& aPolygon,
+    const std::vector<PolygonClipHalfPlane>& aHalfPlaneArray,
+    std::vector<Vector2d>& anOuterRing,
+    std::vector<std::vector<Vector2d>>& anInnerRingArray
+)
+{
+    anOuterRing = PolygonClipPointsOf(aPolygon.outer());
+    anInnerRingArray.clear();
+
+    std::vector<Vector2d> clippedRing;
+    std::vector<char> boundaryFlags;
+
+    for (const PolygonClipHalfPlane& halfPlane : aHalfPlaneArray)
+    {
+        if (!PolygonClipRing(anOuterRing, halfPlane, clippedRing, boundaryFlags))
+        {
+            return false;
+        }
+
+        std::swap(anOuterRing, clippedRing);
+    }
+
+    // Drop repeated points, then rings without area
+
+    anOuterRing.erase(std::unique(anOuterRing.begin(), anOuterRing.end()), anOuterRing.end());
+
+    while ((anOuterRing.size() > 1) && (anOuterRing.front() == anOuterRing.back()))
+    {
+        anOuterRing.pop_back();
+    }
+
+    double doubleArea = 0.0;
+
+    for (std::size_t pointIndex = 0; pointIndex < anOuterRing.size(); ++pointIndex)
+    {
+        const Vector2d& point = anOuterRing[pointIndex];
+        const Vector2d& nextPoint = anOuterRing[(pointIndex + 1) % anOuterRing.size()];
+
+        doubleArea += (point.x() * nextPoint.y()) - (nextPoint.x() * point.y());
+    }
+
+    if ((anOuterRing.size() < 3) || (doubleArea == 0.0))
+    {
+        anOuterRing.clear();
+
+        return true;
+    }
+
+    // Pieces touching at a single point share a vertex: the result is then made of several polygons
+
+    std::vector<Vector2d> sortedPoints = anOuterRing;
+
+    const auto precedes = [](const Vector2d& aFirstPoint, const Vector2d& aSecondPoint) -> bool
+    {
+        return (aFirstPoint.x() < aSecondPoint.x()) ||
+               ((aFirstPoint.x() == aSecondPoint.x()) && (aFirstPoint.y() < aSecondPoint.y()));
+    };
+
+    std::sort(sortedPoints.begin(), sortedPoints.end(), precedes);
+
+    if (std::adjacent_find(sortedPoints.begin(), sortedPoints.end()) != sortedPoints.end())
+    {
+        return false;
+    }
+
+    // Inner rings are kept whole when inside the window, and dropped when outside of one of its half-planes
+
+    for (const auto& innerRing : aPolygon.inners())
+    {
+        const std::vector<Vector2d> innerRingPoints = PolygonClipPointsOf(innerRing);
+
+        bool isInside = true;
+        bool isOutside = false;
+
+        for (const PolygonClipHalfPlane& halfPlane : aHalfPlaneArray)
+        {
+            double minimumDistance = std::numeric_limits<double>::infinity();
+            double maximumDistance = -std::numeric_limits<double>::infinity();
+
+            for (const Vector2d& point : innerRingPoints)
+            {
+                const double distance = halfPlane.distanceTo(point);
+
+                minimumDistance = std::min(minimumDistance, distance);
+                maximumDistance = std::max(maximumDistance, distance);
+            }
+
+            isInside = isInside && (maximumDistance <= 0.0);
+            isOutside = isOutside || (minimumDistance >= 0.0);
+        }
+
+        if (isOutside)
+        {
+            continue;
+        }
+
+        if (!isInside)
+        {
+            return false;
+        }
+
+        anInnerRingArray.push_back(innerRingPoints);
+    }
+
+    return true;
+}
+
+Array<Polygon> Polygon::Impl::clipTo(const BoundingBox& aBoundingBox) const
+{
+    const Point lowerBound = aBoundingBox.getLowerBound();
+    const Point upperBound = aBoundingBox.getUpperBound();
+
+    return this->clipToBoostPolygon(Polygon::Impl::BoostPolygonFromPoints({
+        lowerBound,
+        {lowerBound.x(), upperBound.y()},
+        upperBound,
+        {upperBound.x(), lowerBound.y()},
+    }));
+}
+
+Array<Polygon> Polygon::Impl::clipTo(const Polygon& aPolygon) const
+{
+    return this->clipToBoostPolygon(aPolygon.implUPtr_->polygon_);
+}
+
 String Polygon::Impl::toString(const Object::Format& aFormat, const Integer& aPrecision) const
 {
     switch (aFormat)
@@ -616,29 +1018,33 @@ String Polygon::Impl::toString(const Object::Format& aFormat, const Integer& aPr
     return String::Empty();
 }
 
-void Polygon::Impl::applyTransformation(const Transformation& aTransformation)
+// Transform the coordinates of a Boost ring in place, viewed as a contiguous 2 x N matrix
+
+template <typename BoostRing>
+void PolygonTransformRing(BoostRing& aRing, const Transformation& aTransformation)
 {
-    using ostk::mathematics::object::Matrix3d;
+    static_assert(sizeof(typename BoostRing::value_type) == (2 * sizeof(double)), "Unexpected Boost point layout.");
 
-    Polygon::Impl::BoostPolygon transformedPolygon;
+    if (aRing.empty())
+    {
+        return;
+    }
 
-    const Matrix3d transformationMatrix = aTransformation.getMatrix();
+    aTransformation.applyToPoints(
+        Eigen::Map<MatrixXd>(reinterpret_cast<double*>(aRing.data()), 2, static_cast<Eigen::Index>(aRing.size()))
+    );
+}
 
-    const boost::geometry::strategy::transform::matrix_transformer<double, 2, 2> transform = {
-        transformationMatrix(0, 0),
-        transformationMatrix(0, 1),
-        transformationMatrix(0, 2),
-        transformationMatrix(1, 0),
-        transformationMatrix(1, 1),
-        transformationMatrix(1, 2),
-        transformationMatrix(2, 0),
-        transformationMatrix(2, 1),
-        transformationMatrix(2, 2),
-    };
+void Polygon::Impl::applyTransformation(const Transformation& aTransformation)
+{
+    PolygonTransformRing(polygon_.outer(), aTransformation);
 
-    boost::geometry::transform(polygon_, transformedPolygon, transform);
+    for (auto& innerRing : polygon_.inners())
+    {
+        PolygonTransformRing(innerRing, aTransformation);
+    }
 
-    polygon_ = transformedPolygon;
+    envelope_ = boost::geometry::return_envelope<Polygon::Impl::BoostBox>(polygon_);
 }
 
 Polygon::Impl::BoostPolygon Polygon::Impl::BoostPolygonFromPoints(const Array<Point>& aPointArray)
@@ -710,6 +1116,104 @@ Polygon Polygon::Impl::PolygonFromBoostPolygon(const Polygon::Impl::BoostPolygon
     return Polygon {outerRing, innerRings};
 }
 
+void Polygon::Impl::ValidateBoostPolygons(
+    const Polygon::Impl::BoostPolygon& aPolygon,
+    const Polygon::Impl::BoostPolygon& anotherPolygon,
+    const bool isFirstPolygonValidated
+)
+{
+    // Validation of the first polygon is skipped when it has already been validated by the caller (prepared polygon)
+
+    boost::geometry::validity_failure_type failurePolygon1;
+    boost::geometry::validity_failure_type failurePolygon2;
+
+    bool polygon1IsValid = isFirstPolygonValidated || boost::geometry::is_valid(aPolygon, failurePolygon1);
+    bool polygon2IsValid = boost::geometry::is_valid(anotherPolygon, failurePolygon2);
+
+    if (!polygon1IsValid)
+    {
+        throw ostk::core::error::RuntimeError("Polygon 1 is not valid: [{}]", failurePolygon1);
+    }
+
+    if (!polygon2IsValid)
+    {
+        throw ostk::core::error::RuntimeError("Polygon 2 is not valid: [{}]", failurePolygon2);
+    }
+}
+
+Array<Polygon> Polygon::Impl::clipToBoostPolygon(const Polygon::Impl::BoostPolygon& aClipPolygon) const
+{
+    // Polygons with disjoint envelopes cannot intersect
+
+    if (boost::geometry::disjoint(envelope_, boost::geometry::return_envelope<Polygon::Impl::BoostBox>(aClipPolygon)))
+    {
+        return Array<Polygon>::Empty();
+    }
+
+    // Convex clip window: clip rings one half-plane at a time
+
+    std::vector<PolygonClipHalfPlane> halfPlanes;
+
+    if (aClipPolygon.inners().empty() && PolygonClipHalfPlanesOf(aClipPolygon.outer(), halfPlanes))
+    {
+        std::vector<Vector2d> outerRing;
+        std::vector<std::vector<Vector2d>> innerRings;
+
+        if (PolygonClipToHalfPlanes(polygon_, halfPlanes, outerRing, innerRings))
+        {
+            if (outerRing.empty())
+            {
+                return Array<Polygon>::Empty();
+            }
+
+            const auto pointsOf = [](const std::vector<Vector2d>& aRing) -> Array<Point>
+            {
+                Array<Point> points = Array<Point>::Empty();
+
+                points.reserve(aRing.size());
+
+                for (const Vector2d& point : aRing)
+                {
+                    points.add(Point::Vector(point));
+                }
+
+                return points;
+            };
+
+            Array<Array<Point>> innerRingPoints = Array<Array<Point>>::Empty();
+
+            for (const auto& innerRing : innerRings)
+            {
+                innerRingPoints.add(pointsOf(innerRing));
+            }
+
+            return {Polygon(pointsOf(outerRing), innerRingPoints)};
+        }
+    }
+
+    // General case: concave clip window, or result split into several polygons
+
+    Array<Polygon::Impl::BoostPolygon> polygonIntersectionOutput;
+
+    try
+    {
+        boost::geometry::intersection(polygon_, aClipPolygon, polygonIntersectionOutput);
+    }
+    catch (const std::exception& anException)
+    {
+        throw ostk::core::error::RuntimeError("Error caught while clipping polygon: [{}]", anException.what());
+    }
+
+    Array<Polygon> polygons = Array<Polygon>::Empty();
+
+    for (const auto& polygon : polygonIntersectionOutput)
+    {
+        polygons.add(Polygon::Impl::PolygonFromBoostPolygon(polygon));
+    }
+
+    return polygons;
+}
+
 Polygon::Polygon(const Array<Point>& anOuterRing, const Array<Array<Point>>& anInnerRingArray)
     : Object(),
       implUPtr_(std::make_unique<Polygon::Impl>(anOuterRing, anInnerRingArray))
@@ -761,6 +1265,16 @@ bool Polygon::isDefined() const
     return (implUPtr_ != nullptr) && implUPtr_->isDefined();
 }
 
+BoundingBox Polygon::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon");
+    }
+
+    return implUPtr_->getBoundingBox();
+}
+
 bool Polygon::isNear(const Polygon& aPolygon, const Real& aTolerance) const
 {
     if (!aPolygon.isDefined())
@@ -858,6 +1372,16 @@ bool Polygon::contains(const LineString& aLineString) const
     return implUPtr_->contains(aLineString);
 }
 
+Array<Polygon::Location> Polygon::locate(const MatrixXd& aPointMatrix, const Size& aThreadCount) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon");
+    }
+
+    return PreparedPolygon(*this).locate(aPointMatrix, aThreadCount);
+}
+
 Size Polygon::getInnerRingCount() const
 {
     if (!this->isDefined())
@@ -958,6 +1482,41 @@ Polygon Polygon::getConvexHull() const
     return implUPtr_->getConvexHull();
 }
 
+Polygon Polygon::simplify(const Real& aTolerance) const
+{
+    if (!aTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tolerance");
+    }
+
+    if (aTolerance < 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon");
+    }
+
+    return implUPtr_->simplify(aTolerance);
+}
+
+Polygon Polygon::simplifyTo(const Size& aVertexCount) const
+{
+    if (aVertexCount < 3)
+    {
+        throw ostk::core::error::runtime::Wrong("Vertex count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon");
+    }
+
+    return implUPtr_->simplifyTo(aVertexCount);
+}
+
 void Polygon::print(std::ostream& anOutputStream, bool displayDecorators) const
 {
     displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Polygon") : void();
@@ -1005,7 +1564,7 @@ Intersection Polygon::intersectionWith(const Polygon& aPolygon) const
         throw ostk::core::error::runtime::Undefined("Polygon");
     }
 
-    return implUPtr_->intersectionWith(aPolygon);
+    return implUPtr_->intersectionWith(aPolygon, false);
 }
 
 Intersection Polygon::differenceWith(const Polygon& aPolygon) const
@@ -1015,7 +1574,32 @@ Intersection Polygon::differenceWith(const Polygon& aPolygon) const
         throw ostk::core::error::runtime::Undefined("Polygon");
     }
 
-    return implUPtr_->differenceWith(aPolygon);
+    return implUPtr_->differenceWith(aPolygon, false);
+}
+
+Array<Polygon> Polygon::clipTo(const BoundingBox& aBoundingBox) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon");
+    }
+
+    if (!aBoundingBox.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Bounding box");
+    }
+
+    return implUPtr_->clipTo(aBoundingBox);
+}
+
+Array<Polygon> Polygon::clipTo(const Polygon& aPolygon) const
+{
+    if ((!this->isDefined()) || (!aPolygon.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon");
+    }
+
+    return implUPtr_->clipTo(aPolygon);
 }
 
 MultiPolygon Polygon::unionWith(const Polygon& aPolygon) const
@@ -1053,6 +1637,26 @@ void Polygon::applyTransformation(const Transformation& aTransformation)
     implUPtr_->applyTransformation(aTransformation);
 }
 
+Intersection Polygon::intersectionWith(const Polygon& aPolygon, const bool isFirstPolygonValidated) const
+{
+    if ((!this->isDefined()) || (!aPolygon.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon");
+    }
+
+    return implUPtr_->intersectionWith(aPolygon, isFirstPolygonValidated);
+}
+
+Intersection Polygon::differenceWith(const Polygon& aPolygon, const bool isFirstPolygonValidated) const
+{
+    if ((!this->isDefined()) || (!aPolygon.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon");
+    }
+
+    return implUPtr_->differenceWith(aPolygon, isFirstPolygonValidated);
+}
+
 Polygon Polygon::Undefined()
 {
     return {Array<Point>::Empty()};
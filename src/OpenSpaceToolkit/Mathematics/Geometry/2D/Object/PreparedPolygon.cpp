@@ -0,0 +1,458 @@
+/// Apache License 2.0
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/geometries/polygon.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/PreparedPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/Parallel.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+namespace d2
+{
+namespace object
+{
+
+using boost::geometry::model::box;
+using boost::geometry::model::d2::point_xy;
+using boost::geometry::model::linestring;
+using boost::geometry::model::polygon;
+
+using ostk::core::container::Array;
+using ostk::core::container::Pair;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+class PreparedPolygon::Impl
+{
+   public:
+    Impl(const Polygon& aPolygon);
+
+    ~Impl() = default;
+
+    bool isValid() const;
+
+    bool intersects(const Polygon& aPolygon) const;
+
+    Polygon::Location locate(const Point& aPoint) const;
+
+    bool contains(const LineString& aLineString) const;
+
+    void checkValidity() const;
+
+   private:
+    typedef point_xy<double> BoostPoint;
+    typedef linestring<Impl::BoostPoint> BoostLineString;
+    typedef polygon<Impl::BoostPoint> BoostPolygon;
+    typedef box<Impl::BoostPoint> BoostBox;
+    typedef Pair<Impl::BoostPoint, Impl::BoostPoint> BoostEdge;
+    typedef Pair<Impl::BoostBox, Index> EdgeTreeValue;
+    typedef boost::geometry::index::rtree<Impl::EdgeTreeValue, boost::geometry::index::rstar<16>> EdgeTree;
+
+    Impl::BoostPolygon polygon_;
+    Impl::BoostBox envelope_;
+    boost::geometry::validity_failure_type validityFailure_;
+    bool isValid_;
+    Array<Impl::BoostEdge> edges_;
+    Impl::EdgeTree edgeTree_;
+
+    static Impl::BoostPolygon BoostPolygonFromPolygon(const Polygon& aPolygon);
+
+    static Impl::BoostLineString BoostLineStringFromLineString(const LineString& aLineString);
+
+    static bool IsOnEdge(const Impl::BoostPoint& aPoint, const Impl::BoostEdge& anEdge);
+};
+
+PreparedPolygon::Impl::Impl(const Polygon& aPolygon)
+    : polygon_(PreparedPolygon::Impl::BoostPolygonFromPolygon(aPolygon)),
+      envelope_(boost::geometry::return_envelope<PreparedPolygon::Impl::BoostBox>(polygon_)),
+      validityFailure_(boost::geometry::no_failure),
+      isValid_(boost::geometry::is_valid(polygon_, validityFailure_)),
+      edges_(Array<PreparedPolygon::Impl::BoostEdge>::Empty()),
+      edgeTree_()
+{
+    const auto addRingEdges = [this](const auto& aRing)
+    {
+        for (Index vertexIndex = 1; vertexIndex < aRing.size(); ++vertexIndex)
+        {
+            edges_.add({aRing.at(vertexIndex - 1), aRing.at(vertexIndex)});
+        }
+    };
+
+    addRingEdges(polygon_.outer());
+
+    for (const auto& innerRing : polygon_.inners())
+    {
+        addRingEdges(innerRing);
+    }
+
+    Array<PreparedPolygon::Impl::EdgeTreeValue> edgeTreeValues = Array<PreparedPolygon::Impl::EdgeTreeValue>::Empty();
+
+    edgeTreeValues.reserve(edges_.getSize());
+
+    for (Index edgeIndex = 0; edgeIndex < edges_.getSize(); ++edgeIndex)
+    {
+        const PreparedPolygon::Impl::BoostEdge& edge = edges_[edgeIndex];
+
+        edgeTreeValues.add(
+            {PreparedPolygon::Impl::BoostBox(
+                 {std::min(edge.first.x(), edge.second.x()), std::min(edge.first.y(), edge.second.y())},
+                 {std::max(edge.first.x(), edge.second.x()), std::max(edge.first.y(), edge.second.y())}
+             ),
+             edgeIndex}
+        );
+    }
+
+    // Range constructor bulk loads the tree (packing algorithm)
+
+    edgeTree_ = PreparedPolygon::Impl::EdgeTree(edgeTreeValues.begin(), edgeTreeValues.end());
+}
+
+bool PreparedPolygon::Impl::isValid() const
+{
+    return isValid_;
+}
+
+bool PreparedPolygon::Impl::intersects(const Polygon& aPolygon) const
+{
+    const PreparedPolygon::Impl::BoostPolygon polygon = PreparedPolygon::Impl::BoostPolygonFromPolygon(aPolygon);
+
+    const PreparedPolygon::Impl::BoostBox envelope =
+        boost::geometry::return_envelope<PreparedPolygon::Impl::BoostBox>(polygon);
+
+    if (boost::geometry::disjoint(envelope_, envelope))
+    {
+        return false;
+    }
+
+    // Fast positive answer: any vertex of the polygon lies inside the prepared polygon
+
+    for (const auto& vertex : polygon.outer())
+    {
+        if (this->locate(Point(vertex.x(), vertex.y())) != Polygon::Location::Outside)
+        {
+            return true;
+        }
+    }
+
+    try
+    {
+        return boost::geometry::intersects(polygon_, polygon);
+    }
+    catch (const std::exception& anException)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Error when checking if polygon intersects polygon: [{}]", anException.what()
+        );
+    }
+
+    return false;
+}
+
+Polygon::Location PreparedPolygon::Impl::locate(const Point& aPoint) const
+{
+    const PreparedPolygon::Impl::BoostPoint point(aPoint.x(), aPoint.y());
+
+    if (!boost::geometry::covered_by(point, envelope_))
+    {
+        return Polygon::Location::Outside;
+    }
+
+    // Crossing number test, restricted to the edges whose bounding box intersects the ray cast from the point towards
+    // +x (the ray is clipped to the envelope)
+
+    const PreparedPolygon::Impl::BoostBox ray = {point, {envelope_.max_corner().x(), point.y()}};
+
+    bool isInside = false;
+
+    for (auto edgeTreeIt = edgeTree_.qbegin(boost::geometry::index::intersects(ray)); edgeTreeIt != edgeTree_.qend();
+         ++edgeTreeIt)
+    {
+        const PreparedPolygon::Impl::BoostEdge& edge = edges_[edgeTreeIt->second];
+
+        if (PreparedPolygon::Impl::IsOnEdge(point, edge))
+        {
+            return Polygon::Location::Boundary;
+        }
+
+        const PreparedPolygon::Impl::BoostPoint& firstVertex = edge.first;
+        const PreparedPolygon::Impl::BoostPoint& secondVertex = edge.second;
+
+        if ((firstVertex.y() > point.y()) != (secondVertex.y() > point.y()))
+        {
+            const double crossingX = firstVertex.x() + (point.y() - firstVertex.y()) *
+                                                           (secondVertex.x() - firstVertex.x()) /
+                                                           (secondVertex.y() - firstVertex.y());
+
+            if (crossingX > point.x())
+            {
+                isInside = !isInside;
+            }
+        }
+    }
+
+    return isInside ? Polygon::Location::Inside : Polygon::Location::Outside;
+}
+
+bool PreparedPolygon::Impl::contains(const LineString& aLineString) const
+{
+    // Necessary condition: every point of the line string is contained
+
+    for (const auto& point : aLineString)
+    {
+        if (this->locate(point) == Polygon::Location::Outside)
+        {
+            return false;
+        }
+    }
+
+    try
+    {
+        return boost::geometry::covered_by(
+            PreparedPolygon::Impl::BoostLineStringFromLineString(aLineString), polygon_
+        );
+    }
+    catch (const std::exception& anException)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Error when checking if polygon contains line string: [{}]", anException.what()
+        );
+    }
+
+    return false;
+}
+
+void PreparedPolygon::Impl::checkValidity() const
+{
+    if (!isValid_)
+    {
+        throw ostk::core::error::RuntimeError("Prepared polygon is not valid: [{}]", validityFailure_);
+    }
+}
+
+PreparedPolygon::Impl::BoostPolygon PreparedPolygon::Impl::BoostPolygonFromPolygon(const Polygon& aPolygon)
+{
+    PreparedPolygon::Impl::BoostPolygon polygon;
+
+    for (const auto& point : aPolygon.getOuterRing())
+    {
+        boost::geometry::append(polygon.outer(), PreparedPolygon::Impl::BoostPoint(point.x(), point.y()));
+    }
+
+    for (Index innerRingIndex = 0; innerRingIndex < aPolygon.getInnerRingCount(); ++innerRingIndex)
+    {
+        polygon.inners().emplace_back();
+
+        for (const auto& point : aPolygon.getInnerRingAt(innerRingIndex))
+        {
+            boost::geometry::append(polygon.inners().back(), PreparedPolygon::Impl::BoostPoint(point.x(), point.y()));
+        }
+    }
+
+    boost::geometry::correct(polygon);
+
+    return polygon;
+}
+
+PreparedPolygon::Impl::BoostLineString PreparedPolygon::Impl::BoostLineStringFromLineString(
+    const LineString& aLineString
+)
+{
+    PreparedPolygon::Impl::BoostLineString lineString;
+
+    for (const auto& point : aLineString)
+    {
+        boost::geometry::append(lineString, PreparedPolygon::Impl::BoostPoint(point.x(), point.y()));
+    }
+
+    return lineString;
+}
+
+bool PreparedPolygon::Impl::IsOnEdge(
+    const PreparedPolygon::Impl::BoostPoint& aPoint, const PreparedPolygon::Impl::BoostEdge& anEdge
+)
+{
+    const PreparedPolygon::Impl::BoostPoint& firstVertex = anEdge.first;
+    const PreparedPolygon::Impl::BoostPoint& secondVertex = anEdge.second;
+
+    const double crossProduct = (secondVertex.x() - firstVertex.x()) * (aPoint.y() - firstVertex.y()) -
+                                (secondVertex.y() - firstVertex.y()) * (aPoint.x() - firstVertex.x());
+
+    return (crossProduct == 0.0) && (aPoint.x() >= std::min(firstVertex.x(), secondVertex.x())) &&
+           (aPoint.x() <= std::max(firstVertex.x(), secondVertex.x())) &&
+           (aPoint.y() >= std::min(firstVertex.y(), secondVertex.y())) &&
+           (aPoint.y() <= std::max(firstVertex.y(), secondVertex.y()));
+}
+
+PreparedPolygon::PreparedPolygon(const Polygon& aPolygon)
+    : polygon_(aPolygon),
+      implUPtr_(nullptr)
+{
+    if (!aPolygon.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon");
+    }
+
+    implUPtr_ = std::make_unique<PreparedPolygon::Impl>(polygon_);
+}
+
+PreparedPolygon::PreparedPolygon(const PreparedPolygon& aPreparedPolygon)
+    : polygon_(aPreparedPolygon.polygon_),
+      implUPtr_(std::make_unique<PreparedPolygon::Impl>(*aPreparedPolygon.implUPtr_))
+{
+}
+
+PreparedPolygon::~PreparedPolygon() {}
+
+PreparedPolygon& PreparedPolygon::operator=(const PreparedPolygon& aPreparedPolygon)
+{
+    if (this != &aPreparedPolygon)
+    {
+        polygon_ = aPreparedPolygon.polygon_;
+        implUPtr_ = std::make_unique<PreparedPolygon::Impl>(*aPreparedPolygon.implUPtr_);
+    }
+
+    return *this;
+}
+
+bool PreparedPolygon::isValid() const
+{
+    return implUPtr_->isValid();
+}
+
+bool PreparedPolygon::intersects(const Polygon& aPolygon) const
+{
+    if (!aPolygon.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon");
+    }
+
+    return implUPtr_->intersects(aPolygon);
+}
+
+bool PreparedPolygon::contains(const Point& aPoint) const
+{
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    return implUPtr_->locate(aPoint) != Polygon::Location::Outside;
+}
+
+bool PreparedPolygon::contains(const PointSet& aPointSet) const
+{
+    if (!aPointSet.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point set");
+    }
+
+    for (const auto& point : aPointSet)
+    {
+        if (implUPtr_->locate(point) == Polygon::Location::Outside)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool PreparedPolygon::contains(const LineString& aLineString) const
+{
+    if (!aLineString.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    return implUPtr_->contains(aLineString);
+}
+
+Polygon::Location PreparedPolygon::locate(const Point& aPoint) const
+{
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    return implUPtr_->locate(aPoint);
+}
+
+Array<Polygon::Location> PreparedPolygon::locate(const MatrixXd& aPointMatrix, const Size& aThreadCount) const
+{
+    if ((aPointMatrix.rows() > 0) && (aPointMatrix.cols() != 2))
+    {
+        throw ostk::core::error::runtime::Wrong("Point matrix");
+    }
+
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    const Size pointCount = aPointMatrix.rows();
+
+    Array<Polygon::Location> locations(pointCount, Polygon::Location::Outside);
+
+    const auto locateRange = [this, &aPointMatrix, &locations](const Index aBeginIndex, const Index anEndIndex)
+    {
+        for (Index pointIndex = aBeginIndex; pointIndex < anEndIndex; ++pointIndex)
+        {
+            locations[pointIndex] =
+                implUPtr_->locate(Point(aPointMatrix(pointIndex, 0), aPointMatrix(pointIndex, 1)));
+        }
+    };
+
+    // The prepared polygon is immutable: threads only share read access to it, and write disjoint output ranges
+
+    ostk::mathematics::utility::ForEachRange(pointCount, aThreadCount, locateRange);
+
+    return locations;
+}
+
+const Polygon& PreparedPolygon::accessPolygon() const
+{
+    return polygon_;
+}
+
+Intersection PreparedPolygon::intersectionWith(const Polygon& aPolygon) const
+{
+    if (!aPolygon.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon");
+    }
+
+    implUPtr_->checkValidity();
+
+    return polygon_.intersectionWith(aPolygon, true);
+}
+
+Intersection PreparedPolygon::differenceWith(const Polygon& aPolygon) const
+{
+    if (!aPolygon.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon");
+    }
+
+    implUPtr_->checkValidity();
+
+    return polygon_.differenceWith(aPolygon, true);
+}
+
+}  // namespace object
+}  // namespace d2
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
@@ -1,9 +1,19 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <set>
+#include <utility>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/LineString.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/PointSet.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Segment.hpp>
@@ -20,6 +30,391 @@ namespace d2
 namespace object
 {
 
+using ostk::core::container::Pair;
+
+// Sweep events are ordered lexicographically, by x then y
+
+bool SegmentSweepPrecedes(const Vector2d& aFirstPoint, const Vector2d& aSecondPoint)
+{
+    return (aFirstPoint.x() < aSecondPoint.x()) ||
+           ((aFirstPoint.x() == aSecondPoint.x()) && (aFirstPoint.y() < aSecondPoint.y()));
+}
+
+// Segments starting at, ending at and crossing an event point
+
+struct SegmentSweepEvent
+{
+    Array<Index> startingIndices = Array<Index>::Empty();
+    Array<Index> endingIndices = Array<Index>::Empty();
+    Array<Index> crossingIndices = Array<Index>::Empty();
+};
+
+// Twice the signed area of triangle (A, B, C), positive if counter-clockwise
+
+double SegmentOrientation(const Vector2d& A, const Vector2d& B, const Vector2d& C)
+{
+    return ((B.x() - A.x()) * (C.y() - A.y())) - ((B.y() - A.y()) * (C.x() - A.x()));
+}
+
+// Segments as seen by the sweep line: left (first in sweep order) and right end points
+
+struct SegmentSweepState
+{
+    Array<Vector2d> leftPoints = Array<Vector2d>::Empty();
+    Array<Vector2d> rightPoints = Array<Vector2d>::Empty();
+
+    Vector2d sweepPoint = Vector2d::Zero();
+
+    // Flags segments passing through the sweep point, while they are (re)inserted: their ordinate is then taken
+    // exactly, so that only their slopes decide their order
+
+    Array<char> throughSweepPoint = Array<char>::Empty();
+
+    // Ordinate of a segment on the sweep line (vertical segments are clamped to the sweep point)
+
+    double ordinateOf(const Index anIndex) const
+    {
+        if (throughSweepPoint[anIndex])
+        {
+            return sweepPoint.y();
+        }
+
+        const Vector2d& leftPoint = leftPoints[anIndex];
+        const Vector2d& rightPoint = rightPoints[anIndex];
+
+        if (leftPoint.x() == rightPoint.x())
+        {
+            return std::min(std::max(sweepPoint.y(), leftPoint.y()), rightPoint.y());
+        }
+
+        if (sweepPoint.x() <= leftPoint.x())
+        {
+            return leftPoint.y();
+        }
+
+        if (sweepPoint.x() >= rightPoint.x())
+        {
+            return rightPoint.y();
+        }
+
+        return leftPoint.y() + (((sweepPoint.x() - leftPoint.x()) * (rightPoint.y() - leftPoint.y())) /
+                                (rightPoint.x() - leftPoint.x()));
+    }
+
+    // True if the first segment is below the second one just after the sweep point
+
+    bool isBelow(const Index aFirstIndex, const Index aSecondIndex) const
+    {
+        const double firstOrdinate = this->ordinateOf(aFirstIndex);
+        const double secondOrdinate = this->ordinateOf(aSecondIndex);
+
+        if (firstOrdinate != secondOrdinate)
+        {
+            return firstOrdinate < secondOrdinate;
+        }
+
+        // Compare slopes without dividing (directions point right or up, vertical segments come last)
+
+        const Vector2d firstDirection = rightPoints[aFirstIndex] - leftPoints[aFirstIndex];
+        const Vector2d secondDirection = rightPoints[aSecondIndex] - leftPoints[aSecondIndex];
+
+        const double firstSlope = firstDirection.y() * secondDirection.x();
+        const double secondSlope = secondDirection.y() * firstDirection.x();
+
+        if (firstSlope != secondSlope)
+        {
+            return firstSlope < secondSlope;
+        }
+
+        return aFirstIndex < aSecondIndex;
+    }
+
+    // True if a segment contains the sweep point, up to the rounding of computed intersection points (so that a
+    // crossing is shared by all the segments overlapping at that point)
+
+    bool containsSweepPoint(const Index anIndex) const
+    {
+        const Vector2d& leftPoint = leftPoints[anIndex];
+        const Vector2d& rightPoint = rightPoints[anIndex];
+
+        if (SegmentSweepPrecedes(sweepPoint, leftPoint) || SegmentSweepPrecedes(rightPoint, sweepPoint))
+        {
+            return false;
+        }
+
+        const double magnitude = std::max(
+            {sweepPoint.cwiseAbs().maxCoeff(), leftPoint.cwiseAbs().maxCoeff(), rightPoint.cwiseAbs().maxCoeff()}
+        );
+        const double tolerance = 8.0 * std::numeric_limits<double>::epsilon() *
+                                 (rightPoint - leftPoint).cwiseAbs().maxCoeff() *
+                                 (magnitude + (sweepPoint - leftPoint).cwiseAbs().maxCoeff());
+
+        return std::abs(SegmentOrientation(leftPoint, rightPoint, sweepPoint)) <= tolerance;
+    }
+
+    // Intersection point of two segments, if any. Collinear overlaps are left out, as their ends are end points
+    // of the segments themselves.
+
+    bool intersect(const Index aFirstIndex, const Index aSecondIndex, Vector2d& anIntersectionPoint) const
+    {
+        const Vector2d& A = leftPoints[aFirstIndex];
+        const Vector2d& B = rightPoints[aFirstIndex];
+        const Vector2d& C = leftPoints[aSecondIndex];
+        const Vector2d& D = rightPoints[aSecondIndex];
+
+        const double orientationC = SegmentOrientation(A, B, C);
+        const double orientationD = SegmentOrientation(A, B, D);
+
+        if (((orientationC > 0.0) && (orientationD > 0.0)) || ((orientationC < 0.0) && (orientationD < 0.0)) ||
+            ((orientationC == 0.0) && (orientationD == 0.0)))
+        {
+            return false;
+        }
+
+        const double orientationA = SegmentOrientation(C, D, A);
+        const double orientationB = SegmentOrientation(C, D, B);
+
+        if (((orientationA > 0.0) && (orientationB > 0.0)) || ((orientationA < 0.0) && (orientationB < 0.0)))
+        {
+            return false;
+        }
+
+        // End points lying on the other segment are returned as is
+
+        if (orientationC == 0.0)
+        {
+            anIntersectionPoint = C;
+        }
+        else if (orientationD == 0.0)
+        {
+            anIntersectionPoint = D;
+        }
+        else if (orientationA == 0.0)
+        {
+            anIntersectionPoint = A;
+        }
+        else if (orientationB == 0.0)
+        {
+            anIntersectionPoint = B;
+        }
+        else
+        {
+            const double ratio = std::min(std::max(orientationA / (orientationA - orientationB), 0.0), 1.0);
+
+            anIntersectionPoint = A + (ratio * (B - A));
+        }
+
+        return true;
+    }
+};
+
+struct SegmentSweepOrder
+{
+    typedef void is_transparent;
+
+    const SegmentSweepState* statePtr;
+
+    bool operator()(const Index aFirstIndex, const Index aSecondIndex) const
+    {
+        return statePtr->isBelow(aFirstIndex, aSecondIndex);
+    }
+
+    bool operator()(const Index anIndex, const double anOrdinate) const
+    {
+        return statePtr->ordinateOf(anIndex) < anOrdinate;
+    }
+
+    bool operator()(const double anOrdinate, const Index anIndex) const
+    {
+        return anOrdinate < statePtr->ordinateOf(anIndex);
+    }
+};
+
+// Bentley-Ottmann sweep over non degenerate segments given by their left and right end points.
+// Returns (first index, second index, point) triplets, with first index < second index.
+
+Array<Tuple<Index, Index, Vector2d>> SegmentSweepIntersections(
+    const Array<Vector2d>& aLeftPointArray, const Array<Vector2d>& aRightPointArray
+)
+{
+    typedef std::set<Index, SegmentSweepOrder> Status;
+    typedef std::map<Pair<double, double>, SegmentSweepEvent> EventQueue;  // Lexicographic order
+
+    const Index segmentCount = aLeftPointArray.getSize();
+
+    SegmentSweepState state;
+
+    state.leftPoints = aLeftPointArray;
+    state.rightPoints = aRightPointArray;
+    state.throughSweepPoint = Array<char>(segmentCount, 0);
+
+    EventQueue events;
+
+    for (Index segmentIndex = 0; segmentIndex < segmentCount; ++segmentIndex)
+    {
+        const Vector2d& leftPoint = aLeftPointArray[segmentIndex];
+        const Vector2d& rightPoint = aRightPointArray[segmentIndex];
+
+        events[{leftPoint.x(), leftPoint.y()}].startingIndices.add(segmentIndex);
+        events[{rightPoint.x(), rightPoint.y()}].endingIndices.add(segmentIndex);
+    }
+
+    Status status(SegmentSweepOrder {&state});
+
+    Array<Status::iterator> positions(segmentCount, status.end());
+    Array<char> isInStatus(segmentCount, 0);
+    Array<char> isInvolved(segmentCount, 0);
+
+    Array<Tuple<Index, Index, Vector2d>> intersections = Array<Tuple<Index, Index, Vector2d>>::Empty();
+
+    // Schedule the intersection of two segments adjacent on the sweep line, if it lies ahead of the sweep point
+
+    const auto scheduleIntersection = [&state, &events](const Index aFirstIndex, const Index aSecondIndex) -> void
+    {
+        Vector2d intersectionPoint;
+
+        if (state.intersect(aFirstIndex, aSecondIndex, intersectionPoint) &&
+            SegmentSweepPrecedes(state.sweepPoint, intersectionPoint))
+        {
+            Array<Index>& crossingIndices = events[{intersectionPoint.x(), intersectionPoint.y()}].crossingIndices;
+
+            crossingIndices.add(aFirstIndex);
+            crossingIndices.add(aSecondIndex);
+        }
+    };
+
+    Array<Index> involvedIndices = Array<Index>::Empty();
+    Array<Index> insertedIndices = Array<Index>::Empty();
+
+    while (!events.empty())
+    {
+        const auto eventIt = events.begin();
+
+        state.sweepPoint = {eventIt->first.first, eventIt->first.second};
+
+        const SegmentSweepEvent event = std::move(eventIt->second);
+
+        events.erase(eventIt);
+
+        involvedIndices.clear();
+        involvedIndices.insert(involvedIndices.end(), event.startingIndices.begin(), event.startingIndices.end());
+        involvedIndices.insert(involvedIndices.end(), event.endingIndices.begin(), event.endingIndices.end());
+
+        for (const Index crossingIndex : event.crossingIndices)
+        {
+            if (isInStatus[crossingIndex])
+            {
+                involvedIndices.add(crossingIndex);
+            }
+        }
+
+        for (const Index involvedIndex : involvedIndices)
+        {
+            isInvolved[involvedIndex] = 1;
+        }
+
+        // Add the segments of the sweep line running exactly through the event point (touching end points,
+        // overlaps). They are contiguous, and next to the segments already involved.
+
+        const auto runsThroughSweepPoint = [&state, &isInvolved](const Index anIndex) -> bool
+        {
+            return isInvolved[anIndex] || state.containsSweepPoint(anIndex);
+        };
+
+        const Status::iterator probeIt = status.lower_bound(state.sweepPoint.y());
+
+        for (Status::iterator statusIt = probeIt; (statusIt != status.end()) && runsThroughSweepPoint(*statusIt);
+             ++statusIt)
+        {
+            involvedIndices.add(*statusIt);
+        }
+
+        for (Status::iterator statusIt = probeIt;
+             (statusIt != status.begin()) && runsThroughSweepPoint(*std::prev(statusIt));
+             --statusIt)
+        {
+            involvedIndices.add(*std::prev(statusIt));
+        }
+
+        std::sort(involvedIndices.begin(), involvedIndices.end());
+        involvedIndices.erase(std::unique(involvedIndices.begin(), involvedIndices.end()), involvedIndices.end());
+
+        for (auto firstIt = involvedIndices.begin(); firstIt != involvedIndices.end(); ++firstIt)
+        {
+            for (auto secondIt = std::next(firstIt); secondIt != involvedIndices.end(); ++secondIt)
+            {
+                intersections.emplace_back(*firstIt, *secondIt, state.sweepPoint);
+            }
+        }
+
+        // Remove the segments of the sweep line involved in the event, then reinsert those continuing past it
+
+        insertedIndices.clear();
+
+        for (const Index involvedIndex : involvedIndices)
+        {
+            if (isInStatus[involvedIndex])
+            {
+                status.erase(positions[involvedIndex]);
+                isInStatus[involvedIndex] = 0;
+            }
+
+            if (SegmentSweepPrecedes(state.sweepPoint, aRightPointArray[involvedIndex]))
+            {
+                insertedIndices.add(involvedIndex);
+                state.throughSweepPoint[involvedIndex] = 1;
+            }
+        }
+
+        for (const Index insertedIndex : insertedIndices)
+        {
+            positions[insertedIndex] = status.insert(insertedIndex).first;
+            isInStatus[insertedIndex] = 1;
+        }
+
+        for (const Index insertedIndex : insertedIndices)
+        {
+            state.throughSweepPoint[insertedIndex] = 0;
+        }
+
+        for (const Index involvedIndex : involvedIndices)
+        {
+            isInvolved[involvedIndex] = 0;
+        }
+
+        // Test the segments that became adjacent
+
+        if (insertedIndices.isEmpty())
+        {
+            const Status::iterator aboveIt = status.lower_bound(state.sweepPoint.y());
+
+            if ((aboveIt != status.end()) && (aboveIt != status.begin()))
+            {
+                scheduleIntersection(*std::prev(aboveIt), *aboveIt);
+            }
+        }
+        else
+        {
+            for (const Index insertedIndex : insertedIndices)
+            {
+                const Status::iterator insertedIt = positions[insertedIndex];
+
+                if (insertedIt != status.begin())
+                {
+                    scheduleIntersection(*std::prev(insertedIt), insertedIndex);
+                }
+
+                if (std::next(insertedIt) != status.end())
+                {
+                    scheduleIntersection(insertedIndex, *std::next(insertedIt));
+                }
+            }
+        }
+    }
+
+    return intersections;
+}
+
 Segment::Segment(const Point& aFirstPoint, const Point& aSecondPoint)
     : Object(),
       firstPoint_(aFirstPoint),
@@ -53,6 +448,16 @@ bool Segment::isDefined() const
     return firstPoint_.isDefined() && secondPoint_.isDefined();
 }
 
+BoundingBox Segment::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Segment");
+    }
+
+    return BoundingBox::Points({firstPoint_, secondPoint_});
+}
+
 bool Segment::isDegenerate() const
 {
     if (!this->isDefined())
@@ -293,6 +698,80 @@ Segment Segment::Undefined()
     return {Point::Undefined(), Point::Undefined()};
 }
 
+Array<Segment::IntersectionPoint> Segment::IntersectionPoints(const Array<Segment>& aSegmentArray)
+{
+    Array<Vector2d> leftPoints = Array<Vector2d>::Empty();
+    Array<Vector2d> rightPoints = Array<Vector2d>::Empty();
+    Array<Index> segmentIndices = Array<Index>::Empty();
+
+    leftPoints.reserve(aSegmentArray.getSize());
+    rightPoints.reserve(aSegmentArray.getSize());
+    segmentIndices.reserve(aSegmentArray.getSize());
+
+    for (Index segmentIndex = 0; segmentIndex < aSegmentArray.getSize(); ++segmentIndex)
+    {
+        const Segment& segment = aSegmentArray[segmentIndex];
+
+        if (!segment.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Segment");
+        }
+
+        if (segment.isDegenerate())
+        {
+            continue;
+        }
+
+        const Vector2d firstPoint = segment.firstPoint_.asVector();
+        const Vector2d secondPoint = segment.secondPoint_.asVector();
+
+        const bool isReversed = SegmentSweepPrecedes(secondPoint, firstPoint);
+
+        leftPoints.add(isReversed ? secondPoint : firstPoint);
+        rightPoints.add(isReversed ? firstPoint : secondPoint);
+        segmentIndices.add(segmentIndex);
+    }
+
+    Array<Tuple<Index, Index, Vector2d>> intersections = SegmentSweepIntersections(leftPoints, rightPoints);
+
+    // Sweep indices map to input indices in increasing order, so that pairs stay ordered
+
+    std::sort(
+        intersections.begin(),
+        intersections.end(),
+        [](const Tuple<Index, Index, Vector2d>& aFirstIntersection,
+           const Tuple<Index, Index, Vector2d>& aSecondIntersection) -> bool
+        {
+            if (std::get<0>(aFirstIntersection) != std::get<0>(aSecondIntersection))
+            {
+                return std::get<0>(aFirstIntersection) < std::get<0>(aSecondIntersection);
+            }
+
+            if (std::get<1>(aFirstIntersection) != std::get<1>(aSecondIntersection))
+            {
+                return std::get<1>(aFirstIntersection) < std::get<1>(aSecondIntersection);
+            }
+
+            return SegmentSweepPrecedes(std::get<2>(aFirstIntersection), std::get<2>(aSecondIntersection));
+        }
+    );
+
+    Array<Segment::IntersectionPoint> intersectionPoints = Array<Segment::IntersectionPoint>::Empty();
+
+    intersectionPoints.reserve(intersections.getSize());
+
+    for (const auto& intersection : intersections)
+    {
+        intersectionPoints.add(
+            {segmentIndices[std::get<0>(intersection)],
+             segmentIndices[std::get<1>(intersection)],
+             Point::Vector(std::get<2>(intersection))}
+        );
+    }
+
+    return intersectionPoints;
+}
+
 }  // namespace object
 }  // namespace d2
 }  // namespace geometry
@@ -0,0 +1,519 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Simplifier.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+namespace d2
+{
+namespace object
+{
+
+using ostk::core::container::Pair;
+using ostk::core::type::Index;
+
+using ostk::mathematics::object::Vector2d;
+
+typedef boost::geometry::model::point<double, 2, boost::geometry::cs::cartesian> SimplifierBoostPoint;
+typedef boost::geometry::model::box<SimplifierBoostPoint> SimplifierBoostBox;
+typedef Pair<SimplifierBoostPoint, Index> SimplifierTreeValue;
+typedef boost::geometry::index::rtree<SimplifierTreeValue, boost::geometry::index::rstar<16>> SimplifierTree;
+
+static constexpr Index SimplifierNoIndex = std::numeric_limits<Index>::max();
+
+// Signed area of the parallelogram spanned by [aFirstPoint, aSecondPoint] and [aFirstPoint, aThirdPoint]
+
+double SimplifierCross(const Vector2d& aFirstPoint, const Vector2d& aSecondPoint, const Vector2d& aThirdPoint)
+{
+    return ((aSecondPoint.x() - aFirstPoint.x()) * (aThirdPoint.y() - aFirstPoint.y())) -
+           ((aSecondPoint.y() - aFirstPoint.y()) * (aThirdPoint.x() - aFirstPoint.x()));
+}
+
+// Distance from a point to segment [aFirstPoint, aSecondPoint]
+
+double SimplifierDistance(const Vector2d& aFirstPoint, const Vector2d& aSecondPoint, const Vector2d& aPoint)
+{
+    const Vector2d direction = aSecondPoint - aFirstPoint;
+    const double squaredLength = direction.squaredNorm();
+
+    if (squaredLength == 0.0)
+    {
+        return (aPoint - aFirstPoint).norm();
+    }
+
+    const double parameter = std::max(0.0, std::min(1.0, (aPoint - aFirstPoint).dot(direction) / squaredLength));
+
+    return (aPoint - (aFirstPoint + (parameter * direction))).norm();
+}
+
+// True if a point lies on segment [aFirstPoint, aSecondPoint]
+
+bool SimplifierIsOnSegment(const Vector2d& aFirstPoint, const Vector2d& aSecondPoint, const Vector2d& aPoint)
+{
+    return (SimplifierCross(aFirstPoint, aSecondPoint, aPoint) == 0.0) &&
+           (aPoint.x() >= std::min(aFirstPoint.x(), aSecondPoint.x())) &&
+           (aPoint.x() <= std::max(aFirstPoint.x(), aSecondPoint.x())) &&
+           (aPoint.y() >= std::min(aFirstPoint.y(), aSecondPoint.y())) &&
+           (aPoint.y() <= std::max(aFirstPoint.y(), aSecondPoint.y()));
+}
+
+// Chains of points simplified together: current points are linked along their chain, and indexed in an R-tree
+
+struct SimplifierState
+{
+    std::vector<Vector2d> points;
+    std::vector<Index> chainOffsets;  // First point of each chain, followed by the total point count
+    std::vector<Size> chainPointCounts;  // Current point count of each chain
+    std::vector<Index> chainIndices;
+    std::vector<Index> previousIndices;  // Previous current point along the chain, if any
+    std::vector<Index> nextIndices;  // Next current point along the chain, if any
+    std::vector<char> removedFlags;
+    std::vector<Index> pathStamps;
+    Index pathStamp = 0;
+    Size treeRemovedPointCount = 0;
+    std::vector<Vector2d> pathPoints;
+    std::vector<SimplifierTreeValue> candidates;
+    SimplifierTree tree;
+
+    SimplifierState(const Array<Array<Point>>& aChainArray, const bool areRings)
+    {
+        chainOffsets.push_back(0);
+
+        for (const Array<Point>& chain : aChainArray)
+        {
+            // Repeated points are dropped, as well as the closing point of rings
+
+            const Index chainOffset = points.size();
+
+            for (const Point& point : chain)
+            {
+                if ((points.size() == chainOffset) || (point.asVector() != points.back()))
+                {
+                    points.push_back(point.asVector());
+                }
+            }
+
+            while (areRings && ((points.size() - chainOffset) > 1) && (points[chainOffset] == points.back()))
+            {
+                points.pop_back();
+            }
+
+            const Size chainPointCount = points.size() - chainOffset;
+
+            for (Index pointIndex = chainOffset; pointIndex < points.size(); ++pointIndex)
+            {
+                chainIndices.push_back(chainPointCounts.size());
+
+                if (areRings)
+                {
+                    previousIndices.push_back((pointIndex == chainOffset) ? (points.size() - 1) : (pointIndex - 1));
+                    nextIndices.push_back(((pointIndex + 1) == points.size()) ? chainOffset : (pointIndex + 1));
+                }
+                else
+                {
+                    previousIndices.push_back((pointIndex == chainOffset) ? SimplifierNoIndex : (pointIndex - 1));
+                    nextIndices.push_back(((pointIndex + 1) == points.size()) ? SimplifierNoIndex : (pointIndex + 1));
+                }
+            }
+
+            chainOffsets.push_back(points.size());
+            chainPointCounts.push_back(chainPointCount);
+        }
+
+        removedFlags.assign(points.size(), 0);
+        pathStamps.assign(points.size(), 0);
+
+        this->buildTree();
+    }
+
+    // Removed points are skipped by queries, and dropped from the tree once they make up half of it
+
+    void buildTree()
+    {
+        std::vector<SimplifierTreeValue> treeValues;
+
+        treeValues.reserve(points.size());
+
+        for (Index pointIndex = 0; pointIndex < points.size(); ++pointIndex)
+        {
+            if (!removedFlags[pointIndex])
+            {
+                treeValues.push_back({{points[pointIndex].x(), points[pointIndex].y()}, pointIndex});
+            }
+        }
+
+        tree = SimplifierTree(treeValues.begin(), treeValues.end());
+        treeRemovedPointCount = 0;
+    }
+
+    // Replacing the current points strictly between two points of a chain by a shortcut keeps chains simple and
+    // mutually disjoint, and leaves every other point on the same side of each ring, if no other current point lies
+    // on the shortcut or within the region enclosed by the replaced path and the shortcut (even-odd rule): any
+    // segment crossing the shortcut would otherwise have exactly one end point within that region.
+
+    bool isShortcutSafe(const Index aFirstIndex, const Index aLastIndex)
+    {
+        ++pathStamp;
+
+        pathPoints.assign(1, points[aFirstIndex]);
+
+        Vector2d lowerBound = points[aFirstIndex];
+        Vector2d upperBound = points[aFirstIndex];
+
+        for (Index pointIndex = nextIndices[aFirstIndex]; pointIndex != aLastIndex;
+             pointIndex = nextIndices[pointIndex])
+        {
+            pathStamps[pointIndex] = pathStamp;
+            pathPoints.push_back(points[pointIndex]);
+
+            lowerBound = lowerBound.cwiseMin(points[pointIndex]);
+            upperBound = upperBound.cwiseMax(points[pointIndex]);
+        }
+
+        pathPoints.push_back(points[aLastIndex]);
+
+        lowerBound = lowerBound.cwiseMin(points[aLastIndex]);
+        upperBound = upperBound.cwiseMax(points[aLastIndex]);
+
+        const SimplifierBoostBox box = {{lowerBound.x(), lowerBound.y()}, {upperBound.x(), upperBound.y()}};
+
+        candidates.clear();
+
+        tree.query(boost::geometry::index::intersects(box), std::back_inserter(candidates));
+
+        for (const SimplifierTreeValue& candidate : candidates)
+        {
+            const Index pointIndex = candidate.second;
+            const Vector2d& point = points[pointIndex];
+
+            if (removedFlags[pointIndex] || (pathStamps[pointIndex] == pathStamp) || (point == pathPoints.front()) ||
+                (point == pathPoints.back()))
+            {
+                continue;
+            }
+
+            bool isInside = false;
+
+            for (Index pathPointIndex = 0; pathPointIndex < pathPoints.size(); ++pathPointIndex)
+            {
+                const Vector2d& firstPoint = pathPoints[pathPointIndex];
+                const Vector2d& secondPoint = pathPoints[(pathPointIndex + 1) % pathPoints.size()];
+
+                if (SimplifierIsOnSegment(firstPoint, secondPoint, point))
+                {
+                    return false;
+                }
+
+                if ((firstPoint.y() > point.y()) != (secondPoint.y() > point.y()))
+                {
+                    const double crossingAbscissa = firstPoint.x() + ((point.y() - firstPoint.y()) /
+                                                                      (secondPoint.y() - firstPoint.y()) *
+                                                                      (secondPoint.x() - firstPoint.x()));
+
+                    if (point.x() < crossingAbscissa)
+                    {
+                        isInside = !isInside;
+                    }
+                }
+            }
+
+            if (isInside)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void remove(const Index aPointIndex)
+    {
+        const Index previousIndex = previousIndices[aPointIndex];
+        const Index nextIndex = nextIndices[aPointIndex];
+
+        nextIndices[previousIndex] = nextIndex;
+        previousIndices[nextIndex] = previousIndex;
+
+        removedFlags[aPointIndex] = 1;
+        chainPointCounts[chainIndices[aPointIndex]] -= 1;
+
+        if ((2 * (++treeRemovedPointCount)) > tree.size())
+        {
+            this->buildTree();
+        }
+    }
+
+    Array<Array<Point>> getChains() const
+    {
+        Array<Array<Point>> chains = Array<Array<Point>>::Empty();
+
+        chains.reserve(chainPointCounts.size());
+
+        for (Index chainIndex = 0; chainIndex < chainPointCounts.size(); ++chainIndex)
+        {
+            Array<Point> chain = Array<Point>::Empty();
+
+            chain.reserve(chainPointCounts[chainIndex]);
+
+            for (Index pointIndex = chainOffsets[chainIndex]; pointIndex < chainOffsets[chainIndex + 1]; ++pointIndex)
+            {
+                if (!removedFlags[pointIndex])
+                {
+                    chain.add(Point::Vector(points[pointIndex]));
+                }
+            }
+
+            chains.add(chain);
+        }
+
+        return chains;
+    }
+};
+
+Array<Array<Point>> Simplifier::DouglasPeucker(
+    const Array<Array<Point>>& aChainArray, const bool areRings, const Real& aTolerance
+)
+{
+    const double tolerance = aTolerance;
+
+    SimplifierState state(aChainArray, areRings);
+
+    std::vector<Pair<Index, Index>> stack;  // Ranges of chain point offsets, wrapping around rings
+
+    for (Index chainIndex = 0; chainIndex < state.chainPointCounts.size(); ++chainIndex)
+    {
+        const Index chainOffset = state.chainOffsets[chainIndex];
+        const Size chainPointCount = state.chainPointCounts[chainIndex];
+
+        if (chainPointCount < (areRings ? 4 : 3))
+        {
+            continue;
+        }
+
+        const auto pointAt = [&state, chainOffset, chainPointCount](const Index anOffset) -> const Vector2d&
+        {
+            return state.points[chainOffset + (anOffset % chainPointCount)];
+        };
+
+        // Point farthest from the shortcut between two chain point offsets, along with its distance
+
+        const auto farthestPoint = [&pointAt](const Index aFirstOffset, const Index aLastOffset) -> Pair<Index, double>
+        {
+            Pair<Index, double> farthestPoint = {aFirstOffset + 1, -1.0};
+
+            for (Index pointOffset = aFirstOffset + 1; pointOffset < aLastOffset; ++pointOffset)
+            {
+                const double distance =
+                    SimplifierDistance(pointAt(aFirstOffset), pointAt(aLastOffset), pointAt(pointOffset));
+
+                if (distance > farthestPoint.second)
+                {
+                    farthestPoint = {pointOffset, distance};
+                }
+            }
+
+            return farthestPoint;
+        };
+
+        if (areRings)
+        {
+            // Rings are first split at three points spanning a large triangle, farthest from each other
+
+            const Index secondOffset = farthestPoint(0, chainPointCount).first;
+
+            const Pair<Index, double> firstSidePoint = farthestPoint(0, secondOffset);
+            const Pair<Index, double> secondSidePoint = farthestPoint(secondOffset, chainPointCount);
+
+            const Index thirdOffset =
+                (firstSidePoint.second > secondSidePoint.second) ? firstSidePoint.first : secondSidePoint.first;
+
+            stack.push_back({std::max(secondOffset, thirdOffset), chainPointCount});
+            stack.push_back({std::min(secondOffset, thirdOffset), std::max(secondOffset, thirdOffset)});
+            stack.push_back({0, std::min(secondOffset, thirdOffset)});
+        }
+        else if (pointAt(0) == pointAt(chainPointCount - 1))
+        {
+            // Closed chains are first split at their farthest point
+
+            const Index middleOffset = farthestPoint(0, chainPointCount - 1).first;
+
+            stack.push_back({middleOffset, chainPointCount - 1});
+            stack.push_back({0, middleOffset});
+        }
+        else
+        {
+            stack.push_back({0, chainPointCount - 1});
+        }
+
+        while (!stack.empty())
+        {
+            const auto [firstOffset, lastOffset] = stack.back();
+
+            stack.pop_back();
+
+            if ((lastOffset - firstOffset) < 2)
+            {
+                continue;
+            }
+
+            const auto [middleOffset, distance] = farthestPoint(firstOffset, lastOffset);
+
+            if ((distance <= tolerance) && state.isShortcutSafe(
+                                               chainOffset + (firstOffset % chainPointCount),
+                                               chainOffset + (lastOffset % chainPointCount)
+                                           ))
+            {
+                for (Index pointOffset = firstOffset + 1; pointOffset < lastOffset; ++pointOffset)
+                {
+                    state.remove(chainOffset + (pointOffset % chainPointCount));
+                }
+
+                continue;
+            }
+
+            stack.push_back({middleOffset, lastOffset});
+            stack.push_back({firstOffset, middleOffset});
+        }
+    }
+
+    return state.getChains();
+}
+
+Array<Array<Point>> Simplifier::VisvalingamWhyatt(
+    const Array<Array<Point>>& aChainArray, const bool areRings, const Size& aPointCount
+)
+{
+    typedef Pair<double, Index> HeapEntry;  // Effective area, point index
+
+    SimplifierState state(aChainArray, areRings);
+
+    const Size minimumChainPointCount = areRings ? 3 : 2;
+
+    const auto areaAt = [&state](const Index aPointIndex) -> double
+    {
+        return 0.5 * std::abs(SimplifierCross(
+                         state.points[state.previousIndices[aPointIndex]],
+                         state.points[aPointIndex],
+                         state.points[state.nextIndices[aPointIndex]]
+                     ));
+    };
+
+    const auto isRemovable = [&state](const Index aPointIndex) -> bool
+    {
+        return (state.previousIndices[aPointIndex] != SimplifierNoIndex) &&
+               (state.nextIndices[aPointIndex] != SimplifierNoIndex);
+    };
+
+    // Heap entries are outdated once the effective area of their point changed
+
+    std::vector<double> areas(state.points.size(), std::numeric_limits<double>::infinity());
+    std::vector<HeapEntry> heapEntries;
+
+    heapEntries.reserve(state.points.size());
+
+    for (Index pointIndex = 0; pointIndex < state.points.size(); ++pointIndex)
+    {
+        if (isRemovable(pointIndex))
+        {
+            areas[pointIndex] = areaAt(pointIndex);
+            heapEntries.push_back({areas[pointIndex], pointIndex});
+        }
+    }
+
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap(
+        std::greater<HeapEntry>(), std::move(heapEntries)
+    );
+
+    std::vector<HeapEntry> blockedEntries;
+
+    Size pointCount = state.points.size();
+    Size blockedPointCount = pointCount;
+
+    while (pointCount > aPointCount)
+    {
+        // Points blocked by other points are reconsidered, as long as points were removed since they were blocked
+
+        if (heap.empty())
+        {
+            if (blockedEntries.empty() || (blockedPointCount == pointCount))
+            {
+                break;
+            }
+
+            for (const HeapEntry& blockedEntry : blockedEntries)
+            {
+                heap.push(blockedEntry);
+            }
+
+            blockedEntries.clear();
+            blockedPointCount = pointCount;
+
+            continue;
+        }
+
+        const HeapEntry heapEntry = heap.top();
+        const auto& [area, pointIndex] = heapEntry;
+
+        heap.pop();
+
+        if (state.removedFlags[pointIndex] || (area != areas[pointIndex]) ||
+            (state.chainPointCounts[state.chainIndices[pointIndex]] <= minimumChainPointCount))
+        {
+            continue;
+        }
+
+        const Index previousIndex = state.previousIndices[pointIndex];
+        const Index nextIndex = state.nextIndices[pointIndex];
+
+        if (!state.isShortcutSafe(previousIndex, nextIndex))
+        {
+            blockedEntries.push_back(heapEntry);
+
+            continue;
+        }
+
+        state.remove(pointIndex);
+
+        pointCount -= 1;
+
+        // Effective areas never decrease, so that points are removed in order of significance
+
+        for (const Index neighborIndex : {previousIndex, nextIndex})
+        {
+            if (isRemovable(neighborIndex))
+            {
+                areas[neighborIndex] = std::max(area, areaAt(neighborIndex));
+                heap.push({areas[neighborIndex], neighborIndex});
+            }
+        }
+    }
+
+    return state.getChains();
+}
+
+}  // namespace object
+}  // namespace d2
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
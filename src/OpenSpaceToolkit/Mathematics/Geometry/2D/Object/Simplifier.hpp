@@ -0,0 +1,77 @@
+/// Apache License 2.0
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Simplifier__
+#define __OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Simplifier__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Point.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+namespace d2
+{
+namespace object
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d2::object::Point;
+
+/// @brief                      Topology preserving simplification of point chains (line strings and polygon rings)
+///
+///                             Chains are simplified together, removing runs of points that can be replaced by a
+///                             shortcut without any other current point lying on that shortcut, or within the region
+///                             enclosed by the removed run and the shortcut. Simple and mutually disjoint chains thus
+///                             remain so, and inner rings stay on the same side of outer rings. Candidate points are
+///                             found with an R-tree of the current points.
+///
+///                             Repeated consecutive points (and closing points of rings) are dropped. End points of
+///                             open chains are kept, and rings keep at least 3 points.
+///
+///                             Internal to the library: used by line strings, polygons and multi-polygons.
+class Simplifier
+{
+   public:
+    /// @brief              Simplify chains, Douglas-Peucker style
+    ///
+    ///                     Every original point lies within the tolerance of its simplified chain. Shortcuts that
+    ///                     would alter the topology are refined further. Runs in O(n log n) on average.
+    ///
+    /// @param              [in] aChainArray An array of chains
+    /// @param              [in] areRings True if chains are closed rings
+    /// @param              [in] aTolerance A distance tolerance
+    /// @return             Array of simplified chains
+    static Array<Array<Point>> DouglasPeucker(
+        const Array<Array<Point>>& aChainArray, const bool areRings, const Real& aTolerance
+    );
+
+    /// @brief              Simplify chains down to a total number of points, Visvalingam-Whyatt style
+    ///
+    ///                     Points spanning the smallest effective area with their neighbors are removed first. Points
+    ///                     whose removal would alter the topology are kept, so that the point count may remain above
+    ///                     the requested one. Runs in O(n log n).
+    ///
+    /// @param              [in] aChainArray An array of chains
+    /// @param              [in] areRings True if chains are closed rings
+    /// @param              [in] aPointCount A total number of points
+    /// @return             Array of simplified chains
+    static Array<Array<Point>> VisvalingamWhyatt(
+        const Array<Array<Point>>& aChainArray, const bool areRings, const Size& aPointCount
+    );
+};
+
+}  // namespace object
+}  // namespace d2
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
@@ -16,6 +16,48 @@ namespace geometry
 namespace d2
 {
 
+// Apply the affine part of a homogeneous transformation matrix to the columns of a 2 x N matrix, in place
+
+void TransformationApplyInPlace(
+    const Transformation::Type& aType,
+    const Matrix3d& aTransformationMatrix,
+    const bool isTranslated,
+    Eigen::Ref<MatrixXd> aMatrix
+)
+{
+    using ostk::mathematics::object::Matrix2d;
+
+    switch (aType)
+    {
+        case Transformation::Type::Identity:
+            return;
+
+        case Transformation::Type::Translation:
+
+            if (isTranslated)
+            {
+                aMatrix.colwise() += aTransformationMatrix.topRightCorner<2, 1>();
+            }
+
+            return;
+
+        default:
+            break;
+    }
+
+    const Matrix2d linearPart = aTransformationMatrix.topLeftCorner<2, 2>();
+    const Vector2d translationPart = isTranslated ? Vector2d(aTransformationMatrix.topRightCorner<2, 1>()) : Vector2d::Zero();
+
+    // Fixed-size column copies keep the product allocation-free
+
+    for (Eigen::Index columnIndex = 0; columnIndex < aMatrix.cols(); ++columnIndex)
+    {
+        const Vector2d column = aMatrix.col(columnIndex);
+
+        aMatrix.col(columnIndex) = (linearPart * column) + translationPart;
+    }
+}
+
 Transformation::Transformation(const Matrix3d& aMatrix)
     : type_(Transformation::TypeOfMatrix(aMatrix)),
       matrix_(aMatrix)
@@ -236,6 +278,36 @@ Vector2d Transformation::applyTo(const Vector2d& aVector) const
     return Vector2d {(matrix_ * Vector3d(aVector.x(), aVector.y(), 0.0)).head<2>()};
 }
 
+void Transformation::applyToPoints(Eigen::Ref<MatrixXd> aPointMatrix) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Transformation");
+    }
+
+    if (aPointMatrix.rows() != 2)
+    {
+        throw ostk::core::error::runtime::Wrong("Point matrix");
+    }
+
+    TransformationApplyInPlace(type_, matrix_, true, aPointMatrix);
+}
+
+void Transformation::applyToVectors(Eigen::Ref<MatrixXd> aVectorMatrix) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Transformation");
+    }
+
+    if (aVectorMatrix.rows() != 2)
+    {
+        throw ostk::core::error::runtime::Wrong("Vector matrix");
+    }
+
+    TransformationApplyInPlace(type_, matrix_, false, aVectorMatrix);
+}
+
 // Unique<Object>                  Transformation::applyTo                     (   const   Unique<Object>& anObject )
 // const
 // {
@@ -0,0 +1,205 @@
+/// Apache License 2.0
+
+#include <limits>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+namespace d3
+{
+
+BoundingBox::BoundingBox(const Point& aLowerBound, const Point& anUpperBound)
+    : lowerBound_(aLowerBound),
+      upperBound_(anUpperBound)
+{
+    if (lowerBound_.isDefined() && upperBound_.isDefined())
+    {
+        if ((lowerBound_.x() > upperBound_.x()) || (lowerBound_.y() > upperBound_.y()) ||
+            (lowerBound_.z() > upperBound_.z()))
+        {
+            throw ostk::core::error::RuntimeError("Lower bound is greater than upper bound.");
+        }
+    }
+}
+
+bool BoundingBox::operator==(const BoundingBox& aBoundingBox) const
+{
+    if ((!this->isDefined()) || (!aBoundingBox.isDefined()))
+    {
+        return false;
+    }
+
+    return (lowerBound_ == aBoundingBox.lowerBound_) && (upperBound_ == aBoundingBox.upperBound_);
+}
+
+bool BoundingBox::operator!=(const BoundingBox& aBoundingBox) const
+{
+    return !((*this) == aBoundingBox);
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const BoundingBox& aBoundingBox)
+{
+    aBoundingBox.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+bool BoundingBox::isDefined() const
+{
+    return lowerBound_.isDefined() && upperBound_.isDefined();
+}
+
+bool BoundingBox::intersects(const BoundingBox& aBoundingBox) const
+{
+    if (!aBoundingBox.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Bounding box");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Bounding box");
+    }
+
+    return (lowerBound_.x() <= aBoundingBox.upperBound_.x()) && (aBoundingBox.lowerBound_.x() <= upperBound_.x()) &&
+           (lowerBound_.y() <= aBoundingBox.upperBound_.y()) && (aBoundingBox.lowerBound_.y() <= upperBound_.y()) &&
+           (lowerBound_.z() <= aBoundingBox.upperBound_.z()) && (aBoundingBox.lowerBound_.z() <= upperBound_.z());
+}
+
+bool BoundingBox::contains(const Point& aPoint) const
+{
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Bounding box");
+    }
+
+    return (lowerBound_.x() <= aPoint.x()) && (aPoint.x() <= upperBound_.x()) && (lowerBound_.y() <= aPoint.y()) &&
+           (aPoint.y() <= upperBound_.y()) && (lowerBound_.z() <= aPoint.z()) && (aPoint.z() <= upperBound_.z());
+}
+
+bool BoundingBox::contains(const BoundingBox& aBoundingBox) const
+{
+    if (!aBoundingBox.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Bounding box");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Bounding box");
+    }
+
+    return this->contains(aBoundingBox.lowerBound_) && this->contains(aBoundingBox.upperBound_);
+}
+
+Point BoundingBox::getLowerBound() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Bounding box");
+    }
+
+    return lowerBound_;
+}
+
+Point BoundingBox::getUpperBound() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Bounding box");
+    }
+
+    return upperBound_;
+}
+
+Point BoundingBox::getCenter() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Bounding box");
+    }
+
+    return Point::Vector(0.5 * (lowerBound_.asVector() + upperBound_.asVector()));
+}
+
+Vector3d BoundingBox::getSize() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Bounding box");
+    }
+
+    return upperBound_ - lowerBound_;
+}
+
+BoundingBox BoundingBox::unionWith(const BoundingBox& aBoundingBox) const
+{
+    if ((!this->isDefined()) || (!aBoundingBox.isDefined()))
+    {
+        return BoundingBox::Undefined();
+    }
+
+    return {
+        Point::Vector(lowerBound_.asVector().cwiseMin(aBoundingBox.lowerBound_.asVector())),
+        Point::Vector(upperBound_.asVector().cwiseMax(aBoundingBox.upperBound_.asVector()))
+    };
+}
+
+void BoundingBox::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Bounding Box") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Lower bound:" << (lowerBound_.isDefined() ? lowerBound_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Upper bound:" << (upperBound_.isDefined() ? upperBound_.toString() : "Undefined");
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+BoundingBox BoundingBox::Undefined()
+{
+    return {Point::Undefined(), Point::Undefined()};
+}
+
+BoundingBox BoundingBox::Points(const Array<Point>& aPointArray)
+{
+    if (aPointArray.isEmpty())
+    {
+        return BoundingBox::Undefined();
+    }
+
+    Vector3d lowerBound = Vector3d::Constant(std::numeric_limits<double>::infinity());
+    Vector3d upperBound = Vector3d::Constant(-std::numeric_limits<double>::infinity());
+
+    for (const auto& point : aPointArray)
+    {
+        if (!point.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Point");
+        }
+
+        lowerBound = lowerBound.cwiseMin(point.asVector());
+        upperBound = upperBound.cwiseMax(point.asVector());
+    }
+
+    return {Point::Vector(lowerBound), Point::Vector(upperBound)};
+}
+
+}  // namespace d3
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
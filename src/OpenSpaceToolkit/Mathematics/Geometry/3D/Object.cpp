@@ -3,6 +3,7 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Composite.hpp>
@@ -13,12 +14,14 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/LineString.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Plane.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/PointCloud.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/PointSet.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Polygon.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Pyramid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ray.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Segment.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/TriangleMesh.hpp>
 
 namespace ostk
 {
@@ -41,12 +44,14 @@ bool Object::operator==(const Object& anObject) const
     using ostk::mathematics::geometry::d3::object::LineString;
     using ostk::mathematics::geometry::d3::object::Plane;
     using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::PointCloud;
     using ostk::mathematics::geometry::d3::object::PointSet;
     using ostk::mathematics::geometry::d3::object::Polygon;
     using ostk::mathematics::geometry::d3::object::Pyramid;
     using ostk::mathematics::geometry::d3::object::Ray;
     using ostk::mathematics::geometry::d3::object::Segment;
     using ostk::mathematics::geometry::d3::object::Sphere;
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
 
     if ((!this->isDefined()) || (!anObject.isDefined()))
     {
@@ -78,6 +83,16 @@ bool Object::operator==(const Object& anObject) const
         }
     }
 
+    // PointCloud
+
+    if (const PointCloud* objectPtr = dynamic_cast<const PointCloud*>(this))
+    {
+        if (const PointCloud* otherObjectPtr = dynamic_cast<const PointCloud*>(&anObject))
+        {
+            return (*objectPtr) == (*otherObjectPtr);
+        }
+    }
+
     // Line
 
     if (const Line* objectPtr = dynamic_cast<const Line*>(this))
@@ -188,6 +203,16 @@ bool Object::operator==(const Object& anObject) const
         }
     }
 
+    // TriangleMesh
+
+    if (const TriangleMesh* objectPtr = dynamic_cast<const TriangleMesh*>(this))
+    {
+        if (const TriangleMesh* otherObjectPtr = dynamic_cast<const TriangleMesh*>(&anObject))
+        {
+            return (*objectPtr) == (*otherObjectPtr);
+        }
+    }
+
     // Composite
 
     if (const Composite* objectPtr = dynamic_cast<const Composite*>(this))
@@ -218,6 +243,11 @@ std::ostream& operator<<(std::ostream& anOutputStream, const Object& anObject)
     return anOutputStream;
 }
 
+BoundingBox Object::getBoundingBox() const
+{
+    return BoundingBox::Undefined();
+}
+
 bool Object::intersects(const Object& anObject) const
 {
     using ostk::mathematics::geometry::d3::object::Composite;
@@ -234,12 +264,21 @@ bool Object::intersects(const Object& anObject) const
     using ostk::mathematics::geometry::d3::object::Ray;
     using ostk::mathematics::geometry::d3::object::Segment;
     using ostk::mathematics::geometry::d3::object::Sphere;
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
 
     if (!anObject.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Object");
     }
 
+    // Early reject on bounding boxes, only applied within supported pairs of bounded objects, so that unsupported
+    // pairs keep throwing wherever they lie
+
+    const auto haveDisjointBoundingBoxes = [this, &anObject]() -> bool
+    {
+        return !this->getBoundingBox().intersects(anObject.getBoundingBox());
+    };
+
     // Line
 
     if (const Line* objectPtr = dynamic_cast<const Line*>(this))
@@ -290,6 +329,13 @@ bool Object::intersects(const Object& anObject) const
         {
             return objectPtr->intersects(*otherObjectPtr);
         }
+
+        // TriangleMesh
+
+        if (const TriangleMesh* otherObjectPtr = dynamic_cast<const TriangleMesh*>(&anObject))
+        {
+            return otherObjectPtr->intersects(*objectPtr);
+        }
     }
 
     // Segment
@@ -307,14 +353,14 @@ bool Object::intersects(const Object& anObject) const
 
         if (const Sphere* otherObjectPtr = dynamic_cast<const Sphere*>(&anObject))
         {
-            return objectPtr->intersects(*otherObjectPtr);
+            return (!haveDisjointBoundingBoxes()) && objectPtr->intersects(*otherObjectPtr);
         }
 
         // Ellipsoid
 
         if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
         {
-            return objectPtr->intersects(*otherObjectPtr);
+            return (!haveDisjointBoundingBoxes()) && objectPtr->intersects(*otherObjectPtr);
         }
     }
 
@@ -373,7 +419,7 @@ bool Object::intersects(const Object& anObject) const
 
         if (const Segment* otherObjectPtr = dynamic_cast<const Segment*>(&anObject))
         {
-            return objectPtr->intersects(*otherObjectPtr);
+            return (!haveDisjointBoundingBoxes()) && objectPtr->intersects(*otherObjectPtr);
         }
 
         // Ray
@@ -413,7 +459,7 @@ bool Object::intersects(const Object& anObject) const
 
         if (const Segment* otherObjectPtr = dynamic_cast<const Segment*>(&anObject))
         {
-            return objectPtr->intersects(*otherObjectPtr);
+            return (!haveDisjointBoundingBoxes()) && objectPtr->intersects(*otherObjectPtr);
         }
 
         // Ray
@@ -483,6 +529,18 @@ bool Object::intersects(const Object& anObject) const
         }
     }
 
+    // TriangleMesh
+
+    if (const TriangleMesh* objectPtr = dynamic_cast<const TriangleMesh*>(this))
+    {
+        // Ray
+
+        if (const Ray* otherObjectPtr = dynamic_cast<const Ray*>(&anObject))
+        {
+            return objectPtr->intersects(*otherObjectPtr);
+        }
+    }
+
     std::cout << (*this) << std::endl;
     std::cout << anObject << std::endl;
 
@@ -694,6 +752,7 @@ Intersection Object::intersectionWith(const Object& anObject) const
     using ostk::mathematics::geometry::d3::object::Ray;
     using ostk::mathematics::geometry::d3::object::Segment;
     using ostk::mathematics::geometry::d3::object::Sphere;
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
 
     if (!anObject.isDefined())
     {
@@ -729,6 +788,13 @@ Intersection Object::intersectionWith(const Object& anObject) const
         {
             return objectPtr->intersectionWith(*otherObjectPtr);
         }
+
+        // TriangleMesh
+
+        if (const TriangleMesh* otherObjectPtr = dynamic_cast<const TriangleMesh*>(&anObject))
+        {
+            return otherObjectPtr->intersectionWith(*objectPtr);
+        }
     }
 
     // Segment
@@ -845,6 +911,18 @@ Intersection Object::intersectionWith(const Object& anObject) const
         }
     }
 
+    // TriangleMesh
+
+    if (const TriangleMesh* objectPtr = dynamic_cast<const TriangleMesh*>(this))
+    {
+        // Ray
+
+        if (const Ray* otherObjectPtr = dynamic_cast<const Ray*>(&anObject))
+        {
+            return objectPtr->intersectionWith(*otherObjectPtr);
+        }
+    }
+
     std::cout << (*this) << std::endl;
     std::cout << anObject << std::endl;
 
@@ -1,10 +1,18 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <limits>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Segment.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 
 namespace ostk
@@ -18,10 +26,95 @@ namespace d3
 namespace object
 {
 
+using ostk::core::type::Real;
+
+void CompositeExtendBoundingBox(const Vector3d& aPoint, Vector3d& aLowerBound, Vector3d& anUpperBound)
+{
+    aLowerBound = aLowerBound.cwiseMin(aPoint);
+    anUpperBound = anUpperBound.cwiseMax(aPoint);
+}
+
+// Bounding box of an object as lower and upper bound vectors, padded so that boundary contacts reported by the exact
+// routines are never culled by the slab test; false if the object is unbounded
+
+bool CompositeBoundingBoxOf(const Object& anObject, Vector3d& aLowerBound, Vector3d& anUpperBound)
+{
+    const BoundingBox boundingBox = anObject.getBoundingBox();
+
+    if (!boundingBox.isDefined())
+    {
+        return false;
+    }
+
+    aLowerBound = boundingBox.getLowerBound().asVector();
+    anUpperBound = boundingBox.getUpperBound().asVector();
+
+    const Real margin =
+        1e-12 * (1.0 + std::max(aLowerBound.cwiseAbs().maxCoeff(), anUpperBound.cwiseAbs().maxCoeff()));
+
+    aLowerBound -= Vector3d::Constant(margin);
+    anUpperBound += Vector3d::Constant(margin);
+
+    return true;
+}
+
+double CompositeBoundingBoxHalfArea(const Vector3d& aLowerBound, const Vector3d& anUpperBound)
+{
+    const Vector3d extent = anUpperBound - aLowerBound;
+
+    return (extent.x() * extent.y()) + (extent.y() * extent.z()) + (extent.z() * extent.x());
+}
+
+// Slab test of the parametric query origin + t * direction, with t in [0, maxParameter]: a point has a null direction,
+// a segment a parameter range of [0, 1] and a ray an unbounded one
+
+bool CompositeBoundingBoxIntersects(
+    const Vector3d& aLowerBound,
+    const Vector3d& anUpperBound,
+    const Vector3d& anOrigin,
+    const Vector3d& aDirection,
+    const double aMaxParameter
+)
+{
+    double minimumParameter = 0.0;
+    double maximumParameter = aMaxParameter;
+
+    for (Index axisIndex = 0; axisIndex < 3; ++axisIndex)
+    {
+        if (aDirection[axisIndex] == 0.0)
+        {
+            if ((anOrigin[axisIndex] < aLowerBound[axisIndex]) || (anOrigin[axisIndex] > anUpperBound[axisIndex]))
+            {
+                return false;
+            }
+
+            continue;
+        }
+
+        const double inverseDirection = 1.0 / aDirection[axisIndex];
+        const double firstParameter = (aLowerBound[axisIndex] - anOrigin[axisIndex]) * inverseDirection;
+        const double secondParameter = (anUpperBound[axisIndex] - anOrigin[axisIndex]) * inverseDirection;
+
+        minimumParameter = std::max(minimumParameter, std::min(firstParameter, secondParameter));
+        maximumParameter = std::min(maximumParameter, std::max(firstParameter, secondParameter));
+
+        if (minimumParameter > maximumParameter)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 Composite::Composite(const Object& anObject)
     : Object(),
       defined_(true),
-      objects_(Array<Unique<Object>>::Empty())
+      objects_(Array<Unique<Object>>::Empty()),
+      indexed_(false),
+      indexNodes_(Array<IndexNode>::Empty()),
+      indexedObjectIndices_(Array<Index>::Empty()),
+      unindexedObjectIndices_(Array<Index>::Empty())
 {
     objects_.emplace_back(Unique<Object>(anObject.clone()));
 }
@@ -29,7 +122,11 @@ Composite::Composite(const Object& anObject)
 Composite::Composite(const Unique<Object>& anObjectUPtr)
     : Object(),
       defined_(true),
-      objects_(Array<Unique<Object>>::Empty())
+      objects_(Array<Unique<Object>>::Empty()),
+      indexed_(false),
+      indexNodes_(Array<IndexNode>::Empty()),
+      indexedObjectIndices_(Array<Index>::Empty()),
+      unindexedObjectIndices_(Array<Index>::Empty())
 {
     objects_.emplace_back(Unique<Object>(anObjectUPtr->clone()));
 }
@@ -37,7 +134,11 @@ Composite::Composite(const Unique<Object>& anObjectUPtr)
 Composite::Composite(Array<Unique<Object>>&& anObjectArray)
     : Object(),
       defined_(true),
-      objects_(Array<Unique<Object>>::Empty())
+      objects_(Array<Unique<Object>>::Empty()),
+      indexed_(false),
+      indexNodes_(Array<IndexNode>::Empty()),
+      indexedObjectIndices_(Array<Index>::Empty()),
+      unindexedObjectIndices_(Array<Index>::Empty())
 {
     objects_.reserve(anObjectArray.getSize());
 
@@ -55,7 +156,11 @@ Composite::Composite(Array<Unique<Object>>&& anObjectArray)
 Composite::Composite(const Composite& aComposite)
     : Object(),
       defined_(aComposite.defined_),
-      objects_(Array<Unique<Object>>::Empty())
+      objects_(Array<Unique<Object>>::Empty()),
+      indexed_(aComposite.indexed_),
+      indexNodes_(aComposite.indexNodes_),
+      indexedObjectIndices_(aComposite.indexedObjectIndices_),
+      unindexedObjectIndices_(aComposite.unindexedObjectIndices_)
 {
     objects_.reserve(aComposite.objects_.getSize());
 
@@ -81,6 +186,11 @@ Composite& Composite::operator=(const Composite& aComposite)
     {
         defined_ = aComposite.defined_;
 
+        indexed_ = aComposite.indexed_;
+        indexNodes_ = aComposite.indexNodes_;
+        indexedObjectIndices_ = aComposite.indexedObjectIndices_;
+        unindexedObjectIndices_ = aComposite.unindexedObjectIndices_;
+
         objects_.clear();
 
         objects_.reserve(aComposite.objects_.getSize());
@@ -162,6 +272,11 @@ Composite Composite::operator+(const Composite& aComposite) const
         }
     );
 
+    if (indexed_ || aComposite.indexed_)
+    {
+        composite.buildIndex();
+    }
+
     return composite;
 }
 
@@ -189,6 +304,11 @@ Composite& Composite::operator+=(const Composite& aComposite)
         }
     );
 
+    if (indexed_)
+    {
+        this->buildIndex();
+    }
+
     return *this;
 }
 
@@ -204,6 +324,33 @@ bool Composite::isDefined() const
                        );
 }
 
+BoundingBox Composite::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Composite");
+    }
+
+    if (objects_.isEmpty())
+    {
+        return BoundingBox::Undefined();
+    }
+
+    BoundingBox boundingBox = objects_.accessFirst()->getBoundingBox();
+
+    for (const auto& objectUPtr : objects_)
+    {
+        if (!boundingBox.isDefined())
+        {
+            break;
+        }
+
+        boundingBox = boundingBox.unionWith(objectUPtr->getBoundingBox());
+    }
+
+    return boundingBox;
+}
+
 bool Composite::isEmpty() const
 {
     if (!this->isDefined())
@@ -214,6 +361,16 @@ bool Composite::isEmpty() const
     return objects_.isEmpty();
 }
 
+bool Composite::isIndexed() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Composite");
+    }
+
+    return indexed_;
+}
+
 bool Composite::intersects(const Object& anObject) const
 {
     if (!anObject.isDefined())
@@ -226,6 +383,20 @@ bool Composite::intersects(const Object& anObject) const
         throw ostk::core::error::runtime::Undefined("Composite");
     }
 
+    if (indexed_)
+    {
+        const Array<Index> candidateObjectIndices = this->getCandidateObjectIndices(anObject);
+
+        return std::any_of(
+            candidateObjectIndices.begin(),
+            candidateObjectIndices.end(),
+            [this, &anObject](const Index& anObjectIndex) -> bool
+            {
+                return objects_[anObjectIndex]->intersects(anObject);
+            }
+        );
+    }
+
     return std::any_of(
         objects_.begin(),
         objects_.end(),
@@ -270,6 +441,13 @@ bool Composite::contains(const Object& anObject) const
         throw ostk::core::error::runtime::Undefined("Composite");
     }
 
+    // An object whose bounding box does not even overlap the query cannot contain it
+
+    if (indexed_ && (this->getCandidateObjectIndices(anObject).getSize() < objects_.getSize()))
+    {
+        return false;
+    }
+
     return std::all_of(
         objects_.begin(),
         objects_.end(),
@@ -351,6 +529,21 @@ Intersection Composite::intersectionWith(const Object& anObject) const
 
     Intersection intersection = Intersection::Empty();
 
+    if (indexed_)
+    {
+        for (const auto& objectIndex : this->getCandidateObjectIndices(anObject))
+        {
+            const Intersection objectToObjectIntersection = objects_[objectIndex]->intersectionWith(anObject);
+
+            if (objectToObjectIntersection.isDefined() && (!objectToObjectIntersection.isEmpty()))
+            {
+                intersection += objectToObjectIntersection;
+            }
+        }
+
+        return intersection;
+    }
+
     for (const auto& objectUPtr : objects_)
     {
         const Intersection objectToObjectIntersection = objectUPtr->intersectionWith(anObject);
@@ -411,6 +604,188 @@ Composite::ConstIterator Composite::end() const
     return objects_.end();
 }
 
+void Composite::buildIndex()
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Composite");
+    }
+
+    struct Item
+    {
+        Index objectIndex;
+        Vector3d lowerBound;
+        Vector3d upperBound;
+        Vector3d centroid;
+    };
+
+    static constexpr Size binCount = 12;
+    static constexpr Size leafSize = 4;
+
+    Array<Item> items = Array<Item>::Empty();
+
+    indexNodes_.clear();
+    indexedObjectIndices_.clear();
+    unindexedObjectIndices_.clear();
+
+    for (Index objectIndex = 0; objectIndex < objects_.getSize(); ++objectIndex)
+    {
+        Item item = {objectIndex, Vector3d::Zero(), Vector3d::Zero(), Vector3d::Zero()};
+
+        if (CompositeBoundingBoxOf(*objects_[objectIndex], item.lowerBound, item.upperBound))
+        {
+            item.centroid = 0.5 * (item.lowerBound + item.upperBound);
+            items.add(item);
+        }
+        else
+        {
+            unindexedObjectIndices_.add(objectIndex);
+        }
+    }
+
+    // Top-down construction in depth-first order: the first child of a branch immediately follows it
+
+    const auto buildNode =
+        [this, &items](const auto& aBuildNode, const Index aBeginIndex, const Index anEndIndex) -> void
+    {
+        const Index nodeIndex = indexNodes_.getSize();
+
+        IndexNode node = {
+            items[aBeginIndex].lowerBound, items[aBeginIndex].upperBound, aBeginIndex, anEndIndex - aBeginIndex
+        };
+        Vector3d centroidLowerBound = items[aBeginIndex].centroid;
+        Vector3d centroidUpperBound = items[aBeginIndex].centroid;
+
+        for (Index itemIndex = aBeginIndex; itemIndex < anEndIndex; ++itemIndex)
+        {
+            CompositeExtendBoundingBox(items[itemIndex].lowerBound, node.lowerBound, node.upperBound);
+            CompositeExtendBoundingBox(items[itemIndex].upperBound, node.lowerBound, node.upperBound);
+            CompositeExtendBoundingBox(items[itemIndex].centroid, centroidLowerBound, centroidUpperBound);
+        }
+
+        indexNodes_.add(node);
+
+        const Size itemCount = anEndIndex - aBeginIndex;
+
+        Index axisIndex = 0;
+        const double centroidExtent = (centroidUpperBound - centroidLowerBound).maxCoeff(&axisIndex);
+
+        if ((itemCount <= leafSize) || (centroidExtent <= 0.0))
+        {
+            return;
+        }
+
+        // Surface area heuristic over uniform centroid bins along the widest axis: the split minimizing the summed
+        // (item count x half area) of both sides is selected
+
+        const auto binOf = [&](const Item& anItem) -> Index
+        {
+            const double ratio = (anItem.centroid[axisIndex] - centroidLowerBound[axisIndex]) / centroidExtent;
+
+            return std::min(static_cast<Index>(ratio * binCount), binCount - 1);
+        };
+
+        Size binItemCounts[binCount] = {};
+        Vector3d binLowerBounds[binCount];
+        Vector3d binUpperBounds[binCount];
+
+        for (Index binIndex = 0; binIndex < binCount; ++binIndex)
+        {
+            binLowerBounds[binIndex] = Vector3d::Constant(std::numeric_limits<double>::infinity());
+            binUpperBounds[binIndex] = Vector3d::Constant(-std::numeric_limits<double>::infinity());
+        }
+
+        for (Index itemIndex = aBeginIndex; itemIndex < anEndIndex; ++itemIndex)
+        {
+            const Index binIndex = binOf(items[itemIndex]);
+
+            binItemCounts[binIndex]++;
+            CompositeExtendBoundingBox(items[itemIndex].lowerBound, binLowerBounds[binIndex], binUpperBounds[binIndex]);
+            CompositeExtendBoundingBox(items[itemIndex].upperBound, binLowerBounds[binIndex], binUpperBounds[binIndex]);
+        }
+
+        double splitCosts[binCount - 1];
+
+        Size leftItemCount = 0;
+        Vector3d leftLowerBound = Vector3d::Constant(std::numeric_limits<double>::infinity());
+        Vector3d leftUpperBound = Vector3d::Constant(-std::numeric_limits<double>::infinity());
+
+        for (Index binIndex = 0; binIndex < (binCount - 1); ++binIndex)
+        {
+            leftItemCount += binItemCounts[binIndex];
+            leftLowerBound = leftLowerBound.cwiseMin(binLowerBounds[binIndex]);
+            leftUpperBound = leftUpperBound.cwiseMax(binUpperBounds[binIndex]);
+
+            splitCosts[binIndex] = (leftItemCount > 0)
+                                     ? (leftItemCount * CompositeBoundingBoxHalfArea(leftLowerBound, leftUpperBound))
+                                     : std::numeric_limits<double>::infinity();
+        }
+
+        Size rightItemCount = 0;
+        Vector3d rightLowerBound = Vector3d::Constant(std::numeric_limits<double>::infinity());
+        Vector3d rightUpperBound = Vector3d::Constant(-std::numeric_limits<double>::infinity());
+
+        for (Index binIndex = binCount - 1; binIndex > 0; --binIndex)
+        {
+            rightItemCount += binItemCounts[binIndex];
+            rightLowerBound = rightLowerBound.cwiseMin(binLowerBounds[binIndex]);
+            rightUpperBound = rightUpperBound.cwiseMax(binUpperBounds[binIndex]);
+
+            splitCosts[binIndex - 1] +=
+                (rightItemCount > 0) ? (rightItemCount * CompositeBoundingBoxHalfArea(rightLowerBound, rightUpperBound))
+                                     : std::numeric_limits<double>::infinity();
+        }
+
+        const Index splitBinIndex = std::min_element(splitCosts, splitCosts + (binCount - 1)) - splitCosts;
+
+        Index middleIndex = std::partition(
+                                items.begin() + aBeginIndex,
+                                items.begin() + anEndIndex,
+                                [&binOf, splitBinIndex](const Item& anItem) -> bool
+                                {
+                                    return binOf(anItem) <= splitBinIndex;
+                                }
+                            ) -
+                            items.begin();
+
+        if ((middleIndex == aBeginIndex) || (middleIndex == anEndIndex))
+        {
+            middleIndex = aBeginIndex + (itemCount / 2);
+
+            std::nth_element(
+                items.begin() + aBeginIndex,
+                items.begin() + middleIndex,
+                items.begin() + anEndIndex,
+                [axisIndex](const Item& aFirstItem, const Item& aSecondItem) -> bool
+                {
+                    return aFirstItem.centroid[axisIndex] < aSecondItem.centroid[axisIndex];
+                }
+            );
+        }
+
+        aBuildNode(aBuildNode, aBeginIndex, middleIndex);
+
+        indexNodes_[nodeIndex].offset = indexNodes_.getSize();
+        indexNodes_[nodeIndex].count = 0;
+
+        aBuildNode(aBuildNode, middleIndex, anEndIndex);
+    };
+
+    if (!items.isEmpty())
+    {
+        buildNode(buildNode, 0, items.getSize());
+    }
+
+    indexedObjectIndices_.reserve(items.getSize());
+
+    for (const Item& item : items)
+    {
+        indexedObjectIndices_.add(item.objectIndex);
+    }
+
+    indexed_ = true;
+}
+
 void Composite::print(std::ostream& anOutputStream, bool displayDecorators) const
 {
     displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Composite") : void();
@@ -455,6 +830,11 @@ void Composite::applyTransformation(const Transformation& aTransformation)
     {
         objectUPtr->applyTransformation(aTransformation);
     }
+
+    if (indexed_)
+    {
+        this->buildIndex();
+    }
 }
 
 Composite Composite::Undefined()
@@ -471,6 +851,85 @@ Composite Composite::Empty()
     return Composite {Array<Unique<Object>>::Empty()};
 }
 
+Array<Index> Composite::getCandidateObjectIndices(const Object& anObject) const
+{
+    Array<Index> candidateObjectIndices = Array<Index>::Empty();
+
+    Vector3d origin = Vector3d::Zero();
+    Vector3d direction = Vector3d::Zero();
+    double maxParameter = 0.0;
+
+    if (const Point* pointPtr = dynamic_cast<const Point*>(&anObject))
+    {
+        origin = pointPtr->asVector();
+    }
+    else if (const Segment* segmentPtr = dynamic_cast<const Segment*>(&anObject))
+    {
+        origin = segmentPtr->getFirstPoint().asVector();
+        direction = segmentPtr->getSecondPoint() - segmentPtr->getFirstPoint();
+        maxParameter = 1.0;
+    }
+    else if (const Ray* rayPtr = dynamic_cast<const Ray*>(&anObject))
+    {
+        origin = rayPtr->getOrigin().asVector();
+        direction = rayPtr->getDirection();
+        maxParameter = std::numeric_limits<double>::infinity();
+    }
+    else
+    {
+        candidateObjectIndices.reserve(objects_.getSize());
+
+        for (Index objectIndex = 0; objectIndex < objects_.getSize(); ++objectIndex)
+        {
+            candidateObjectIndices.add(objectIndex);
+        }
+
+        return candidateObjectIndices;
+    }
+
+    candidateObjectIndices = unindexedObjectIndices_;
+
+    Array<Index> nodeIndexStack = Array<Index>::Empty();
+
+    if (!indexNodes_.isEmpty())
+    {
+        nodeIndexStack.add(0);
+    }
+
+    while (!nodeIndexStack.isEmpty())
+    {
+        const Index nodeIndex = nodeIndexStack.back();
+        const IndexNode& node = indexNodes_[nodeIndex];
+
+        nodeIndexStack.pop_back();
+
+        if (!CompositeBoundingBoxIntersects(node.lowerBound, node.upperBound, origin, direction, maxParameter))
+        {
+            continue;
+        }
+
+        if (node.count > 0)
+        {
+            candidateObjectIndices.insert(
+                candidateObjectIndices.end(),
+                indexedObjectIndices_.begin() + node.offset,
+                indexedObjectIndices_.begin() + node.offset + node.count
+            );
+        }
+        else
+        {
+            nodeIndexStack.add(node.offset);
+            nodeIndexStack.add(nodeIndex + 1);
+        }
+    }
+
+    // Evaluate in insertion order, so that results (e.g. intersections) match the unindexed path
+
+    std::sort(candidateObjectIndices.begin(), candidateObjectIndices.end());
+
+    return candidateObjectIndices;
+}
+
 }  // namespace object
 }  // namespace d3
 }  // namespace geometry
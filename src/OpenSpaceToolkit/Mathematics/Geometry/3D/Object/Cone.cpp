@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <algorithm>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -14,6 +16,8 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationVector.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/CoarseToFine.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/Parallel.hpp>
 
 namespace ostk
 {
@@ -26,12 +30,73 @@ namespace d3
 namespace object
 {
 
+Vector3d ConeLateralSurfaceReferenceDirection(const Vector3d& anAxis, const Angle& anAngle)
+{
+    using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+    using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
+
+    const Vector3d rotationAxis = (std::abs(anAxis.dot(Vector3d::X())) < 0.5) ? anAxis.cross(Vector3d::X()).normalized()
+                                                                               : anAxis.cross(Vector3d::Y()).normalized();
+
+    return Quaternion::RotationVector(RotationVector(rotationAxis, anAngle)).toConjugate() * anAxis;
+}
+
+Vector3d ConeLateralSurfaceDirection(
+    const Vector3d& anAxis, const Vector3d& aReferenceDirection, const Real& anAzimuth_deg
+)
+{
+    using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+    using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
+
+    return Quaternion::RotationVector(RotationVector(anAxis, Angle::Degrees(anAzimuth_deg))).toConjugate() *
+           aReferenceDirection;
+}
+
+// Conservative test against the bounding sphere of the ellipsoid: lateral surface rays make an angle theta with the
+// axis, and a ray can only hit a sphere seen from the apex under the half-angle alpha, in the direction phi from the
+// axis, if |phi - theta| <= alpha
+
+bool ConeLateralSurfaceCanIntersect(
+    const Point& anApex, const Vector3d& aUnitAxis, const Angle& anAngle, const Ellipsoid& anEllipsoid
+)
+{
+    const double boundingRadius = std::max(
+        {anEllipsoid.getFirstPrincipalSemiAxis(),
+         anEllipsoid.getSecondPrincipalSemiAxis(),
+         anEllipsoid.getThirdPrincipalSemiAxis()}
+    );
+
+    const Vector3d apexToCenter = anEllipsoid.getCenter() - anApex;
+    const double distance = apexToCenter.norm();
+
+    if (distance <= boundingRadius)
+    {
+        return true;
+    }
+
+    double angle_rad = anAngle.inRadians(0.0, Real::TwoPi());
+
+    if (angle_rad > Real::Pi())
+    {
+        angle_rad = Real::TwoPi() - angle_rad;
+    }
+
+    const double centerAngle_rad = std::acos(std::clamp(aUnitAxis.dot(apexToCenter) / distance, -1.0, 1.0));
+    const double sphereAngle_rad = std::asin(boundingRadius / distance);
+
+    return std::abs(centerAngle_rad - angle_rad) <= sphereAngle_rad;
+}
+
 Cone::Cone(const Point& anApex, const Vector3d& anAxis, const Angle& anAngle)
     : Object(),
       apex_(anApex),
       axis_(anAxis),
-      angle_(anAngle)
+      angle_(anAngle),
+      unitAxis_(Vector3d::Undefined()),
+      cosineOfAngle_(Real::Undefined()),
+      referenceDirection_(Vector3d::Undefined())
 {
+    this->updateFrame();
 }
 
 Cone* Cone::clone() const
@@ -102,16 +167,34 @@ bool Cone::intersects(const Ellipsoid& anEllipsoid, const Size aDiscretizationLe
         throw ostk::core::error::runtime::Undefined("Cone");
     }
 
-    for (const auto& ray :
-         this->getRaysOfLateralSurface(aDiscretizationLevel))  // [TBM] Could be improved by calculating rays on the fly
+    if (aDiscretizationLevel == 0)
     {
-        if (ray.intersects(anEllipsoid))
-        {
-            return true;
-        }
+        throw ostk::core::error::runtime::Wrong("Ray count");
+    }
+
+    // Early rejection: no lateral surface ray can hit the bounding sphere of the ellipsoid
+
+    if (cosineOfAngle_.isDefined() && (!ConeLateralSurfaceCanIntersect(apex_, unitAxis_, angle_, anEllipsoid)))
+    {
+        return false;
     }
 
-    return false;
+    // Rays are generated on the fly, coarse-to-fine, so that the test exits as soon as a ray hits the ellipsoid
+
+    const Vector3d referenceDirection =
+        referenceDirection_.isDefined() ? referenceDirection_ : ConeLateralSurfaceReferenceDirection(axis_, angle_);
+
+    return ostk::mathematics::utility::AnyOfCoarseToFine(
+        aDiscretizationLevel,
+        [this, &anEllipsoid, &referenceDirection, aDiscretizationLevel](const Index& aRayIndex) -> bool
+        {
+            const Real angle_deg = 360.0 * static_cast<double>(aRayIndex) / static_cast<double>(aDiscretizationLevel);
+
+            const Ray ray = {apex_, ConeLateralSurfaceDirection(axis_, referenceDirection, angle_deg)};
+
+            return ray.intersects(anEllipsoid);
+        }
+    );
 }
 
 bool Cone::contains(const Point& aPoint) const
@@ -133,6 +216,13 @@ bool Cone::contains(const Point& aPoint) const
 
     const Vector3d apexToPoint = aPoint - this->apex_;
 
+    if (cosineOfAngle_.isDefined())
+    {
+        const double projection = apexToPoint.dot(unitAxis_);
+
+        return (projection >= 0.0) && (projection >= (apexToPoint.norm() * cosineOfAngle_));
+    }
+
     if (apexToPoint.dot(this->axis_) < 0.0)
     {
         return false;
@@ -163,6 +253,51 @@ bool Cone::contains(const Segment& aSegment) const
     return this->contains(aSegment.getFirstPoint()) && this->contains(aSegment.getSecondPoint());
 }
 
+Array<bool> Cone::contains(const MatrixXd& aPointMatrix, const Size& aThreadCount) const
+{
+    using ostk::mathematics::utility::ForEachRange;
+
+    if ((aPointMatrix.rows() > 0) && (aPointMatrix.cols() != 3))
+    {
+        throw ostk::core::error::runtime::Wrong("Point matrix");
+    }
+
+    if (!aPointMatrix.allFinite())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Cone");
+    }
+
+    // Array<bool> packs bits, which threads cannot write concurrently
+
+    Eigen::Array<bool, Eigen::Dynamic, 1> containments(aPointMatrix.rows());
+
+    ForEachRange(
+        aPointMatrix.rows(),
+        aThreadCount,
+        [this, &aPointMatrix, &containments](const Index aBeginIndex, const Index anEndIndex)
+        {
+            for (Index rowIndex = aBeginIndex; rowIndex < anEndIndex; ++rowIndex)
+            {
+                containments(rowIndex) = this->contains(
+                    Point(aPointMatrix(rowIndex, 0), aPointMatrix(rowIndex, 1), aPointMatrix(rowIndex, 2))
+                );
+            }
+        }
+    );
+
+    return Array<bool>(containments.begin(), containments.end());
+}
+
 bool Cone::contains(const Ray& aRay) const
 {
     if (!aRay.isDefined())
@@ -247,8 +382,6 @@ Angle Cone::getAngle() const
 
 Array<Ray> Cone::getRaysOfLateralSurface(const Size aRayCount) const
 {
-    using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
-    using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
     using ostk::mathematics::object::Interval;
 
     if (aRayCount == 0)
@@ -256,31 +389,28 @@ Array<Ray> Cone::getRaysOfLateralSurface(const Size aRayCount) const
         throw ostk::core::error::runtime::Wrong("Ray count");
     }
 
-    const Vector3d referenceDirection = (std::abs(axis_.dot(Vector3d::X())) < 0.5)
-                                          ? axis_.cross(Vector3d::X()).normalized()
-                                          : axis_.cross(Vector3d::Y()).normalized();
-
-    const Ray referenceRay = {
-        apex_, Quaternion::RotationVector(RotationVector(referenceDirection, angle_)).toConjugate() * axis_
-    };
-
-    const Array<Real> angles_rad = (aRayCount > 1)
-                                     ? Interval<Real>::HalfOpenRight(0.0, 360.0).generateArrayWithSize(aRayCount)
-                                     : Array<Real> {0.0};
+    const Vector3d referenceDirection =
+        referenceDirection_.isDefined() ? referenceDirection_ : ConeLateralSurfaceReferenceDirection(axis_, angle_);
 
     Array<Ray> rays = Array<Ray>::Empty();
 
-    rays.reserve(angles_rad.getSize());
+    rays.reserve(aRayCount);
 
-    for (const auto& angle_rad : angles_rad)
+    const auto addRay = [this, &rays, &referenceDirection](const Real& anAngle_deg)
     {
-        const Angle angle = Angle::Degrees(angle_rad);
-
-        const Ray ray = {
-            apex_, Quaternion::RotationVector(RotationVector(axis_, angle)).toConjugate() * referenceRay.getDirection()
-        };
+        rays.add({apex_, ConeLateralSurfaceDirection(axis_, referenceDirection, anAngle_deg)});
+    };
 
-        rays.add(ray);
+    if (aRayCount > 1)
+    {
+        for (const Real& angle_deg : Interval<Real>::HalfOpenRight(0.0, 360.0).generateRangeWithSize(aRayCount))
+        {
+            addRay(angle_deg);
+        }
+    }
+    else
+    {
+        addRay(0.0);
     }
 
     return rays;
@@ -494,6 +624,8 @@ void Cone::applyTransformation(const Transformation& aTransformation)
     axis_ = aTransformation.applyTo(axis_);
 
     axis_.normalize();
+
+    this->updateFrame();
 }
 
 Cone Cone::Undefined()
@@ -501,6 +633,32 @@ Cone Cone::Undefined()
     return {Point::Undefined(), Vector3d::Undefined(), Angle::Undefined()};
 }
 
+void Cone::updateFrame()
+{
+    unitAxis_ = Vector3d::Undefined();
+    cosineOfAngle_ = Real::Undefined();
+    referenceDirection_ = Vector3d::Undefined();
+
+    if ((!this->isDefined()) || (axis_.norm() < Real::Epsilon()))
+    {
+        return;
+    }
+
+    // A point is contained if its direction from the apex lies in the front half-space and within the half-angle:
+    // caching the unit axis and the cosine of the half-angle reduces this to a dot product and a norm
+
+    unitAxis_ = axis_.normalized();
+
+    // Directions behind the apex are always rejected, hence half-angles of 90 deg or more accept the whole front
+    // half-space
+
+    cosineOfAngle_ = (angle_.inDegrees(0.0, 360.0) < 90.0) ? Real(std::cos(angle_.inRadians())) : Real(0.0);
+
+    // Lateral surface rays are generated by rotating this direction about the axis
+
+    referenceDirection_ = ConeLateralSurfaceReferenceDirection(axis_, angle_);
+}
+
 }  // namespace object
 }  // namespace d3
 }  // namespace geometry
@@ -1,11 +1,16 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <array>
+#include <numeric>
+
 #include <Gte/Mathematics/GteIntrOrientedBox3Cone3.h>
 #include <Gte/Mathematics/GteIntrOrientedBox3Frustum3.h>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Cuboid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Line.hpp>
@@ -17,6 +22,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationMatrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/Parallel.hpp>
 // #include <Gte/Mathematics/GteIntrOrientedBox3Cylinder3.h>
 #include <Gte/Mathematics/GteIntrLine3OrientedBox3.h>
 #include <Gte/Mathematics/GteIntrOrientedBox3OrientedBox3.h>
@@ -36,6 +42,30 @@ namespace d3
 namespace object
 {
 
+using ostk::mathematics::object::MatrixXd;
+
+// Columns of the box matrices, which hold one cuboid per row so that each component is contiguous across cuboids: the
+// center, the axes (row by row) and the extents (half-lengths, as in GTE oriented boxes)
+
+static constexpr Index CuboidCenterColumn = 0;
+static constexpr Index CuboidAxisColumn = 3;
+static constexpr Index CuboidExtentColumn = 12;
+static constexpr Index CuboidBoxColumnCount = 15;
+
+// Columns of the sphere matrices: the center and the radius
+
+static constexpr Index CuboidRadiusColumn = 3;
+static constexpr Index CuboidSphereColumnCount = 4;
+
+// Number of candidate pairs evaluated together by the narrow phase
+
+static constexpr Size CuboidBlockSize = 256;
+
+// Absolute cosine above which two axes are deemed parallel: the face normals are then the only separating axes needed,
+// and the degenerate edge cross products are skipped
+
+static constexpr double CuboidParallelCutoff = 1.0 - 1e-12;
+
 gte::Vector3<double> CuboidGteVectorFromPoint(const Point& aPoint)
 {
     return {aPoint.x(), aPoint.y(), aPoint.z()};
@@ -51,12 +81,461 @@ Point CuboidPointFromGteVector(const gte::Vector3<double>& aVector)
     return {aVector[0], aVector[1], aVector[2]};
 }
 
+gte::OrientedBox3<double> CuboidGteOrientedBox(
+    const Point& aCenter, const Matrix3d& anAxisMatrix, const Vector3d& anExtentVector
+)
+{
+    return {
+        CuboidGteVectorFromPoint(aCenter),
+        {CuboidGteVectorFromVector3d(anAxisMatrix.row(0)),
+         CuboidGteVectorFromVector3d(anAxisMatrix.row(1)),
+         CuboidGteVectorFromVector3d(anAxisMatrix.row(2))},
+        CuboidGteVectorFromVector3d(anExtentVector)
+    };
+}
+
+MatrixXd CuboidBoxMatrix(const Array<Cuboid>& aCuboidArray)
+{
+    MatrixXd boxMatrix(aCuboidArray.getSize(), CuboidBoxColumnCount);
+
+    for (Index cuboidIndex = 0; cuboidIndex < aCuboidArray.getSize(); ++cuboidIndex)
+    {
+        const Cuboid& cuboid = aCuboidArray[cuboidIndex];
+
+        if (!cuboid.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Cuboid");
+        }
+
+        boxMatrix.block<1, 3>(cuboidIndex, CuboidCenterColumn) = cuboid.getCenter().asVector().transpose();
+        boxMatrix.block<1, 3>(cuboidIndex, CuboidAxisColumn) = cuboid.getFirstAxis().transpose();
+        boxMatrix.block<1, 3>(cuboidIndex, CuboidAxisColumn + 3) = cuboid.getSecondAxis().transpose();
+        boxMatrix.block<1, 3>(cuboidIndex, CuboidAxisColumn + 6) = cuboid.getThirdAxis().transpose();
+        boxMatrix(cuboidIndex, CuboidExtentColumn) = cuboid.getFirstExtent();
+        boxMatrix(cuboidIndex, CuboidExtentColumn + 1) = cuboid.getSecondExtent();
+        boxMatrix(cuboidIndex, CuboidExtentColumn + 2) = cuboid.getThirdExtent();
+    }
+
+    return boxMatrix;
+}
+
+MatrixXd CuboidSphereMatrix(const Array<Sphere>& aSphereArray)
+{
+    MatrixXd sphereMatrix(aSphereArray.getSize(), CuboidSphereColumnCount);
+
+    for (Index sphereIndex = 0; sphereIndex < aSphereArray.getSize(); ++sphereIndex)
+    {
+        const Sphere& sphere = aSphereArray[sphereIndex];
+
+        if (!sphere.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Sphere");
+        }
+
+        sphereMatrix.block<1, 3>(sphereIndex, CuboidCenterColumn) = sphere.getCenter().asVector().transpose();
+        sphereMatrix(sphereIndex, CuboidRadiusColumn) = sphere.getRadius();
+    }
+
+    return sphereMatrix;
+}
+
+// Axis-aligned bounds, one object per column so that the sweep reads them contiguously: lower bounds in the first three
+// rows, upper bounds in the last three
+
+MatrixXd CuboidBoundMatrix(const MatrixXd& aCenterMatrix, const MatrixXd& aHalfSizeMatrix)
+{
+    MatrixXd boundMatrix(6, aCenterMatrix.rows());
+
+    boundMatrix.topRows<3>() = (aCenterMatrix - aHalfSizeMatrix).transpose();
+    boundMatrix.bottomRows<3>() = (aCenterMatrix + aHalfSizeMatrix).transpose();
+
+    return boundMatrix;
+}
+
+MatrixXd CuboidBoxBoundMatrix(const MatrixXd& aBoxMatrix)
+{
+    MatrixXd halfSizeMatrix = MatrixXd::Zero(aBoxMatrix.rows(), 3);
+
+    for (Index axisIndex = 0; axisIndex < 3; ++axisIndex)
+    {
+        halfSizeMatrix.array() += aBoxMatrix.middleCols<3>(CuboidAxisColumn + (3 * axisIndex)).array().abs().colwise() *
+                                  aBoxMatrix.col(CuboidExtentColumn + axisIndex).array();
+    }
+
+    return CuboidBoundMatrix(aBoxMatrix.middleCols<3>(CuboidCenterColumn), halfSizeMatrix);
+}
+
+MatrixXd CuboidSphereBoundMatrix(const MatrixXd& aSphereMatrix)
+{
+    return CuboidBoundMatrix(
+        aSphereMatrix.middleCols<3>(CuboidCenterColumn), aSphereMatrix.col(CuboidRadiusColumn).replicate(1, 3)
+    );
+}
+
+// Sweep and prune: the pairs (first, second) of objects whose bounds overlap. Objects enter the sweep by increasing
+// lower bound along the axis on which their centers spread the most, and leave the active lists once the sweep has
+// passed their upper bound
+
+Array<Pair<Index, Index>> CuboidSweepAndPrune(const MatrixXd& aFirstBoundMatrix, const MatrixXd& aSecondBoundMatrix)
+{
+    Array<Pair<Index, Index>> candidatePairs = Array<Pair<Index, Index>>::Empty();
+
+    if ((aFirstBoundMatrix.cols() == 0) || (aSecondBoundMatrix.cols() == 0))
+    {
+        return candidatePairs;
+    }
+
+    MatrixXd centerMatrix(3, aFirstBoundMatrix.cols() + aSecondBoundMatrix.cols());
+
+    centerMatrix.leftCols(aFirstBoundMatrix.cols()) = aFirstBoundMatrix.topRows<3>() + aFirstBoundMatrix.bottomRows<3>();
+    centerMatrix.rightCols(aSecondBoundMatrix.cols()) =
+        aSecondBoundMatrix.topRows<3>() + aSecondBoundMatrix.bottomRows<3>();
+
+    Eigen::Index sweepAxis = 0;
+
+    (centerMatrix.colwise() - centerMatrix.rowwise().mean()).rowwise().squaredNorm().maxCoeff(&sweepAxis);
+
+    const auto sweepOrder = [sweepAxis](const MatrixXd& aBoundMatrix) -> Array<Index>
+    {
+        Array<Index> order(aBoundMatrix.cols(), 0);
+
+        std::iota(order.begin(), order.end(), 0);
+
+        std::sort(
+            order.begin(),
+            order.end(),
+            [&aBoundMatrix, sweepAxis](const Index& aFirstIndex, const Index& aSecondIndex) -> bool
+            {
+                return aBoundMatrix(sweepAxis, aFirstIndex) < aBoundMatrix(sweepAxis, aSecondIndex);
+            }
+        );
+
+        return order;
+    };
+
+    const Array<Index> firstOrder = sweepOrder(aFirstBoundMatrix);
+    const Array<Index> secondOrder = sweepOrder(aSecondBoundMatrix);
+
+    Array<Index> firstActiveIndices = Array<Index>::Empty();
+    Array<Index> secondActiveIndices = Array<Index>::Empty();
+
+    // Prune the active objects of one side that end before the entering object of the other side starts, then pair
+    // the entering object with the remaining ones whose bounds overlap along all three axes
+
+    const auto enter = [sweepAxis](
+                           const MatrixXd& anEnteringBoundMatrix,
+                           const Index& anEnteringIndex,
+                           const MatrixXd& anActiveBoundMatrix,
+                           Array<Index>& anActiveIndexArray,
+                           const auto& anOverlapFunction
+                       )
+    {
+        const double lowerBound = anEnteringBoundMatrix(sweepAxis, anEnteringIndex);
+
+        anActiveIndexArray.erase(
+            std::remove_if(
+                anActiveIndexArray.begin(),
+                anActiveIndexArray.end(),
+                [&anActiveBoundMatrix, sweepAxis, lowerBound](const Index& anActiveIndex) -> bool
+                {
+                    return anActiveBoundMatrix(3 + sweepAxis, anActiveIndex) < lowerBound;
+                }
+            ),
+            anActiveIndexArray.end()
+        );
+
+        for (const Index& activeIndex : anActiveIndexArray)
+        {
+            const bool overlaps = (anEnteringBoundMatrix.block<3, 1>(0, anEnteringIndex).array() <=
+                                   anActiveBoundMatrix.block<3, 1>(3, activeIndex).array())
+                                      .all() &&
+                                  (anActiveBoundMatrix.block<3, 1>(0, activeIndex).array() <=
+                                   anEnteringBoundMatrix.block<3, 1>(3, anEnteringIndex).array())
+                                      .all();
+
+            if (overlaps)
+            {
+                anOverlapFunction(activeIndex);
+            }
+        }
+    };
+
+    Index firstPosition = 0;
+    Index secondPosition = 0;
+
+    while ((firstPosition < firstOrder.getSize()) || (secondPosition < secondOrder.getSize()))
+    {
+        const bool isFirstEntering =
+            (secondPosition == secondOrder.getSize()) ||
+            ((firstPosition < firstOrder.getSize()) &&
+             (aFirstBoundMatrix(sweepAxis, firstOrder[firstPosition]) <=
+              aSecondBoundMatrix(sweepAxis, secondOrder[secondPosition])));
+
+        if (isFirstEntering)
+        {
+            const Index firstIndex = firstOrder[firstPosition++];
+
+            enter(
+                aFirstBoundMatrix,
+                firstIndex,
+                aSecondBoundMatrix,
+                secondActiveIndices,
+                [&candidatePairs, firstIndex](const Index& aSecondIndex)
+                {
+                    candidatePairs.add({firstIndex, aSecondIndex});
+                }
+            );
+
+            firstActiveIndices.add(firstIndex);
+        }
+        else
+        {
+            const Index secondIndex = secondOrder[secondPosition++];
+
+            enter(
+                aSecondBoundMatrix,
+                secondIndex,
+                aFirstBoundMatrix,
+                firstActiveIndices,
+                [&candidatePairs, secondIndex](const Index& aFirstIndex)
+                {
+                    candidatePairs.add({aFirstIndex, secondIndex});
+                }
+            );
+
+            secondActiveIndices.add(secondIndex);
+        }
+    }
+
+    return candidatePairs;
+}
+
+// Separating axis test between oriented boxes (Gottschalk, Lin and Manocha, "OBBTree", 1996) over the candidate pairs
+// [aBeginIndex, anEndIndex): the 15 potential separating axes are evaluated component-wise across the pairs, in the
+// frame of the first box of each pair
+
+void CuboidIntersectBoxes(
+    const MatrixXd& aFirstBoxMatrix,
+    const MatrixXd& aSecondBoxMatrix,
+    const Array<Pair<Index, Index>>& aPairArray,
+    const Index aBeginIndex,
+    const Index anEndIndex,
+    Eigen::Array<bool, Eigen::Dynamic, 1>& anIntersectionArray
+)
+{
+    const Index pairCount = anEndIndex - aBeginIndex;
+
+    MatrixXd firstBoxMatrix(pairCount, CuboidBoxColumnCount);
+    MatrixXd secondBoxMatrix(pairCount, CuboidBoxColumnCount);
+
+    for (Index pairIndex = 0; pairIndex < pairCount; ++pairIndex)
+    {
+        firstBoxMatrix.row(pairIndex) = aFirstBoxMatrix.row(aPairArray[aBeginIndex + pairIndex].first);
+        secondBoxMatrix.row(pairIndex) = aSecondBoxMatrix.row(aPairArray[aBeginIndex + pairIndex].second);
+    }
+
+    const auto firstAxis = [&firstBoxMatrix](const Index anAxisIndex, const Index aComponentIndex)
+    {
+        return firstBoxMatrix.col(CuboidAxisColumn + (3 * anAxisIndex) + aComponentIndex).array();
+    };
+
+    const auto secondAxis = [&secondBoxMatrix](const Index anAxisIndex, const Index aComponentIndex)
+    {
+        return secondBoxMatrix.col(CuboidAxisColumn + (3 * anAxisIndex) + aComponentIndex).array();
+    };
+
+    const auto firstExtent = [&firstBoxMatrix](const Index anAxisIndex)
+    {
+        return firstBoxMatrix.col(CuboidExtentColumn + anAxisIndex).array();
+    };
+
+    const auto secondExtent = [&secondBoxMatrix](const Index anAxisIndex)
+    {
+        return secondBoxMatrix.col(CuboidExtentColumn + anAxisIndex).array();
+    };
+
+    const Eigen::ArrayXXd offset = (secondBoxMatrix.middleCols<3>(CuboidCenterColumn) -
+                                    firstBoxMatrix.middleCols<3>(CuboidCenterColumn))
+                                       .array();
+
+    // Rotation R_ij = A_i . B_j and translation t_i = A_i . (c_B - c_A) of the second box in the frame of the first
+
+    std::array<Eigen::ArrayXd, 9> rotation;
+    std::array<Eigen::ArrayXd, 9> absoluteRotation;
+    std::array<Eigen::ArrayXd, 3> translation;
+
+    for (Index i = 0; i < 3; ++i)
+    {
+        translation[i] = (firstAxis(i, 0) * offset.col(0)) + (firstAxis(i, 1) * offset.col(1)) +
+                         (firstAxis(i, 2) * offset.col(2));
+
+        for (Index j = 0; j < 3; ++j)
+        {
+            rotation[(3 * i) + j] = (firstAxis(i, 0) * secondAxis(j, 0)) + (firstAxis(i, 1) * secondAxis(j, 1)) +
+                                    (firstAxis(i, 2) * secondAxis(j, 2));
+            absoluteRotation[(3 * i) + j] = rotation[(3 * i) + j].abs();
+        }
+    }
+
+    Eigen::Array<bool, Eigen::Dynamic, 1> isSeparated = Eigen::Array<bool, Eigen::Dynamic, 1>::Constant(pairCount, false);
+    Eigen::Array<bool, Eigen::Dynamic, 1> hasParallelAxes =
+        Eigen::Array<bool, Eigen::Dynamic, 1>::Constant(pairCount, false);
+
+    // Face normals of the first box
+
+    for (Index i = 0; i < 3; ++i)
+    {
+        const Eigen::ArrayXd secondRadius = (secondExtent(0) * absoluteRotation[3 * i]) +
+                                            (secondExtent(1) * absoluteRotation[(3 * i) + 1]) +
+                                            (secondExtent(2) * absoluteRotation[(3 * i) + 2]);
+
+        isSeparated = isSeparated || (translation[i].abs() > (firstExtent(i) + secondRadius));
+    }
+
+    // Face normals of the second box
+
+    for (Index j = 0; j < 3; ++j)
+    {
+        const Eigen::ArrayXd firstRadius = (firstExtent(0) * absoluteRotation[j]) +
+                                           (firstExtent(1) * absoluteRotation[3 + j]) +
+                                           (firstExtent(2) * absoluteRotation[6 + j]);
+        const Eigen::ArrayXd projection =
+            (translation[0] * rotation[j]) + (translation[1] * rotation[3 + j]) + (translation[2] * rotation[6 + j]);
+
+        isSeparated = isSeparated || (projection.abs() > (firstRadius + secondExtent(j)));
+    }
+
+    for (const Eigen::ArrayXd& absoluteCosine : absoluteRotation)
+    {
+        hasParallelAxes = hasParallelAxes || (absoluteCosine >= CuboidParallelCutoff);
+    }
+
+    // Cross products A_i x B_j of an edge direction of each box
+
+    for (Index i = 0; i < 3; ++i)
+    {
+        const Index i1 = (i + 1) % 3;
+        const Index i2 = (i + 2) % 3;
+
+        for (Index j = 0; j < 3; ++j)
+        {
+            const Index j1 = (j + 1) % 3;
+            const Index j2 = (j + 2) % 3;
+
+            const Eigen::ArrayXd firstRadius =
+                (firstExtent(i1) * absoluteRotation[(3 * i2) + j]) + (firstExtent(i2) * absoluteRotation[(3 * i1) + j]);
+            const Eigen::ArrayXd secondRadius =
+                (secondExtent(j1) * absoluteRotation[(3 * i) + j2]) + (secondExtent(j2) * absoluteRotation[(3 * i) + j1]);
+            const Eigen::ArrayXd projection =
+                (translation[i2] * rotation[(3 * i1) + j]) - (translation[i1] * rotation[(3 * i2) + j]);
+
+            isSeparated = isSeparated || ((projection.abs() > (firstRadius + secondRadius)) && (!hasParallelAxes));
+        }
+    }
+
+    anIntersectionArray.segment(aBeginIndex, pairCount) = !isSeparated;
+}
+
+// Sphere - oriented box test over the candidate pairs [aBeginIndex, anEndIndex): squared distance from the center of
+// the sphere to the box, from its coordinates in the frame of the box clamped to the extents
+
+void CuboidIntersectSpheres(
+    const MatrixXd& aSphereMatrix,
+    const MatrixXd& aBoxMatrix,
+    const Array<Pair<Index, Index>>& aPairArray,
+    const Index aBeginIndex,
+    const Index anEndIndex,
+    Eigen::Array<bool, Eigen::Dynamic, 1>& anIntersectionArray
+)
+{
+    const Index pairCount = anEndIndex - aBeginIndex;
+
+    MatrixXd sphereMatrix(pairCount, CuboidSphereColumnCount);
+    MatrixXd boxMatrix(pairCount, CuboidBoxColumnCount);
+
+    for (Index pairIndex = 0; pairIndex < pairCount; ++pairIndex)
+    {
+        sphereMatrix.row(pairIndex) = aSphereMatrix.row(aPairArray[aBeginIndex + pairIndex].first);
+        boxMatrix.row(pairIndex) = aBoxMatrix.row(aPairArray[aBeginIndex + pairIndex].second);
+    }
+
+    const Eigen::ArrayXXd offset =
+        (sphereMatrix.middleCols<3>(CuboidCenterColumn) - boxMatrix.middleCols<3>(CuboidCenterColumn)).array();
+
+    Eigen::ArrayXd squaredDistance = Eigen::ArrayXd::Zero(pairCount);
+
+    for (Index i = 0; i < 3; ++i)
+    {
+        const Eigen::ArrayXd coordinate = (boxMatrix.col(CuboidAxisColumn + (3 * i)).array() * offset.col(0)) +
+                                          (boxMatrix.col(CuboidAxisColumn + (3 * i) + 1).array() * offset.col(1)) +
+                                          (boxMatrix.col(CuboidAxisColumn + (3 * i) + 2).array() * offset.col(2));
+
+        squaredDistance += (coordinate.abs() - boxMatrix.col(CuboidExtentColumn + i).array()).max(0.0).square();
+    }
+
+    anIntersectionArray.segment(aBeginIndex, pairCount) =
+        squaredDistance <= sphereMatrix.col(CuboidRadiusColumn).array().square();
+}
+
+// Broad phase, then narrow phase over blocks of candidate pairs split across threads
+
+template <typename NarrowPhase>
+Array<Pair<Index, Index>> CuboidIntersectingPairs(
+    const MatrixXd& aFirstMatrix,
+    const MatrixXd& aFirstBoundMatrix,
+    const MatrixXd& aSecondMatrix,
+    const MatrixXd& aSecondBoundMatrix,
+    const Size aThreadCount,
+    const NarrowPhase& aNarrowPhase
+)
+{
+    const Array<Pair<Index, Index>> candidatePairs = CuboidSweepAndPrune(aFirstBoundMatrix, aSecondBoundMatrix);
+
+    Eigen::Array<bool, Eigen::Dynamic, 1> intersections(candidatePairs.getSize());
+
+    ostk::mathematics::utility::ForEachRange(
+        candidatePairs.getSize(),
+        aThreadCount,
+        [&](const Index aBeginIndex, const Index anEndIndex)
+        {
+            for (Index blockIndex = aBeginIndex; blockIndex < anEndIndex; blockIndex += CuboidBlockSize)
+            {
+                aNarrowPhase(
+                    aFirstMatrix,
+                    aSecondMatrix,
+                    candidatePairs,
+                    blockIndex,
+                    std::min<Index>(blockIndex + CuboidBlockSize, anEndIndex),
+                    intersections
+                );
+            }
+        }
+    );
+
+    Array<Pair<Index, Index>> intersectingPairs = Array<Pair<Index, Index>>::Empty();
+
+    for (Index candidateIndex = 0; candidateIndex < candidatePairs.getSize(); ++candidateIndex)
+    {
+        if (intersections(candidateIndex))
+        {
+            intersectingPairs.add(candidatePairs[candidateIndex]);
+        }
+    }
+
+    std::sort(intersectingPairs.begin(), intersectingPairs.end());
+
+    return intersectingPairs;
+}
+
 Cuboid::Cuboid(const Point& aCenter, const std::array<Vector3d, 3>& aAxisArray, const std::array<Real, 3>& anExtent)
     : Object(),
       center_(aCenter),
       axes_(aAxisArray),
-      extent_(anExtent)
+      extent_(anExtent),
+      axisMatrix_(Matrix3d::Undefined()),
+      extentVector_(Vector3d::Undefined())
 {
+    this->updateFrame();
 }
 
 Cuboid* Cuboid::clone() const
@@ -154,6 +633,19 @@ bool Cuboid::isDefined() const
            extent_[0].isDefined() && extent_[1].isDefined() && extent_[2].isDefined();
 }
 
+BoundingBox Cuboid::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Cuboid");
+    }
+
+    const Vector3d halfSize = ((extent_[0] / 2.0) * axes_[0].cwiseAbs()) + ((extent_[1] / 2.0) * axes_[1].cwiseAbs()) +
+                              ((extent_[2] / 2.0) * axes_[2].cwiseAbs());
+
+    return {center_ - halfSize, center_ + halfSize};
+}
+
 bool Cuboid::isNear(const Cuboid& aCuboid, const Real& aTolerance) const
 {
     if (!aCuboid.isDefined())
@@ -216,15 +708,7 @@ bool Cuboid::intersects(const Line& aLine) const
 
     // Cuboid
 
-    const gte::Vector3<double> center = CuboidGteVectorFromPoint(center_);
-    const std::array<gte::Vector3<double>, 3> axis = {
-        CuboidGteVectorFromVector3d(axes_[0]),
-        CuboidGteVectorFromVector3d(axes_[1]),
-        CuboidGteVectorFromVector3d(axes_[2]),
-    };
-    const gte::Vector3<double> extent = {extent_[0], extent_[1], extent_[2]};
-
-    const gte::OrientedBox3<double> cuboid = {center, axis, extent};
+    const gte::OrientedBox3<double> cuboid = CuboidGteOrientedBox(center_, axisMatrix_, extentVector_);
 
     // Intersection
 
@@ -247,29 +731,9 @@ bool Cuboid::intersects(const Cuboid& aCuboid) const
         throw ostk::core::error::runtime::Undefined("Cuboid");
     }
 
-    // First cuboid
-
-    const gte::Vector3<double> firstCenter = CuboidGteVectorFromPoint(center_);
-    const std::array<gte::Vector3<double>, 3> firstAxis = {
-        CuboidGteVectorFromVector3d(axes_[0]),
-        CuboidGteVectorFromVector3d(axes_[1]),
-        CuboidGteVectorFromVector3d(axes_[2]),
-    };
-    const gte::Vector3<double> firstExtent = {extent_[0], extent_[1], extent_[2]};
-
-    const gte::OrientedBox3<double> firstCuboid = {firstCenter, firstAxis, firstExtent};
-
-    // Second cuboid
-
-    const gte::Vector3<double> secondCenter = CuboidGteVectorFromPoint(aCuboid.center_);
-    const std::array<gte::Vector3<double>, 3> secondAxis = {
-        CuboidGteVectorFromVector3d(aCuboid.axes_[0]),
-        CuboidGteVectorFromVector3d(aCuboid.axes_[1]),
-        CuboidGteVectorFromVector3d(aCuboid.axes_[2]),
-    };
-    const gte::Vector3<double> secondExtent = {aCuboid.extent_[0], aCuboid.extent_[1], aCuboid.extent_[2]};
-
-    const gte::OrientedBox3<double> secondCuboid = {secondCenter, secondAxis, secondExtent};
+    const gte::OrientedBox3<double> firstCuboid = CuboidGteOrientedBox(center_, axisMatrix_, extentVector_);
+    const gte::OrientedBox3<double> secondCuboid =
+        CuboidGteOrientedBox(aCuboid.center_, aCuboid.axisMatrix_, aCuboid.extentVector_);
 
     // Intersection
 
@@ -292,11 +756,11 @@ bool Cuboid::contains(const Point& aPoint) const
         throw ostk::core::error::runtime::Undefined("Cuboid");
     }
 
-    const Vector3d dx = aPoint - center_;
+    const Vector3d projection = (axisMatrix_ * (aPoint - center_)).cwiseAbs();
 
-    const Real a = std::abs(dx.dot(axes_[0]));
-    const Real b = std::abs(dx.dot(axes_[1]));
-    const Real c = std::abs(dx.dot(axes_[2]));
+    const Real a = projection(0);
+    const Real b = projection(1);
+    const Real c = projection(2);
 
     if (std::abs(a - extent_[0]) < Real::Epsilon())
     {
@@ -491,6 +955,8 @@ void Cuboid::applyTransformation(const Transformation& aTransformation)
     axes_[0].normalize();
     axes_[1].normalize();
     axes_[2].normalize();
+
+    this->updateFrame();
 }
 
 Cuboid Cuboid::Undefined()
@@ -517,6 +983,69 @@ Cuboid Cuboid::Cube(const Point& aCenter, const Real& anExtent)
     return {aCenter, {Vector3d::X(), Vector3d::Y(), Vector3d::Z()}, {anExtent, anExtent, anExtent}};
 }
 
+Array<Pair<Index, Index>> Cuboid::IntersectingPairs(
+    const Array<Cuboid>& aFirstCuboidArray, const Array<Cuboid>& aSecondCuboidArray, const Size& aThreadCount
+)
+{
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    const MatrixXd firstBoxMatrix = CuboidBoxMatrix(aFirstCuboidArray);
+    const MatrixXd secondBoxMatrix = CuboidBoxMatrix(aSecondCuboidArray);
+
+    return CuboidIntersectingPairs(
+        firstBoxMatrix,
+        CuboidBoxBoundMatrix(firstBoxMatrix),
+        secondBoxMatrix,
+        CuboidBoxBoundMatrix(secondBoxMatrix),
+        aThreadCount,
+        CuboidIntersectBoxes
+    );
+}
+
+Array<Pair<Index, Index>> Cuboid::IntersectingPairs(
+    const Array<Sphere>& aSphereArray, const Array<Cuboid>& aCuboidArray, const Size& aThreadCount
+)
+{
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    const MatrixXd sphereMatrix = CuboidSphereMatrix(aSphereArray);
+    const MatrixXd boxMatrix = CuboidBoxMatrix(aCuboidArray);
+
+    return CuboidIntersectingPairs(
+        sphereMatrix,
+        CuboidSphereBoundMatrix(sphereMatrix),
+        boxMatrix,
+        CuboidBoxBoundMatrix(boxMatrix),
+        aThreadCount,
+        CuboidIntersectSpheres
+    );
+}
+
+void Cuboid::updateFrame()
+{
+    axisMatrix_ = Matrix3d::Undefined();
+    extentVector_ = Vector3d::Undefined();
+
+    if (!this->isDefined())
+    {
+        return;
+    }
+
+    // Plain double copies of the frame, so that queries skip the Real conversions and build GTE boxes directly
+
+    axisMatrix_.row(0) = axes_[0];
+    axisMatrix_.row(1) = axes_[1];
+    axisMatrix_.row(2) = axes_[2];
+
+    extentVector_ = Vector3d(extent_[0], extent_[1], extent_[2]);
+}
+
 }  // namespace object
 }  // namespace d3
 }  // namespace geometry
@@ -5,6 +5,7 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Cone.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ellipsoid.hpp>
@@ -17,6 +18,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationMatrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/Parallel.hpp>
 // #include <Gte/Mathematics/GteIntrHalfspace3Ellipsoid3.h>
 #include <Gte/Mathematics/GteIntrLine3Ellipsoid3.h>
 #include <Gte/Mathematics/GteIntrPlane3Ellipsoid3.h>
@@ -35,6 +37,9 @@
 
 #pragma GCC diagnostic pop  // Turn the warnings back on
 
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <math.h>
 
 namespace ostk
@@ -48,6 +53,8 @@ namespace d3
 namespace object
 {
 
+using ostk::core::type::Index;
+
 gte::Vector3<double> EllipsoidGteVectorFromPoint(const Point& aPoint)
 {
     return {aPoint.x(), aPoint.y(), aPoint.z()};
@@ -63,6 +70,269 @@ Point EllipsoidPointFromGteVector(const gte::Vector3<double>& aVector)
     return {aVector[0], aVector[1], aVector[2]};
 }
 
+std::array<gte::Vector3<double>, 3> EllipsoidGteAxesFromMatrix(const Matrix3d& anAxisMatrix)
+{
+    return {
+        gte::Vector3<double> {anAxisMatrix(0, 0), anAxisMatrix(0, 1), anAxisMatrix(0, 2)},
+        gte::Vector3<double> {anAxisMatrix(1, 0), anAxisMatrix(1, 1), anAxisMatrix(1, 2)},
+        gte::Vector3<double> {anAxisMatrix(2, 0), anAxisMatrix(2, 1), anAxisMatrix(2, 2)}
+    };
+}
+
+// Rows are the principal axes (as returned by getFirstAxis, ...): maps frame coordinates to principal frame coordinates
+
+Matrix3d EllipsoidDirectionCosineMatrix(const Quaternion& anOrientation)
+{
+    const Quaternion conjugateOrientation = anOrientation.toConjugate();
+
+    Matrix3d dcm;
+
+    dcm.row(0) = conjugateOrientation * Vector3d::X();
+    dcm.row(1) = conjugateOrientation * Vector3d::Y();
+    dcm.row(2) = conjugateOrientation * Vector3d::Z();
+
+    return dcm;
+}
+
+// Root u > 0 of F(u) = sum_i (n_i / (u + d_i))^2 - 1, for numerators n_i = r_i z_i > 0 and offsets d_i = r_i - 1 >= 0,
+// with scaled coordinates z_i = y_i / e_i and axis ratios r_i = (e_i / e_{n-1})^2 (Eberly, "Distance from a Point to an
+// Ellipse, an Ellipsoid, or a Hyperellipsoid"). The root is shifted by one from Eberly's, so that it stays resolvable
+// when the closest point leaves a point close to the minor axes.
+//
+// F is decreasing and convex on the bracket [n_{n-1}, max(1, |n|)], so that Newton iterations started from its right
+// end converge monotonically; bisection takes over whenever rounding pushes an iterate out of the bracket
+
+double EllipsoidSecularRoot(const double* aNumeratorArray, const double* anOffsetArray, const Size aDimension)
+{
+    double valueAtOne = -1.0;
+    double numeratorNorm = 0.0;
+
+    for (Size axisIndex = 0; axisIndex < aDimension; ++axisIndex)
+    {
+        const double ratio = aNumeratorArray[axisIndex] / (1.0 + anOffsetArray[axisIndex]);
+
+        valueAtOne += ratio * ratio;
+        numeratorNorm = std::hypot(numeratorNorm, aNumeratorArray[axisIndex]);
+    }
+
+    // F(1) is the implicit function of the ellipsoid at the point: the root is below one inside the ellipsoid
+
+    double lowerBound = aNumeratorArray[aDimension - 1];
+    double upperBound = (valueAtOne < 0.0) ? 1.0 : numeratorNorm;
+
+    double root = upperBound;
+
+    for (Size iterationIndex = 0; iterationIndex < 2100; ++iterationIndex)
+    {
+        double functionValue = -1.0;
+        double derivativeValue = 0.0;
+
+        for (Size axisIndex = 0; axisIndex < aDimension; ++axisIndex)
+        {
+            const double denominator = root + anOffsetArray[axisIndex];
+            const double ratio = aNumeratorArray[axisIndex] / denominator;
+
+            functionValue += ratio * ratio;
+            derivativeValue -= (2.0 * ratio * ratio) / denominator;
+        }
+
+        if (functionValue > 0.0)
+        {
+            lowerBound = root;
+        }
+        else if (functionValue < 0.0)
+        {
+            upperBound = root;
+        }
+        else
+        {
+            return root;
+        }
+
+        const double step = functionValue / derivativeValue;
+
+        // Past quadratic convergence, a step of a few ulps may leave the bracket: stop instead of bisecting it down
+
+        if (std::abs(step) <= (4.0 * std::numeric_limits<double>::epsilon() * root))
+        {
+            return root;
+        }
+
+        double nextRoot = root - step;
+
+        if ((!(nextRoot > lowerBound)) || (!(nextRoot < upperBound)))
+        {
+            nextRoot = 0.5 * (lowerBound + upperBound);
+
+            if ((nextRoot == lowerBound) || (nextRoot == upperBound))
+            {
+                return nextRoot;
+            }
+        }
+
+        if (nextRoot == root)
+        {
+            return root;
+        }
+
+        root = nextRoot;
+    }
+
+    return root;
+}
+
+// Closest point of an ellipse to a point, for semi-axes e_0 >= e_1 > 0 and a point in the first quadrant
+
+std::array<double, 2> EllipsoidClosestPointOnEllipse(
+    const std::array<double, 2>& aSemiAxisArray, const std::array<double, 2>& aPointArray
+)
+{
+    const double e0 = aSemiAxisArray[0];
+    const double e1 = aSemiAxisArray[1];
+    const double y0 = aPointArray[0];
+    const double y1 = aPointArray[1];
+
+    if (y1 > 0.0)
+    {
+        if (y0 > 0.0)
+        {
+            const double ratio0 = (e0 / e1) * (e0 / e1);
+
+            const double numerators[2] = {ratio0 * (y0 / e0), y1 / e1};
+            const double offsets[2] = {((e0 - e1) * (e0 + e1)) / (e1 * e1), 0.0};
+
+            const double root = EllipsoidSecularRoot(numerators, offsets, 2);
+
+            return {(ratio0 * y0) / (root + offsets[0]), y1 / root};
+        }
+
+        return {0.0, e1};
+    }
+
+    // On the major axis: the closest point leaves the axis when the point is within the evolute
+
+    const double numerator = e0 * y0;
+    const double denominator = (e0 * e0) - (e1 * e1);
+
+    if (numerator < denominator)
+    {
+        const double x0OverE0 = numerator / denominator;
+
+        return {e0 * x0OverE0, e1 * std::sqrt(1.0 - (x0OverE0 * x0OverE0))};
+    }
+
+    return {e0, 0.0};
+}
+
+// Closest point of an ellipsoid to a point, for semi-axes e_0 >= e_1 >= e_2 > 0 and a point in the first octant
+
+std::array<double, 3> EllipsoidClosestPointInFirstOctant(
+    const std::array<double, 3>& aSemiAxisArray, const std::array<double, 3>& aPointArray
+)
+{
+    const double e0 = aSemiAxisArray[0];
+    const double e1 = aSemiAxisArray[1];
+    const double e2 = aSemiAxisArray[2];
+    const double y0 = aPointArray[0];
+    const double y1 = aPointArray[1];
+    const double y2 = aPointArray[2];
+
+    if (y2 > 0.0)
+    {
+        if ((y1 > 0.0) && (y0 > 0.0))
+        {
+            const double ratio0 = (e0 / e2) * (e0 / e2);
+            const double ratio1 = (e1 / e2) * (e1 / e2);
+
+            const double numerators[3] = {ratio0 * (y0 / e0), ratio1 * (y1 / e1), y2 / e2};
+            const double offsets[3] = {((e0 - e2) * (e0 + e2)) / (e2 * e2), ((e1 - e2) * (e1 + e2)) / (e2 * e2), 0.0};
+
+            const double root = EllipsoidSecularRoot(numerators, offsets, 3);
+
+            return {(ratio0 * y0) / (root + offsets[0]), (ratio1 * y1) / (root + offsets[1]), y2 / root};
+        }
+
+        if (y1 > 0.0)
+        {
+            const std::array<double, 2> closestPoint = EllipsoidClosestPointOnEllipse({e1, e2}, {y1, y2});
+
+            return {0.0, closestPoint[0], closestPoint[1]};
+        }
+
+        if (y0 > 0.0)
+        {
+            const std::array<double, 2> closestPoint = EllipsoidClosestPointOnEllipse({e0, e2}, {y0, y2});
+
+            return {closestPoint[0], 0.0, closestPoint[1]};
+        }
+
+        return {0.0, 0.0, e2};
+    }
+
+    // In the plane of the two major axes: the closest point leaves the plane when the point is within the evolute
+
+    const double denominator0 = (e0 * e0) - (e2 * e2);
+    const double denominator1 = (e1 * e1) - (e2 * e2);
+    const double numerator0 = e0 * y0;
+    const double numerator1 = e1 * y1;
+
+    if ((numerator0 < denominator0) && (numerator1 < denominator1))
+    {
+        const double x0OverE0 = numerator0 / denominator0;
+        const double x1OverE1 = numerator1 / denominator1;
+        const double discriminant = 1.0 - (x0OverE0 * x0OverE0) - (x1OverE1 * x1OverE1);
+
+        if (discriminant > 0.0)
+        {
+            return {e0 * x0OverE0, e1 * x1OverE1, e2 * std::sqrt(discriminant)};
+        }
+    }
+
+    const std::array<double, 2> closestPoint = EllipsoidClosestPointOnEllipse({e0, e1}, {y0, y1});
+
+    return {closestPoint[0], closestPoint[1], 0.0};
+}
+
+// Project a point given in the principal frame: axes are sorted by decreasing semi-axis and the point is reflected
+// into the first octant, which the closest point then shares
+
+Ellipsoid::Projection EllipsoidProjectPrincipalPoint(const Vector3d& aSemiAxes, const Vector3d& aPrincipalPoint)
+{
+    std::array<Index, 3> axisIndices = {0, 1, 2};
+
+    std::sort(
+        axisIndices.begin(),
+        axisIndices.end(),
+        [&aSemiAxes](const Index aFirstIndex, const Index aSecondIndex) -> bool
+        {
+            return aSemiAxes(aFirstIndex) > aSemiAxes(aSecondIndex);
+        }
+    );
+
+    const std::array<double, 3> closestPoint = EllipsoidClosestPointInFirstOctant(
+        {aSemiAxes(axisIndices[0]), aSemiAxes(axisIndices[1]), aSemiAxes(axisIndices[2])},
+        {std::abs(aPrincipalPoint(axisIndices[0])),
+         std::abs(aPrincipalPoint(axisIndices[1])),
+         std::abs(aPrincipalPoint(axisIndices[2]))}
+    );
+
+    Vector3d surfacePoint;
+
+    for (Index sortedIndex = 0; sortedIndex < 3; ++sortedIndex)
+    {
+        const Index axisIndex = axisIndices[sortedIndex];
+
+        surfacePoint(axisIndex) = std::copysign(closestPoint[sortedIndex], aPrincipalPoint(axisIndex));
+    }
+
+    const Vector3d normal = surfacePoint.cwiseQuotient(aSemiAxes.cwiseAbs2()).normalized();
+
+    const double distance = (aPrincipalPoint - surfacePoint).norm();
+    const bool isInside = aPrincipalPoint.cwiseQuotient(aSemiAxes).squaredNorm() < 1.0;
+
+    return {Point::Vector(surfacePoint), normal, isInside ? -distance : distance};
+}
+
 Ellipsoid::Ellipsoid(
     const Point& aCenter,
     const Real& aFirstPrincipalSemiAxis,
@@ -75,7 +345,9 @@ Ellipsoid::Ellipsoid(
       a_(aFirstPrincipalSemiAxis),
       b_(aSecondPrincipalSemiAxis),
       c_(aThirdPrincipalSemiAxis),
-      q_(anOrientation)
+      q_(anOrientation),
+      axes_(Matrix3d::Undefined()),
+      matrix_(Matrix3d::Undefined())
 {
     if (a_.isDefined() && (a_ < 0.0))
     {
@@ -91,6 +363,8 @@ Ellipsoid::Ellipsoid(
     {
         throw ostk::core::error::RuntimeError("Third principal semi-axis is negative.");
     }
+
+    this->updateFrame();
 }
 
 Ellipsoid* Ellipsoid::clone() const
@@ -128,6 +402,20 @@ bool Ellipsoid::isDefined() const
     return center_.isDefined() && a_.isDefined() && b_.isDefined() && c_.isDefined() && q_.isDefined();
 }
 
+BoundingBox Ellipsoid::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ellipsoid");
+    }
+
+    // Half size along each frame axis: norm of the projections of the scaled principal axes onto it
+
+    const Vector3d halfSize = (Vector3d(a_, b_, c_).asDiagonal() * axes_).cwiseAbs2().colwise().sum().cwiseSqrt();
+
+    return {center_ - halfSize, center_ + halfSize};
+}
+
 bool Ellipsoid::intersects(const Point& aPoint) const
 {
     return this->contains(aPoint);
@@ -171,11 +459,7 @@ bool Ellipsoid::intersects(const Line& aLine) const
     // Ellipsoid
 
     const gte::Vector3<double> center = EllipsoidGteVectorFromPoint(center_);
-    const std::array<gte::Vector3<double>, 3> axes = {
-        EllipsoidGteVectorFromVector3d(this->getFirstAxis()),
-        EllipsoidGteVectorFromVector3d(this->getSecondAxis()),
-        EllipsoidGteVectorFromVector3d(this->getThirdAxis())
-    };
+    const std::array<gte::Vector3<double>, 3> axes = EllipsoidGteAxesFromMatrix(axes_);
     const gte::Vector3<double> extent = {a_, b_, c_};
 
     const gte::Ellipsoid3<double> ellipsoid = {center, axes, extent};
@@ -210,11 +494,7 @@ bool Ellipsoid::intersects(const Ray& aRay) const
     // Ellipsoid
 
     const gte::Vector3<double> center = EllipsoidGteVectorFromPoint(center_);
-    const std::array<gte::Vector3<double>, 3> axes = {
-        EllipsoidGteVectorFromVector3d(this->getFirstAxis()),
-        EllipsoidGteVectorFromVector3d(this->getSecondAxis()),
-        EllipsoidGteVectorFromVector3d(this->getThirdAxis())
-    };
+    const std::array<gte::Vector3<double>, 3> axes = EllipsoidGteAxesFromMatrix(axes_);
     const gte::Vector3<double> extent = {a_, b_, c_};
 
     const gte::Ellipsoid3<double> ellipsoid = {center, axes, extent};
@@ -278,7 +558,7 @@ bool Ellipsoid::intersects(const Segment& aSegment) const
     const Vector3d segmentCenter = aSegment.getCenter().asVector();
     const Real segmentHalfLength = aSegment.getLength() / 2.0;
 
-    const Matrix3d M = this->getMatrix();
+    const Matrix3d& M = matrix_;
 
     const Vector3d diff = segmentCenter - center_.asVector();
     const Vector3d matDir = M * segmentDirection;
@@ -365,11 +645,7 @@ bool Ellipsoid::intersects(const Plane& aPlane) const
     // Ellipsoid
 
     const gte::Vector3<double> center = EllipsoidGteVectorFromPoint(center_);
-    const std::array<gte::Vector3<double>, 3> axes = {
-        EllipsoidGteVectorFromVector3d(this->getFirstAxis()),
-        EllipsoidGteVectorFromVector3d(this->getSecondAxis()),
-        EllipsoidGteVectorFromVector3d(this->getThirdAxis())
-    };
+    const std::array<gte::Vector3<double>, 3> axes = EllipsoidGteAxesFromMatrix(axes_);
     const gte::Vector3<double> extent = {a_, b_, c_};
 
     const gte::Ellipsoid3<double> ellipsoid = {center, axes, extent};
@@ -469,13 +745,7 @@ bool Ellipsoid::contains(const Point& aPoint) const
         throw ostk::core::error::runtime::Undefined("Ellipsoid");
     }
 
-    Matrix3d dcm;
-
-    dcm.row(0) = q_ * Vector3d::X();
-    dcm.row(1) = q_ * Vector3d::Y();
-    dcm.row(2) = q_ * Vector3d::Z();
-
-    const Vector3d point = dcm * (aPoint - center_);
+    const Vector3d point = axes_ * (aPoint - center_);
 
     const Real& x = point.x();
     const Real& y = point.y();
@@ -506,6 +776,81 @@ bool Ellipsoid::contains(const Segment& aSegment) const
     return this->contains(aSegment.getFirstPoint()) && this->contains(aSegment.getSecondPoint());
 }
 
+Real Ellipsoid::distanceTo(const Point& aPoint) const
+{
+    return std::abs(std::get<2>(this->projectPoint(aPoint)));
+}
+
+Ellipsoid::Projection Ellipsoid::projectPoint(const Point& aPoint) const
+{
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    MatrixXd pointMatrix(3, 1);
+
+    pointMatrix.col(0) = aPoint.asVector();
+
+    return this->projectPoints(pointMatrix).accessFirst();
+}
+
+Array<Ellipsoid::Projection> Ellipsoid::projectPoints(const MatrixXd& aPointMatrix, const Size& aThreadCount) const
+{
+    if ((aPointMatrix.cols() > 0) && (aPointMatrix.rows() != 3))
+    {
+        throw ostk::core::error::runtime::Wrong("Point matrix");
+    }
+
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ellipsoid");
+    }
+
+    if ((a_ == 0.0) || (b_ == 0.0) || (c_ == 0.0))
+    {
+        throw ostk::core::error::RuntimeError("Cannot project point onto degenerate ellipsoid.");
+    }
+
+    const Matrix3d& dcm = axes_;
+    const Vector3d center = center_.asVector();
+    const Vector3d semiAxes = Vector3d(a_, b_, c_);
+
+    const Size pointCount = aPointMatrix.cols();
+
+    Array<Ellipsoid::Projection> projections(
+        pointCount, {Point::Undefined(), Vector3d::Undefined(), Real::Undefined()}
+    );
+
+    const auto projectRange = [&aPointMatrix, &projections, &dcm, &center, &semiAxes](
+                                  const Index aBeginIndex, const Index anEndIndex
+                              )
+    {
+        for (Index pointIndex = aBeginIndex; pointIndex < anEndIndex; ++pointIndex)
+        {
+            const Ellipsoid::Projection principalProjection =
+                EllipsoidProjectPrincipalPoint(semiAxes, dcm * (aPointMatrix.col(pointIndex) - center));
+
+            projections[pointIndex] = {
+                Point::Vector((dcm.transpose() * std::get<0>(principalProjection).asVector()) + center),
+                dcm.transpose() * std::get<1>(principalProjection),
+                std::get<2>(principalProjection)
+            };
+        }
+    };
+
+    // Threads only read the principal frame, and write disjoint output ranges
+
+    ostk::mathematics::utility::ForEachRange(pointCount, aThreadCount, projectRange);
+
+    return projections;
+}
+
 Point Ellipsoid::getCenter() const
 {
     if (!this->isDefined())
@@ -553,7 +898,7 @@ Vector3d Ellipsoid::getFirstAxis() const
         throw ostk::core::error::runtime::Undefined("Ellipsoid");
     }
 
-    return q_.toConjugate() * Vector3d::X();
+    return axes_.row(0).transpose();
 }
 
 Vector3d Ellipsoid::getSecondAxis() const
@@ -563,7 +908,7 @@ Vector3d Ellipsoid::getSecondAxis() const
         throw ostk::core::error::runtime::Undefined("Ellipsoid");
     }
 
-    return q_.toConjugate() * Vector3d::Y();
+    return axes_.row(1).transpose();
 }
 
 Vector3d Ellipsoid::getThirdAxis() const
@@ -573,7 +918,7 @@ Vector3d Ellipsoid::getThirdAxis() const
         throw ostk::core::error::runtime::Undefined("Ellipsoid");
     }
 
-    return q_.toConjugate() * Vector3d::Z();
+    return axes_.row(2).transpose();
 }
 
 Quaternion Ellipsoid::getOrientation() const
@@ -593,24 +938,7 @@ Matrix3d Ellipsoid::getMatrix() const
         throw ostk::core::error::runtime::Undefined("Ellipsoid");
     }
 
-    const Vector3d firstRatio = this->getFirstAxis() / a_;
-    const Vector3d secondRatio = this->getSecondAxis() / b_;
-    const Vector3d thirdRatio = this->getThirdAxis() / c_;
-
-    auto tensorProduct = [](const Vector3d& aFirstVector, const Vector3d& aSecondVector) -> Matrix3d
-    {
-        Matrix3d tensorProductMatrix;
-
-        tensorProductMatrix << aFirstVector(0) * aSecondVector(0), aFirstVector(0) * aSecondVector(1),
-            aFirstVector(0) * aSecondVector(2), aFirstVector(1) * aSecondVector(0), aFirstVector(1) * aSecondVector(1),
-            aFirstVector(1) * aSecondVector(2), aFirstVector(2) * aSecondVector(0), aFirstVector(2) * aSecondVector(1),
-            aFirstVector(2) * aSecondVector(2);
-
-        return tensorProductMatrix;
-    };
-
-    return tensorProduct(firstRatio, firstRatio) + tensorProduct(secondRatio, secondRatio) +
-           tensorProduct(thirdRatio, thirdRatio);
+    return matrix_;
 }
 
 Intersection Ellipsoid::intersectionWith(const Line& aLine) const
@@ -636,11 +964,7 @@ Intersection Ellipsoid::intersectionWith(const Line& aLine) const
     // Ellipsoid
 
     const gte::Vector3<double> center = EllipsoidGteVectorFromPoint(center_);
-    const std::array<gte::Vector3<double>, 3> axes = {
-        EllipsoidGteVectorFromVector3d(this->getFirstAxis()),
-        EllipsoidGteVectorFromVector3d(this->getSecondAxis()),
-        EllipsoidGteVectorFromVector3d(this->getThirdAxis())
-    };
+    const std::array<gte::Vector3<double>, 3> axes = EllipsoidGteAxesFromMatrix(axes_);
     const gte::Vector3<double> extent = {a_, b_, c_};
 
     const gte::Ellipsoid3<double> ellipsoid = {center, axes, extent};
@@ -696,11 +1020,7 @@ Intersection Ellipsoid::intersectionWith(const Ray& aRay, const bool onlyInSight
     // Ellipsoid
 
     const gte::Vector3<double> center = EllipsoidGteVectorFromPoint(center_);
-    const std::array<gte::Vector3<double>, 3> axes = {
-        EllipsoidGteVectorFromVector3d(this->getFirstAxis()),
-        EllipsoidGteVectorFromVector3d(this->getSecondAxis()),
-        EllipsoidGteVectorFromVector3d(this->getThirdAxis())
-    };
+    const std::array<gte::Vector3<double>, 3> axes = EllipsoidGteAxesFromMatrix(axes_);
     const gte::Vector3<double> extent = {a_, b_, c_};
 
     const gte::Ellipsoid3<double> ellipsoid = {center, axes, extent};
@@ -792,11 +1112,7 @@ Intersection Ellipsoid::intersectionWith(const Segment& aSegment) const
     // Ellipsoid
 
     const gte::Vector3<double> center = EllipsoidGteVectorFromPoint(center_);
-    const std::array<gte::Vector3<double>, 3> axes = {
-        EllipsoidGteVectorFromVector3d(this->getFirstAxis()),
-        EllipsoidGteVectorFromVector3d(this->getSecondAxis()),
-        EllipsoidGteVectorFromVector3d(this->getThirdAxis())
-    };
+    const std::array<gte::Vector3<double>, 3> axes = EllipsoidGteAxesFromMatrix(axes_);
     const gte::Vector3<double> extent = {a_, b_, c_};
 
     const gte::Ellipsoid3<double> ellipsoid = {center, axes, extent};
@@ -945,7 +1261,7 @@ void Ellipsoid::applyTransformation(const Transformation& aTransformation)
     center_.applyTransformation(aTransformation);
 
     const Matrix3d rotationMatrix = aTransformation.getMatrix().block<3, 3>(0, 0).inverse();
-    const Matrix3d transformedMatrix = rotationMatrix.transpose() * this->getMatrix() * rotationMatrix;
+    const Matrix3d transformedMatrix = rotationMatrix.transpose() * matrix_ * rotationMatrix;
 
     Eigen::SelfAdjointEigenSolver<Matrix3d> eigenSolver(transformedMatrix);
 
@@ -963,6 +1279,8 @@ void Ellipsoid::applyTransformation(const Transformation& aTransformation)
     const Vector3d thirdAxis = firstAxis.cross(secondAxis);
 
     q_ = Quaternion::RotationMatrix(RotationMatrix::Columns(firstAxis, secondAxis, thirdAxis)).conjugate();
+
+    this->updateFrame();
 }
 
 Ellipsoid Ellipsoid::Undefined()
@@ -970,6 +1288,28 @@ Ellipsoid Ellipsoid::Undefined()
     return {Point::Undefined(), Real::Undefined(), Real::Undefined(), Real::Undefined(), Quaternion::Undefined()};
 }
 
+void Ellipsoid::updateFrame()
+{
+    axes_ = Matrix3d::Undefined();
+    matrix_ = Matrix3d::Undefined();
+
+    if (!this->isDefined())
+    {
+        return;
+    }
+
+    // Queries work in the principal frame: caching its axes and the quadric matrix spares them the quaternion products
+
+    axes_ = EllipsoidDirectionCosineMatrix(q_);
+
+    const Vector3d firstRatio = axes_.row(0).transpose() / a_;
+    const Vector3d secondRatio = axes_.row(1).transpose() / b_;
+    const Vector3d thirdRatio = axes_.row(2).transpose() / c_;
+
+    matrix_ = (firstRatio * firstRatio.transpose()) + (secondRatio * secondRatio.transpose()) +
+              (thirdRatio * thirdRatio.transpose());
+}
+
 }  // namespace object
 }  // namespace d3
 }  // namespace geometry
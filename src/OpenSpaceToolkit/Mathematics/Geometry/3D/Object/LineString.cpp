@@ -1,11 +1,20 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/LineString.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Segment.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/BoundingVolumeHierarchy.hpp>
 
 namespace ostk
 {
@@ -18,9 +27,244 @@ namespace d3
 namespace object
 {
 
+using ostk::mathematics::utility::SquaredDistanceToBox;
+using ostk::mathematics::utility::VisitLeavesClosestFirst;
+
+BoundingBox LineStringBoundingBoxOf(const Array<Point>& aPointArray)
+{
+    const bool allPointsDefined = std::all_of(
+        aPointArray.begin(),
+        aPointArray.end(),
+        [](const Point& aPoint) -> bool
+        {
+            return aPoint.isDefined();
+        }
+    );
+
+    return allPointsDefined ? BoundingBox::Points(aPointArray) : BoundingBox::Undefined();
+}
+
+// Maximum number of segments per index leaf
+
+static constexpr Size LineStringLeafSize = 8;
+
+// Upper bound on the index depth (ranges are halved at each level), plus room for siblings
+
+static constexpr Size LineStringStackSize = 128;
+
+// Parameter in [0, 1] of the point of segment [aFirstPoint, aSecondPoint] closest to a point
+
+double LineStringSegmentParameter(const Vector3d& aFirstPoint, const Vector3d& aSecondPoint, const Vector3d& aPoint)
+{
+    const Vector3d direction = aSecondPoint - aFirstPoint;
+    const double squaredLength = direction.squaredNorm();
+
+    if (squaredLength == 0.0)
+    {
+        return 0.0;
+    }
+
+    return std::max(0.0, std::min(1.0, (aPoint - aFirstPoint).dot(direction) / squaredLength));
+}
+
+// Distance from a point to segment [aFirstPoint, aSecondPoint]
+
+double LineStringSegmentDistance(const Vector3d& aFirstPoint, const Vector3d& aSecondPoint, const Vector3d& aPoint)
+{
+    const double parameter = LineStringSegmentParameter(aFirstPoint, aSecondPoint, aPoint);
+
+    return (aFirstPoint + parameter * (aSecondPoint - aFirstPoint) - aPoint).norm();
+}
+
+// Points of a line string, without repeated consecutive points
+
+std::vector<Vector3d> LineStringDistinctPointsOf(const Array<Point>& aPointArray)
+{
+    std::vector<Vector3d> points;
+
+    points.reserve(aPointArray.getSize());
+
+    for (const Point& point : aPointArray)
+    {
+        if (points.empty() || (point.asVector() != points.back()))
+        {
+            points.push_back(point.asVector());
+        }
+    }
+
+    return points;
+}
+
+// Points kept by Douglas-Peucker simplification, flagged by index. End points are always kept.
+
+std::vector<char> LineStringDouglasPeuckerFlags(const std::vector<Vector3d>& aPointArray, const double aTolerance)
+{
+    std::vector<char> keptFlags(aPointArray.size(), 0);
+
+    keptFlags.front() = 1;
+    keptFlags.back() = 1;
+
+    // Point farthest from the shortcut between two point indices, along with its distance
+
+    const auto farthestPoint = [&aPointArray](const Index aFirstIndex, const Index aLastIndex) -> Pair<Index, double>
+    {
+        Pair<Index, double> farthestPoint = {aFirstIndex + 1, -1.0};
+
+        for (Index pointIndex = aFirstIndex + 1; pointIndex < aLastIndex; ++pointIndex)
+        {
+            const double distance =
+                LineStringSegmentDistance(aPointArray[aFirstIndex], aPointArray[aLastIndex], aPointArray[pointIndex]);
+
+            if (distance > farthestPoint.second)
+            {
+                farthestPoint = {pointIndex, distance};
+            }
+        }
+
+        return farthestPoint;
+    };
+
+    std::vector<Pair<Index, Index>> stack = {{0, aPointArray.size() - 1}};
+
+    // Closed line strings are first split at their farthest point
+
+    if ((aPointArray.size() > 2) && (aPointArray.front() == aPointArray.back()))
+    {
+        const Index middleIndex = farthestPoint(0, aPointArray.size() - 1).first;
+
+        keptFlags[middleIndex] = 1;
+
+        stack = {{middleIndex, aPointArray.size() - 1}, {0, middleIndex}};
+    }
+
+    while (!stack.empty())
+    {
+        const auto [firstIndex, lastIndex] = stack.back();
+
+        stack.pop_back();
+
+        if ((lastIndex - firstIndex) < 2)
+        {
+            continue;
+        }
+
+        const auto [middleIndex, distance] = farthestPoint(firstIndex, lastIndex);
+
+        if (distance > aTolerance)
+        {
+            keptFlags[middleIndex] = 1;
+
+            stack.push_back({middleIndex, lastIndex});
+            stack.push_back({firstIndex, middleIndex});
+        }
+    }
+
+    return keptFlags;
+}
+
+// Points kept by Visvalingam-Whyatt simplification, flagged by index. End points are always kept.
+
+std::vector<char> LineStringVisvalingamWhyattFlags(const std::vector<Vector3d>& aPointArray, const Size aPointCount)
+{
+    typedef Pair<double, Index> HeapEntry;  // Effective area, point index
+
+    const Size pointCount = aPointArray.size();
+
+    std::vector<char> keptFlags(pointCount, 1);
+    std::vector<Index> previousIndices(pointCount);
+    std::vector<Index> nextIndices(pointCount);
+    std::vector<double> areas(pointCount, std::numeric_limits<double>::infinity());
+
+    const auto areaAt = [&aPointArray, &previousIndices, &nextIndices](const Index aPointIndex) -> double
+    {
+        return 0.5 * (aPointArray[aPointIndex] - aPointArray[previousIndices[aPointIndex]])
+                         .cross(aPointArray[nextIndices[aPointIndex]] - aPointArray[previousIndices[aPointIndex]])
+                         .norm();
+    };
+
+    std::vector<HeapEntry> heapEntries;
+
+    heapEntries.reserve(pointCount);
+
+    for (Index pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+    {
+        previousIndices[pointIndex] = pointIndex - 1;
+        nextIndices[pointIndex] = pointIndex + 1;
+
+        if ((pointIndex > 0) && ((pointIndex + 1) < pointCount))
+        {
+            areas[pointIndex] = areaAt(pointIndex);
+            heapEntries.push_back({areas[pointIndex], pointIndex});
+        }
+    }
+
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap(
+        std::greater<HeapEntry>(), std::move(heapEntries)
+    );
+
+    Size keptPointCount = pointCount;
+
+    while ((keptPointCount > aPointCount) && (!heap.empty()))
+    {
+        const auto [area, pointIndex] = heap.top();
+
+        heap.pop();
+
+        // Heap entries are outdated once the effective area of their point changed
+
+        if ((!keptFlags[pointIndex]) || (area != areas[pointIndex]))
+        {
+            continue;
+        }
+
+        const Index previousIndex = previousIndices[pointIndex];
+        const Index nextIndex = nextIndices[pointIndex];
+
+        keptFlags[pointIndex] = 0;
+        nextIndices[previousIndex] = nextIndex;
+        previousIndices[nextIndex] = previousIndex;
+
+        keptPointCount -= 1;
+
+        // Effective areas never decrease, so that points are removed in order of significance
+
+        for (const Index neighborIndex : {previousIndex, nextIndex})
+        {
+            if ((neighborIndex > 0) && ((neighborIndex + 1) < pointCount))
+            {
+                areas[neighborIndex] = std::max(area, areaAt(neighborIndex));
+                heap.push({areas[neighborIndex], neighborIndex});
+            }
+        }
+    }
+
+    return keptFlags;
+}
+
+// Points of a line string flagged as kept
+
+Array<Point> LineStringKeptPointsOf(const std::vector<Vector3d>& aPointArray, const std::vector<char>& aKeptFlagArray)
+{
+    Array<Point> points = Array<Point>::Empty();
+
+    for (Index pointIndex = 0; pointIndex < aPointArray.size(); ++pointIndex)
+    {
+        if (aKeptFlagArray[pointIndex])
+        {
+            points.add(Point::Vector(aPointArray[pointIndex]));
+        }
+    }
+
+    return points;
+}
+
 LineString::LineString(const Array<Point>& aPointArray)
     : Object(),
-      points_(aPointArray)
+      points_(aPointArray),
+      boundingBox_(LineStringBoundingBoxOf(points_)),
+      indexed_(false),
+      indexNodes_(Array<LineString::IndexNode>::Empty()),
+      indexArcLengths_(Array<double>::Empty())
 {
 }
 
@@ -44,11 +288,26 @@ bool LineString::isDefined() const
     return !points_.isEmpty();
 }
 
+BoundingBox LineString::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    return boundingBox_;
+}
+
 bool LineString::isEmpty() const
 {
     return points_.isEmpty();
 }
 
+bool LineString::isIndexed() const
+{
+    return indexed_;
+}
+
 bool LineString::isNear(const LineString& aLineString, const Real& aTolerance) const
 {
     if ((this->isEmpty()) || (aLineString.isEmpty()))
@@ -99,6 +358,44 @@ Point LineString::getPointClosestTo(const Point& aPoint) const
         throw ostk::core::error::runtime::Undefined("Line string");
     }
 
+    if (indexed_)
+    {
+        const Vector3d point = aPoint.asVector();
+
+        Index closestPointIndex = 0;
+        double minSquaredDistance = std::numeric_limits<double>::infinity();
+
+        // A leaf spanning segments [begin, end) also bounds vertices begin to end
+
+        VisitLeavesClosestFirst<LineStringStackSize>(
+            indexNodes_,
+            [&point](const LineString::IndexNode& aNode) -> double
+            {
+                return SquaredDistanceToBox(point, aNode.lowerBound, aNode.upperBound);
+            },
+            minSquaredDistance,
+            [this, &point, &closestPointIndex, &minSquaredDistance](const Index aBeginIndex, const Index anEndIndex
+            ) -> bool
+            {
+                for (Index pointIndex = aBeginIndex; pointIndex <= anEndIndex; ++pointIndex)
+                {
+                    const double squaredDistance = (points_[pointIndex].asVector() - point).squaredNorm();
+
+                    if ((squaredDistance < minSquaredDistance) ||
+                        ((squaredDistance == minSquaredDistance) && (pointIndex < closestPointIndex)))
+                    {
+                        closestPointIndex = pointIndex;
+                        minSquaredDistance = squaredDistance;
+                    }
+                }
+
+                return true;
+            }
+        );
+
+        return points_[closestPointIndex];
+    }
+
     Point const* pointPtr = nullptr;
     Real minDistance = Real::Undefined();
 
@@ -117,6 +414,167 @@ Point LineString::getPointClosestTo(const Point& aPoint) const
     return *pointPtr;
 }
 
+Real LineString::getLength() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    if (indexed_)
+    {
+        return indexArcLengths_.accessLast();
+    }
+
+    double length = 0.0;
+
+    for (Index pointIndex = 1; pointIndex < points_.getSize(); ++pointIndex)
+    {
+        length += (points_[pointIndex].asVector() - points_[pointIndex - 1].asVector()).norm();
+    }
+
+    return length;
+}
+
+Real LineString::distanceTo(const Point& aPoint) const
+{
+    return aPoint.distanceTo(this->projectPoint(aPoint).first);
+}
+
+LineString::Projection LineString::projectPoint(const Point& aPoint) const
+{
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    if (this->isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    if (points_.getSize() == 1)
+    {
+        return {points_.accessFirst(), 0.0};
+    }
+
+    const Vector3d point = aPoint.asVector();
+
+    Index closestSegmentIndex = 0;
+    double closestParameter = 0.0;
+    double minSquaredDistance = std::numeric_limits<double>::infinity();
+
+    const auto visitSegment = [this, &point, &closestSegmentIndex, &closestParameter, &minSquaredDistance](
+                                  const Index aSegmentIndex
+                              )
+    {
+        const Vector3d firstPoint = points_[aSegmentIndex].asVector();
+        const Vector3d secondPoint = points_[aSegmentIndex + 1].asVector();
+
+        const double parameter = LineStringSegmentParameter(firstPoint, secondPoint, point);
+        const double squaredDistance = (firstPoint + parameter * (secondPoint - firstPoint) - point).squaredNorm();
+
+        if ((squaredDistance < minSquaredDistance) ||
+            ((squaredDistance == minSquaredDistance) && (aSegmentIndex < closestSegmentIndex)))
+        {
+            closestSegmentIndex = aSegmentIndex;
+            closestParameter = parameter;
+            minSquaredDistance = squaredDistance;
+        }
+    };
+
+    if (indexed_)
+    {
+        VisitLeavesClosestFirst<LineStringStackSize>(
+            indexNodes_,
+            [&point](const LineString::IndexNode& aNode) -> double
+            {
+                return SquaredDistanceToBox(point, aNode.lowerBound, aNode.upperBound);
+            },
+            minSquaredDistance,
+            [&visitSegment](const Index aBeginIndex, const Index anEndIndex) -> bool
+            {
+                for (Index segmentIndex = aBeginIndex; segmentIndex < anEndIndex; ++segmentIndex)
+                {
+                    visitSegment(segmentIndex);
+                }
+
+                return true;
+            }
+        );
+    }
+    else
+    {
+        for (Index segmentIndex = 0; segmentIndex < (points_.getSize() - 1); ++segmentIndex)
+        {
+            visitSegment(segmentIndex);
+        }
+    }
+
+    const Vector3d firstPoint = points_[closestSegmentIndex].asVector();
+    const Vector3d secondPoint = points_[closestSegmentIndex + 1].asVector();
+
+    // Same summation order as the index, so that both paths return identical arc lengths
+
+    double arcLength = 0.0;
+
+    if (indexed_)
+    {
+        arcLength = indexArcLengths_[closestSegmentIndex];
+    }
+    else
+    {
+        for (Index pointIndex = 1; pointIndex <= closestSegmentIndex; ++pointIndex)
+        {
+            arcLength += (points_[pointIndex].asVector() - points_[pointIndex - 1].asVector()).norm();
+        }
+    }
+
+    return {
+        Point::Vector(firstPoint + closestParameter * (secondPoint - firstPoint)),
+        arcLength + closestParameter * (secondPoint - firstPoint).norm()
+    };
+}
+
+LineString LineString::simplify(const Real& aTolerance) const
+{
+    if (!aTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tolerance");
+    }
+
+    if (aTolerance < 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    const std::vector<Vector3d> points = LineStringDistinctPointsOf(points_);
+
+    return {LineStringKeptPointsOf(points, LineStringDouglasPeuckerFlags(points, aTolerance))};
+}
+
+LineString LineString::simplifyTo(const Size& aPointCount) const
+{
+    if (aPointCount < 2)
+    {
+        throw ostk::core::error::runtime::Wrong("Point count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    const std::vector<Vector3d> points = LineStringDistinctPointsOf(points_);
+
+    return {LineStringKeptPointsOf(points, LineStringVisvalingamWhyattFlags(points, aPointCount))};
+}
+
 void LineString::print(std::ostream& anOutputStream, bool displayDecorators) const
 {
     displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Line String") : void();
@@ -151,10 +609,105 @@ void LineString::applyTransformation(const Transformation& aTransformation)
         throw ostk::core::error::runtime::Undefined("Line string");
     }
 
-    for (auto& point : points_)
+    if (!boundingBox_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    MatrixXd pointMatrix(3, points_.getSize());
+
+    for (Index pointIndex = 0; pointIndex < points_.getSize(); ++pointIndex)
+    {
+        pointMatrix.col(pointIndex) = points_[pointIndex].asVector();
+    }
+
+    aTransformation.applyToPoints(pointMatrix);
+
+    for (Index pointIndex = 0; pointIndex < points_.getSize(); ++pointIndex)
+    {
+        points_[pointIndex] = Point::Vector(pointMatrix.col(pointIndex));
+    }
+
+    boundingBox_ = LineStringBoundingBoxOf(points_);
+
+    if (indexed_)
+    {
+        this->buildIndex();
+    }
+}
+
+void LineString::buildIndex()
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string");
+    }
+
+    if (!boundingBox_.isDefined())
     {
-        point.applyTransformation(aTransformation);
+        throw ostk::core::error::runtime::Undefined("Point");
     }
+
+    const Size segmentCount = points_.getSize() - 1;
+
+    indexNodes_.clear();
+    indexNodes_.reserve((2 * segmentCount) / LineStringLeafSize + 1);
+
+    indexArcLengths_ = Array<double>(points_.getSize(), 0.0);
+
+    for (Index pointIndex = 1; pointIndex < points_.getSize(); ++pointIndex)
+    {
+        indexArcLengths_[pointIndex] = indexArcLengths_[pointIndex - 1] +
+                                       (points_[pointIndex].asVector() - points_[pointIndex - 1].asVector()).norm();
+    }
+
+    // Consecutive segments are spatially coherent, so halving index ranges yields tight boxes without reordering.
+    // Nodes are stored in depth-first order: the first child of a branch immediately follows it.
+
+    const auto buildNode = [this](const auto& aBuildNode, const Index aBeginIndex, const Index anEndIndex) -> void
+    {
+        const Index nodeIndex = indexNodes_.getSize();
+
+        indexNodes_.add({points_[aBeginIndex].asVector(), points_[aBeginIndex].asVector(), aBeginIndex, 0});
+
+        const Size segmentCount = anEndIndex - aBeginIndex;
+
+        if (segmentCount <= LineStringLeafSize)
+        {
+            LineString::IndexNode& node = indexNodes_[nodeIndex];
+
+            for (Index pointIndex = aBeginIndex + 1; pointIndex <= anEndIndex; ++pointIndex)
+            {
+                node.lowerBound = node.lowerBound.cwiseMin(points_[pointIndex].asVector());
+                node.upperBound = node.upperBound.cwiseMax(points_[pointIndex].asVector());
+            }
+
+            node.count = segmentCount;
+
+            return;
+        }
+
+        const Index middleIndex = aBeginIndex + (segmentCount / 2);
+
+        aBuildNode(aBuildNode, aBeginIndex, middleIndex);
+
+        const Index secondChildIndex = indexNodes_.getSize();
+
+        aBuildNode(aBuildNode, middleIndex, anEndIndex);
+
+        LineString::IndexNode& node = indexNodes_[nodeIndex];
+
+        node.lowerBound = indexNodes_[nodeIndex + 1].lowerBound.cwiseMin(indexNodes_[secondChildIndex].lowerBound);
+        node.upperBound = indexNodes_[nodeIndex + 1].upperBound.cwiseMax(indexNodes_[secondChildIndex].upperBound);
+        node.offset = secondChildIndex;
+    };
+
+    if (segmentCount > 0)
+    {
+        buildNode(buildNode, 0, segmentCount);
+    }
+
+    indexed_ = true;
 }
 
 LineString LineString::Empty()
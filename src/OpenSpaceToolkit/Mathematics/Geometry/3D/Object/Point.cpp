@@ -3,6 +3,7 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 
@@ -95,6 +96,16 @@ bool Point::isDefined() const
     return x_.isDefined() && y_.isDefined() && z_.isDefined();
 }
 
+BoundingBox Point::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    return {*this, *this};
+}
+
 bool Point::isNear(const Point& aPoint, const Real& aTolerance) const
 {
     if (!aTolerance.isDefined())
@@ -0,0 +1,671 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/PointCloud.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/BoundingVolumeHierarchy.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/Parallel.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+namespace d3
+{
+namespace object
+{
+
+using ostk::core::container::Pair;
+
+using ostk::mathematics::utility::ForEachRange;
+using ostk::mathematics::utility::SquaredDistanceToBox;
+using ostk::mathematics::utility::VisitLeavesClosestFirst;
+
+// Maximum number of points per KD-tree leaf
+
+static constexpr Size PointCloudLeafSize = 16;
+
+// Upper bound on the KD-tree depth (median splits halve the point count at each level), plus room for siblings
+
+static constexpr Size PointCloudStackSize = 128;
+
+PointCloud::PointCloud(const Array<Point>& aPointArray)
+    : Object(),
+      points_(),
+      indices_(Array<Index>::Empty()),
+      positions_(Array<Index>::Empty()),
+      nodes_(Array<PointCloud::Node>::Empty())
+{
+    MatrixXd pointMatrix(aPointArray.getSize(), 3);
+
+    for (Index pointIndex = 0; pointIndex < aPointArray.getSize(); ++pointIndex)
+    {
+        if (!aPointArray[pointIndex].isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Point");
+        }
+
+        pointMatrix.row(pointIndex) = aPointArray[pointIndex].asVector().transpose();
+    }
+
+    this->build(pointMatrix);
+}
+
+PointCloud* PointCloud::clone() const
+{
+    return new PointCloud(*this);
+}
+
+bool PointCloud::operator==(const PointCloud& aPointCloud) const
+{
+    if ((!this->isDefined()) || (!aPointCloud.isDefined()))
+    {
+        return false;
+    }
+
+    return (this->getSize() == aPointCloud.getSize()) && (this->getPoints() == aPointCloud.getPoints());
+}
+
+bool PointCloud::operator!=(const PointCloud& aPointCloud) const
+{
+    return !((*this) == aPointCloud);
+}
+
+bool PointCloud::isDefined() const
+{
+    return !this->isEmpty();
+}
+
+BoundingBox PointCloud::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point cloud");
+    }
+
+    // The root node spans every point
+
+    return {Point::Vector(nodes_.accessFirst().lowerBound), Point::Vector(nodes_.accessFirst().upperBound)};
+}
+
+bool PointCloud::isEmpty() const
+{
+    return points_.rows() == 0;
+}
+
+Size PointCloud::getSize() const
+{
+    return points_.rows();
+}
+
+Point PointCloud::getPointAt(const Index& anIndex) const
+{
+    if (anIndex >= this->getSize())
+    {
+        throw ostk::core::error::RuntimeError("Point index [{}] out of bounds [0 - {}].", anIndex, this->getSize());
+    }
+
+    const Index position = positions_[anIndex];
+
+    return {points_(position, 0), points_(position, 1), points_(position, 2)};
+}
+
+MatrixXd PointCloud::getPoints() const
+{
+    MatrixXd pointMatrix(this->getSize(), 3);
+
+    for (Index position = 0; position < this->getSize(); ++position)
+    {
+        pointMatrix.row(indices_[position]) = points_.row(position);
+    }
+
+    return pointMatrix;
+}
+
+Real PointCloud::distanceTo(const Point& aPoint) const
+{
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point cloud");
+    }
+
+    Index position = 0;
+    double squaredDistance = 0.0;
+
+    this->searchNearest(aPoint.asVector(), position, squaredDistance);
+
+    return std::sqrt(squaredDistance);
+}
+
+Point PointCloud::getPointClosestTo(const Point& aPoint) const
+{
+    return this->getPointAt(this->findNearestNeighbor(aPoint));
+}
+
+Index PointCloud::findNearestNeighbor(const Point& aPoint) const
+{
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point cloud");
+    }
+
+    Index position = 0;
+    double squaredDistance = 0.0;
+
+    this->searchNearest(aPoint.asVector(), position, squaredDistance);
+
+    return indices_[position];
+}
+
+Array<Index> PointCloud::findNearestNeighbor(const MatrixXd& aPointMatrix, const Size& aThreadCount) const
+{
+    if ((aPointMatrix.rows() > 0) && (aPointMatrix.cols() != 3))
+    {
+        throw ostk::core::error::runtime::Wrong("Point matrix");
+    }
+
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point cloud");
+    }
+
+    Array<Index> indices(aPointMatrix.rows(), 0);
+
+    ForEachRange(
+        aPointMatrix.rows(),
+        aThreadCount,
+        [this, &aPointMatrix, &indices](const Index aBeginIndex, const Index anEndIndex)
+        {
+            for (Index rowIndex = aBeginIndex; rowIndex < anEndIndex; ++rowIndex)
+            {
+                Index position = 0;
+                double squaredDistance = 0.0;
+
+                this->searchNearest(aPointMatrix.row(rowIndex).transpose(), position, squaredDistance);
+
+                indices[rowIndex] = indices_[position];
+            }
+        }
+    );
+
+    return indices;
+}
+
+Array<Index> PointCloud::findNearestNeighbors(const Point& aPoint, const Size& aNeighborCount) const
+{
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point cloud");
+    }
+
+    Array<Index> indices = Array<Index>::Empty();
+
+    this->searchNearest(aPoint.asVector(), aNeighborCount, indices);
+
+    return indices;
+}
+
+Array<Array<Index>> PointCloud::findNearestNeighbors(
+    const MatrixXd& aPointMatrix, const Size& aNeighborCount, const Size& aThreadCount
+) const
+{
+    if ((aPointMatrix.rows() > 0) && (aPointMatrix.cols() != 3))
+    {
+        throw ostk::core::error::runtime::Wrong("Point matrix");
+    }
+
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point cloud");
+    }
+
+    Array<Array<Index>> indices(aPointMatrix.rows(), Array<Index>::Empty());
+
+    ForEachRange(
+        aPointMatrix.rows(),
+        aThreadCount,
+        [this, &aPointMatrix, &aNeighborCount, &indices](const Index aBeginIndex, const Index anEndIndex)
+        {
+            for (Index rowIndex = aBeginIndex; rowIndex < anEndIndex; ++rowIndex)
+            {
+                this->searchNearest(aPointMatrix.row(rowIndex).transpose(), aNeighborCount, indices[rowIndex]);
+            }
+        }
+    );
+
+    return indices;
+}
+
+Array<Index> PointCloud::findNeighborsWithinRadius(const Point& aPoint, const Real& aRadius) const
+{
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    if (!aRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Radius");
+    }
+
+    if (aRadius < 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Radius");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point cloud");
+    }
+
+    Array<Index> indices = Array<Index>::Empty();
+
+    this->searchWithinRadius(aPoint.asVector(), aRadius * aRadius, indices);
+
+    return indices;
+}
+
+Array<Array<Index>> PointCloud::findNeighborsWithinRadius(
+    const MatrixXd& aPointMatrix, const Real& aRadius, const Size& aThreadCount
+) const
+{
+    if ((aPointMatrix.rows() > 0) && (aPointMatrix.cols() != 3))
+    {
+        throw ostk::core::error::runtime::Wrong("Point matrix");
+    }
+
+    if (!aRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Radius");
+    }
+
+    if (aRadius < 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Radius");
+    }
+
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point cloud");
+    }
+
+    const double squaredRadius = aRadius * aRadius;
+
+    Array<Array<Index>> indices(aPointMatrix.rows(), Array<Index>::Empty());
+
+    ForEachRange(
+        aPointMatrix.rows(),
+        aThreadCount,
+        [this, &aPointMatrix, squaredRadius, &indices](const Index aBeginIndex, const Index anEndIndex)
+        {
+            for (Index rowIndex = aBeginIndex; rowIndex < anEndIndex; ++rowIndex)
+            {
+                this->searchWithinRadius(aPointMatrix.row(rowIndex).transpose(), squaredRadius, indices[rowIndex]);
+            }
+        }
+    );
+
+    return indices;
+}
+
+void PointCloud::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Point Cloud") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Size:" << this->getSize();
+
+    for (Index pointIndex = 0; pointIndex < this->getSize(); ++pointIndex)
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << this->getPointAt(pointIndex).toString();
+    }
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+void PointCloud::applyTransformation(const Transformation& aTransformation)
+{
+    if (!aTransformation.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Transformation");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point cloud");
+    }
+
+    MatrixXd pointMatrix = this->getPoints().transpose();
+
+    aTransformation.applyToPoints(pointMatrix);
+
+    this->build(pointMatrix.transpose());
+}
+
+PointCloud PointCloud::Empty()
+{
+    return {Array<Point>::Empty()};
+}
+
+PointCloud PointCloud::Matrix(const MatrixXd& aPointMatrix)
+{
+    if ((aPointMatrix.rows() > 0) && (aPointMatrix.cols() != 3))
+    {
+        throw ostk::core::error::runtime::Wrong("Point matrix");
+    }
+
+    if (!aPointMatrix.allFinite())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    PointCloud pointCloud = PointCloud::Empty();
+
+    pointCloud.build(aPointMatrix);
+
+    return pointCloud;
+}
+
+void PointCloud::build(const MatrixXd& aPointMatrix)
+{
+    const Size pointCount = aPointMatrix.rows();
+
+    indices_ = Array<Index>(pointCount, 0);
+    positions_ = Array<Index>(pointCount, 0);
+    nodes_ = Array<PointCloud::Node>::Empty();
+
+    for (Index pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+    {
+        indices_[pointIndex] = pointIndex;
+    }
+
+    nodes_.reserve((2 * pointCount) / PointCloudLeafSize + 1);
+
+    // Top-down median splits along the axis of largest extent, in depth-first order: the first child of a branch
+    // immediately follows it
+
+    const auto buildNode =
+        [this, &aPointMatrix](const auto& aBuildNode, const Index aBeginIndex, const Index anEndIndex) -> void
+    {
+        const Index nodeIndex = nodes_.getSize();
+
+        PointCloud::Node node = {
+            aPointMatrix.row(indices_[aBeginIndex]).transpose(),
+            aPointMatrix.row(indices_[aBeginIndex]).transpose(),
+            aBeginIndex,
+            anEndIndex - aBeginIndex
+        };
+
+        for (Index position = aBeginIndex + 1; position < anEndIndex; ++position)
+        {
+            const Vector3d point = aPointMatrix.row(indices_[position]).transpose();
+
+            node.lowerBound = node.lowerBound.cwiseMin(point);
+            node.upperBound = node.upperBound.cwiseMax(point);
+        }
+
+        nodes_.add(node);
+
+        Index axis = 0;
+        const double extent = (node.upperBound - node.lowerBound).maxCoeff(&axis);
+
+        if ((node.count <= PointCloudLeafSize) || (extent == 0.0))
+        {
+            return;
+        }
+
+        const Index middleIndex = aBeginIndex + (node.count / 2);
+
+        std::nth_element(
+            indices_.begin() + aBeginIndex,
+            indices_.begin() + middleIndex,
+            indices_.begin() + anEndIndex,
+            [&aPointMatrix, axis](const Index aFirstIndex, const Index aSecondIndex) -> bool
+            {
+                return aPointMatrix(aFirstIndex, axis) < aPointMatrix(aSecondIndex, axis);
+            }
+        );
+
+        aBuildNode(aBuildNode, aBeginIndex, middleIndex);
+
+        nodes_[nodeIndex].offset = nodes_.getSize();
+        nodes_[nodeIndex].count = 0;
+
+        aBuildNode(aBuildNode, middleIndex, anEndIndex);
+    };
+
+    if (pointCount > 0)
+    {
+        buildNode(buildNode, 0, pointCount);
+    }
+
+    // Store coordinates in tree order, so that leaf scans read contiguous memory
+
+    points_.resize(pointCount, 3);
+
+    for (Index position = 0; position < pointCount; ++position)
+    {
+        points_.row(position) = aPointMatrix.row(indices_[position]);
+        positions_[indices_[position]] = position;
+    }
+}
+
+void PointCloud::searchNearest(const Vector3d& aPoint, Index& aPosition, double& aSquaredDistance) const
+{
+    const double* xs = points_.col(0).data();
+    const double* ys = points_.col(1).data();
+    const double* zs = points_.col(2).data();
+
+    const double x = aPoint.x();
+    const double y = aPoint.y();
+    const double z = aPoint.z();
+
+    aPosition = 0;
+    aSquaredDistance = std::numeric_limits<double>::infinity();
+
+    VisitLeavesClosestFirst<PointCloudStackSize>(
+        nodes_,
+        [&aPoint](const PointCloud::Node& aNode) -> double
+        {
+            return SquaredDistanceToBox(aPoint, aNode.lowerBound, aNode.upperBound);
+        },
+        aSquaredDistance,
+        [this, xs, ys, zs, x, y, z, &aPosition, &aSquaredDistance](const Index aBeginIndex, const Index anEndIndex
+        ) -> bool
+        {
+            for (Index position = aBeginIndex; position < anEndIndex; ++position)
+            {
+                const double dx = xs[position] - x;
+                const double dy = ys[position] - y;
+                const double dz = zs[position] - z;
+                const double squaredDistance = (dx * dx) + (dy * dy) + (dz * dz);
+
+                // Ties are broken by lowest index
+
+                if ((squaredDistance < aSquaredDistance) ||
+                    ((squaredDistance == aSquaredDistance) && (indices_[position] < indices_[aPosition])))
+                {
+                    aPosition = position;
+                    aSquaredDistance = squaredDistance;
+                }
+            }
+
+            return true;
+        }
+    );
+}
+
+void PointCloud::searchNearest(const Vector3d& aPoint, const Size& aNeighborCount, Array<Index>& anIndexArray) const
+{
+    const double* xs = points_.col(0).data();
+    const double* ys = points_.col(1).data();
+    const double* zs = points_.col(2).data();
+
+    const double x = aPoint.x();
+    const double y = aPoint.y();
+    const double z = aPoint.z();
+
+    const Size neighborCount = std::min(aNeighborCount, this->getSize());
+
+    anIndexArray.clear();
+
+    if (neighborCount == 0)
+    {
+        return;
+    }
+
+    // Max-heap of the best candidates found so far, ordered by (squared distance, index)
+
+    Array<Pair<double, Index>> heap = Array<Pair<double, Index>>::Empty();
+
+    heap.reserve(neighborCount);
+
+    // Nodes farther than the worst candidate are pruned once the heap is full
+
+    double squaredBound = std::numeric_limits<double>::infinity();
+
+    VisitLeavesClosestFirst<PointCloudStackSize>(
+        nodes_,
+        [&aPoint](const PointCloud::Node& aNode) -> double
+        {
+            return SquaredDistanceToBox(aPoint, aNode.lowerBound, aNode.upperBound);
+        },
+        squaredBound,
+        [this, xs, ys, zs, x, y, z, neighborCount, &heap, &squaredBound](
+            const Index aBeginIndex, const Index anEndIndex
+        ) -> bool
+        {
+            for (Index position = aBeginIndex; position < anEndIndex; ++position)
+            {
+                const double dx = xs[position] - x;
+                const double dy = ys[position] - y;
+                const double dz = zs[position] - z;
+                const Pair<double, Index> candidate = {(dx * dx) + (dy * dy) + (dz * dz), indices_[position]};
+
+                if (heap.getSize() < neighborCount)
+                {
+                    heap.add(candidate);
+                    std::push_heap(heap.begin(), heap.end());
+                }
+                else if (candidate < heap.accessFirst())
+                {
+                    std::pop_heap(heap.begin(), heap.end());
+                    heap.back() = candidate;
+                    std::push_heap(heap.begin(), heap.end());
+                }
+            }
+
+            if (heap.getSize() == neighborCount)
+            {
+                squaredBound = heap.accessFirst().first;
+            }
+
+            return true;
+        }
+    );
+
+    std::sort_heap(heap.begin(), heap.end());
+
+    anIndexArray.reserve(heap.getSize());
+
+    for (const auto& candidate : heap)
+    {
+        anIndexArray.add(candidate.second);
+    }
+}
+
+void PointCloud::searchWithinRadius(
+    const Vector3d& aPoint, const double aSquaredRadius, Array<Index>& anIndexArray
+) const
+{
+    const double* xs = points_.col(0).data();
+    const double* ys = points_.col(1).data();
+    const double* zs = points_.col(2).data();
+
+    const double x = aPoint.x();
+    const double y = aPoint.y();
+    const double z = aPoint.z();
+
+    Array<Pair<double, Index>> candidates = Array<Pair<double, Index>>::Empty();
+
+    VisitLeavesClosestFirst<PointCloudStackSize>(
+        nodes_,
+        [&aPoint](const PointCloud::Node& aNode) -> double
+        {
+            return SquaredDistanceToBox(aPoint, aNode.lowerBound, aNode.upperBound);
+        },
+        aSquaredRadius,
+        [this, xs, ys, zs, x, y, z, aSquaredRadius, &candidates](const Index aBeginIndex, const Index anEndIndex
+        ) -> bool
+        {
+            for (Index position = aBeginIndex; position < anEndIndex; ++position)
+            {
+                const double dx = xs[position] - x;
+                const double dy = ys[position] - y;
+                const double dz = zs[position] - z;
+                const double squaredDistance = (dx * dx) + (dy * dy) + (dz * dz);
+
+                if (squaredDistance <= aSquaredRadius)
+                {
+                    candidates.add({squaredDistance, indices_[position]});
+                }
+            }
+
+            return true;
+        }
+    );
+
+    std::sort(candidates.begin(), candidates.end());
+
+    anIndexArray.clear();
+    anIndexArray.reserve(candidates.getSize());
+
+    for (const auto& candidate : candidates)
+    {
+        anIndexArray.add(candidate.second);
+    }
+}
+
+}  // namespace object
+}  // namespace d3
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
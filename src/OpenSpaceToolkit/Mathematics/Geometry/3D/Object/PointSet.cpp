@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <algorithm>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
@@ -18,9 +20,26 @@ namespace d3
 namespace object
 {
 
+BoundingBox PointSetBoundingBoxOf(const PointSet::Container& aPointContainer)
+{
+    const Array<Point> points(aPointContainer.begin(), aPointContainer.end());
+
+    const bool allPointsDefined = std::all_of(
+        points.begin(),
+        points.end(),
+        [](const Point& aPoint) -> bool
+        {
+            return aPoint.isDefined();
+        }
+    );
+
+    return allPointsDefined ? BoundingBox::Points(points) : BoundingBox::Undefined();
+}
+
 PointSet::PointSet(const Array<Point>& aPointArray)
     : Object(),
-      points_(aPointArray.begin(), aPointArray.end())
+      points_(aPointArray.begin(), aPointArray.end()),
+      boundingBox_(PointSetBoundingBoxOf(points_))
 {
 }
 
@@ -44,6 +63,16 @@ bool PointSet::isDefined() const
     return !points_.empty();
 }
 
+BoundingBox PointSet::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point set");
+    }
+
+    return boundingBox_;
+}
+
 bool PointSet::isEmpty() const
 {
     return points_.empty();
@@ -106,8 +135,6 @@ Size PointSet::getSize() const
 
 Real PointSet::distanceTo(const Point& aPoint) const
 {
-    using ostk::core::container::Array;
-
     if (!aPoint.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Point");
@@ -118,15 +145,7 @@ Real PointSet::distanceTo(const Point& aPoint) const
         throw ostk::core::error::runtime::Undefined("Point Set");
     }
 
-    const Array<Real> distances = Array<Point>(this->begin(), this->end())
-                                      .map<Real>(
-                                          [&aPoint](const Point& anOtherPoint) -> Real
-                                          {
-                                              return aPoint.distanceTo(anOtherPoint);
-                                          }
-                                      );
-
-    return *std::min_element(distances.begin(), distances.end());
+    return aPoint.distanceTo(this->getPointClosestTo(aPoint));
 }
 
 Point PointSet::getPointClosestTo(const Point& aPoint) const
@@ -193,14 +212,28 @@ void PointSet::applyTransformation(const Transformation& aTransformation)
         throw ostk::core::error::runtime::Undefined("Point set");
     }
 
+    MatrixXd pointMatrix(3, points_.size());
+
+    Index pointIndex = 0;
+
+    for (const auto& point : points_)
+    {
+        pointMatrix.col(pointIndex++) = point.asVector();
+    }
+
+    aTransformation.applyToPoints(pointMatrix);
+
     PointSet::Container points;
+    points.reserve(points_.size());
 
-    for (auto& point : points_)
+    for (pointIndex = 0; pointIndex < points_.size(); ++pointIndex)
     {
-        points.insert(aTransformation.applyTo(point));
+        points.insert(Point::Vector(pointMatrix.col(pointIndex)));
     }
 
-    points_ = points;
+    points_ = std::move(points);
+
+    boundingBox_ = PointSetBoundingBoxOf(points_);
 }
 
 PointSet PointSet::Empty()
@@ -22,7 +22,8 @@ Polygon::Polygon(const Polygon2d& aPolygon, const Point& anOrigin, const Vector3
       polygon_(aPolygon),
       origin_(anOrigin),
       xAxis_(aXAxis.isDefined() ? aXAxis.normalized() : aXAxis),
-      yAxis_(aYAxis.isDefined() ? aYAxis.normalized() : aYAxis)
+      yAxis_(aYAxis.isDefined() ? aYAxis.normalized() : aYAxis),
+      boundingBox_(BoundingBox::Undefined())
 {
     if (xAxis_.isDefined() && yAxis_.isDefined())
     {
@@ -31,6 +32,11 @@ Polygon::Polygon(const Polygon2d& aPolygon, const Point& anOrigin, const Vector3
             throw ostk::core::error::RuntimeError("X and Y axes are not orthogonal.");
         }
     }
+
+    if (this->isDefined())
+    {
+        boundingBox_ = BoundingBox::Points(this->getVertices());
+    }
 }
 
 Polygon* Polygon::clone() const
@@ -61,6 +67,16 @@ bool Polygon::isDefined() const
     return polygon_.isDefined() && origin_.isDefined() && xAxis_.isDefined() && yAxis_.isDefined();
 }
 
+BoundingBox Polygon::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon");
+    }
+
+    return boundingBox_;
+}
+
 bool Polygon::isNear(const Polygon& aPolygon, const Real& aTolerance) const
 {
     if (!aPolygon.isDefined())
@@ -281,6 +297,8 @@ void Polygon::applyTransformation(const Transformation& aTransformation)
 
     xAxis_ = aTransformation.applyTo(xAxis_);
     yAxis_ = aTransformation.applyTo(yAxis_);
+
+    boundingBox_ = BoundingBox::Points(this->getVertices());
 }
 
 Polygon Polygon::Undefined()
@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <algorithm>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -16,6 +18,8 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationMatrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationVector.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/CoarseToFine.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/Parallel.hpp>
 
 namespace ostk
 {
@@ -28,11 +32,81 @@ namespace d3
 namespace object
 {
 
+Vector3d PyramidLateralFaceRayDirection(
+    const Vector3d& aFirstRayDirection, const Vector3d& aRotationAxis, const Real& anAngle_rad
+)
+{
+    using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+    using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
+
+    return Quaternion::RotationVector(RotationVector(aRotationAxis, Angle::Radians(anAngle_rad))).conjugate() *
+           aFirstRayDirection;
+}
+
+// Conservative test against the bounding sphere of the ellipsoid: lateral face rays lie within the bounding cone of the
+// apex to base vertex directions (a spherical cap, hence convex, as long as its half-angle beta is lower than 90 deg),
+// and can only hit a sphere seen from the apex under the half-angle alpha, in the direction phi from the bounding cone
+// axis, if phi <= beta + alpha
+
+bool PyramidLateralFacesCanIntersect(const Point& anApex, const Array<Point>& aVertexArray, const Ellipsoid& anEllipsoid)
+{
+    const double boundingRadius = std::max(
+        {anEllipsoid.getFirstPrincipalSemiAxis(),
+         anEllipsoid.getSecondPrincipalSemiAxis(),
+         anEllipsoid.getThirdPrincipalSemiAxis()}
+    );
+
+    const Vector3d apexToCenter = anEllipsoid.getCenter() - anApex;
+    const double distance = apexToCenter.norm();
+
+    if (distance <= boundingRadius)
+    {
+        return true;
+    }
+
+    Vector3d boundingConeAxis = Vector3d::Zero();
+
+    for (const auto& vertex : aVertexArray)
+    {
+        boundingConeAxis += (vertex - anApex).normalized();
+    }
+
+    if (boundingConeAxis.norm() < Real::Epsilon())
+    {
+        return true;
+    }
+
+    boundingConeAxis.normalize();
+
+    double boundingConeAngle_rad = 0.0;
+
+    for (const auto& vertex : aVertexArray)
+    {
+        boundingConeAngle_rad = std::max(
+            boundingConeAngle_rad,
+            std::acos(std::clamp(boundingConeAxis.dot((vertex - anApex).normalized()), -1.0, 1.0))
+        );
+    }
+
+    if (boundingConeAngle_rad >= Real::HalfPi())
+    {
+        return true;
+    }
+
+    const double centerAngle_rad = std::acos(std::clamp(boundingConeAxis.dot(apexToCenter) / distance, -1.0, 1.0));
+    const double sphereAngle_rad = std::asin(boundingRadius / distance);
+
+    return centerAngle_rad <= (boundingConeAngle_rad + sphereAngle_rad);
+}
+
 Pyramid::Pyramid(const Polygon& aBase, const Point& anApex)
     : Object(),
       base_(aBase),
-      apex_(anApex)
+      apex_(anApex),
+      baseDirection_(Vector3d::Undefined()),
+      lateralFaceNormals_(Array<Vector3d>::Empty())
 {
+    this->updateLateralFaceNormals();
 }
 
 Pyramid* Pyramid::clone() const
@@ -96,16 +170,87 @@ bool Pyramid::intersects(const Ellipsoid& anEllipsoid, const Size aDiscretizatio
         throw ostk::core::error::runtime::Undefined("Pyramid");
     }
 
-    for (const auto& ray :
-         this->getRaysOfLateralFaces(aDiscretizationLevel))  // [TBM] Could be improved by calculating rays on the fly
+    const Size lateralFaceCount = this->getLateralFaceCount();
+
+    if (aDiscretizationLevel < lateralFaceCount)
     {
-        if (ray.intersects(anEllipsoid))
+        throw ostk::core::error::RuntimeError(
+            "Ray count [{}] lower than lateral face count [{}].", aDiscretizationLevel, lateralFaceCount
+        );
+    }
+
+    // Early rejection: no lateral face ray can hit the bounding sphere of the ellipsoid
+
+    if (!PyramidLateralFacesCanIntersect(apex_, base_.getVertices(), anEllipsoid))
+    {
+        return false;
+    }
+
+    // Rays are generated on the fly, coarse-to-fine (first ray of every lateral face, then progressively in between),
+    // so that the test exits as soon as a ray hits the ellipsoid
+
+    struct LateralFace
+    {
+        Vector3d firstRayDirection;
+        Vector3d rotationAxis;
+        Real angleBetweenRays_rad;
+    };
+
+    Array<LateralFace> lateralFaces = Array<LateralFace>::Empty();
+
+    lateralFaces.reserve(lateralFaceCount);
+
+    for (const auto& baseEdge : base_.getEdges())
+    {
+        const Vector3d firstRayDirection = (baseEdge.getFirstPoint() - apex_).normalized();
+        const Vector3d secondRayDirection = (baseEdge.getSecondPoint() - apex_).normalized();
+
+        if (firstRayDirection == secondRayDirection)
         {
-            return true;
+            lateralFaces.add({firstRayDirection, Vector3d::Zero(), 0.0});
+        }
+        else
+        {
+            lateralFaces.add(
+                {firstRayDirection,
+                 firstRayDirection.cross(secondRayDirection).normalized(),
+                 Angle::Between(firstRayDirection, secondRayDirection).inRadians()}
+            );
         }
     }
 
-    return false;
+    const Size lateralRayCount = aDiscretizationLevel / lateralFaceCount;
+
+    return ostk::mathematics::utility::AnyOfCoarseToFine(
+        lateralRayCount,
+        [this, &anEllipsoid, &lateralFaces, lateralRayCount](const Index& aRayIndex) -> bool
+        {
+            for (const auto& lateralFace : lateralFaces)
+            {
+                if ((aRayIndex > 0) && (lateralFace.angleBetweenRays_rad == 0.0))
+                {
+                    continue;  // Degenerate lateral face, with a single ray
+                }
+
+                const Real angle_rad = (lateralRayCount > 1) ? (lateralFace.angleBetweenRays_rad *
+                                                                static_cast<double>(aRayIndex) /
+                                                                static_cast<double>(lateralRayCount - 1))
+                                                             : Real(0.0);
+
+                const Ray ray = {
+                    apex_,
+                    PyramidLateralFaceRayDirection(lateralFace.firstRayDirection, lateralFace.rotationAxis, angle_rad)
+                };
+
+                if (ray.intersects(anEllipsoid))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    );
 }
 
 bool Pyramid::contains(const Point& aPoint) const
@@ -127,6 +272,29 @@ bool Pyramid::contains(const Point& aPoint) const
         return true;
     }
 
+    // Convex base: the pyramid is the intersection of the half-spaces bounded by its lateral faces, in front of the
+    // apex
+
+    if (!lateralFaceNormals_.isEmpty())
+    {
+        const Vector3d apexToPoint = aPoint - apex_;
+
+        if (apexToPoint.dot(baseDirection_) <= 0.0)
+        {
+            return false;
+        }
+
+        for (const auto& lateralFaceNormal : lateralFaceNormals_)
+        {
+            if (apexToPoint.dot(lateralFaceNormal) < 0.0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     // Projection of the point onto the pyramid base plane, along the apex to point ray
 
     const Ray apexToPointRay = {apex_, aPoint - apex_};
@@ -192,6 +360,51 @@ bool Pyramid::contains(const Segment& aSegment) const
     return this->contains(aSegment.getFirstPoint()) && this->contains(aSegment.getSecondPoint());
 }
 
+Array<bool> Pyramid::contains(const MatrixXd& aPointMatrix, const Size& aThreadCount) const
+{
+    using ostk::mathematics::utility::ForEachRange;
+
+    if ((aPointMatrix.rows() > 0) && (aPointMatrix.cols() != 3))
+    {
+        throw ostk::core::error::runtime::Wrong("Point matrix");
+    }
+
+    if (!aPointMatrix.allFinite())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Pyramid");
+    }
+
+    // Array<bool> packs bits, which threads cannot write concurrently
+
+    Eigen::Array<bool, Eigen::Dynamic, 1> containments(aPointMatrix.rows());
+
+    ForEachRange(
+        aPointMatrix.rows(),
+        aThreadCount,
+        [this, &aPointMatrix, &containments](const Index aBeginIndex, const Index anEndIndex)
+        {
+            for (Index rowIndex = aBeginIndex; rowIndex < anEndIndex; ++rowIndex)
+            {
+                containments(rowIndex) = this->contains(
+                    Point(aPointMatrix(rowIndex, 0), aPointMatrix(rowIndex, 1), aPointMatrix(rowIndex, 2))
+                );
+            }
+        }
+    );
+
+    return Array<bool>(containments.begin(), containments.end());
+}
+
 bool Pyramid::contains(const Ellipsoid& anEllipsoid) const
 {
     if (!anEllipsoid.isDefined())
@@ -271,8 +484,6 @@ Polygon Pyramid::getLateralFaceAt(const Index aLateralFaceIndex) const
 
 Array<Ray> Pyramid::getRaysOfLateralFaceAt(const Index aLateralFaceIndex, const Size aRayCount) const
 {
-    using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
-    using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
     using ostk::mathematics::object::Interval;
 
     // if (aRayCount < 2)
@@ -294,23 +505,26 @@ Array<Ray> Pyramid::getRaysOfLateralFaceAt(const Index aLateralFaceIndex, const
 
     const Angle angleBetweenRays = Angle::Between(firstRayDirection, secondRayDirection);
 
-    const Array<Real> angles_rad =
-        (aRayCount > 1) ? Interval<Real>::Closed(0.0, angleBetweenRays.inRadians()).generateArrayWithSize(aRayCount)
-                        : Array<Real> {0.0};
-
     Array<Ray> rays = Array<Ray>::Empty();
 
-    rays.reserve(angles_rad.getSize());
+    const auto addRay = [this, &rays, &rotationAxis, &firstRayDirection](const Real& anAngle_rad)
+    {
+        rays.emplace_back(apex_, PyramidLateralFaceRayDirection(firstRayDirection, rotationAxis, anAngle_rad));
+    };
 
-    for (const auto& angle_rad : angles_rad)
+    if (aRayCount > 1)
     {
-        const Ray ray = {
-            apex_,
-            Quaternion::RotationVector(RotationVector(rotationAxis, Angle::Radians(angle_rad))).conjugate() *
-                firstRayDirection
-        };
+        rays.reserve(aRayCount);
 
-        rays.emplace_back(ray);
+        for (const Real& angle_rad :
+             Interval<Real>::Closed(0.0, angleBetweenRays.inRadians()).generateRangeWithSize(aRayCount))
+        {
+            addRay(angle_rad);
+        }
+    }
+    else
+    {
+        addRay(0.0);
     }
 
     return rays;
@@ -521,6 +735,8 @@ void Pyramid::applyTransformation(const Transformation& aTransformation)
 
     base_.applyTransformation(aTransformation);
     apex_.applyTransformation(aTransformation);
+
+    this->updateLateralFaceNormals();
 }
 
 Pyramid Pyramid::Undefined()
@@ -528,6 +744,94 @@ Pyramid Pyramid::Undefined()
     return {Polygon::Undefined(), Point::Undefined()};
 }
 
+void Pyramid::updateLateralFaceNormals()
+{
+    baseDirection_ = Vector3d::Undefined();
+    lateralFaceNormals_ = Array<Vector3d>::Empty();
+
+    if ((!this->isDefined()) || (base_.getPolygon2d().getInnerRingCount() > 0))
+    {
+        return;
+    }
+
+    const Vector3d baseNormal = base_.getNormalVector();
+    const Real apexToBaseDistance = baseNormal.dot(base_.getOrigin() - apex_);
+
+    if (apexToBaseDistance.abs() < Real::Epsilon())
+    {
+        return;  // Degenerate pyramid (apex in base plane)
+    }
+
+    const Array<Point> vertices = base_.getVertices();
+
+    if (vertices.getSize() < 3)
+    {
+        return;
+    }
+
+    Vector3d centroid = Vector3d::Zero();
+
+    for (const auto& vertex : vertices)
+    {
+        centroid += vertex.asVector();
+    }
+
+    centroid /= static_cast<double>(vertices.getSize());
+
+    const Vector3d apexToCentroid = centroid - apex_.asVector();
+
+    Array<Vector3d> lateralFaceNormals = Array<Vector3d>::Empty();
+
+    lateralFaceNormals.reserve(vertices.getSize());
+
+    for (Index vertexIndex = 0; vertexIndex < vertices.getSize(); ++vertexIndex)
+    {
+        const Index nextVertexIndex = (vertexIndex + 1) % vertices.getSize();
+
+        const Vector3d apexToFirstVertex = vertices[vertexIndex] - apex_;
+        const Vector3d apexToSecondVertex = vertices[nextVertexIndex] - apex_;
+
+        Vector3d lateralFaceNormal = apexToFirstVertex.cross(apexToSecondVertex);
+
+        if (lateralFaceNormal.norm() < Real::Epsilon())
+        {
+            continue;  // Repeated vertex
+        }
+
+        lateralFaceNormal.normalize();
+
+        // Orient normal inwards
+
+        if (lateralFaceNormal.dot(apexToCentroid) < 0.0)
+        {
+            lateralFaceNormal = -lateralFaceNormal;
+        }
+
+        // Half-space representation only holds for convex bases: every other vertex must lie on the inner side of
+        // the lateral face, otherwise points are projected onto the base instead
+
+        for (Index otherVertexIndex = 0; otherVertexIndex < vertices.getSize(); ++otherVertexIndex)
+        {
+            if ((otherVertexIndex == vertexIndex) || (otherVertexIndex == nextVertexIndex))
+            {
+                continue;
+            }
+
+            const Vector3d apexToOtherVertex = vertices[otherVertexIndex] - apex_;
+
+            if (apexToOtherVertex.dot(lateralFaceNormal) < -(Real::Epsilon() * apexToOtherVertex.norm()))
+            {
+                return;
+            }
+        }
+
+        lateralFaceNormals.add(lateralFaceNormal);
+    }
+
+    baseDirection_ = (apexToBaseDistance > 0.0) ? baseNormal : Vector3d(-baseNormal);
+    lateralFaceNormals_ = lateralFaceNormals;
+}
+
 }  // namespace object
 }  // namespace d3
 }  // namespace geometry
@@ -4,6 +4,7 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ellipsoid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Plane.hpp>
@@ -56,6 +57,16 @@ bool Segment::isDefined() const
     return firstPoint_.isDefined() && secondPoint_.isDefined();
 }
 
+BoundingBox Segment::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Segment");
+    }
+
+    return BoundingBox::Points({firstPoint_, secondPoint_});
+}
+
 bool Segment::isDegenerate() const
 {
     if (!this->isDefined())
@@ -5,6 +5,7 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Cone.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ellipsoid.hpp>
@@ -85,6 +86,18 @@ bool Sphere::isDefined() const
     return center_.isDefined() && radius_.isDefined();
 }
 
+BoundingBox Sphere::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Sphere");
+    }
+
+    const Vector3d halfSize = Vector3d::Constant(radius_);
+
+    return {center_ - halfSize, center_ + halfSize};
+}
+
 bool Sphere::isUnitary() const
 {
     if (!this->isDefined())
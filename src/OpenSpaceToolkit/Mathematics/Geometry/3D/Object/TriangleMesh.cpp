@@ -0,0 +1,734 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/TriangleMesh.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/BoundingVolumeHierarchy.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/Parallel.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+namespace d3
+{
+namespace object
+{
+
+using ostk::mathematics::utility::ForEachRange;
+using ostk::mathematics::utility::VisitLeavesClosestFirst;
+
+// Maximum number of triangles per leaf, and number of centroid bins evaluated by the surface area heuristic
+
+static constexpr Size TriangleMeshLeafSize = 4;
+static constexpr Size TriangleMeshBinCount = 16;
+
+// Depth below which nodes are split by the surface area heuristic. Deeper nodes are split at the median centroid, which
+// bounds the depth of the hierarchy (and the traversal stack) whatever the geometry
+
+static constexpr Size TriangleMeshHeuristicDepth = 48;
+static constexpr Size TriangleMeshStackSize = 128;
+
+// Half of the surface area of an axis-aligned box
+
+double TriangleMeshHalfArea(const Vector3d& aLowerBound, const Vector3d& anUpperBound)
+{
+    const Vector3d size = anUpperBound - aLowerBound;
+
+    return (size.x() * size.y()) + (size.y() * size.z()) + (size.z() * size.x());
+}
+
+// Distance along a ray at which it enters an axis-aligned box (zero if the origin is inside), infinite if the ray
+// misses the box before aMaxDistance. Axes along which the direction vanishes are handled apart, to avoid 0 * inf
+
+double TriangleMeshEntryDistance(
+    const Vector3d& anOrigin,
+    const Vector3d& aDirection,
+    const Vector3d& anInverseDirection,
+    const Vector3d& aLowerBound,
+    const Vector3d& anUpperBound,
+    const double aMaxDistance
+)
+{
+    double entryDistance = 0.0;
+    double exitDistance = aMaxDistance;
+
+    for (Index axis = 0; axis < 3; ++axis)
+    {
+        if (aDirection(axis) == 0.0)
+        {
+            if ((anOrigin(axis) < aLowerBound(axis)) || (anOrigin(axis) > anUpperBound(axis)))
+            {
+                return std::numeric_limits<double>::infinity();
+            }
+
+            continue;
+        }
+
+        const double lowerDistance = (aLowerBound(axis) - anOrigin(axis)) * anInverseDirection(axis);
+        const double upperDistance = (anUpperBound(axis) - anOrigin(axis)) * anInverseDirection(axis);
+
+        entryDistance = std::max(entryDistance, std::min(lowerDistance, upperDistance));
+        exitDistance = std::min(exitDistance, std::max(lowerDistance, upperDistance));
+
+        if (entryDistance > exitDistance)
+        {
+            return std::numeric_limits<double>::infinity();
+        }
+    }
+
+    return entryDistance;
+}
+
+// Distance along a ray to a two-sided triangle given by its first vertex and two edges (Moller and Trumbore, "Fast,
+// Minimum Storage Ray/Triangle Intersection", 1997), infinite if the ray misses it
+
+double TriangleMeshHitDistance(const Vector3d& anOrigin, const Vector3d& aDirection, const double* aFace)
+{
+    const Eigen::Map<const Vector3d> vertex(aFace);
+    const Eigen::Map<const Vector3d> firstEdge(aFace + 3);
+    const Eigen::Map<const Vector3d> secondEdge(aFace + 6);
+
+    const Vector3d directionCrossEdge = aDirection.cross(secondEdge);
+    const double determinant = firstEdge.dot(directionCrossEdge);
+
+    if (determinant == 0.0)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    const double inverseDeterminant = 1.0 / determinant;
+    const Vector3d offset = anOrigin - vertex;
+
+    const double u = offset.dot(directionCrossEdge) * inverseDeterminant;
+
+    if ((u < 0.0) || (u > 1.0))
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    const Vector3d offsetCrossEdge = offset.cross(firstEdge);
+
+    const double v = aDirection.dot(offsetCrossEdge) * inverseDeterminant;
+
+    if ((v < 0.0) || ((u + v) > 1.0))
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    const double distance = secondEdge.dot(offsetCrossEdge) * inverseDeterminant;
+
+    return (distance >= 0.0) ? distance : std::numeric_limits<double>::infinity();
+}
+
+// Check the ray matrices of bulk queries, and return the normalized directions
+
+MatrixXd TriangleMeshRayDirections(const MatrixXd& anOriginMatrix, const MatrixXd& aDirectionMatrix)
+{
+    if ((anOriginMatrix.rows() > 0) && (anOriginMatrix.cols() != 3))
+    {
+        throw ostk::core::error::runtime::Wrong("Origin matrix");
+    }
+
+    if (!anOriginMatrix.allFinite())
+    {
+        throw ostk::core::error::runtime::Undefined("Origin");
+    }
+
+    if ((aDirectionMatrix.rows() != anOriginMatrix.rows()) ||
+        ((aDirectionMatrix.rows() > 0) && (aDirectionMatrix.cols() != 3)))
+    {
+        throw ostk::core::error::runtime::Wrong("Direction matrix");
+    }
+
+    if (!aDirectionMatrix.allFinite())
+    {
+        throw ostk::core::error::runtime::Undefined("Direction");
+    }
+
+    if ((aDirectionMatrix.rows() > 0) && (aDirectionMatrix.rowwise().squaredNorm().minCoeff() == 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Direction");
+    }
+
+    return aDirectionMatrix.rowwise().normalized();
+}
+
+TriangleMesh::TriangleMesh(const MatrixXd& aVertexMatrix, const MatrixXi& aTriangleMatrix)
+    : Object(),
+      vertices_(aVertexMatrix),
+      triangles_(aTriangleMatrix),
+      faces_(),
+      indices_(Array<Index>::Empty()),
+      nodes_(Array<TriangleMesh::Node>::Empty())
+{
+    if ((vertices_.rows() > 0) && (vertices_.cols() != 3))
+    {
+        throw ostk::core::error::runtime::Wrong("Vertex matrix");
+    }
+
+    if (!vertices_.allFinite())
+    {
+        throw ostk::core::error::runtime::Undefined("Vertex");
+    }
+
+    if ((triangles_.rows() > 0) &&
+        ((triangles_.cols() != 3) || (triangles_.minCoeff() < 0) || (triangles_.maxCoeff() >= vertices_.rows())))
+    {
+        throw ostk::core::error::runtime::Wrong("Triangle matrix");
+    }
+
+    vertices_.resize(vertices_.rows(), 3);
+    triangles_.resize(triangles_.rows(), 3);
+
+    this->build();
+}
+
+TriangleMesh* TriangleMesh::clone() const
+{
+    return new TriangleMesh(*this);
+}
+
+bool TriangleMesh::operator==(const TriangleMesh& aTriangleMesh) const
+{
+    if ((!this->isDefined()) || (!aTriangleMesh.isDefined()))
+    {
+        return false;
+    }
+
+    return (vertices_.rows() == aTriangleMesh.vertices_.rows()) &&
+           (triangles_.rows() == aTriangleMesh.triangles_.rows()) && (vertices_ == aTriangleMesh.vertices_) &&
+           (triangles_ == aTriangleMesh.triangles_);
+}
+
+bool TriangleMesh::operator!=(const TriangleMesh& aTriangleMesh) const
+{
+    return !((*this) == aTriangleMesh);
+}
+
+bool TriangleMesh::isDefined() const
+{
+    return triangles_.rows() > 0;
+}
+
+BoundingBox TriangleMesh::getBoundingBox() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Triangle mesh");
+    }
+
+    // The root node spans every triangle
+
+    return {Point::Vector(nodes_.accessFirst().lowerBound), Point::Vector(nodes_.accessFirst().upperBound)};
+}
+
+bool TriangleMesh::intersects(const Ray& aRay) const
+{
+    if (!aRay.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ray");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Triangle mesh");
+    }
+
+    Index position = 0;
+    double distance = 0.0;
+
+    return this->cast(aRay.getOrigin().asVector(), aRay.getDirection(), true, position, distance);
+}
+
+Array<bool> TriangleMesh::intersects(
+    const MatrixXd& anOriginMatrix, const MatrixXd& aDirectionMatrix, const Size& aThreadCount
+) const
+{
+    const MatrixXd directionMatrix = TriangleMeshRayDirections(anOriginMatrix, aDirectionMatrix);
+
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Triangle mesh");
+    }
+
+    // Array<bool> packs bits, which threads cannot write concurrently
+
+    Eigen::Array<bool, Eigen::Dynamic, 1> intersections(anOriginMatrix.rows());
+
+    ForEachRange(
+        anOriginMatrix.rows(),
+        aThreadCount,
+        [this, &anOriginMatrix, &directionMatrix, &intersections](const Index aBeginIndex, const Index anEndIndex)
+        {
+            for (Index rowIndex = aBeginIndex; rowIndex < anEndIndex; ++rowIndex)
+            {
+                Index position = 0;
+                double distance = 0.0;
+
+                intersections(rowIndex) = this->cast(
+                    anOriginMatrix.row(rowIndex).transpose(),
+                    directionMatrix.row(rowIndex).transpose(),
+                    true,
+                    position,
+                    distance
+                );
+            }
+        }
+    );
+
+    return Array<bool>(intersections.begin(), intersections.end());
+}
+
+Size TriangleMesh::getVertexCount() const
+{
+    return vertices_.rows();
+}
+
+Size TriangleMesh::getTriangleCount() const
+{
+    return triangles_.rows();
+}
+
+MatrixXd TriangleMesh::getVertices() const
+{
+    return vertices_;
+}
+
+MatrixXi TriangleMesh::getTriangles() const
+{
+    return triangles_;
+}
+
+Intersection TriangleMesh::intersectionWith(const Ray& aRay) const
+{
+    const TriangleMesh::Hit hit = this->castRay(aRay);
+
+    if (!std::get<1>(hit).isDefined())
+    {
+        return Intersection::Empty();
+    }
+
+    return Intersection::Point(std::get<2>(hit));
+}
+
+TriangleMesh::Hit TriangleMesh::castRay(const Ray& aRay) const
+{
+    if (!aRay.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ray");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Triangle mesh");
+    }
+
+    const Vector3d origin = aRay.getOrigin().asVector();
+    const Vector3d direction = aRay.getDirection();
+
+    Index position = 0;
+    double distance = 0.0;
+
+    if (!this->cast(origin, direction, false, position, distance))
+    {
+        return {this->getTriangleCount(), Real::Undefined(), Point::Undefined()};
+    }
+
+    return {indices_[position], distance, Point::Vector(origin + (distance * direction))};
+}
+
+Array<TriangleMesh::Hit> TriangleMesh::castRays(
+    const MatrixXd& anOriginMatrix, const MatrixXd& aDirectionMatrix, const Size& aThreadCount
+) const
+{
+    const MatrixXd directionMatrix = TriangleMeshRayDirections(anOriginMatrix, aDirectionMatrix);
+
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Triangle mesh");
+    }
+
+    Array<TriangleMesh::Hit> hits(
+        anOriginMatrix.rows(), TriangleMesh::Hit(this->getTriangleCount(), Real::Undefined(), Point::Undefined())
+    );
+
+    ForEachRange(
+        anOriginMatrix.rows(),
+        aThreadCount,
+        [this, &anOriginMatrix, &directionMatrix, &hits](const Index aBeginIndex, const Index anEndIndex)
+        {
+            for (Index rowIndex = aBeginIndex; rowIndex < anEndIndex; ++rowIndex)
+            {
+                const Vector3d origin = anOriginMatrix.row(rowIndex).transpose();
+                const Vector3d direction = directionMatrix.row(rowIndex).transpose();
+
+                Index position = 0;
+                double distance = 0.0;
+
+                if (this->cast(origin, direction, false, position, distance))
+                {
+                    hits[rowIndex] = {indices_[position], distance, Point::Vector(origin + (distance * direction))};
+                }
+            }
+        }
+    );
+
+    return hits;
+}
+
+void TriangleMesh::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Triangle Mesh") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Vertex count:" << this->getVertexCount();
+    ostk::core::utils::Print::Line(anOutputStream) << "Triangle count:" << this->getTriangleCount();
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+void TriangleMesh::applyTransformation(const Transformation& aTransformation)
+{
+    if (!aTransformation.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Transformation");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Triangle mesh");
+    }
+
+    MatrixXd vertexMatrix = vertices_.transpose();
+
+    aTransformation.applyToPoints(vertexMatrix);
+
+    vertices_ = vertexMatrix.transpose();
+
+    this->build();
+}
+
+TriangleMesh TriangleMesh::Undefined()
+{
+    return {MatrixXd::Zero(0, 3), MatrixXi::Zero(0, 3)};
+}
+
+void TriangleMesh::build()
+{
+    const Size triangleCount = triangles_.rows();
+
+    // Bounds and centroids of the triangles, in insertion order
+
+    MatrixXd lowerBounds(triangleCount, 3);
+    MatrixXd upperBounds(triangleCount, 3);
+    MatrixXd centroids(triangleCount, 3);
+
+    for (Index triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex)
+    {
+        const Vector3d firstVertex = vertices_.row(triangles_(triangleIndex, 0)).transpose();
+        const Vector3d secondVertex = vertices_.row(triangles_(triangleIndex, 1)).transpose();
+        const Vector3d thirdVertex = vertices_.row(triangles_(triangleIndex, 2)).transpose();
+
+        lowerBounds.row(triangleIndex) = firstVertex.cwiseMin(secondVertex).cwiseMin(thirdVertex).transpose();
+        upperBounds.row(triangleIndex) = firstVertex.cwiseMax(secondVertex).cwiseMax(thirdVertex).transpose();
+        centroids.row(triangleIndex) = ((firstVertex + secondVertex + thirdVertex) / 3.0).transpose();
+    }
+
+    indices_ = Array<Index>(triangleCount, 0);
+    nodes_ = Array<TriangleMesh::Node>::Empty();
+
+    std::iota(indices_.begin(), indices_.end(), 0);
+
+    nodes_.reserve(2 * triangleCount);
+
+    // Top-down splits in depth-first order: the first child of a branch immediately follows it. Each split minimizes
+    // the surface area heuristic cost 1 + (A_left N_left + A_right N_right) / A over the boundaries between centroid
+    // bins along each axis, and a node becomes a leaf when no split is cheaper than testing its triangles
+
+    const auto buildNode =
+        [this, &lowerBounds, &upperBounds, &centroids](
+            const auto& aBuildNode, const Index aBeginIndex, const Index anEndIndex, const Size aDepth
+        ) -> void
+    {
+        const Index nodeIndex = nodes_.getSize();
+
+        TriangleMesh::Node node = {
+            lowerBounds.row(indices_[aBeginIndex]).transpose(),
+            upperBounds.row(indices_[aBeginIndex]).transpose(),
+            aBeginIndex,
+            anEndIndex - aBeginIndex
+        };
+
+        Vector3d centroidLowerBound = centroids.row(indices_[aBeginIndex]).transpose();
+        Vector3d centroidUpperBound = centroidLowerBound;
+
+        for (Index position = aBeginIndex + 1; position < anEndIndex; ++position)
+        {
+            const Index triangleIndex = indices_[position];
+
+            node.lowerBound = node.lowerBound.cwiseMin(lowerBounds.row(triangleIndex).transpose());
+            node.upperBound = node.upperBound.cwiseMax(upperBounds.row(triangleIndex).transpose());
+
+            centroidLowerBound = centroidLowerBound.cwiseMin(centroids.row(triangleIndex).transpose());
+            centroidUpperBound = centroidUpperBound.cwiseMax(centroids.row(triangleIndex).transpose());
+        }
+
+        nodes_.add(node);
+
+        Index splitAxis = 0;
+        const double centroidExtent = (centroidUpperBound - centroidLowerBound).maxCoeff(&splitAxis);
+
+        if ((node.count == 1) || (centroidExtent == 0.0))
+        {
+            return;
+        }
+
+        const double nodeArea = TriangleMeshHalfArea(node.lowerBound, node.upperBound);
+
+        Index middleIndex = aBeginIndex + (node.count / 2);
+
+        if ((aDepth < TriangleMeshHeuristicDepth) && (nodeArea > 0.0))
+        {
+            double splitCost = std::numeric_limits<double>::infinity();
+            Index splitBin = 0;
+
+            for (Index axis = 0; axis < 3; ++axis)
+            {
+                const double axisExtent = centroidUpperBound(axis) - centroidLowerBound(axis);
+
+                if (axisExtent == 0.0)
+                {
+                    continue;
+                }
+
+                const double binScale = static_cast<double>(TriangleMeshBinCount) / axisExtent;
+
+                std::array<Size, TriangleMeshBinCount> binCounts;
+                std::array<Vector3d, TriangleMeshBinCount> binLowerBounds;
+                std::array<Vector3d, TriangleMeshBinCount> binUpperBounds;
+
+                binCounts.fill(0);
+                binLowerBounds.fill(Vector3d::Constant(std::numeric_limits<double>::infinity()));
+                binUpperBounds.fill(Vector3d::Constant(-std::numeric_limits<double>::infinity()));
+
+                for (Index position = aBeginIndex; position < anEndIndex; ++position)
+                {
+                    const Index triangleIndex = indices_[position];
+                    const Index bin = std::min<Index>(
+                        TriangleMeshBinCount - 1,
+                        static_cast<Index>((centroids(triangleIndex, axis) - centroidLowerBound(axis)) * binScale)
+                    );
+
+                    ++binCounts[bin];
+                    binLowerBounds[bin] = binLowerBounds[bin].cwiseMin(lowerBounds.row(triangleIndex).transpose());
+                    binUpperBounds[bin] = binUpperBounds[bin].cwiseMax(upperBounds.row(triangleIndex).transpose());
+                }
+
+                // Sweep the bins from the right to accumulate the right-hand side costs, then from the left
+
+                std::array<double, TriangleMeshBinCount> rightCosts;
+
+                Size rightCount = 0;
+                Vector3d rightLowerBound = Vector3d::Constant(std::numeric_limits<double>::infinity());
+                Vector3d rightUpperBound = Vector3d::Constant(-std::numeric_limits<double>::infinity());
+
+                for (Index bin = TriangleMeshBinCount - 1; bin > 0; --bin)
+                {
+                    rightCount += binCounts[bin];
+                    rightLowerBound = rightLowerBound.cwiseMin(binLowerBounds[bin]);
+                    rightUpperBound = rightUpperBound.cwiseMax(binUpperBounds[bin]);
+
+                    rightCosts[bin] = (rightCount > 0)
+                                        ? (TriangleMeshHalfArea(rightLowerBound, rightUpperBound) * rightCount)
+                                        : 0.0;
+                }
+
+                Size leftCount = 0;
+                Vector3d leftLowerBound = Vector3d::Constant(std::numeric_limits<double>::infinity());
+                Vector3d leftUpperBound = Vector3d::Constant(-std::numeric_limits<double>::infinity());
+
+                for (Index bin = 1; bin < TriangleMeshBinCount; ++bin)
+                {
+                    leftCount += binCounts[bin - 1];
+                    leftLowerBound = leftLowerBound.cwiseMin(binLowerBounds[bin - 1]);
+                    leftUpperBound = leftUpperBound.cwiseMax(binUpperBounds[bin - 1]);
+
+                    if ((leftCount == 0) || (leftCount == node.count))
+                    {
+                        continue;
+                    }
+
+                    const double cost =
+                        1.0 +
+                        (((TriangleMeshHalfArea(leftLowerBound, leftUpperBound) * leftCount) + rightCosts[bin]) /
+                         nodeArea);
+
+                    if (cost < splitCost)
+                    {
+                        splitCost = cost;
+                        splitAxis = axis;
+                        splitBin = bin;
+                    }
+                }
+            }
+
+            if ((splitCost >= static_cast<double>(node.count)) && (node.count <= TriangleMeshLeafSize))
+            {
+                return;
+            }
+
+            if (splitBin > 0)
+            {
+                const double binScale =
+                    static_cast<double>(TriangleMeshBinCount) /
+                    (centroidUpperBound(splitAxis) - centroidLowerBound(splitAxis));
+
+                middleIndex = std::partition(
+                                  indices_.begin() + aBeginIndex,
+                                  indices_.begin() + anEndIndex,
+                                  [&centroids, &centroidLowerBound, splitAxis, splitBin, binScale](
+                                      const Index aTriangleIndex
+                                  ) -> bool
+                                  {
+                                      const Index bin = std::min<Index>(
+                                          TriangleMeshBinCount - 1,
+                                          static_cast<Index>(
+                                              (centroids(aTriangleIndex, splitAxis) - centroidLowerBound(splitAxis)) *
+                                              binScale
+                                          )
+                                      );
+
+                                      return bin < splitBin;
+                                  }
+                              ) -
+                              indices_.begin();
+            }
+        }
+        else if (node.count <= TriangleMeshLeafSize)
+        {
+            return;
+        }
+
+        if ((middleIndex == aBeginIndex) || (middleIndex == anEndIndex) || (aDepth >= TriangleMeshHeuristicDepth) ||
+            (nodeArea == 0.0))
+        {
+            middleIndex = aBeginIndex + (node.count / 2);
+
+            std::nth_element(
+                indices_.begin() + aBeginIndex,
+                indices_.begin() + middleIndex,
+                indices_.begin() + anEndIndex,
+                [&centroids, splitAxis](const Index aFirstIndex, const Index aSecondIndex) -> bool
+                {
+                    return centroids(aFirstIndex, splitAxis) < centroids(aSecondIndex, splitAxis);
+                }
+            );
+        }
+
+        aBuildNode(aBuildNode, aBeginIndex, middleIndex, aDepth + 1);
+
+        nodes_[nodeIndex].offset = nodes_.getSize();
+        nodes_[nodeIndex].count = 0;
+
+        aBuildNode(aBuildNode, middleIndex, anEndIndex, aDepth + 1);
+    };
+
+    if (triangleCount > 0)
+    {
+        buildNode(buildNode, 0, triangleCount, 0);
+    }
+
+    // Store the first vertex and the two edges of each triangle in hierarchy order (one triangle per column), so that
+    // leaf scans read contiguous memory
+
+    faces_.resize(9, triangleCount);
+
+    for (Index position = 0; position < triangleCount; ++position)
+    {
+        const Index triangleIndex = indices_[position];
+
+        const Vector3d firstVertex = vertices_.row(triangles_(triangleIndex, 0)).transpose();
+
+        faces_.block<3, 1>(0, position) = firstVertex;
+        faces_.block<3, 1>(3, position) = vertices_.row(triangles_(triangleIndex, 1)).transpose() - firstVertex;
+        faces_.block<3, 1>(6, position) = vertices_.row(triangles_(triangleIndex, 2)).transpose() - firstVertex;
+    }
+}
+
+bool TriangleMesh::cast(
+    const Vector3d& anOrigin, const Vector3d& aDirection, const bool isAnyHit, Index& aPosition, double& aDistance
+) const
+{
+    const Vector3d inverseDirection = aDirection.cwiseInverse();
+
+    aPosition = 0;
+    aDistance = std::numeric_limits<double>::infinity();
+
+    bool isHit = false;
+
+    // Boxes are clipped to the closest hit found so far, so that nodes pushed before it was found are skipped
+
+    VisitLeavesClosestFirst<TriangleMeshStackSize>(
+        nodes_,
+        [&anOrigin, &aDirection, &inverseDirection, &aDistance](const TriangleMesh::Node& aNode) -> double
+        {
+            return TriangleMeshEntryDistance(
+                anOrigin, aDirection, inverseDirection, aNode.lowerBound, aNode.upperBound, aDistance
+            );
+        },
+        aDistance,
+        [this, &anOrigin, &aDirection, isAnyHit, &aPosition, &aDistance, &isHit](
+            const Index aBeginIndex, const Index anEndIndex
+        ) -> bool
+        {
+            for (Index position = aBeginIndex; position < anEndIndex; ++position)
+            {
+                const double distance = TriangleMeshHitDistance(anOrigin, aDirection, faces_.col(position).data());
+
+                if (distance < aDistance)
+                {
+                    aPosition = position;
+                    aDistance = distance;
+                    isHit = true;
+
+                    if (isAnyHit)
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+    );
+
+    return isHit;
+}
+
+}  // namespace object
+}  // namespace d3
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
@@ -17,6 +17,48 @@ namespace geometry
 namespace d3
 {
 
+// Apply the affine part of a homogeneous transformation matrix to the columns of a 3 x N matrix, in place
+
+void TransformationApplyInPlace(
+    const Transformation::Type& aType,
+    const Matrix4d& aTransformationMatrix,
+    const bool isTranslated,
+    Eigen::Ref<MatrixXd> aMatrix
+)
+{
+    using ostk::mathematics::object::Matrix3d;
+
+    switch (aType)
+    {
+        case Transformation::Type::Identity:
+            return;
+
+        case Transformation::Type::Translation:
+
+            if (isTranslated)
+            {
+                aMatrix.colwise() += aTransformationMatrix.topRightCorner<3, 1>();
+            }
+
+            return;
+
+        default:
+            break;
+    }
+
+    const Matrix3d linearPart = aTransformationMatrix.topLeftCorner<3, 3>();
+    const Vector3d translationPart = isTranslated ? Vector3d(aTransformationMatrix.topRightCorner<3, 1>()) : Vector3d::Zero();
+
+    // Fixed-size column copies keep the product allocation-free
+
+    for (Eigen::Index columnIndex = 0; columnIndex < aMatrix.cols(); ++columnIndex)
+    {
+        const Vector3d column = aMatrix.col(columnIndex);
+
+        aMatrix.col(columnIndex) = (linearPart * column) + translationPart;
+    }
+}
+
 Transformation::Transformation(const Matrix4d& aMatrix)
     : type_(Transformation::TypeOfMatrix(aMatrix)),
       matrix_(aMatrix),
@@ -233,6 +275,36 @@ Vector3d Transformation::applyTo(const Vector3d& aVector) const
     return Vector3d {(matrix_ * Vector4d(aVector.x(), aVector.y(), aVector.z(), 0.0)).head<3>()};
 }
 
+void Transformation::applyToPoints(Eigen::Ref<MatrixXd> aPointMatrix) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Transformation");
+    }
+
+    if (aPointMatrix.rows() != 3)
+    {
+        throw ostk::core::error::runtime::Wrong("Point matrix");
+    }
+
+    TransformationApplyInPlace(type_, matrix_, true, aPointMatrix);
+}
+
+void Transformation::applyToVectors(Eigen::Ref<MatrixXd> aVectorMatrix) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Transformation");
+    }
+
+    if (aVectorMatrix.rows() != 3)
+    {
+        throw ostk::core::error::runtime::Wrong("Vector matrix");
+    }
+
+    TransformationApplyInPlace(type_, matrix_, false, aVectorMatrix);
+}
+
 void Transformation::print(std::ostream& anOutputStream, bool displayDecorators) const
 {
     displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "3D :: Transformation") : void();
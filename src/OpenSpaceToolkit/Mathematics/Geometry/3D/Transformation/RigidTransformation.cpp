@@ -0,0 +1,359 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/RigidTransformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationMatrix.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+namespace d3
+{
+namespace transformation
+{
+
+using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
+using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::Matrix4d;
+
+// Rotate a vector by a unit quaternion in XYZS format, as Quaternion::rotateVector does, without the Real overhead
+
+Vector3d RigidTransformationRotate(const Vector4d& aQuaternion, const Vector3d& aVector)
+{
+    const Vector3d vectorPart = aQuaternion.head<3>();
+    const Vector3d crossProduct = 2.0 * vectorPart.cross(aVector);
+
+    return aVector - (aQuaternion(3) * crossProduct) + vectorPart.cross(crossProduct);
+}
+
+// Multiply two quaternions in XYZS format, as Quaternion::crossMultiply does
+
+Vector4d RigidTransformationMultiply(const Vector4d& aFirstQuaternion, const Vector4d& aSecondQuaternion)
+{
+    const Vector3d firstVectorPart = aFirstQuaternion.head<3>();
+    const Vector3d secondVectorPart = aSecondQuaternion.head<3>();
+
+    Vector4d product;
+
+    product.head<3>() = (aSecondQuaternion(3) * firstVectorPart) + (aFirstQuaternion(3) * secondVectorPart) -
+                        firstVectorPart.cross(secondVectorPart);
+    product(3) = (aFirstQuaternion(3) * aSecondQuaternion(3)) - firstVectorPart.dot(secondVectorPart);
+
+    return product;
+}
+
+// Rotation matrix M such that M * v == RigidTransformationRotate(aQuaternion, v)
+
+Matrix3d RigidTransformationRotationMatrixOf(const Vector4d& aQuaternion)
+{
+    // The crossMultiply convention amounts to an active Hamilton rotation by the conjugate quaternion
+
+    return Eigen::Quaterniond(aQuaternion(3), -aQuaternion(0), -aQuaternion(1), -aQuaternion(2)).toRotationMatrix();
+}
+
+RigidTransformation::RigidTransformation(const Quaternion& aRotation, const Vector3d& aTranslation)
+    : rotation_(aRotation.isDefined() ? aRotation.toNormalized().toVector() : Vector4d::Undefined()),
+      translation_(aTranslation)
+{
+}
+
+bool RigidTransformation::operator==(const RigidTransformation& aRigidTransformation) const
+{
+    if ((!this->isDefined()) || (!aRigidTransformation.isDefined()))
+    {
+        return false;
+    }
+
+    return ((rotation_ == aRigidTransformation.rotation_) || (rotation_ == -aRigidTransformation.rotation_)) &&
+           (translation_ == aRigidTransformation.translation_);
+}
+
+bool RigidTransformation::operator!=(const RigidTransformation& aRigidTransformation) const
+{
+    return !((*this) == aRigidTransformation);
+}
+
+RigidTransformation RigidTransformation::operator*(const RigidTransformation& aRigidTransformation) const
+{
+    RigidTransformation rigidTransformation = {*this};
+
+    rigidTransformation *= aRigidTransformation;
+
+    return rigidTransformation;
+}
+
+RigidTransformation& RigidTransformation::operator*=(const RigidTransformation& aRigidTransformation)
+{
+    if (!aRigidTransformation.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Rigid transformation");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Rigid transformation");
+    }
+
+    const Vector4d rotation = RigidTransformationMultiply(rotation_, aRigidTransformation.rotation_);
+
+    translation_ += RigidTransformationRotate(rotation_, aRigidTransformation.translation_);
+
+    // The product of unit quaternions only drifts from unit norm by rounding: a first-order correction of the norm
+    // keeps long chains unitary without a square root on the critical path
+
+    rotation_ = rotation * (0.5 * (3.0 - rotation.squaredNorm()));
+
+    return *this;
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const RigidTransformation& aRigidTransformation)
+{
+    aRigidTransformation.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+bool RigidTransformation::isDefined() const
+{
+    return rotation_.allFinite() && translation_.allFinite();
+}
+
+bool RigidTransformation::isNear(
+    const RigidTransformation& aRigidTransformation, const Angle& anAngularTolerance, const Real& aTranslationTolerance
+) const
+{
+    if ((!this->isDefined()) || (!aRigidTransformation.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Rigid transformation");
+    }
+
+    if (!aTranslationTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Translation tolerance");
+    }
+
+    return this->getRotation().isNear(aRigidTransformation.getRotation(), anAngularTolerance) &&
+           ((translation_ - aRigidTransformation.translation_).norm() <= aTranslationTolerance);
+}
+
+Quaternion RigidTransformation::getRotation() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Rigid transformation");
+    }
+
+    return {rotation_, Quaternion::Format::XYZS};
+}
+
+Vector3d RigidTransformation::getTranslation() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Rigid transformation");
+    }
+
+    return translation_;
+}
+
+RigidTransformation RigidTransformation::getInverse() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Rigid transformation");
+    }
+
+    RigidTransformation inverse = {*this};
+
+    inverse.rotation_.head<3>() = -rotation_.head<3>();
+    inverse.translation_ = -RigidTransformationRotate(inverse.rotation_, translation_);
+
+    return inverse;
+}
+
+Point RigidTransformation::applyTo(const Point& aPoint) const
+{
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Rigid transformation");
+    }
+
+    return Point::Vector(RigidTransformationRotate(rotation_, aPoint.asVector()) + translation_);
+}
+
+Vector3d RigidTransformation::applyTo(const Vector3d& aVector) const
+{
+    if (!aVector.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Vector");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Rigid transformation");
+    }
+
+    return RigidTransformationRotate(rotation_, aVector);
+}
+
+void RigidTransformation::applyToPoints(Eigen::Ref<MatrixXd> aPointMatrix) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Rigid transformation");
+    }
+
+    if (aPointMatrix.rows() != 3)
+    {
+        throw ostk::core::error::runtime::Wrong("Point matrix");
+    }
+
+    const Matrix3d rotationMatrix = RigidTransformationRotationMatrixOf(rotation_);
+
+    for (Eigen::Index columnIndex = 0; columnIndex < aPointMatrix.cols(); ++columnIndex)
+    {
+        const Vector3d column = aPointMatrix.col(columnIndex);
+
+        aPointMatrix.col(columnIndex) = (rotationMatrix * column) + translation_;
+    }
+}
+
+d3::Transformation RigidTransformation::toTransformation() const
+{
+    if (!this->isDefined())
+    {
+        return d3::Transformation::Undefined();
+    }
+
+    const bool isRotated = (rotation_(0) != 0.0) || (rotation_(1) != 0.0) || (rotation_(2) != 0.0);
+    const bool isTranslated = translation_ != Vector3d::Zero();
+
+    if ((!isRotated) && (!isTranslated))
+    {
+        return d3::Transformation::Identity();
+    }
+
+    if (!isRotated)
+    {
+        return d3::Transformation::Translation(translation_);
+    }
+
+    // Transformation::Rotation applies the transpose of the rotation matrix it is given
+
+    const d3::Transformation rotation = d3::Transformation::Rotation(
+        RotationMatrix(RigidTransformationRotationMatrixOf(rotation_).transpose())
+    );
+
+    if (!isTranslated)
+    {
+        return rotation;
+    }
+
+    return d3::Transformation::Translation(translation_) * rotation;
+}
+
+void RigidTransformation::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "3D :: Rigid Transformation") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Rotation:" << (rotation_.isDefined() ? this->getRotation().toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Translation:" << (translation_.isDefined() ? translation_.toString() : "Undefined");
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+RigidTransformation RigidTransformation::Undefined()
+{
+    return {Quaternion::Undefined(), Vector3d::Undefined()};
+}
+
+RigidTransformation RigidTransformation::Identity()
+{
+    return {Quaternion::Unit(), Vector3d::Zero()};
+}
+
+RigidTransformation RigidTransformation::Translation(const Vector3d& aTranslation)
+{
+    if (!aTranslation.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Translation");
+    }
+
+    return {Quaternion::Unit(), aTranslation};
+}
+
+RigidTransformation RigidTransformation::Rotation(const Quaternion& aRotation)
+{
+    if (!aRotation.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Rotation");
+    }
+
+    return {aRotation, Vector3d::Zero()};
+}
+
+RigidTransformation RigidTransformation::Transformation(const d3::Transformation& aTransformation)
+{
+    if (!aTransformation.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Transformation");
+    }
+
+    const Matrix4d transformationMatrix = aTransformation.getMatrix();
+    const Matrix3d linearPart = transformationMatrix.topLeftCorner<3, 3>();
+
+    if ((!aTransformation.isRigid()) || (linearPart.determinant() < 0.0))
+    {
+        throw ostk::core::error::RuntimeError("Transformation is not a proper rigid transformation.");
+    }
+
+    // Inverse of RigidTransformationRotationMatrixOf
+
+    const Eigen::Quaterniond rotation = Eigen::Quaterniond(linearPart);
+
+    return {
+        Quaternion(-rotation.x(), -rotation.y(), -rotation.z(), rotation.w(), Quaternion::Format::XYZS),
+        Vector3d(transformationMatrix.topRightCorner<3, 1>())
+    };
+}
+
+RigidTransformation RigidTransformation::Interpolate(
+    const RigidTransformation& aFirstRigidTransformation,
+    const RigidTransformation& aSecondRigidTransformation,
+    const Real& aRatio
+)
+{
+    if ((!aFirstRigidTransformation.isDefined()) || (!aSecondRigidTransformation.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Rigid transformation");
+    }
+
+    const Quaternion rotation =
+        Quaternion::SLERP(aFirstRigidTransformation.getRotation(), aSecondRigidTransformation.getRotation(), aRatio);
+
+    const double ratio = aRatio;
+
+    const Vector3d translation =
+        aFirstRigidTransformation.translation_ +
+        (ratio * (aSecondRigidTransformation.translation_ - aFirstRigidTransformation.translation_));
+
+    return {rotation, translation};
+}
+
+}  // namespace transformation
+}  // namespace d3
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
@@ -0,0 +1,1051 @@
+/// Apache License 2.0
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/WKB.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace geometry
+{
+
+using ostk::core::type::Index;
+
+using Point2d = ostk::mathematics::geometry::d2::object::Point;
+using PointSet2d = ostk::mathematics::geometry::d2::object::PointSet;
+using LineString2d = ostk::mathematics::geometry::d2::object::LineString;
+using Polygon2d = ostk::mathematics::geometry::d2::object::Polygon;
+using MultiPolygon2d = ostk::mathematics::geometry::d2::object::MultiPolygon;
+using Point3d = ostk::mathematics::geometry::d3::object::Point;
+using PointSet3d = ostk::mathematics::geometry::d3::object::PointSet;
+using LineString3d = ostk::mathematics::geometry::d3::object::LineString;
+
+// Type codes, and flags of extended (EWKB) type codes
+
+static const std::uint32_t WKBPointCode = 1;
+static const std::uint32_t WKBLineStringCode = 2;
+static const std::uint32_t WKBPolygonCode = 3;
+static const std::uint32_t WKBMultiPointCode = 4;
+static const std::uint32_t WKBMultiPolygonCode = 6;
+static const std::uint32_t WKBZCodeOffset = 1000;
+
+static const std::uint32_t WKBZFlag = 0x80000000;
+static const std::uint32_t WKBMFlag = 0x40000000;
+static const std::uint32_t WKBSRIDFlag = 0x20000000;
+
+static const Size WKBHeaderByteCount = 1 + 4;
+static const Size WKBCountByteCount = 4;
+static const Size WKBCoordinateByteCount = 8;
+
+bool WKBIsLittleEndianHost()
+{
+    const std::uint16_t value = 1;
+
+    std::uint8_t firstByte;
+
+    std::memcpy(&firstByte, &value, 1);
+
+    return firstByte == 1;
+}
+
+bool WKBIsSwapped(const WKB::ByteOrder& aByteOrder)
+{
+    return (aByteOrder == WKB::ByteOrder::LittleEndian) != WKBIsLittleEndianHost();
+}
+
+// Grow buffer capacity geometrically, so that appending many geometries remains linear
+
+void WKBReserve(WKB::Buffer& aBuffer, const Size aByteCount)
+{
+    const Size requiredCapacity = aBuffer.size() + aByteCount;
+
+    if (requiredCapacity > aBuffer.capacity())
+    {
+        aBuffer.reserve(std::max(requiredCapacity, 2 * aBuffer.capacity()));
+    }
+}
+
+template <typename Value>
+void WKBAppend(WKB::Buffer& aBuffer, const Value aValue, const bool isSwapped)
+{
+    std::uint8_t bytes[sizeof(Value)];
+
+    std::memcpy(bytes, &aValue, sizeof(Value));
+
+    if (isSwapped)
+    {
+        std::reverse(bytes, bytes + sizeof(Value));
+    }
+
+    aBuffer.insert(aBuffer.end(), bytes, bytes + sizeof(Value));
+}
+
+void WKBAppendHeader(WKB::Buffer& aBuffer, const std::uint32_t aTypeCode, const bool isSwapped)
+{
+    const bool isLittleEndian = (WKBIsLittleEndianHost() != isSwapped);
+
+    aBuffer.push_back(isLittleEndian ? 1 : 0);
+
+    WKBAppend<std::uint32_t>(aBuffer, aTypeCode, isSwapped);
+}
+
+void WKBAppendCount(WKB::Buffer& aBuffer, const Size aCount, const bool isSwapped)
+{
+    if (aCount > std::numeric_limits<std::uint32_t>::max())
+    {
+        throw ostk::core::error::RuntimeError("Element count [{}] exceeds WKB limit.", aCount);
+    }
+
+    WKBAppend<std::uint32_t>(aBuffer, static_cast<std::uint32_t>(aCount), isSwapped);
+}
+
+void WKBAppendCoordinate(WKB::Buffer& aBuffer, const double aCoordinate, const bool isSwapped)
+{
+    WKBAppend<double>(aBuffer, aCoordinate, isSwapped);
+}
+
+// Coordinates of points, NaN for undefined points
+
+void WKBAppendCoordinates(WKB::Buffer& aBuffer, const Point2d& aPoint, const bool isSwapped)
+{
+    if (!aPoint.isDefined())
+    {
+        WKBAppendCoordinate(aBuffer, std::numeric_limits<double>::quiet_NaN(), isSwapped);
+        WKBAppendCoordinate(aBuffer, std::numeric_limits<double>::quiet_NaN(), isSwapped);
+
+        return;
+    }
+
+    WKBAppendCoordinate(aBuffer, aPoint.x(), isSwapped);
+    WKBAppendCoordinate(aBuffer, aPoint.y(), isSwapped);
+}
+
+void WKBAppendCoordinates(WKB::Buffer& aBuffer, const Point3d& aPoint, const bool isSwapped)
+{
+    if (!aPoint.isDefined())
+    {
+        WKBAppendCoordinate(aBuffer, std::numeric_limits<double>::quiet_NaN(), isSwapped);
+        WKBAppendCoordinate(aBuffer, std::numeric_limits<double>::quiet_NaN(), isSwapped);
+        WKBAppendCoordinate(aBuffer, std::numeric_limits<double>::quiet_NaN(), isSwapped);
+
+        return;
+    }
+
+    WKBAppendCoordinate(aBuffer, aPoint.x(), isSwapped);
+    WKBAppendCoordinate(aBuffer, aPoint.y(), isSwapped);
+    WKBAppendCoordinate(aBuffer, aPoint.z(), isSwapped);
+}
+
+// Ring, already closed
+
+void WKBAppendRing(WKB::Buffer& aBuffer, const LineString2d& aRing, const bool isSwapped)
+{
+    WKBReserve(aBuffer, WKBCountByteCount + (aRing.getPointCount() * 2 * WKBCoordinateByteCount));
+
+    WKBAppendCount(aBuffer, aRing.getPointCount(), isSwapped);
+
+    for (const Point2d& vertex : aRing)
+    {
+        WKBAppendCoordinates(aBuffer, vertex, isSwapped);
+    }
+}
+
+void WKBWrite(WKB::Buffer& aBuffer, const Point2d& aPoint, const bool isSwapped)
+{
+    WKBReserve(aBuffer, WKBHeaderByteCount + (2 * WKBCoordinateByteCount));
+
+    WKBAppendHeader(aBuffer, WKBPointCode, isSwapped);
+    WKBAppendCoordinates(aBuffer, aPoint, isSwapped);
+}
+
+void WKBWrite(WKB::Buffer& aBuffer, const Point3d& aPoint, const bool isSwapped)
+{
+    WKBReserve(aBuffer, WKBHeaderByteCount + (3 * WKBCoordinateByteCount));
+
+    WKBAppendHeader(aBuffer, WKBPointCode + WKBZCodeOffset, isSwapped);
+    WKBAppendCoordinates(aBuffer, aPoint, isSwapped);
+}
+
+void WKBWrite(WKB::Buffer& aBuffer, const PointSet2d& aPointSet, const bool isSwapped)
+{
+    WKBReserve(
+        aBuffer,
+        WKBHeaderByteCount + WKBCountByteCount +
+            (aPointSet.getSize() * (WKBHeaderByteCount + (2 * WKBCoordinateByteCount)))
+    );
+
+    WKBAppendHeader(aBuffer, WKBMultiPointCode, isSwapped);
+    WKBAppendCount(aBuffer, aPointSet.getSize(), isSwapped);
+
+    for (const Point2d& point : aPointSet)
+    {
+        WKBWrite(aBuffer, point, isSwapped);
+    }
+}
+
+void WKBWrite(WKB::Buffer& aBuffer, const PointSet3d& aPointSet, const bool isSwapped)
+{
+    WKBReserve(
+        aBuffer,
+        WKBHeaderByteCount + WKBCountByteCount +
+            (aPointSet.getSize() * (WKBHeaderByteCount + (3 * WKBCoordinateByteCount)))
+    );
+
+    WKBAppendHeader(aBuffer, WKBMultiPointCode + WKBZCodeOffset, isSwapped);
+    WKBAppendCount(aBuffer, aPointSet.getSize(), isSwapped);
+
+    for (const Point3d& point : aPointSet)
+    {
+        WKBWrite(aBuffer, point, isSwapped);
+    }
+}
+
+void WKBWrite(WKB::Buffer& aBuffer, const LineString2d& aLineString, const bool isSwapped)
+{
+    WKBReserve(
+        aBuffer, WKBHeaderByteCount + WKBCountByteCount + (aLineString.getPointCount() * 2 * WKBCoordinateByteCount)
+    );
+
+    WKBAppendHeader(aBuffer, WKBLineStringCode, isSwapped);
+    WKBAppendCount(aBuffer, aLineString.getPointCount(), isSwapped);
+
+    for (const Point2d& point : aLineString)
+    {
+        WKBAppendCoordinates(aBuffer, point, isSwapped);
+    }
+}
+
+void WKBWrite(WKB::Buffer& aBuffer, const LineString3d& aLineString, const bool isSwapped)
+{
+    WKBReserve(
+        aBuffer, WKBHeaderByteCount + WKBCountByteCount + (aLineString.getPointCount() * 3 * WKBCoordinateByteCount)
+    );
+
+    WKBAppendHeader(aBuffer, WKBLineStringCode + WKBZCodeOffset, isSwapped);
+    WKBAppendCount(aBuffer, aLineString.getPointCount(), isSwapped);
+
+    for (const Point3d& point : aLineString)
+    {
+        WKBAppendCoordinates(aBuffer, point, isSwapped);
+    }
+}
+
+void WKBWrite(WKB::Buffer& aBuffer, const Polygon2d& aPolygon, const bool isSwapped)
+{
+    WKBReserve(aBuffer, WKBHeaderByteCount + WKBCountByteCount);
+
+    WKBAppendHeader(aBuffer, WKBPolygonCode, isSwapped);
+
+    if (!aPolygon.isDefined())
+    {
+        WKBAppendCount(aBuffer, 0, isSwapped);
+
+        return;
+    }
+
+    WKBAppendCount(aBuffer, 1 + aPolygon.getInnerRingCount(), isSwapped);
+
+    WKBAppendRing(aBuffer, aPolygon.getOuterRing(), isSwapped);
+
+    for (Index innerRingIndex = 0; innerRingIndex < aPolygon.getInnerRingCount(); ++innerRingIndex)
+    {
+        WKBAppendRing(aBuffer, aPolygon.getInnerRingAt(innerRingIndex), isSwapped);
+    }
+}
+
+void WKBWrite(WKB::Buffer& aBuffer, const MultiPolygon2d& aMultiPolygon, const bool isSwapped)
+{
+    WKBReserve(aBuffer, WKBHeaderByteCount + WKBCountByteCount);
+
+    WKBAppendHeader(aBuffer, WKBMultiPolygonCode, isSwapped);
+
+    if (!aMultiPolygon.isDefined())
+    {
+        WKBAppendCount(aBuffer, 0, isSwapped);
+
+        return;
+    }
+
+    WKBAppendCount(aBuffer, aMultiPolygon.getPolygonCount(), isSwapped);
+
+    for (const Polygon2d& polygon : aMultiPolygon.getPolygons())
+    {
+        WKBWrite(aBuffer, polygon, isSwapped);
+    }
+}
+
+template <typename Geometry>
+WKB::Buffer WKBEncode(const Geometry& aGeometry, const WKB::ByteOrder& aByteOrder)
+{
+    WKB::Buffer buffer = WKB::Buffer::Empty();
+
+    WKBWrite(buffer, aGeometry, WKBIsSwapped(aByteOrder));
+
+    return buffer;
+}
+
+// Cursor over WKB bytes. The byte order is set by each geometry header.
+
+struct WKBHeader
+{
+    WKB::Type type;
+    Size dimension;
+};
+
+struct WKBDecoder
+{
+    const std::uint8_t* dataPtr;
+    Size byteCount;
+    Size offset;
+    bool isSwapped;
+
+    void require(const Size aByteCount) const
+    {
+        if (aByteCount > (byteCount - offset))
+        {
+            throw ostk::core::error::RuntimeError(
+                "WKB data truncated at offset [{}]: [{}] bytes required, [{}] left.",
+                offset,
+                aByteCount,
+                byteCount - offset
+            );
+        }
+    }
+
+    template <typename Value>
+    Value read()
+    {
+        this->require(sizeof(Value));
+
+        std::uint8_t bytes[sizeof(Value)];
+
+        std::memcpy(bytes, dataPtr + offset, sizeof(Value));
+
+        if (isSwapped)
+        {
+            std::reverse(bytes, bytes + sizeof(Value));
+        }
+
+        Value value;
+
+        std::memcpy(&value, bytes, sizeof(Value));
+
+        offset += sizeof(Value);
+
+        return value;
+    }
+
+    // Element count, checked against the remaining bytes before anything gets allocated
+
+    Size readCount(const Size aMinimumElementByteCount)
+    {
+        const Size count = this->read<std::uint32_t>();
+
+        this->require(count * aMinimumElementByteCount);
+
+        return count;
+    }
+
+    WKBHeader readHeader()
+    {
+        this->require(WKBHeaderByteCount);
+
+        const std::uint8_t byteOrder = dataPtr[offset];
+
+        if (byteOrder > 1)
+        {
+            throw ostk::core::error::RuntimeError("Wrong WKB byte order [{}] at offset [{}].", byteOrder, offset);
+        }
+
+        offset += 1;
+        isSwapped = ((byteOrder == 1) != WKBIsLittleEndianHost());
+
+        std::uint32_t typeCode = this->read<std::uint32_t>();
+
+        Size dimension = 2;
+
+        if ((typeCode & WKBMFlag) != 0)
+        {
+            throw ostk::core::error::RuntimeError("Measured WKB geometries are not supported.");
+        }
+
+        if ((typeCode & WKBZFlag) != 0)
+        {
+            dimension = 3;
+        }
+
+        if ((typeCode & WKBSRIDFlag) != 0)
+        {
+            this->read<std::uint32_t>();
+        }
+
+        typeCode &= ~(WKBZFlag | WKBMFlag | WKBSRIDFlag);
+
+        if ((typeCode / WKBZCodeOffset) == 1)
+        {
+            dimension = 3;
+        }
+        else if ((typeCode / WKBZCodeOffset) != 0)
+        {
+            throw ostk::core::error::RuntimeError("WKB type code [{}] is not supported.", typeCode);
+        }
+
+        switch (typeCode % WKBZCodeOffset)
+        {
+            case WKBPointCode:
+                return {WKB::Type::Point, dimension};
+
+            case WKBLineStringCode:
+                return {WKB::Type::LineString, dimension};
+
+            case WKBPolygonCode:
+                return {WKB::Type::Polygon, dimension};
+
+            case WKBMultiPointCode:
+                return {WKB::Type::MultiPoint, dimension};
+
+            case WKBMultiPolygonCode:
+                return {WKB::Type::MultiPolygon, dimension};
+
+            default:
+                throw ostk::core::error::RuntimeError("WKB type code [{}] is not supported.", typeCode);
+        }
+
+        return {WKB::Type::Undefined, dimension};
+    }
+
+    WKBHeader readHeader(const WKB::Type& anExpectedType, const Size anExpectedDimension)
+    {
+        const Size headerOffset = offset;
+        const WKBHeader header = this->readHeader();
+
+        if ((header.type != anExpectedType) || (header.dimension != anExpectedDimension))
+        {
+            throw ostk::core::error::RuntimeError(
+                "Expected WKB {}D [{}] at offset [{}], got {}D [{}].",
+                anExpectedDimension,
+                WKB::StringFromType(anExpectedType),
+                headerOffset,
+                header.dimension,
+                WKB::StringFromType(header.type)
+            );
+        }
+
+        return header;
+    }
+
+    Point2d readCoordinates2d()
+    {
+        const double x = this->read<double>();
+        const double y = this->read<double>();
+
+        if (std::isnan(x) || std::isnan(y))
+        {
+            return Point2d::Undefined();
+        }
+
+        return {x, y};
+    }
+
+    Point3d readCoordinates3d()
+    {
+        const double x = this->read<double>();
+        const double y = this->read<double>();
+        const double z = this->read<double>();
+
+        if (std::isnan(x) || std::isnan(y) || std::isnan(z))
+        {
+            return Point3d::Undefined();
+        }
+
+        return {x, y, z};
+    }
+
+    Array<Point2d> readPoints2d()
+    {
+        const Size pointCount = this->readCount(2 * WKBCoordinateByteCount);
+
+        Array<Point2d> points = Array<Point2d>::Empty();
+
+        points.reserve(pointCount);
+
+        for (Index pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+        {
+            points.add(this->readCoordinates2d());
+        }
+
+        return points;
+    }
+
+    Array<Point3d> readPoints3d()
+    {
+        const Size pointCount = this->readCount(3 * WKBCoordinateByteCount);
+
+        Array<Point3d> points = Array<Point3d>::Empty();
+
+        points.reserve(pointCount);
+
+        for (Index pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+        {
+            points.add(this->readCoordinates3d());
+        }
+
+        return points;
+    }
+
+    // Ring vertices, without closing point
+
+    Array<Point2d> readRing()
+    {
+        Array<Point2d> vertices = this->readPoints2d();
+
+        if ((vertices.getSize() > 1) && (vertices.accessFirst() == vertices.accessLast()))
+        {
+            vertices.pop_back();
+        }
+
+        return vertices;
+    }
+
+    Point2d readPoint2d()
+    {
+        this->readHeader(WKB::Type::Point, 2);
+
+        return this->readCoordinates2d();
+    }
+
+    Point3d readPoint3d()
+    {
+        this->readHeader(WKB::Type::Point, 3);
+
+        return this->readCoordinates3d();
+    }
+
+    PointSet2d readPointSet2d()
+    {
+        this->readHeader(WKB::Type::MultiPoint, 2);
+
+        const Size pointCount = this->readCount(WKBHeaderByteCount + (2 * WKBCoordinateByteCount));
+
+        Array<Point2d> points = Array<Point2d>::Empty();
+
+        points.reserve(pointCount);
+
+        for (Index pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+        {
+            points.add(this->readPoint2d());
+        }
+
+        return {points};
+    }
+
+    PointSet3d readPointSet3d()
+    {
+        this->readHeader(WKB::Type::MultiPoint, 3);
+
+        const Size pointCount = this->readCount(WKBHeaderByteCount + (3 * WKBCoordinateByteCount));
+
+        Array<Point3d> points = Array<Point3d>::Empty();
+
+        points.reserve(pointCount);
+
+        for (Index pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+        {
+            points.add(this->readPoint3d());
+        }
+
+        return {points};
+    }
+
+    LineString2d readLineString2d()
+    {
+        this->readHeader(WKB::Type::LineString, 2);
+
+        return {this->readPoints2d()};
+    }
+
+    LineString3d readLineString3d()
+    {
+        this->readHeader(WKB::Type::LineString, 3);
+
+        return {this->readPoints3d()};
+    }
+
+    Polygon2d readPolygonBody()
+    {
+        const Size ringCount = this->readCount(WKBCountByteCount);
+
+        if (ringCount == 0)
+        {
+            return Polygon2d::Undefined();
+        }
+
+        const Array<Point2d> outerRing = this->readRing();
+
+        Array<Array<Point2d>> innerRings = Array<Array<Point2d>>::Empty();
+
+        innerRings.reserve(ringCount - 1);
+
+        for (Index ringIndex = 1; ringIndex < ringCount; ++ringIndex)
+        {
+            innerRings.add(this->readRing());
+        }
+
+        return {outerRing, innerRings};
+    }
+
+    Polygon2d readPolygon2d()
+    {
+        this->readHeader(WKB::Type::Polygon, 2);
+
+        return this->readPolygonBody();
+    }
+
+    MultiPolygon2d readMultiPolygon2d()
+    {
+        const Size headerOffset = offset;
+        const WKBHeader header = this->readHeader();
+
+        if ((header.type == WKB::Type::Polygon) && (header.dimension == 2))
+        {
+            const Polygon2d polygon = this->readPolygonBody();
+
+            return polygon.isDefined() ? MultiPolygon2d::Polygon(polygon) : MultiPolygon2d::Undefined();
+        }
+
+        offset = headerOffset;
+
+        this->readHeader(WKB::Type::MultiPolygon, 2);
+
+        const Size polygonCount = this->readCount(WKBHeaderByteCount + WKBCountByteCount);
+
+        Array<Polygon2d> polygons = Array<Polygon2d>::Empty();
+
+        polygons.reserve(polygonCount);
+
+        for (Index polygonIndex = 0; polygonIndex < polygonCount; ++polygonIndex)
+        {
+            polygons.add(this->readPolygon2d());
+        }
+
+        return {polygons};
+    }
+
+    void skip()
+    {
+        const WKBHeader header = this->readHeader();
+
+        const Size pointByteCount = header.dimension * WKBCoordinateByteCount;
+
+        switch (header.type)
+        {
+            case WKB::Type::Point:
+                this->require(pointByteCount);
+                offset += pointByteCount;
+                break;
+
+            case WKB::Type::LineString:
+                offset += this->readCount(pointByteCount) * pointByteCount;
+                break;
+
+            case WKB::Type::Polygon:
+            {
+                const Size ringCount = this->readCount(WKBCountByteCount);
+
+                for (Index ringIndex = 0; ringIndex < ringCount; ++ringIndex)
+                {
+                    offset += this->readCount(pointByteCount) * pointByteCount;
+                }
+
+                break;
+            }
+
+            case WKB::Type::MultiPoint:
+            case WKB::Type::MultiPolygon:
+            {
+                const Size geometryCount = this->readCount(WKBHeaderByteCount);
+
+                for (Index geometryIndex = 0; geometryIndex < geometryCount; ++geometryIndex)
+                {
+                    this->skip();
+                }
+
+                break;
+            }
+
+            default:
+                throw ostk::core::error::runtime::Wrong("Type");
+        }
+    }
+};
+
+WKB::Writer::Writer(const WKB::ByteOrder& aByteOrder)
+    : byteOrder_(aByteOrder),
+      buffer_(WKB::Buffer::Empty())
+{
+}
+
+const WKB::Buffer& WKB::Writer::accessBuffer() const
+{
+    return buffer_;
+}
+
+WKB::Buffer WKB::Writer::getBuffer() const
+{
+    return buffer_;
+}
+
+void WKB::Writer::reserve(const Size& aByteCount)
+{
+    buffer_.reserve(aByteCount);
+}
+
+void WKB::Writer::write(const Point2d& aPoint)
+{
+    WKBWrite(buffer_, aPoint, WKBIsSwapped(byteOrder_));
+}
+
+void WKB::Writer::write(const PointSet2d& aPointSet)
+{
+    WKBWrite(buffer_, aPointSet, WKBIsSwapped(byteOrder_));
+}
+
+void WKB::Writer::write(const LineString2d& aLineString)
+{
+    WKBWrite(buffer_, aLineString, WKBIsSwapped(byteOrder_));
+}
+
+void WKB::Writer::write(const Polygon2d& aPolygon)
+{
+    WKBWrite(buffer_, aPolygon, WKBIsSwapped(byteOrder_));
+}
+
+void WKB::Writer::write(const MultiPolygon2d& aMultiPolygon)
+{
+    WKBWrite(buffer_, aMultiPolygon, WKBIsSwapped(byteOrder_));
+}
+
+void WKB::Writer::write(const Point3d& aPoint)
+{
+    WKBWrite(buffer_, aPoint, WKBIsSwapped(byteOrder_));
+}
+
+void WKB::Writer::write(const PointSet3d& aPointSet)
+{
+    WKBWrite(buffer_, aPointSet, WKBIsSwapped(byteOrder_));
+}
+
+void WKB::Writer::write(const LineString3d& aLineString)
+{
+    WKBWrite(buffer_, aLineString, WKBIsSwapped(byteOrder_));
+}
+
+void WKB::Writer::clear()
+{
+    buffer_.clear();
+}
+
+WKB::Reader::Reader(const std::uint8_t* aDataPtr, const Size& aByteCount)
+    : Reader(nullptr, aDataPtr, aByteCount)
+{
+}
+
+WKB::Reader::Reader(const WKB::Buffer& aBuffer)
+    : Reader(nullptr, aBuffer.data(), aBuffer.size())
+{
+}
+
+WKB::Reader::Reader(WKB::Buffer&& aBuffer)
+    : Reader(nullptr, nullptr, 0)
+{
+    const Shared<const WKB::Buffer> bufferSPtr = std::make_shared<const WKB::Buffer>(std::move(aBuffer));
+
+    storageSPtr_ = bufferSPtr;
+    dataPtr_ = bufferSPtr->data();
+    byteCount_ = bufferSPtr->size();
+}
+
+bool WKB::Reader::isEnd() const
+{
+    return offset_ >= byteCount_;
+}
+
+Size WKB::Reader::getOffset() const
+{
+    return offset_;
+}
+
+Size WKB::Reader::getByteCount() const
+{
+    return byteCount_;
+}
+
+WKB::Type WKB::Reader::getNextType() const
+{
+    WKBDecoder decoder = {dataPtr_, byteCount_, offset_, false};
+
+    return decoder.readHeader().type;
+}
+
+Size WKB::Reader::getNextDimension() const
+{
+    WKBDecoder decoder = {dataPtr_, byteCount_, offset_, false};
+
+    return decoder.readHeader().dimension;
+}
+
+Point2d WKB::Reader::readPoint2d()
+{
+    WKBDecoder decoder = {dataPtr_, byteCount_, offset_, false};
+
+    const Point2d point = decoder.readPoint2d();
+
+    offset_ = decoder.offset;
+
+    return point;
+}
+
+PointSet2d WKB::Reader::readPointSet2d()
+{
+    WKBDecoder decoder = {dataPtr_, byteCount_, offset_, false};
+
+    const PointSet2d pointSet = decoder.readPointSet2d();
+
+    offset_ = decoder.offset;
+
+    return pointSet;
+}
+
+LineString2d WKB::Reader::readLineString2d()
+{
+    WKBDecoder decoder = {dataPtr_, byteCount_, offset_, false};
+
+    const LineString2d lineString = decoder.readLineString2d();
+
+    offset_ = decoder.offset;
+
+    return lineString;
+}
+
+Polygon2d WKB::Reader::readPolygon2d()
+{
+    WKBDecoder decoder = {dataPtr_, byteCount_, offset_, false};
+
+    const Polygon2d polygon = decoder.readPolygon2d();
+
+    offset_ = decoder.offset;
+
+    return polygon;
+}
+
+MultiPolygon2d WKB::Reader::readMultiPolygon2d()
+{
+    WKBDecoder decoder = {dataPtr_, byteCount_, offset_, false};
+
+    const MultiPolygon2d multiPolygon = decoder.readMultiPolygon2d();
+
+    offset_ = decoder.offset;
+
+    return multiPolygon;
+}
+
+Point3d WKB::Reader::readPoint3d()
+{
+    WKBDecoder decoder = {dataPtr_, byteCount_, offset_, false};
+
+    const Point3d point = decoder.readPoint3d();
+
+    offset_ = decoder.offset;
+
+    return point;
+}
+
+PointSet3d WKB::Reader::readPointSet3d()
+{
+    WKBDecoder decoder = {dataPtr_, byteCount_, offset_, false};
+
+    const PointSet3d pointSet = decoder.readPointSet3d();
+
+    offset_ = decoder.offset;
+
+    return pointSet;
+}
+
+LineString3d WKB::Reader::readLineString3d()
+{
+    WKBDecoder decoder = {dataPtr_, byteCount_, offset_, false};
+
+    const LineString3d lineString = decoder.readLineString3d();
+
+    offset_ = decoder.offset;
+
+    return lineString;
+}
+
+void WKB::Reader::skip()
+{
+    WKBDecoder decoder = {dataPtr_, byteCount_, offset_, false};
+
+    decoder.skip();
+
+    offset_ = decoder.offset;
+}
+
+void WKB::Reader::rewind()
+{
+    offset_ = 0;
+}
+
+WKB::Reader WKB::Reader::Map(const File& aFile)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    const std::string filePath = aFile.getPath().toString();
+
+    const int fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+
+    if (fileDescriptor < 0)
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", filePath);
+    }
+
+    struct stat fileStatus;
+
+    if (::fstat(fileDescriptor, &fileStatus) != 0)
+    {
+        ::close(fileDescriptor);
+
+        throw ostk::core::error::RuntimeError("Cannot read status of file [{}].", filePath);
+    }
+
+    const Size byteCount = static_cast<Size>(fileStatus.st_size);
+
+    if (byteCount == 0)
+    {
+        ::close(fileDescriptor);
+
+        return {nullptr, nullptr, 0};
+    }
+
+    void* mappingPtr = ::mmap(nullptr, byteCount, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+    // The mapping stays valid once the file descriptor is closed
+
+    ::close(fileDescriptor);
+
+    if (mappingPtr == MAP_FAILED)
+    {
+        throw ostk::core::error::RuntimeError("Cannot map file [{}].", filePath);
+    }
+
+    ::madvise(mappingPtr, byteCount, MADV_SEQUENTIAL);
+
+    const Shared<const void> mappingSPtr = Shared<const void>(
+        mappingPtr,
+        [byteCount](const void* aMappingPtr) -> void
+        {
+            ::munmap(const_cast<void*>(aMappingPtr), byteCount);
+        }
+    );
+
+    return {mappingSPtr, static_cast<const std::uint8_t*>(mappingPtr), byteCount};
+}
+
+WKB::Reader::Reader(const Shared<const void>& aStorageSPtr, const std::uint8_t* aDataPtr, const Size& aByteCount)
+    : storageSPtr_(aStorageSPtr),
+      dataPtr_(aDataPtr),
+      byteCount_(aByteCount),
+      offset_(0)
+{
+}
+
+WKB::Buffer WKB::Encode(const Point2d& aPoint, const WKB::ByteOrder& aByteOrder)
+{
+    return WKBEncode(aPoint, aByteOrder);
+}
+
+WKB::Buffer WKB::Encode(const PointSet2d& aPointSet, const WKB::ByteOrder& aByteOrder)
+{
+    return WKBEncode(aPointSet, aByteOrder);
+}
+
+WKB::Buffer WKB::Encode(const LineString2d& aLineString, const WKB::ByteOrder& aByteOrder)
+{
+    return WKBEncode(aLineString, aByteOrder);
+}
+
+WKB::Buffer WKB::Encode(const Polygon2d& aPolygon, const WKB::ByteOrder& aByteOrder)
+{
+    return WKBEncode(aPolygon, aByteOrder);
+}
+
+WKB::Buffer WKB::Encode(const MultiPolygon2d& aMultiPolygon, const WKB::ByteOrder& aByteOrder)
+{
+    return WKBEncode(aMultiPolygon, aByteOrder);
+}
+
+WKB::Buffer WKB::Encode(const Point3d& aPoint, const WKB::ByteOrder& aByteOrder)
+{
+    return WKBEncode(aPoint, aByteOrder);
+}
+
+WKB::Buffer WKB::Encode(const PointSet3d& aPointSet, const WKB::ByteOrder& aByteOrder)
+{
+    return WKBEncode(aPointSet, aByteOrder);
+}
+
+WKB::Buffer WKB::Encode(const LineString3d& aLineString, const WKB::ByteOrder& aByteOrder)
+{
+    return WKBEncode(aLineString, aByteOrder);
+}
+
+String WKB::StringFromType(const WKB::Type& aType)
+{
+    switch (aType)
+    {
+        case WKB::Type::Undefined:
+            return "Undefined";
+
+        case WKB::Type::Point:
+            return "Point";
+
+        case WKB::Type::LineString:
+            return "LineString";
+
+        case WKB::Type::Polygon:
+            return "Polygon";
+
+        case WKB::Type::MultiPoint:
+            return "MultiPoint";
+
+        case WKB::Type::MultiPolygon:
+            return "MultiPolygon";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Type");
+            break;
+    }
+
+    return String::Empty();
+}
+
+}  // namespace geometry
+}  // namespace mathematics
+}  // namespace ostk
@@ -5,6 +5,7 @@
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/IntervalSet.hpp>
 
 namespace ostk
 {
@@ -15,6 +16,9 @@ namespace object
 
 using ostk::core::type::Size;
 
+template <class T>
+class IntervalSet;
+
 template <class T>
 Interval<T>::Interval(const T& aLowerBound, const T& anUpperBound, const Interval::Type& anIntervalType)
     : type_(anIntervalType),
@@ -373,9 +377,37 @@ template <class T>
 template <class U>
 ctnr::Array<T> Interval<T>::generateArrayWithStep(const U& aStep) const
 {
-    using ostk::core::type::Index;
-    using ostk::core::type::Size;
+    ctnr::Array<T> grid = ctnr::Array<T>::Empty();
+
+    for (const T& value : this->generateRangeWithStep(aStep))
+    {
+        grid.add(value);
+    }
 
+    return grid;
+}
+
+template <class T>
+ctnr::Array<T> Interval<T>::generateArrayWithSize(const types::Size& anArraySize) const
+{
+    const SizeRange range = this->generateRangeWithSize(anArraySize);
+
+    ctnr::Array<T> array = ctnr::Array<T>::Empty();
+
+    array.reserve(range.getSize());
+
+    for (const T& value : range)
+    {
+        array.add(value);
+    }
+
+    return array;
+}
+
+template <class T>
+template <class U>
+typename Interval<T>::template StepRange<U> Interval<T>::generateRangeWithStep(const U& aStep) const
+{
     if (!this->isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Interval");
@@ -391,58 +423,44 @@ ctnr::Array<T> Interval<T>::generateArrayWithStep(const U& aStep) const
         throw ostk::core::error::RuntimeError("Step is zero.");
     }
 
-    ctnr::Array<T> grid = ctnr::Array<T>::Empty();
-
     if (aStep.isPositive())
     {
-        T value = this->accessLowerBound();
+        T firstValue = this->accessLowerBound();
 
         if ((type_ == Interval<T>::Type::Open) || (type_ == Interval<T>::Type::HalfOpenLeft))
         {
-            value += aStep;
-        }
-
-        while (value < this->accessUpperBound())
-        {
-            grid.add(value);
-
-            value += aStep;
+            firstValue += aStep;
         }
 
-        if ((type_ == Interval<T>::Type::Closed) || (type_ == Interval<T>::Type::HalfOpenLeft))
-        {
-            grid.add(this->accessUpperBound());
-        }
+        return StepRange<U>(
+            firstValue,
+            aStep,
+            this->accessUpperBound(),
+            true,
+            (type_ == Interval<T>::Type::Closed) || (type_ == Interval<T>::Type::HalfOpenLeft)
+        );
     }
-    else
-    {
-        T value = this->accessUpperBound();
-
-        if ((type_ == Interval<T>::Type::Open) || (type_ == Interval<T>::Type::HalfOpenRight))
-        {
-            value += aStep;
-        }
-
-        while (value > this->accessLowerBound())
-        {
-            grid.add(value);
 
-            value += aStep;
-        }
+    T firstValue = this->accessUpperBound();
 
-        if ((type_ == Interval<T>::Type::Closed) || (type_ == Interval<T>::Type::HalfOpenRight))
-        {
-            grid.add(this->accessLowerBound());
-        }
+    if ((type_ == Interval<T>::Type::Open) || (type_ == Interval<T>::Type::HalfOpenRight))
+    {
+        firstValue += aStep;
     }
 
-    return grid;
+    return StepRange<U>(
+        firstValue,
+        aStep,
+        this->accessLowerBound(),
+        false,
+        (type_ == Interval<T>::Type::Closed) || (type_ == Interval<T>::Type::HalfOpenRight)
+    );
 }
 
 template <class T>
-ctnr::Array<T> Interval<T>::generateArrayWithSize(const types::Size& anArraySize) const
+typename Interval<T>::SizeRange Interval<T>::generateRangeWithSize(const types::Size& aSize) const
 {
-    if (anArraySize < 2)
+    if (aSize < 2)
     {
         throw ostk::core::error::runtime::Wrong("Array size");
     }
@@ -453,22 +471,22 @@ ctnr::Array<T> Interval<T>::generateArrayWithSize(const types::Size& anArraySize
     switch (type_)
     {
         case Interval<T>::Type::Closed:
-            step = (this->accessUpperBound() - this->accessLowerBound()) / static_cast<T>(anArraySize - 1);
+            step = (this->accessUpperBound() - this->accessLowerBound()) / static_cast<T>(aSize - 1);
             value = this->accessLowerBound();
             break;
 
         case Interval<T>::Type::Open:
-            step = (this->accessUpperBound() - this->accessLowerBound()) / static_cast<T>(anArraySize + 1);
+            step = (this->accessUpperBound() - this->accessLowerBound()) / static_cast<T>(aSize + 1);
             value = this->accessLowerBound() + step;
             break;
 
         case Interval<T>::Type::HalfOpenLeft:
-            step = (this->accessUpperBound() - this->accessLowerBound()) / static_cast<T>(anArraySize);
+            step = (this->accessUpperBound() - this->accessLowerBound()) / static_cast<T>(aSize);
             value = this->accessLowerBound() + step;
             break;
 
         case Interval<T>::Type::HalfOpenRight:
-            step = (this->accessUpperBound() - this->accessLowerBound()) / static_cast<T>(anArraySize);
+            step = (this->accessUpperBound() - this->accessLowerBound()) / static_cast<T>(aSize);
             value = this->accessLowerBound();
             break;
 
@@ -477,16 +495,7 @@ ctnr::Array<T> Interval<T>::generateArrayWithSize(const types::Size& anArraySize
             break;
     }
 
-    ctnr::Array<T> array(anArraySize, T::Undefined());
-
-    typename ctnr::Array<T>::Iterator arrayIt;
-
-    for (arrayIt = array.begin(); arrayIt != array.end(); ++arrayIt, value += step)
-    {
-        *arrayIt = value;
-    }
-
-    return array;
+    return SizeRange(value, step, aSize);
 }
 
 template <class T>
@@ -654,33 +663,7 @@ ctnr::Array<Interval<T>> Interval<T>::Sort(
 template <class T>
 ctnr::Array<Interval<T>> Interval<T>::Merge(const ctnr::Array<Interval<T>>& anIntervalArray)
 {
-    if (anIntervalArray.empty())
-    {
-        return {};
-    }
-
-    ctnr::Array<Interval<T>> sorted = Interval<T>::Sort(anIntervalArray);
-
-    ctnr::Array<Interval<T>> merged;
-    Interval<T> nextUnion = sorted[0];
-
-    for (Size i = 1; i < sorted.size(); ++i)
-    {
-        auto checkUnion = nextUnion.getUnionWith(sorted[i]);
-        if (checkUnion.isDefined())
-        {
-            nextUnion = checkUnion;
-        }
-        else
-        {
-            merged.add(nextUnion);
-            nextUnion = sorted[i];
-        }
-    }
-
-    merged.add(nextUnion);
-
-    return merged;
+    return IntervalSet<T>(anIntervalArray).getIntervals();
 }
 
 template <class T>
@@ -688,91 +671,7 @@ ctnr::Array<Interval<T>> Interval<T>::GetGaps(
     const ctnr::Array<Interval<T>>& anIntervalArray, const Interval<T>& anInterval
 )
 {
-    ctnr::Array<Interval<T>> sanitized = Interval<T>::Merge(anIntervalArray);
-    if (anInterval.isDefined())
-    {
-        sanitized = Interval<T>::Clip(sanitized, anInterval);
-    }
-
-    if (sanitized.size() == 0)
-    {
-        if (anInterval.isDefined())
-        {
-            return {anInterval};
-        }
-        return {};
-    }
-
-    ctnr::Array<Interval<T>> gaps;
-
-    // Deal with potential leading gap
-    if (anInterval.isDefined() && sanitized[0].lowerBound_ > anInterval.lowerBound_)
-    {
-        const Interval<T> upperInterval = sanitized[0];
-        const T lowerBound = anInterval.lowerBound_;
-        const T upperBound = upperInterval.lowerBound_;
-
-        bool openLowerBound = true;
-        if (anInterval.type_ == Interval<T>::Type::Closed || anInterval.type_ == Interval<T>::Type::HalfOpenRight)
-        {
-            openLowerBound = false;
-        }
-
-        bool openUpperBound = false;
-        if (upperInterval.type_ == Interval<T>::Type::Closed || upperInterval.type_ == Interval<T>::Type::HalfOpenRight)
-        {
-            openUpperBound = true;
-        }
-
-        gaps.add(Interval<T>::buildInterval(lowerBound, openLowerBound, upperBound, openUpperBound));
-    }
-
-    // Deal with intermediate gaps
-    for (Size i = 1; i < sanitized.size(); ++i)
-    {
-        const Interval<T> lowerInterval = sanitized[i - 1];
-        const Interval<T> upperInterval = sanitized[i];
-        const T lowerBound = lowerInterval.upperBound_;
-        const T upperBound = upperInterval.lowerBound_;
-
-        bool openLowerBound = false;
-        if (lowerInterval.type_ == Interval<T>::Type::Closed || lowerInterval.type_ == Interval<T>::Type::HalfOpenLeft)
-        {
-            openLowerBound = true;
-        }
-
-        bool openUpperBound = false;
-        if (upperInterval.type_ == Interval<T>::Type::Closed || upperInterval.type_ == Interval<T>::Type::HalfOpenRight)
-        {
-            openUpperBound = true;
-        }
-
-        gaps.add(Interval<T>::buildInterval(lowerBound, openLowerBound, upperBound, openUpperBound));
-    }
-
-    // Deal with potential trailing gap
-    if (anInterval.isDefined() && sanitized[sanitized.size() - 1].upperBound_ < anInterval.upperBound_)
-    {
-        const Interval<T> lowerInterval = sanitized[sanitized.size() - 1];
-        const T lowerBound = lowerInterval.upperBound_;
-        const T upperBound = anInterval.upperBound_;
-
-        bool openLowerBound = false;
-        if (lowerInterval.type_ == Interval<T>::Type::Closed || lowerInterval.type_ == Interval<T>::Type::HalfOpenLeft)
-        {
-            openLowerBound = true;
-        }
-
-        bool openUpperBound = true;
-        if (anInterval.type_ == Interval<T>::Type::Closed || anInterval.type_ == Interval<T>::Type::HalfOpenLeft)
-        {
-            openUpperBound = false;
-        }
-
-        gaps.add(Interval<T>::buildInterval(lowerBound, openLowerBound, upperBound, openUpperBound));
-    }
-
-    return gaps;
+    return IntervalSet<T>(anIntervalArray).getGaps(anInterval).getIntervals();
 }
 
 template <class T>
@@ -780,19 +679,7 @@ ctnr::Array<Interval<T>> Interval<T>::LogicalOr(
     const ctnr::Array<Interval<T>>& anIntervalArray, const ctnr::Array<Interval<T>>& anotherIntervalArray
 )
 {
-    ctnr::Array<Interval<T>> array;
-
-    for (Size i = 0; i < anIntervalArray.size(); ++i)
-    {
-        array.add(anIntervalArray[i]);
-    }
-
-    for (Size i = 0; i < anotherIntervalArray.size(); ++i)
-    {
-        array.add(anotherIntervalArray[i]);
-    }
-
-    return Interval<T>::Merge(array);
+    return IntervalSet<T>(anIntervalArray).getUnionWith(IntervalSet<T>(anotherIntervalArray)).getIntervals();
 }
 
 template <class T>
@@ -800,95 +687,7 @@ ctnr::Array<Interval<T>> Interval<T>::LogicalAnd(
     const ctnr::Array<Interval<T>>& anIntervalArray, const ctnr::Array<Interval<T>>& anotherIntervalArray
 )
 {
-    const ctnr::Array<Interval<T>> aSanitizedArray = Interval<T>::Merge(anIntervalArray);
-    const ctnr::Array<Interval<T>> anotherSanitizedArray = Interval<T>::Merge(anotherIntervalArray);
-
-    if (aSanitizedArray.size() == 0 or anotherSanitizedArray.size() == 0)
-    {
-        return {};
-    }
-
-    // Determine Span lower bound
-    bool openLowerBound = true;
-    T lowerBound = aSanitizedArray[0].lowerBound_;
-
-    if (aSanitizedArray[0].lowerBound_ < anotherSanitizedArray[0].lowerBound_)
-    {
-        if (aSanitizedArray[0].type_ == Interval<T>::Type::Closed ||
-            aSanitizedArray[0].type_ == Interval<T>::Type::HalfOpenRight)
-        {
-            openLowerBound = false;
-        }
-    }
-
-    else if (aSanitizedArray[0].lowerBound_ > anotherSanitizedArray[0].lowerBound_)
-    {
-        lowerBound = anotherSanitizedArray[0].lowerBound_;
-
-        if (anotherSanitizedArray[0].type_ == Interval<T>::Type::Closed ||
-            anotherSanitizedArray[0].type_ == Interval<T>::Type::HalfOpenRight)
-        {
-            openLowerBound = false;
-        }
-    }
-
-    else
-    {
-        if ((aSanitizedArray[0].type_ == Interval<T>::Type::Closed ||
-             aSanitizedArray[0].type_ == Interval<T>::Type::HalfOpenRight) &&
-            (anotherSanitizedArray[0].type_ == Interval<T>::Type::Closed ||
-             anotherSanitizedArray[0].type_ == Interval<T>::Type::HalfOpenRight))
-        {
-            openLowerBound = false;
-        }
-    }
-
-    // Determine Span upper bound
-    bool openUpperBound = true;
-    T upperBound = aSanitizedArray[aSanitizedArray.size() - 1].upperBound_;
-    ;
-
-    if (aSanitizedArray[aSanitizedArray.size() - 1].upperBound_ >
-        anotherSanitizedArray[anotherSanitizedArray.size() - 1].upperBound_)
-    {
-        if (aSanitizedArray[aSanitizedArray.size() - 1].type_ == Interval<T>::Type::Closed ||
-            aSanitizedArray[aSanitizedArray.size() - 1].type_ == Interval<T>::Type::HalfOpenLeft)
-        {
-            openUpperBound = false;
-        }
-    }
-
-    else if (aSanitizedArray[aSanitizedArray.size() - 1].upperBound_ <
-             anotherSanitizedArray[anotherSanitizedArray.size() - 1].upperBound_)
-    {
-        upperBound = anotherSanitizedArray[anotherSanitizedArray.size() - 1].upperBound_;
-
-        if (anotherSanitizedArray[anotherSanitizedArray.size() - 1].type_ == Interval<T>::Type::Closed ||
-            anotherSanitizedArray[anotherSanitizedArray.size() - 1].type_ == Interval<T>::Type::HalfOpenLeft)
-        {
-            openUpperBound = false;
-        }
-    }
-
-    else
-    {
-        if ((aSanitizedArray[aSanitizedArray.size() - 1].type_ == Interval<T>::Type::Closed ||
-             aSanitizedArray[aSanitizedArray.size() - 1].type_ == Interval<T>::Type::HalfOpenLeft) &&
-            (anotherSanitizedArray[anotherSanitizedArray.size() - 1].type_ == Interval<T>::Type::Closed ||
-             anotherSanitizedArray[anotherSanitizedArray.size() - 1].type_ == Interval<T>::Type::HalfOpenLeft))
-        {
-            openUpperBound = false;
-        }
-    }
-
-    const Interval<T> span = Interval<T>::buildInterval(lowerBound, openLowerBound, upperBound, openUpperBound);
-
-    return Interval<T>::GetGaps(
-        Interval<T>::LogicalOr(
-            Interval<T>::GetGaps(aSanitizedArray, span), Interval<T>::GetGaps(anotherSanitizedArray, span)
-        ),
-        span
-    );
+    return IntervalSet<T>(anIntervalArray).getIntersectionWith(IntervalSet<T>(anotherIntervalArray)).getIntervals();
 }
 
 //                                 template <class T>
@@ -1004,6 +803,235 @@ Interval<T> Interval<T>::buildInterval(
     return Interval<T>::Closed(lowerBound, upperBound);
 }
 
+template <class T>
+template <class U>
+Interval<T>::StepRange<U>::ConstIterator::ConstIterator()
+    : rangePtr_(nullptr),
+      value_(T::Undefined()),
+      index_(0),
+      isBound_(false),
+      isEnd_(true)
+{
+}
+
+template <class T>
+template <class U>
+bool Interval<T>::StepRange<U>::ConstIterator::operator==(const ConstIterator& anIterator) const
+{
+    if (isEnd_ || anIterator.isEnd_)
+    {
+        return isEnd_ == anIterator.isEnd_;
+    }
+
+    return (rangePtr_ == anIterator.rangePtr_) && (index_ == anIterator.index_);
+}
+
+template <class T>
+template <class U>
+bool Interval<T>::StepRange<U>::ConstIterator::operator!=(const ConstIterator& anIterator) const
+{
+    return !((*this) == anIterator);
+}
+
+template <class T>
+template <class U>
+const T& Interval<T>::StepRange<U>::ConstIterator::operator*() const
+{
+    return value_;
+}
+
+template <class T>
+template <class U>
+const T* Interval<T>::StepRange<U>::ConstIterator::operator->() const
+{
+    return &value_;
+}
+
+template <class T>
+template <class U>
+typename Interval<T>::template StepRange<U>::ConstIterator& Interval<T>::StepRange<U>::ConstIterator::operator++()
+{
+    ++index_;
+
+    if (isBound_)
+    {
+        isEnd_ = true;
+
+        return *this;
+    }
+
+    value_ += rangePtr_->step_;
+
+    if (rangePtr_->isBeyondBound(value_))
+    {
+        if (rangePtr_->includesBound_)
+        {
+            value_ = rangePtr_->bound_;
+            isBound_ = true;
+        }
+        else
+        {
+            isEnd_ = true;
+        }
+    }
+
+    return *this;
+}
+
+template <class T>
+template <class U>
+typename Interval<T>::template StepRange<U>::ConstIterator Interval<T>::StepRange<U>::ConstIterator::operator++(int)
+{
+    const ConstIterator iterator = *this;
+
+    ++(*this);
+
+    return iterator;
+}
+
+template <class T>
+template <class U>
+Interval<T>::StepRange<U>::ConstIterator::ConstIterator(const StepRange* aRangePtr)
+    : rangePtr_(aRangePtr),
+      value_(aRangePtr->firstValue_),
+      index_(0),
+      isBound_(false),
+      isEnd_(false)
+{
+    if (rangePtr_->isBeyondBound(value_))
+    {
+        if (rangePtr_->includesBound_)
+        {
+            value_ = rangePtr_->bound_;
+            isBound_ = true;
+        }
+        else
+        {
+            isEnd_ = true;
+        }
+    }
+}
+
+template <class T>
+template <class U>
+typename Interval<T>::template StepRange<U>::ConstIterator Interval<T>::StepRange<U>::begin() const
+{
+    return ConstIterator(this);
+}
+
+template <class T>
+template <class U>
+typename Interval<T>::template StepRange<U>::ConstIterator Interval<T>::StepRange<U>::end() const
+{
+    return ConstIterator();
+}
+
+template <class T>
+template <class U>
+Interval<T>::StepRange<U>::StepRange(
+    const T& aFirstValue, const U& aStep, const T& aBound, const bool isAscending, const bool includesBound
+)
+    : firstValue_(aFirstValue),
+      step_(aStep),
+      bound_(aBound),
+      isAscending_(isAscending),
+      includesBound_(includesBound)
+{
+}
+
+template <class T>
+template <class U>
+bool Interval<T>::StepRange<U>::isBeyondBound(const T& aValue) const
+{
+    return isAscending_ ? !(aValue < bound_) : !(aValue > bound_);
+}
+
+template <class T>
+Interval<T>::SizeRange::ConstIterator::ConstIterator()
+    : rangePtr_(nullptr),
+      value_(T::Undefined()),
+      index_(0)
+{
+}
+
+template <class T>
+bool Interval<T>::SizeRange::ConstIterator::operator==(const ConstIterator& anIterator) const
+{
+    return (rangePtr_ == anIterator.rangePtr_) && (index_ == anIterator.index_);
+}
+
+template <class T>
+bool Interval<T>::SizeRange::ConstIterator::operator!=(const ConstIterator& anIterator) const
+{
+    return !((*this) == anIterator);
+}
+
+template <class T>
+const T& Interval<T>::SizeRange::ConstIterator::operator*() const
+{
+    return value_;
+}
+
+template <class T>
+const T* Interval<T>::SizeRange::ConstIterator::operator->() const
+{
+    return &value_;
+}
+
+template <class T>
+typename Interval<T>::SizeRange::ConstIterator& Interval<T>::SizeRange::ConstIterator::operator++()
+{
+    ++index_;
+
+    value_ += rangePtr_->step_;
+
+    return *this;
+}
+
+template <class T>
+typename Interval<T>::SizeRange::ConstIterator Interval<T>::SizeRange::ConstIterator::operator++(int)
+{
+    const ConstIterator iterator = *this;
+
+    ++(*this);
+
+    return iterator;
+}
+
+template <class T>
+Interval<T>::SizeRange::ConstIterator::ConstIterator(const SizeRange* aRangePtr, const types::Size& anIndex)
+    : rangePtr_(aRangePtr),
+      value_(aRangePtr->firstValue_),
+      index_(anIndex)
+{
+}
+
+template <class T>
+types::Size Interval<T>::SizeRange::getSize() const
+{
+    return size_;
+}
+
+template <class T>
+typename Interval<T>::SizeRange::ConstIterator Interval<T>::SizeRange::begin() const
+{
+    return ConstIterator(this, 0);
+}
+
+template <class T>
+typename Interval<T>::SizeRange::ConstIterator Interval<T>::SizeRange::end() const
+{
+    return ConstIterator(this, size_);
+}
+
+template <class T>
+Interval<T>::SizeRange::SizeRange(const T& aFirstValue, const T& aStep, const types::Size& aSize)
+    : firstValue_(aFirstValue),
+      step_(aStep),
+      size_(aSize)
+{
+}
+
 }  // namespace object
 }  // namespace mathematics
 }  // namespace ostk
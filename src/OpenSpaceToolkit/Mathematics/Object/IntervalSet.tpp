@@ -0,0 +1,594 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <iterator>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/IntervalSet.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace object
+{
+
+template <class T>
+IntervalSet<T>::IntervalSet(const ctnr::Array<Interval<T>>& anIntervalArray)
+    : intervals_()
+{
+    for (const Interval<T>& interval : anIntervalArray)
+    {
+        if (!interval.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Interval");
+        }
+    }
+
+    ctnr::Array<Interval<T>> sorted = anIntervalArray;
+
+    std::sort(sorted.begin(), sorted.end(), IntervalSet<T>::LowerBoundComparator);
+
+    intervals_ = IntervalSet<T>::MergeSorted(sorted);
+}
+
+template <class T>
+IntervalSet<T>::IntervalSet(std::initializer_list<Interval<T>> anIntervalList)
+    : IntervalSet(ctnr::Array<Interval<T>>(anIntervalList))
+{
+}
+
+template <class T>
+bool IntervalSet<T>::operator==(const IntervalSet& anIntervalSet) const
+{
+    return intervals_ == anIntervalSet.intervals_;
+}
+
+template <class T>
+bool IntervalSet<T>::operator!=(const IntervalSet& anIntervalSet) const
+{
+    return !((*this) == anIntervalSet);
+}
+
+template <class U>
+std::ostream& operator<<(std::ostream& anOutputStream, const IntervalSet<U>& anIntervalSet)
+{
+    ostk::core::utils::Print::Header(anOutputStream, "Interval Set");
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Size:" << anIntervalSet.intervals_.getSize();
+
+    for (const Interval<U>& interval : anIntervalSet.intervals_)
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << interval.toString();
+    }
+
+    ostk::core::utils::Print::Footer(anOutputStream);
+
+    return anOutputStream;
+}
+
+template <class T>
+bool IntervalSet<T>::isEmpty() const
+{
+    return intervals_.isEmpty();
+}
+
+template <class T>
+bool IntervalSet<T>::contains(const T& aValue) const
+{
+    return this->findIndexOf(aValue) < intervals_.getSize();
+}
+
+template <class T>
+bool IntervalSet<T>::contains(const Interval<T>& anInterval) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    // Last interval whose lower bound is not greater than the interval lower bound
+
+    const auto intervalIt = std::upper_bound(
+        intervals_.begin(),
+        intervals_.end(),
+        anInterval.accessLowerBound(),
+        [](const T& aValue, const Interval<T>& anotherInterval)
+        {
+            return aValue < anotherInterval.accessLowerBound();
+        }
+    );
+
+    if (intervalIt == intervals_.begin())
+    {
+        return false;
+    }
+
+    return std::prev(intervalIt)->contains(anInterval);
+}
+
+template <class T>
+bool IntervalSet<T>::intersects(const Interval<T>& anInterval) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    // First interval whose upper bound is not lower than the interval lower bound: only this one and the next one can
+    // intersect first (the next one only if the former merely touches the interval at an open bound)
+
+    auto intervalIt = std::lower_bound(
+        intervals_.begin(),
+        intervals_.end(),
+        anInterval.accessLowerBound(),
+        [](const Interval<T>& anotherInterval, const T& aValue)
+        {
+            return anotherInterval.accessUpperBound() < aValue;
+        }
+    );
+
+    for (types::Size count = 0; (count < 2) && (intervalIt != intervals_.end()); ++count, ++intervalIt)
+    {
+        if (intervalIt->intersects(anInterval))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <class T>
+types::Size IntervalSet<T>::getSize() const
+{
+    return intervals_.getSize();
+}
+
+template <class T>
+const ctnr::Array<Interval<T>>& IntervalSet<T>::accessIntervals() const
+{
+    return intervals_;
+}
+
+template <class T>
+ctnr::Array<Interval<T>> IntervalSet<T>::getIntervals() const
+{
+    return intervals_;
+}
+
+template <class T>
+types::Index IntervalSet<T>::findIndexOf(const T& aValue) const
+{
+    if (!aValue.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Value");
+    }
+
+    // Last interval whose lower bound is not greater than the value
+
+    const auto intervalIt = std::upper_bound(
+        intervals_.begin(),
+        intervals_.end(),
+        aValue,
+        [](const T& anotherValue, const Interval<T>& anInterval)
+        {
+            return anotherValue < anInterval.accessLowerBound();
+        }
+    );
+
+    if ((intervalIt != intervals_.begin()) && std::prev(intervalIt)->contains(aValue))
+    {
+        return static_cast<types::Index>(std::distance(intervals_.begin(), std::prev(intervalIt)));
+    }
+
+    return intervals_.getSize();
+}
+
+template <class T>
+Interval<T> IntervalSet<T>::getSpan() const
+{
+    if (intervals_.isEmpty())
+    {
+        return Interval<T>::Undefined();
+    }
+
+    const Interval<T>& firstInterval = intervals_.accessFirst();
+    const Interval<T>& lastInterval = intervals_.accessLast();
+
+    return IntervalSet<T>::BuildInterval(
+        firstInterval.accessLowerBound(),
+        IntervalSet<T>::IsLowerBoundOpen(firstInterval),
+        lastInterval.accessUpperBound(),
+        IntervalSet<T>::IsUpperBoundOpen(lastInterval)
+    );
+}
+
+template <class T>
+IntervalSet<T> IntervalSet<T>::getIntersectionWith(const Interval<T>& anInterval) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    IntervalSet<T> intersection;
+
+    auto intervalIt = std::lower_bound(
+        intervals_.begin(),
+        intervals_.end(),
+        anInterval.accessLowerBound(),
+        [](const Interval<T>& anotherInterval, const T& aValue)
+        {
+            return anotherInterval.accessUpperBound() < aValue;
+        }
+    );
+
+    for (; (intervalIt != intervals_.end()) && (intervalIt->accessLowerBound() <= anInterval.accessUpperBound());
+         ++intervalIt)
+    {
+        const Interval<T> clippedInterval = intervalIt->getIntersectionWith(anInterval);
+
+        if (clippedInterval.isDefined())
+        {
+            intersection.intervals_.add(clippedInterval);
+        }
+    }
+
+    return intersection;
+}
+
+template <class T>
+IntervalSet<T> IntervalSet<T>::getUnionWith(const IntervalSet& anIntervalSet) const
+{
+    ctnr::Array<Interval<T>> sorted;
+    sorted.reserve(intervals_.getSize() + anIntervalSet.intervals_.getSize());
+
+    std::merge(
+        intervals_.begin(),
+        intervals_.end(),
+        anIntervalSet.intervals_.begin(),
+        anIntervalSet.intervals_.end(),
+        std::back_inserter(sorted),
+        IntervalSet<T>::LowerBoundComparator
+    );
+
+    IntervalSet<T> intervalSet;
+
+    intervalSet.intervals_ = IntervalSet<T>::MergeSorted(sorted);
+
+    return intervalSet;
+}
+
+template <class T>
+IntervalSet<T> IntervalSet<T>::getIntersectionWith(const IntervalSet& anIntervalSet) const
+{
+    IntervalSet<T> intersection;
+
+    types::Index i = 0;
+    types::Index j = 0;
+
+    while ((i < intervals_.getSize()) && (j < anIntervalSet.intervals_.getSize()))
+    {
+        const Interval<T>& interval = intervals_[i];
+        const Interval<T>& otherInterval = anIntervalSet.intervals_[j];
+
+        const Interval<T> intersectionInterval = interval.getIntersectionWith(otherInterval);
+
+        if (intersectionInterval.isDefined())
+        {
+            intersection.intervals_.add(intersectionInterval);
+        }
+
+        // Both operands are normalized: when upper bounds coincide, neither interval can intersect the successor of
+        // the other one
+
+        if (interval.accessUpperBound() < otherInterval.accessUpperBound())
+        {
+            ++i;
+        }
+        else if (interval.accessUpperBound() > otherInterval.accessUpperBound())
+        {
+            ++j;
+        }
+        else
+        {
+            ++i;
+            ++j;
+        }
+    }
+
+    return intersection;
+}
+
+template <class T>
+IntervalSet<T> IntervalSet<T>::getDifferenceWith(const IntervalSet& anIntervalSet) const
+{
+    if (intervals_.isEmpty() || anIntervalSet.intervals_.isEmpty())
+    {
+        return *this;
+    }
+
+    return this->getIntersectionWith(anIntervalSet.getGaps(this->getSpan()));
+}
+
+template <class T>
+IntervalSet<T> IntervalSet<T>::getGaps(const Interval<T>& anInterval) const
+{
+    const ctnr::Array<Interval<T>> sanitized =
+        anInterval.isDefined() ? this->getIntersectionWith(anInterval).intervals_ : intervals_;
+
+    IntervalSet<T> gaps;
+
+    if (sanitized.isEmpty())
+    {
+        if (anInterval.isDefined())
+        {
+            gaps.intervals_.add(anInterval);
+        }
+
+        return gaps;
+    }
+
+    // Deal with potential leading gap
+
+    if (anInterval.isDefined())
+    {
+        const Interval<T>& upperInterval = sanitized.accessFirst();
+
+        const bool isLowerBoundOpen = IntervalSet<T>::IsLowerBoundOpen(anInterval);
+        const bool isUpperBoundOpen = !IntervalSet<T>::IsLowerBoundOpen(upperInterval);
+
+        if ((anInterval.accessLowerBound() < upperInterval.accessLowerBound()) ||
+            ((anInterval.accessLowerBound() == upperInterval.accessLowerBound()) && !isLowerBoundOpen &&
+             !isUpperBoundOpen))
+        {
+            gaps.intervals_.add(IntervalSet<T>::BuildInterval(
+                anInterval.accessLowerBound(), isLowerBoundOpen, upperInterval.accessLowerBound(), isUpperBoundOpen
+            ));
+        }
+    }
+
+    // Deal with intermediate gaps
+
+    for (types::Index i = 1; i < sanitized.getSize(); ++i)
+    {
+        const Interval<T>& lowerInterval = sanitized[i - 1];
+        const Interval<T>& upperInterval = sanitized[i];
+
+        gaps.intervals_.add(IntervalSet<T>::BuildInterval(
+            lowerInterval.accessUpperBound(),
+            !IntervalSet<T>::IsUpperBoundOpen(lowerInterval),
+            upperInterval.accessLowerBound(),
+            !IntervalSet<T>::IsLowerBoundOpen(upperInterval)
+        ));
+    }
+
+    // Deal with potential trailing gap
+
+    if (anInterval.isDefined())
+    {
+        const Interval<T>& lowerInterval = sanitized.accessLast();
+
+        const bool isLowerBoundOpen = !IntervalSet<T>::IsUpperBoundOpen(lowerInterval);
+        const bool isUpperBoundOpen = IntervalSet<T>::IsUpperBoundOpen(anInterval);
+
+        if ((lowerInterval.accessUpperBound() < anInterval.accessUpperBound()) ||
+            ((lowerInterval.accessUpperBound() == anInterval.accessUpperBound()) && !isLowerBoundOpen &&
+             !isUpperBoundOpen))
+        {
+            gaps.intervals_.add(IntervalSet<T>::BuildInterval(
+                lowerInterval.accessUpperBound(), isLowerBoundOpen, anInterval.accessUpperBound(), isUpperBoundOpen
+            ));
+        }
+    }
+
+    return gaps;
+}
+
+template <class T>
+void IntervalSet<T>::insert(const Interval<T>& anInterval)
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    // First interval whose upper bound is not lower than the interval lower bound
+
+    auto firstIt = std::lower_bound(
+        intervals_.begin(),
+        intervals_.end(),
+        anInterval.accessLowerBound(),
+        [](const Interval<T>& anotherInterval, const T& aValue)
+        {
+            return anotherInterval.accessUpperBound() < aValue;
+        }
+    );
+
+    if ((firstIt != intervals_.end()) && !IntervalSet<T>::AreConnected(*firstIt, anInterval))
+    {
+        if (firstIt->accessUpperBound() == anInterval.accessLowerBound())
+        {
+            ++firstIt;
+        }
+    }
+
+    auto lastIt = firstIt;
+
+    while ((lastIt != intervals_.end()) && IntervalSet<T>::AreConnected(*lastIt, anInterval))
+    {
+        ++lastIt;
+    }
+
+    ctnr::Array<Interval<T>> connected(firstIt, lastIt);
+
+    connected.insert(
+        std::upper_bound(connected.begin(), connected.end(), anInterval, IntervalSet<T>::LowerBoundComparator),
+        anInterval
+    );
+
+    const Interval<T> merged = IntervalSet<T>::MergeSorted(connected).accessFirst();
+
+    const auto insertIt = intervals_.erase(firstIt, lastIt);
+
+    intervals_.insert(insertIt, merged);
+}
+
+template <class T>
+typename IntervalSet<T>::ConstIterator IntervalSet<T>::begin() const
+{
+    return intervals_.begin();
+}
+
+template <class T>
+typename IntervalSet<T>::ConstIterator IntervalSet<T>::end() const
+{
+    return intervals_.end();
+}
+
+template <class T>
+IntervalSet<T> IntervalSet<T>::Empty()
+{
+    return {};
+}
+
+template <class T>
+IntervalSet<T>::IntervalSet()
+    : intervals_()
+{
+}
+
+template <class T>
+ctnr::Array<Interval<T>> IntervalSet<T>::MergeSorted(const ctnr::Array<Interval<T>>& aSortedIntervalArray)
+{
+    ctnr::Array<Interval<T>> merged;
+
+    if (aSortedIntervalArray.isEmpty())
+    {
+        return merged;
+    }
+
+    const Interval<T>& firstInterval = aSortedIntervalArray.accessFirst();
+
+    T lowerBound = firstInterval.accessLowerBound();
+    T upperBound = firstInterval.accessUpperBound();
+    bool isLowerBoundOpen = IntervalSet<T>::IsLowerBoundOpen(firstInterval);
+    bool isUpperBoundOpen = IntervalSet<T>::IsUpperBoundOpen(firstInterval);
+
+    for (types::Index i = 1; i < aSortedIntervalArray.getSize(); ++i)
+    {
+        const Interval<T>& interval = aSortedIntervalArray[i];
+
+        const T& intervalLowerBound = interval.accessLowerBound();
+        const T& intervalUpperBound = interval.accessUpperBound();
+
+        const bool isConnected =
+            (intervalLowerBound < upperBound) ||
+            ((intervalLowerBound == upperBound) && (!isUpperBoundOpen || !IntervalSet<T>::IsLowerBoundOpen(interval)));
+
+        if (!isConnected)
+        {
+            merged.add(IntervalSet<T>::BuildInterval(lowerBound, isLowerBoundOpen, upperBound, isUpperBoundOpen));
+
+            lowerBound = intervalLowerBound;
+            upperBound = intervalUpperBound;
+            isLowerBoundOpen = IntervalSet<T>::IsLowerBoundOpen(interval);
+            isUpperBoundOpen = IntervalSet<T>::IsUpperBoundOpen(interval);
+
+            continue;
+        }
+
+        if (intervalLowerBound == lowerBound)
+        {
+            isLowerBoundOpen = isLowerBoundOpen && IntervalSet<T>::IsLowerBoundOpen(interval);
+        }
+
+        if (intervalUpperBound > upperBound)
+        {
+            upperBound = intervalUpperBound;
+            isUpperBoundOpen = IntervalSet<T>::IsUpperBoundOpen(interval);
+        }
+        else if (intervalUpperBound == upperBound)
+        {
+            isUpperBoundOpen = isUpperBoundOpen && IntervalSet<T>::IsUpperBoundOpen(interval);
+        }
+    }
+
+    merged.add(IntervalSet<T>::BuildInterval(lowerBound, isLowerBoundOpen, upperBound, isUpperBoundOpen));
+
+    return merged;
+}
+
+template <class T>
+bool IntervalSet<T>::LowerBoundComparator(const Interval<T>& anInterval, const Interval<T>& anotherInterval)
+{
+    if (anInterval.accessLowerBound() == anotherInterval.accessLowerBound())
+    {
+        return !IntervalSet<T>::IsLowerBoundOpen(anInterval) && IntervalSet<T>::IsLowerBoundOpen(anotherInterval);
+    }
+
+    return anInterval.accessLowerBound() < anotherInterval.accessLowerBound();
+}
+
+template <class T>
+bool IntervalSet<T>::AreConnected(const Interval<T>& anInterval, const Interval<T>& anotherInterval)
+{
+    const bool isOrdered = !IntervalSet<T>::LowerBoundComparator(anotherInterval, anInterval);
+
+    const Interval<T>& lowerInterval = isOrdered ? anInterval : anotherInterval;
+    const Interval<T>& upperInterval = isOrdered ? anotherInterval : anInterval;
+
+    if (upperInterval.accessLowerBound() < lowerInterval.accessUpperBound())
+    {
+        return true;
+    }
+
+    return (upperInterval.accessLowerBound() == lowerInterval.accessUpperBound()) &&
+           (!IntervalSet<T>::IsUpperBoundOpen(lowerInterval) || !IntervalSet<T>::IsLowerBoundOpen(upperInterval));
+}
+
+template <class T>
+Interval<T> IntervalSet<T>::BuildInterval(
+    const T& aLowerBound, const bool isLowerBoundOpen, const T& anUpperBound, const bool isUpperBoundOpen
+)
+{
+    if (isLowerBoundOpen && isUpperBoundOpen)
+    {
+        return Interval<T>::Open(aLowerBound, anUpperBound);
+    }
+
+    if (isLowerBoundOpen)
+    {
+        return Interval<T>::HalfOpenLeft(aLowerBound, anUpperBound);
+    }
+
+    if (isUpperBoundOpen)
+    {
+        return Interval<T>::HalfOpenRight(aLowerBound, anUpperBound);
+    }
+
+    return Interval<T>::Closed(aLowerBound, anUpperBound);
+}
+
+template <class T>
+bool IntervalSet<T>::IsLowerBoundOpen(const Interval<T>& anInterval)
+{
+    const typename Interval<T>::Type type = anInterval.getType();
+
+    return (type == Interval<T>::Type::Open) || (type == Interval<T>::Type::HalfOpenLeft);
+}
+
+template <class T>
+bool IntervalSet<T>::IsUpperBoundOpen(const Interval<T>& anInterval)
+{
+    const typename Interval<T>::Type type = anInterval.getType();
+
+    return (type == Interval<T>::Type::Open) || (type == Interval<T>::Type::HalfOpenRight);
+}
+
+}  // namespace object
+}  // namespace mathematics
+}  // namespace ostk
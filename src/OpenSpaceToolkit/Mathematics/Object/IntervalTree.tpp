@@ -0,0 +1,331 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <numeric>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/IntervalTree.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace object
+{
+
+template <class T>
+IntervalTree<T>::IntervalTree(const ctnr::Array<Interval<T>>& anIntervalArray)
+    : intervals_(anIntervalArray),
+      sortedIndices_(anIntervalArray.getSize(), 0),
+      maxUpperBounds_(anIntervalArray.getSize(), T::Undefined())
+{
+    for (const Interval<T>& interval : intervals_)
+    {
+        if (!interval.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Interval");
+        }
+    }
+
+    std::iota(sortedIndices_.begin(), sortedIndices_.end(), 0);
+
+    std::stable_sort(
+        sortedIndices_.begin(),
+        sortedIndices_.end(),
+        [this](const types::Index& anIndex, const types::Index& anotherIndex)
+        {
+            return intervals_[anIndex].accessLowerBound() < intervals_[anotherIndex].accessLowerBound();
+        }
+    );
+
+    if (!intervals_.isEmpty())
+    {
+        this->buildNode(0, intervals_.getSize());
+    }
+}
+
+template <class T>
+IntervalTree<T>::IntervalTree(std::initializer_list<Interval<T>> anIntervalList)
+    : IntervalTree(ctnr::Array<Interval<T>>(anIntervalList))
+{
+}
+
+template <class T>
+bool IntervalTree<T>::isEmpty() const
+{
+    return intervals_.isEmpty();
+}
+
+template <class T>
+bool IntervalTree<T>::contains(const T& aValue) const
+{
+    if (!aValue.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Value");
+    }
+
+    return this->searchNode(
+        0,
+        intervals_.getSize(),
+        aValue,
+        aValue,
+        [&aValue](const Interval<T>& anInterval)
+        {
+            return anInterval.contains(aValue);
+        },
+        []([[maybe_unused]] const types::Index& anIndex)
+        {
+            return false;
+        }
+    );
+}
+
+template <class T>
+bool IntervalTree<T>::intersects(const Interval<T>& anInterval) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    return this->searchNode(
+        0,
+        intervals_.getSize(),
+        anInterval.accessLowerBound(),
+        anInterval.accessUpperBound(),
+        [&anInterval](const Interval<T>& anotherInterval)
+        {
+            return anotherInterval.intersects(anInterval);
+        },
+        []([[maybe_unused]] const types::Index& anIndex)
+        {
+            return false;
+        }
+    );
+}
+
+template <class T>
+types::Size IntervalTree<T>::getSize() const
+{
+    return intervals_.getSize();
+}
+
+template <class T>
+const Interval<T>& IntervalTree<T>::accessIntervalAt(const types::Index& anIndex) const
+{
+    if (anIndex >= intervals_.getSize())
+    {
+        throw ostk::core::error::RuntimeError("Index out of bounds.");
+    }
+
+    return intervals_[anIndex];
+}
+
+template <class T>
+ctnr::Array<types::Index> IntervalTree<T>::getIndicesContaining(const T& aValue) const
+{
+    if (!aValue.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Value");
+    }
+
+    ctnr::Array<types::Index> indices = ctnr::Array<types::Index>::Empty();
+
+    this->searchNode(
+        0,
+        intervals_.getSize(),
+        aValue,
+        aValue,
+        [&aValue](const Interval<T>& anInterval)
+        {
+            return anInterval.contains(aValue);
+        },
+        [&indices](const types::Index& anIndex)
+        {
+            indices.add(anIndex);
+            return true;
+        }
+    );
+
+    return indices;
+}
+
+template <class T>
+ctnr::Array<types::Index> IntervalTree<T>::getIndicesIntersecting(const Interval<T>& anInterval) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    ctnr::Array<types::Index> indices = ctnr::Array<types::Index>::Empty();
+
+    this->searchNode(
+        0,
+        intervals_.getSize(),
+        anInterval.accessLowerBound(),
+        anInterval.accessUpperBound(),
+        [&anInterval](const Interval<T>& anotherInterval)
+        {
+            return anotherInterval.intersects(anInterval);
+        },
+        [&indices](const types::Index& anIndex)
+        {
+            indices.add(anIndex);
+            return true;
+        }
+    );
+
+    return indices;
+}
+
+template <class T>
+ctnr::Array<ctnr::Array<types::Index>> IntervalTree<T>::getIndicesContaining(const ctnr::Array<T>& aValueArray
+) const
+{
+    ctnr::Array<ctnr::Array<types::Index>> indicesArray(aValueArray.getSize(), ctnr::Array<types::Index>::Empty());
+
+    // Sweep: intervals enter the active list (kept ordered by lower bound) once their lower bound is reached, and
+    // leave it once their upper bound has been passed
+
+    ctnr::Array<types::Index> activeSortedIndices = ctnr::Array<types::Index>::Empty();
+
+    types::Index nextSortedIndex = 0;
+
+    for (types::Index valueIndex = 0; valueIndex < aValueArray.getSize(); ++valueIndex)
+    {
+        const T& value = aValueArray[valueIndex];
+
+        if (!value.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Value");
+        }
+
+        if ((valueIndex > 0) && (value < aValueArray[valueIndex - 1]))
+        {
+            throw ostk::core::error::runtime::Wrong("Value array order");
+        }
+
+        while ((nextSortedIndex < sortedIndices_.getSize()) &&
+               (this->accessSortedLowerBound(nextSortedIndex) <= value))
+        {
+            activeSortedIndices.add(nextSortedIndex++);
+        }
+
+        activeSortedIndices.erase(
+            std::remove_if(
+                activeSortedIndices.begin(),
+                activeSortedIndices.end(),
+                [this, &value](const types::Index& aSortedIndex)
+                {
+                    return this->accessSortedUpperBound(aSortedIndex) < value;
+                }
+            ),
+            activeSortedIndices.end()
+        );
+
+        ctnr::Array<types::Index>& indices = indicesArray[valueIndex];
+
+        for (const types::Index& sortedIndex : activeSortedIndices)
+        {
+            const types::Index index = sortedIndices_[sortedIndex];
+
+            if (intervals_[index].contains(value))
+            {
+                indices.add(index);
+            }
+        }
+    }
+
+    return indicesArray;
+}
+
+template <class T>
+const T& IntervalTree<T>::accessSortedLowerBound(const types::Index& aSortedIndex) const
+{
+    return intervals_[sortedIndices_[aSortedIndex]].accessLowerBound();
+}
+
+template <class T>
+const T& IntervalTree<T>::accessSortedUpperBound(const types::Index& aSortedIndex) const
+{
+    return intervals_[sortedIndices_[aSortedIndex]].accessUpperBound();
+}
+
+template <class T>
+T IntervalTree<T>::buildNode(const types::Index& aBeginIndex, const types::Index& anEndIndex)
+{
+    // Node of the range [aBeginIndex, anEndIndex[ is its middle element, children are the two half ranges
+
+    const types::Index nodeIndex = aBeginIndex + (anEndIndex - aBeginIndex) / 2;
+
+    T maxUpperBound = this->accessSortedUpperBound(nodeIndex);
+
+    if (aBeginIndex < nodeIndex)
+    {
+        maxUpperBound = std::max(maxUpperBound, this->buildNode(aBeginIndex, nodeIndex));
+    }
+
+    if ((nodeIndex + 1) < anEndIndex)
+    {
+        maxUpperBound = std::max(maxUpperBound, this->buildNode(nodeIndex + 1, anEndIndex));
+    }
+
+    maxUpperBounds_[nodeIndex] = maxUpperBound;
+
+    return maxUpperBound;
+}
+
+template <class T>
+template <class Predicate, class Visitor>
+bool IntervalTree<T>::searchNode(
+    const types::Index& aBeginIndex,
+    const types::Index& anEndIndex,
+    const T& aLowerBound,
+    const T& anUpperBound,
+    const Predicate& aPredicate,
+    const Visitor& aVisitor
+) const
+{
+    // Returns true if the search must stop (i.e. the visitor asked for an early exit)
+
+    if (aBeginIndex >= anEndIndex)
+    {
+        return false;
+    }
+
+    const types::Index nodeIndex = aBeginIndex + (anEndIndex - aBeginIndex) / 2;
+
+    // No interval of this subtree reaches the query lower bound
+
+    if (maxUpperBounds_[nodeIndex] < aLowerBound)
+    {
+        return false;
+    }
+
+    if (this->searchNode(aBeginIndex, nodeIndex, aLowerBound, anUpperBound, aPredicate, aVisitor))
+    {
+        return true;
+    }
+
+    // This node and its right subtree start after the query upper bound
+
+    if (this->accessSortedLowerBound(nodeIndex) > anUpperBound)
+    {
+        return false;
+    }
+
+    const types::Index index = sortedIndices_[nodeIndex];
+
+    if (aPredicate(intervals_[index]) && !aVisitor(index))
+    {
+        return true;
+    }
+
+    return this->searchNode(nodeIndex + 1, anEndIndex, aLowerBound, anUpperBound, aPredicate, aVisitor);
+}
+
+}  // namespace object
+}  // namespace mathematics
+}  // namespace ostk
@@ -0,0 +1,122 @@
+/// Apache License 2.0
+#ifndef __OpenSpaceToolkit_Mathematics_Utility_BoundingVolumeHierarchy__
+#define __OpenSpaceToolkit_Mathematics_Utility_BoundingVolumeHierarchy__
+
+#include <array>
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace utility
+{
+
+using ostk::core::container::Pair;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+/// @brief                      Squared distance from a point to an axis-aligned box, zero inside the box
+///
+/// @param                      [in] aPoint A point
+/// @param                      [in] aLowerBound A lower corner of the box
+/// @param                      [in] anUpperBound An upper corner of the box
+/// @return                     Squared distance
+
+template <typename Vector>
+double SquaredDistanceToBox(const Vector& aPoint, const Vector& aLowerBound, const Vector& anUpperBound)
+{
+    return (aLowerBound - aPoint).cwiseMax(aPoint - anUpperBound).cwiseMax(0.0).squaredNorm();
+}
+
+/// @brief                      Visit the leaves of a bounding volume hierarchy, closest first
+///
+///                             Nodes are stored in depth-first order, and expose lowerBound, upperBound, offset and
+///                             count members: a leaf (count > 0) spans entries [offset, offset + count), while the
+///                             first child of a branch (count = 0) immediately follows it and its second child is at
+///                             offset.
+///
+///                             A node is visited only if its distance (as given by the node distance function) is
+///                             finite and no greater than the bound. The bound is read by reference whenever a node is
+///                             popped, so that the leaf function may tighten it as results are found. The leaf
+///                             function is called as aLeafFunction(beginIndex, endIndex), and returns false to stop
+///                             the traversal.
+///
+///                             Internal to the library: used by point clouds, line strings and triangle meshes.
+///
+/// @param                      [in] aNodeArray An array of nodes, the first one being the root
+/// @param                      [in] aNodeDistanceFunction A function returning the distance of a node to the query
+/// @param                      [in] aBound A distance bound, possibly updated by the leaf function
+/// @param                      [in] aLeafFunction A function processing leaf entries in [beginIndex, endIndex)
+
+template <Size StackSize, typename NodeArray, typename NodeDistanceFunction, typename LeafFunction>
+void VisitLeavesClosestFirst(
+    const NodeArray& aNodeArray,
+    const NodeDistanceFunction& aNodeDistanceFunction,
+    const double& aBound,
+    const LeafFunction& aLeafFunction
+)
+{
+    if (aNodeArray.isEmpty())
+    {
+        return;
+    }
+
+    std::array<Pair<Index, double>, StackSize> stack;
+    Size stackSize = 0;
+
+    stack[stackSize++] = {0, aNodeDistanceFunction(aNodeArray[0])};
+
+    while (stackSize > 0)
+    {
+        const Pair<Index, double> entry = stack[--stackSize];
+
+        // Strict comparison, so that entries lying exactly at the bound are still visited
+
+        if (std::isinf(entry.second) || (entry.second > aBound))
+        {
+            continue;
+        }
+
+        const auto& node = aNodeArray[entry.first];
+
+        if (node.count > 0)
+        {
+            if (!aLeafFunction(node.offset, node.offset + node.count))
+            {
+                return;
+            }
+
+            continue;
+        }
+
+        const Index firstChildIndex = entry.first + 1;
+        const Index secondChildIndex = node.offset;
+
+        const double firstChildDistance = aNodeDistanceFunction(aNodeArray[firstChildIndex]);
+        const double secondChildDistance = aNodeDistanceFunction(aNodeArray[secondChildIndex]);
+
+        // Push the farther child first, so that the closer one is visited next
+
+        if (firstChildDistance <= secondChildDistance)
+        {
+            stack[stackSize++] = {secondChildIndex, secondChildDistance};
+            stack[stackSize++] = {firstChildIndex, firstChildDistance};
+        }
+        else
+        {
+            stack[stackSize++] = {firstChildIndex, firstChildDistance};
+            stack[stackSize++] = {secondChildIndex, secondChildDistance};
+        }
+    }
+}
+
+}  // namespace utility
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
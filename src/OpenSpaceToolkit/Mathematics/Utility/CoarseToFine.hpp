@@ -0,0 +1,66 @@
+/// Apache License 2.0
+#ifndef __OpenSpaceToolkit_Mathematics_Utility_CoarseToFine__
+#define __OpenSpaceToolkit_Mathematics_Utility_CoarseToFine__
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace utility
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+/// @brief                      Evaluate a predicate over [0, count) in coarse-to-fine order, until it holds
+///
+///                             Indices are visited by decreasing power-of-two stride (e.g. 0, 32, 16, 8, 24, 4, 12, ...
+///                             for a count of 40), so that a predicate holding over a contiguous fraction of the range
+///                             is found after a few evaluations. Each index is visited exactly once.
+///
+///                             Internal to the library: used by discretized intersection tests of cones and pyramids.
+///
+/// @param                      [in] aCount A number of indices
+/// @param                      [in] aPredicate A predicate over indices
+/// @return                     True if the predicate holds for any index
+
+template <class Predicate>
+bool AnyOfCoarseToFine(const Size aCount, const Predicate& aPredicate)
+{
+    Size stride = 1;
+
+    while ((2 * stride) < aCount)
+    {
+        stride *= 2;
+    }
+
+    for (Index index = 0; index < aCount; index += stride)
+    {
+        if (aPredicate(index))
+        {
+            return true;
+        }
+    }
+
+    for (stride /= 2; stride > 0; stride /= 2)
+    {
+        for (Index index = stride; index < aCount; index += 2 * stride)
+        {
+            if (aPredicate(index))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+}  // namespace utility
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,96 @@
+/// Apache License 2.0
+#ifndef __OpenSpaceToolkit_Mathematics_Utility_Parallel__
+#define __OpenSpaceToolkit_Mathematics_Utility_Parallel__
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace utility
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+/// @brief                      Call a range function over [0, count), split into contiguous chunks processed by
+///                             separate threads
+///
+///                             The range function is called as aRangeFunction(beginIndex, endIndex), once per chunk.
+///                             Chunks are disjoint, so that threads may write to disjoint output ranges without
+///                             synchronization. No thread is spawned for a single chunk. An exception thrown by any
+///                             chunk is rethrown once all threads are joined.
+///
+///                             Internal to the library: used by batched queries of geometric objects.
+///
+/// @param                      [in] aCount A number of items
+/// @param                      [in] aThreadCount A maximum number of threads
+/// @param                      [in] aRangeFunction A function processing items in [beginIndex, endIndex)
+
+template <typename RangeFunction>
+void ForEachRange(const Size aCount, const Size aThreadCount, const RangeFunction& aRangeFunction)
+{
+    const Size threadCount = std::min(aThreadCount, std::max<Size>(aCount, 1));
+
+    if (threadCount <= 1)
+    {
+        aRangeFunction(Index(0), Index(aCount));
+
+        return;
+    }
+
+    const Size chunkSize = (aCount + threadCount - 1) / threadCount;
+
+    Array<std::exception_ptr> exceptionPtrs(threadCount, nullptr);
+    Array<std::thread> threads = Array<std::thread>::Empty();
+
+    threads.reserve(threadCount);
+
+    for (Index beginIndex = 0; beginIndex < aCount; beginIndex += chunkSize)
+    {
+        std::exception_ptr& exceptionPtr = exceptionPtrs[threads.getSize()];
+
+        threads.emplace_back(
+            [&aRangeFunction, &exceptionPtr](const Index aBeginIndex, const Index anEndIndex)
+            {
+                try
+                {
+                    aRangeFunction(aBeginIndex, anEndIndex);
+                }
+                catch (...)
+                {
+                    exceptionPtr = std::current_exception();
+                }
+            },
+            beginIndex,
+            std::min<Index>(beginIndex + chunkSize, aCount)
+        );
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const std::exception_ptr& exceptionPtr : exceptionPtrs)
+    {
+        if (exceptionPtr != nullptr)
+        {
+            std::rethrow_exception(exceptionPtr);
+        }
+    }
+}
+
+}  // namespace utility
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
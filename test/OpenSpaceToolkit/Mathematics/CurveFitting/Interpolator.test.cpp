@@ -75,4 +75,35 @@ TEST_F(OpenSpaceToolkit_Mathematics_Interpolator, GenerateInterpolator)
         EXPECT_TRUE(interpolatorSPtr != nullptr);
         EXPECT_EQ(Interpolator::Type::Linear, interpolatorSPtr->getInterpolationType());
     }
+
+    {
+        EXPECT_ANY_THROW(Interpolator::GenerateInterpolator(Interpolator::Type::Hermite, x, y));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator, GenerateInterpolatorWithDerivatives)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    VectorXd dydx(6);
+    dydx << 3.0, 2.5, 1.5, 2.0, 4.5, 6.0;
+
+    {
+        const Shared<const Interpolator> interpolatorSPtr =
+            Interpolator::GenerateInterpolator(Interpolator::Type::Hermite, x, y, dydx);
+        EXPECT_TRUE(interpolatorSPtr != nullptr);
+        EXPECT_EQ(Interpolator::Type::Hermite, interpolatorSPtr->getInterpolationType());
+        EXPECT_NEAR(2.5, interpolatorSPtr->computeDerivative(1.0), 1e-12);
+    }
+
+    {
+        const Shared<const Interpolator> interpolatorSPtr =
+            Interpolator::GenerateInterpolator(Interpolator::Type::Linear, x, y, dydx);
+        EXPECT_TRUE(interpolatorSPtr != nullptr);
+        EXPECT_EQ(Interpolator::Type::Linear, interpolatorSPtr->getInterpolationType());
+    }
 }
@@ -38,6 +38,32 @@ TEST(OpenSpaceToolkit_Mathematics_Interpolator_BarycentricRational, Constructor)
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_BarycentricRational, GetXVector)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    {
+        EXPECT_EQ(x, BarycentricRational(x, y).getXVector());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_BarycentricRational, GetYVector)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    {
+        EXPECT_EQ(y, BarycentricRational(x, y).getYVector());
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Interpolator_BarycentricRational, Evaluate)
 {
     const Table referenceData = Table::Load(
@@ -48,6 +48,45 @@ TEST(OpenSpaceToolkit_Mathematics_Interpolator_CubicSpline, SecondConstructor)
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_CubicSpline, GetXVector)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    {
+        EXPECT_EQ(x, CubicSpline(x, y).getXVector());
+    }
+
+    {
+        const CubicSpline cubicSpline(y, 1.0, 0.5);
+
+        VectorXd referenceX(6);
+        referenceX << 1.0, 1.5, 2.0, 2.5, 3.0, 3.5;
+
+        EXPECT_EQ(referenceX, cubicSpline.getXVector());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_CubicSpline, GetYVector)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    {
+        EXPECT_EQ(y, CubicSpline(x, y).getYVector());
+    }
+
+    {
+        EXPECT_EQ(y, CubicSpline(y, 1.0, 0.5).getYVector());
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Interpolator_CubicSpline, Evaluate)
 {
     const Table referenceData = Table::Load(
@@ -0,0 +1,280 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Table.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Hermite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Table;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::mathematics::curvefitting::interpolator::Hermite;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_Hermite, Constructor)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    VectorXd dydx(6);
+    dydx << 3.0, 2.5, 1.5, 2.0, 4.5, 6.0;
+
+    {
+        EXPECT_NO_THROW(Hermite(x, y, dydx));
+        EXPECT_NO_THROW(Hermite(x, y, dydx, 4));
+        EXPECT_NO_THROW(Hermite(x, y, dydx, 6));
+    }
+
+    {
+        EXPECT_ANY_THROW(Hermite(x.head(1), y.head(1), dydx.head(1)));
+        EXPECT_ANY_THROW(Hermite(x, y.head(5), dydx));
+        EXPECT_ANY_THROW(Hermite(x, y, dydx.head(5)));
+        EXPECT_ANY_THROW(Hermite(x, y, dydx, 1));
+        EXPECT_ANY_THROW(Hermite(x, y, dydx, 7));
+    }
+
+    {
+        VectorXd unsortedX(6);
+        unsortedX << 0.0, 1.0, 3.0, 2.0, 4.0, 5.0;
+
+        EXPECT_ANY_THROW(Hermite(unsortedX, y, dydx));
+    }
+
+    {
+        VectorXd duplicateX(6);
+        duplicateX << 0.0, 1.0, 2.0, 2.0, 4.0, 5.0;
+
+        EXPECT_ANY_THROW(Hermite(duplicateX, y, dydx));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_Hermite, GetXVector)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    VectorXd dydx(6);
+    dydx << 3.0, 2.5, 1.5, 2.0, 4.5, 6.0;
+
+    {
+        EXPECT_EQ(x, Hermite(x, y, dydx).getXVector());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_Hermite, GetYVector)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    VectorXd dydx(6);
+    dydx << 3.0, 2.5, 1.5, 2.0, 4.5, 6.0;
+
+    {
+        EXPECT_EQ(y, Hermite(x, y, dydx).getYVector());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_Hermite, GetDerivativeVector)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    VectorXd dydx(6);
+    dydx << 3.0, 2.5, 1.5, 2.0, 4.5, 6.0;
+
+    {
+        EXPECT_EQ(dydx, Hermite(x, y, dydx).getDerivativeVector());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_Hermite, GetWindowSize)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    VectorXd dydx(6);
+    dydx << 3.0, 2.5, 1.5, 2.0, 4.5, 6.0;
+
+    {
+        EXPECT_EQ(Size(2), Hermite(x, y, dydx).getWindowSize());
+        EXPECT_EQ(Size(4), Hermite(x, y, dydx, 4).getWindowSize());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_Hermite, Evaluate)
+{
+    // Nodes are matched exactly
+
+    {
+        VectorXd x(6);
+        x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+        VectorXd y(6);
+        y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+        VectorXd dydx(6);
+        dydx << 3.0, 2.5, 1.5, 2.0, 4.5, 6.0;
+
+        for (const Size windowSize : {2, 3, 4})
+        {
+            const Hermite interpolator(x, y, dydx, windowSize);
+
+            for (int i = 0; i < x.size(); ++i)
+            {
+                EXPECT_NEAR(y(i), interpolator.evaluate(x(i)), 1e-12);
+            }
+        }
+    }
+
+    // Piecewise cubic Hermite reproduces cubic polynomials on a non-uniform grid
+
+    {
+        VectorXd x(5);
+        x << -1.0, 0.2, 0.5, 1.7, 3.0;
+
+        const VectorXd y = x.array().cube() - 2.0 * x.array().square() + 1.0;
+        const VectorXd dydx = 3.0 * x.array().square() - 4.0 * x.array();
+
+        const Hermite interpolator(x, y, dydx);
+
+        const VectorXd query = VectorXd::LinSpaced(50, -1.0, 3.0);
+        const VectorXd yTruth = query.array().cube() - 2.0 * query.array().square() + 1.0;
+
+        EXPECT_TRUE(interpolator.evaluate(query).isApprox(yTruth, 1e-12));
+    }
+
+    // Higher order windows reproduce polynomials up to degree 2n - 1
+
+    {
+        VectorXd x(6);
+        x << 0.0, 0.4, 1.0, 1.3, 2.1, 3.0;
+
+        const VectorXd y = x.array().pow(5) - x.array();
+        const VectorXd dydx = 5.0 * x.array().pow(4) - 1.0;
+
+        const Hermite interpolator(x, y, dydx, 3);
+
+        const VectorXd query = VectorXd::LinSpaced(50, 0.0, 3.0);
+        const VectorXd yTruth = query.array().pow(5) - query.array();
+
+        EXPECT_TRUE(interpolator.evaluate(query).isApprox(yTruth, 1e-12));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_Hermite, EvaluateStateHistory)
+{
+    // Position interpolation using velocities, on a grid 3 times coarser than for the other interpolators
+
+    const Table referenceData = Table::Load(
+        File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/propagated_states.csv")
+        ),
+        Table::Format::CSV,
+        true
+    );
+
+    const int testRowIncrement = 60;
+
+    VectorXd referenceX(referenceData.getRowCount());
+    MatrixXd referenceY(referenceData.getRowCount(), 6);
+
+    for (Size i = 0; i < referenceData.getRowCount(); ++i)
+    {
+        const auto& referenceRow = referenceData[i];
+
+        referenceX(i) = referenceRow[0].accessReal();
+
+        for (Size j = 0; j < 6; ++j)
+        {
+            referenceY(i, j) = referenceRow[j + 1].accessReal();
+        }
+    }
+
+    VectorXd testX = referenceX(Eigen::seq(0, Eigen::last, testRowIncrement));
+    MatrixXd testY = referenceY(Eigen::seq(0, Eigen::last, testRowIncrement), Eigen::all);
+
+    const Size testRowCount = referenceX.size() - testRowIncrement;
+
+    for (const auto& [windowSize, tolerance] : {std::pair<Size, double> {2, 5e-1}, {4, 3e-1}})
+    {
+        for (Size j = 0; j < 3; ++j)
+        {
+            const Hermite interpolator = Hermite(testX, testY.col(j), testY.col(j + 3), windowSize);
+
+            VectorXd yEstimated = interpolator.evaluate(referenceX.head(testRowCount));
+            VectorXd yTruth = referenceY.col(j).head(testRowCount);
+
+            VectorXd residuals = (yEstimated - yTruth).array().abs();
+
+            EXPECT_TRUE((residuals.array() < tolerance).all())
+                << String::Format("Residual: {}", residuals.maxCoeff());
+        }
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_Hermite, ComputeDerivative)
+{
+    {
+        VectorXd x(6);
+        x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+        VectorXd y(6);
+        y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+        VectorXd dydx(6);
+        dydx << 3.0, 2.5, 1.5, 2.0, 4.5, 6.0;
+
+        for (const Size windowSize : {2, 3, 4})
+        {
+            const Hermite interpolator(x, y, dydx, windowSize);
+
+            EXPECT_TRUE(interpolator.computeDerivative(x).isApprox(dydx, 1e-12));
+        }
+    }
+
+    {
+        VectorXd x(5);
+        x << -1.0, 0.2, 0.5, 1.7, 3.0;
+
+        const VectorXd y = x.array().cube() - 2.0 * x.array().square() + 1.0;
+        const VectorXd dydx = 3.0 * x.array().square() - 4.0 * x.array();
+
+        const Hermite interpolator(x, y, dydx);
+
+        EXPECT_NEAR(interpolator.computeDerivative(1.0), -1.0, 1e-12);
+        EXPECT_NEAR(interpolator.computeDerivative(2.5), 8.75, 1e-12);
+
+        VectorXd query(3);
+        query << -0.5, 1.0, 2.5;
+
+        VectorXd derivatives = interpolator.computeDerivative(query);
+
+        EXPECT_NEAR(derivatives(0), 2.75, 1e-12);
+        EXPECT_NEAR(derivatives(1), -1.0, 1e-12);
+        EXPECT_NEAR(derivatives(2), 8.75, 1e-12);
+    }
+}
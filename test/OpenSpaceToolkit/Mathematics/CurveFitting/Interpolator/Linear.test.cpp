@@ -38,6 +38,32 @@ TEST(OpenSpaceToolkit_Mathematics_Interpolator_Linear, Constructor)
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_Linear, GetXVector)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    {
+        EXPECT_EQ(x, Linear(x, y).getXVector());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_Linear, GetYVector)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    {
+        EXPECT_EQ(y, Linear(x, y).getYVector());
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Interpolator_Linear, Evaluate)
 {
     const Table referenceData = Table::Load(
@@ -37,6 +37,32 @@ TEST(OpenSpaceToolkit_Mathematics_Interpolator_ZeroOrder, Constructor)
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_ZeroOrder, GetXVector)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    {
+        EXPECT_EQ(x, ZeroOrder(x, y).getXVector());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_ZeroOrder, GetYVector)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    {
+        EXPECT_EQ(y, ZeroOrder(x, y).getYVector());
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Interpolator_ZeroOrder, Evaluate_Scalar)
 {
     VectorXd x(6);
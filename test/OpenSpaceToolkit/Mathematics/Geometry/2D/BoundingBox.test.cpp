@@ -0,0 +1,253 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/BoundingBox.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Line.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/LineString.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/MultiPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Segment.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Transformation.hpp>
+
+#include <Global.test.hpp>
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_BoundingBox, Constructor)
+{
+    using ostk::mathematics::geometry::d2::BoundingBox;
+    using ostk::mathematics::geometry::d2::object::Point;
+
+    {
+        EXPECT_NO_THROW(BoundingBox({0.0, 0.0}, {1.0, 2.0}));
+        EXPECT_NO_THROW(BoundingBox({1.0, 2.0}, {1.0, 2.0}));
+        EXPECT_NO_THROW(BoundingBox(Point::Undefined(), Point::Undefined()));
+    }
+
+    {
+        EXPECT_ANY_THROW(BoundingBox({1.0, 0.0}, {0.0, 1.0}));
+        EXPECT_ANY_THROW(BoundingBox({0.0, 2.0}, {1.0, 1.0}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_BoundingBox, EqualToOperator)
+{
+    using ostk::mathematics::geometry::d2::BoundingBox;
+
+    {
+        EXPECT_TRUE(BoundingBox({0.0, 0.0}, {1.0, 2.0}) == BoundingBox({0.0, 0.0}, {1.0, 2.0}));
+        EXPECT_FALSE(BoundingBox({0.0, 0.0}, {1.0, 2.0}) == BoundingBox({0.0, 0.0}, {1.0, 3.0}));
+        EXPECT_FALSE(BoundingBox({0.0, 0.0}, {1.0, 2.0}) == BoundingBox::Undefined());
+        EXPECT_FALSE(BoundingBox::Undefined() == BoundingBox::Undefined());
+    }
+
+    {
+        EXPECT_TRUE(BoundingBox({0.0, 0.0}, {1.0, 2.0}) != BoundingBox({0.0, 0.0}, {1.0, 3.0}));
+        EXPECT_TRUE(BoundingBox::Undefined() != BoundingBox::Undefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_BoundingBox, IsDefined)
+{
+    using ostk::mathematics::geometry::d2::BoundingBox;
+
+    {
+        EXPECT_TRUE(BoundingBox({0.0, 0.0}, {1.0, 2.0}).isDefined());
+        EXPECT_FALSE(BoundingBox::Undefined().isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_BoundingBox, Intersects)
+{
+    using ostk::mathematics::geometry::d2::BoundingBox;
+
+    {
+        const BoundingBox boundingBox = {{0.0, 0.0}, {1.0, 1.0}};
+
+        EXPECT_TRUE(boundingBox.intersects(boundingBox));
+        EXPECT_TRUE(boundingBox.intersects({{0.5, 0.5}, {2.0, 2.0}}));
+        EXPECT_TRUE(boundingBox.intersects({{0.2, 0.2}, {0.8, 0.8}}));
+        EXPECT_TRUE(boundingBox.intersects({{1.0, 0.0}, {2.0, 1.0}}));
+        EXPECT_TRUE(boundingBox.intersects({{1.0, 1.0}, {2.0, 2.0}}));
+
+        EXPECT_FALSE(boundingBox.intersects({{1.5, 0.0}, {2.0, 1.0}}));
+        EXPECT_FALSE(boundingBox.intersects({{0.0, -2.0}, {1.0, -0.5}}));
+    }
+
+    {
+        EXPECT_ANY_THROW(BoundingBox::Undefined().intersects({{0.0, 0.0}, {1.0, 1.0}}));
+        EXPECT_ANY_THROW(BoundingBox({0.0, 0.0}, {1.0, 1.0}).intersects(BoundingBox::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_BoundingBox, Contains)
+{
+    using ostk::mathematics::geometry::d2::BoundingBox;
+    using ostk::mathematics::geometry::d2::object::Point;
+
+    {
+        const BoundingBox boundingBox = {{0.0, 0.0}, {1.0, 1.0}};
+
+        EXPECT_TRUE(boundingBox.contains(Point(0.5, 0.5)));
+        EXPECT_TRUE(boundingBox.contains(Point(1.0, 1.0)));
+        EXPECT_FALSE(boundingBox.contains(Point(0.5, 1.5)));
+
+        EXPECT_TRUE(boundingBox.contains(boundingBox));
+        EXPECT_TRUE(boundingBox.contains(BoundingBox({0.2, 0.2}, {0.8, 1.0})));
+        EXPECT_FALSE(boundingBox.contains(BoundingBox({0.5, 0.5}, {2.0, 2.0})));
+    }
+
+    {
+        EXPECT_ANY_THROW(BoundingBox::Undefined().contains(Point(0.0, 0.0)));
+        EXPECT_ANY_THROW(BoundingBox({0.0, 0.0}, {1.0, 1.0}).contains(Point::Undefined()));
+        EXPECT_ANY_THROW(BoundingBox({0.0, 0.0}, {1.0, 1.0}).contains(BoundingBox::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_BoundingBox, Getters)
+{
+    using ostk::mathematics::geometry::d2::BoundingBox;
+    using ostk::mathematics::geometry::d2::object::Point;
+    using ostk::mathematics::object::Vector2d;
+
+    {
+        const BoundingBox boundingBox = {{0.0, 0.0}, {1.0, 2.0}};
+
+        EXPECT_EQ(Point(0.0, 0.0), boundingBox.getLowerBound());
+        EXPECT_EQ(Point(1.0, 2.0), boundingBox.getUpperBound());
+        EXPECT_EQ(Point(0.5, 1.0), boundingBox.getCenter());
+        EXPECT_EQ(Vector2d(1.0, 2.0), boundingBox.getSize());
+    }
+
+    {
+        EXPECT_ANY_THROW(BoundingBox::Undefined().getLowerBound());
+        EXPECT_ANY_THROW(BoundingBox::Undefined().getUpperBound());
+        EXPECT_ANY_THROW(BoundingBox::Undefined().getCenter());
+        EXPECT_ANY_THROW(BoundingBox::Undefined().getSize());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_BoundingBox, UnionWith)
+{
+    using ostk::mathematics::geometry::d2::BoundingBox;
+
+    {
+        EXPECT_EQ(
+            BoundingBox({-1.0, 0.0}, {1.0, 3.0}),
+            BoundingBox({0.0, 0.0}, {1.0, 2.0}).unionWith({{-1.0, 1.0}, {0.0, 3.0}})
+        );
+    }
+
+    {
+        EXPECT_FALSE(BoundingBox({0.0, 0.0}, {1.0, 1.0}).unionWith(BoundingBox::Undefined()).isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_BoundingBox, Points)
+{
+    using ostk::core::container::Array;
+
+    using ostk::mathematics::geometry::d2::BoundingBox;
+    using ostk::mathematics::geometry::d2::object::Point;
+
+    {
+        EXPECT_EQ(
+            BoundingBox({-1.0, 0.0}, {2.0, 5.0}),
+            BoundingBox::Points({{0.0, 0.0}, {-1.0, 5.0}, {2.0, 1.0}})
+        );
+    }
+
+    {
+        EXPECT_FALSE(BoundingBox::Points(Array<Point>::Empty()).isDefined());
+        EXPECT_ANY_THROW(BoundingBox::Points({{0.0, 0.0}, Point::Undefined()}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_BoundingBox, GetBoundingBox)
+{
+    using ostk::mathematics::geometry::d2::BoundingBox;
+    using ostk::mathematics::geometry::d2::object::Composite;
+    using ostk::mathematics::geometry::d2::object::Line;
+    using ostk::mathematics::geometry::d2::object::LineString;
+    using ostk::mathematics::geometry::d2::object::MultiPolygon;
+    using ostk::mathematics::geometry::d2::object::Point;
+    using ostk::mathematics::geometry::d2::object::PointSet;
+    using ostk::mathematics::geometry::d2::object::Polygon;
+    using ostk::mathematics::geometry::d2::object::Segment;
+    using ostk::mathematics::geometry::d2::Transformation;
+    using ostk::mathematics::object::Vector2d;
+
+    {
+        EXPECT_EQ(BoundingBox({1.0, 2.0}, {1.0, 2.0}), Point(1.0, 2.0).getBoundingBox());
+        EXPECT_EQ(BoundingBox({0.0, -2.0}, {1.0, 2.0}), Segment({1.0, -2.0}, {0.0, 2.0}).getBoundingBox());
+        EXPECT_EQ(
+            BoundingBox({0.0, -1.0}, {2.0, 1.0}), LineString({{0.0, 0.0}, {2.0, 1.0}, {1.0, -1.0}}).getBoundingBox()
+        );
+        EXPECT_FALSE(Line({0.0, 0.0}, {0.0, 1.0}).getBoundingBox().isDefined());
+    }
+
+    {
+        PointSet pointSet = {{{0.0, 0.0}, {1.0, 2.0}}};
+
+        EXPECT_EQ(BoundingBox({0.0, 0.0}, {1.0, 2.0}), pointSet.getBoundingBox());
+
+        pointSet.applyTransformation(Transformation::Translation(Vector2d(1.0, 0.0)));
+
+        EXPECT_EQ(BoundingBox({1.0, 0.0}, {2.0, 2.0}), pointSet.getBoundingBox());
+    }
+
+    {
+        Polygon polygon = {{{0.0, 0.0}, {2.0, 0.0}, {2.0, 1.0}, {0.0, 1.0}}, {{{0.5, 0.5}, {1.0, 0.5}, {1.0, 0.8}}}};
+
+        EXPECT_EQ(BoundingBox({0.0, 0.0}, {2.0, 1.0}), polygon.getBoundingBox());
+
+        polygon.applyTransformation(Transformation::Translation(Vector2d(-1.0, 3.0)));
+
+        EXPECT_EQ(BoundingBox({-1.0, 3.0}, {1.0, 4.0}), polygon.getBoundingBox());
+
+        const MultiPolygon multiPolygon = {{polygon, Polygon({{5.0, 5.0}, {6.0, 5.0}, {6.0, 6.0}})}};
+
+        EXPECT_EQ(BoundingBox({-1.0, 3.0}, {6.0, 6.0}), multiPolygon.getBoundingBox());
+    }
+
+    {
+        Composite composite = Composite(Point(0.0, 0.0)) + Composite(Segment({1.0, 1.0}, {2.0, -1.0}));
+
+        EXPECT_EQ(BoundingBox({0.0, -1.0}, {2.0, 1.0}), composite.getBoundingBox());
+
+        composite += Composite(Line({0.0, 0.0}, {0.0, 1.0}));
+
+        EXPECT_FALSE(composite.getBoundingBox().isDefined());
+        EXPECT_FALSE(Composite::Empty().getBoundingBox().isDefined());
+    }
+
+    {
+        EXPECT_ANY_THROW(Point::Undefined().getBoundingBox());
+        EXPECT_ANY_THROW(Segment::Undefined().getBoundingBox());
+        EXPECT_ANY_THROW(LineString::Empty().getBoundingBox());
+        EXPECT_ANY_THROW(PointSet::Empty().getBoundingBox());
+        EXPECT_ANY_THROW(Polygon::Undefined().getBoundingBox());
+        EXPECT_ANY_THROW(MultiPolygon::Undefined().getBoundingBox());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_BoundingBox, EarlyReject)
+{
+    using ostk::mathematics::geometry::d2::Object;
+    using ostk::mathematics::geometry::d2::object::Point;
+    using ostk::mathematics::geometry::d2::object::Polygon;
+    using ostk::mathematics::geometry::d2::object::Segment;
+
+    {
+        const Polygon polygon = {{{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}}};
+        const Object& object = polygon;
+
+        EXPECT_TRUE(object.contains(Point(0.5, 0.5)));
+        EXPECT_FALSE(object.contains(Point(2.0, 0.5)));
+
+        // Pairs without an exact routine keep throwing, whether or not bounding boxes are enclosed
+
+        EXPECT_ANY_THROW(object.contains(Segment({0.5, 0.5}, {2.0, 2.0})));
+        EXPECT_ANY_THROW(object.contains(Segment({0.2, 0.2}, {0.8, 0.8})));
+    }
+}
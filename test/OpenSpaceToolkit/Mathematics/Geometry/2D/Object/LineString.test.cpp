@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <random>
+
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/LineString.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Segment.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Transformation.hpp>
@@ -161,6 +163,32 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString, IsEmpty)
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString, IsSimple)
+{
+    using ostk::mathematics::geometry::d2::object::LineString;
+
+    {
+        EXPECT_ANY_THROW(LineString::Empty().isSimple());
+    }
+
+    {
+        EXPECT_TRUE(LineString({{0.0, 0.0}}).isSimple());
+        EXPECT_TRUE(LineString({{0.0, 0.0}, {1.0, 0.0}}).isSimple());
+        EXPECT_TRUE(LineString({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}}).isSimple());
+        EXPECT_TRUE(LineString({{0.0, 0.0}, {1.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}}).isSimple());
+        EXPECT_TRUE(LineString({{0.0, 0.0}, {1.0, 0.0}, {2.0, 0.0}}).isSimple());
+        EXPECT_TRUE(LineString({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 0.0}}).isSimple());
+    }
+
+    {
+        EXPECT_FALSE(LineString({{0.0, 0.0}, {1.0, 1.0}, {1.0, 0.0}, {0.0, 1.0}}).isSimple());
+        EXPECT_FALSE(LineString({{0.0, 0.0}, {2.0, 0.0}, {1.0, 0.0}}).isSimple());
+        EXPECT_FALSE(LineString({{0.0, 0.0}, {1.0, 0.0}, {0.0, 0.0}}).isSimple());
+        EXPECT_FALSE(LineString({{0.0, 0.0}, {2.0, 0.0}, {2.0, 1.0}, {1.0, 1.0}, {1.0, 0.0}}).isSimple());
+        EXPECT_FALSE(LineString({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 0.0}, {-1.0, 0.0}}).isSimple());
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString, Contains)
 {
     using ostk::core::container::Array;
@@ -349,6 +377,223 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString, ConstIterator)
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString, GetLength)
+{
+    using ostk::mathematics::geometry::d2::object::LineString;
+
+    {
+        EXPECT_DOUBLE_EQ(3.0, LineString({{0.0, 0.0}, {1.0, 0.0}, {1.0, 2.0}}).getLength());
+        EXPECT_DOUBLE_EQ(0.0, LineString({{1.0, 2.0}}).getLength());
+    }
+
+    {
+        EXPECT_ANY_THROW(LineString::Empty().getLength());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString, DistanceTo)
+{
+    using ostk::mathematics::geometry::d2::object::LineString;
+    using ostk::mathematics::geometry::d2::object::Point;
+
+    {
+        const LineString lineString = {{{0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}}};
+
+        EXPECT_DOUBLE_EQ(1.0, lineString.distanceTo({1.0, 1.0}));
+        EXPECT_DOUBLE_EQ(0.0, lineString.distanceTo({2.0, 1.0}));
+        EXPECT_DOUBLE_EQ(1.0, lineString.distanceTo({-1.0, 0.0}));
+    }
+
+    {
+        EXPECT_ANY_THROW(LineString({{0.0, 0.0}, {1.0, 0.0}}).distanceTo(Point::Undefined()));
+        EXPECT_ANY_THROW(LineString::Empty().distanceTo({0.0, 0.0}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString, ProjectPoint)
+{
+    using ostk::mathematics::geometry::d2::object::LineString;
+    using ostk::mathematics::geometry::d2::object::Point;
+
+    {
+        const LineString lineString = {{{0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}}};
+
+        const LineString::Projection projection = lineString.projectPoint({3.0, 1.0});
+
+        EXPECT_EQ(Point({2.0, 1.0}), projection.first);
+        EXPECT_DOUBLE_EQ(3.0, projection.second);
+
+        EXPECT_EQ(Point({0.0, 0.0}), lineString.projectPoint({-1.0, -1.0}).first);
+        EXPECT_DOUBLE_EQ(0.0, lineString.projectPoint({-1.0, -1.0}).second);
+
+        EXPECT_EQ(Point({2.0, 2.0}), lineString.projectPoint({2.0, 5.0}).first);
+        EXPECT_DOUBLE_EQ(4.0, lineString.projectPoint({2.0, 5.0}).second);
+    }
+
+    {
+        // Equidistant segments resolve to the lowest segment index
+
+        const LineString lineString = {{{0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}}};
+
+        EXPECT_EQ(Point({1.0, 0.0}), lineString.projectPoint({1.0, 1.0}).first);
+        EXPECT_DOUBLE_EQ(1.0, lineString.projectPoint({1.0, 1.0}).second);
+    }
+
+    {
+        EXPECT_EQ(Point({1.0, 2.0}), LineString({{1.0, 2.0}}).projectPoint({0.0, 0.0}).first);
+    }
+
+    {
+        EXPECT_ANY_THROW(LineString({{0.0, 0.0}, {1.0, 0.0}}).projectPoint(Point::Undefined()));
+        EXPECT_ANY_THROW(LineString::Empty().projectPoint({0.0, 0.0}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString, Simplify)
+{
+    using ostk::core::type::Real;
+
+    using ostk::mathematics::geometry::d2::object::LineString;
+
+    {
+        const LineString lineString = {{{0.0, 0.0}, {1.0, 0.1}, {2.0, 0.0}, {3.0, 0.1}, {4.0, 0.0}}};
+
+        EXPECT_EQ(LineString({{0.0, 0.0}, {4.0, 0.0}}), lineString.simplify(0.5));
+        EXPECT_EQ(lineString, lineString.simplify(0.05));
+    }
+
+    {
+        // Repeated points are dropped
+
+        EXPECT_EQ(LineString({{0.0, 0.0}, {1.0, 0.0}}), LineString({{0.0, 0.0}, {0.0, 0.0}, {1.0, 0.0}}).simplify(0.0));
+    }
+
+    {
+        // Shortcuts crossing other parts of the line string are refined
+
+        const LineString lineString = {{{0.0, 0.0}, {5.0, 1.0}, {10.0, 0.0}, {10.0, -1.0}, {5.0, 0.5}, {0.0, -1.0}}};
+
+        const LineString simplifiedLineString = lineString.simplify(2.0);
+
+        EXPECT_EQ(LineString({{0.0, 0.0}, {5.0, 1.0}, {10.0, 0.0}, {0.0, -1.0}}), simplifiedLineString);
+        EXPECT_TRUE(simplifiedLineString.isSimple());
+    }
+
+    {
+        EXPECT_ANY_THROW(LineString::Empty().simplify(1.0));
+        EXPECT_ANY_THROW(LineString({{0.0, 0.0}, {1.0, 0.0}}).simplify(Real::Undefined()));
+        EXPECT_ANY_THROW(LineString({{0.0, 0.0}, {1.0, 0.0}}).simplify(-1.0));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString, SimplifyTo)
+{
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::geometry::d2::object::LineString;
+
+    {
+        const LineString lineString = {{{0.0, 0.0}, {1.0, 0.1}, {2.0, 0.0}, {3.0, 1.0}, {4.0, 0.0}}};
+
+        EXPECT_EQ(LineString({{0.0, 0.0}, {2.0, 0.0}, {3.0, 1.0}, {4.0, 0.0}}), lineString.simplifyTo(4));
+        EXPECT_EQ(LineString({{0.0, 0.0}, {4.0, 0.0}}), lineString.simplifyTo(2));
+        EXPECT_EQ(lineString, lineString.simplifyTo(10));
+    }
+
+    {
+        const LineString lineString = {{{0.0, 0.0}, {5.0, 1.0}, {10.0, 0.0}, {10.0, -1.0}, {5.0, 0.5}, {0.0, -1.0}}};
+
+        for (Size pointCount = 2; pointCount <= 6; ++pointCount)
+        {
+            EXPECT_TRUE(lineString.simplifyTo(pointCount).isSimple());
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(LineString::Empty().simplifyTo(2));
+        EXPECT_ANY_THROW(LineString({{0.0, 0.0}, {1.0, 0.0}}).simplifyTo(1));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString, BuildIndex)
+{
+    using ostk::core::container::Array;
+    using ostk::core::type::Index;
+
+    using ostk::mathematics::geometry::d2::object::LineString;
+    using ostk::mathematics::geometry::d2::object::Point;
+    using ostk::mathematics::geometry::d2::Transformation;
+
+    // Random walk, revisiting the same area many times
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+    const auto randomPoint = [&generator, &distribution](const double aScale) -> Point
+    {
+        return {aScale * distribution(generator), aScale * distribution(generator)};
+    };
+
+    Array<Point> points = {{0.0, 0.0}};
+
+    for (Index pointIndex = 1; pointIndex < 5000; ++pointIndex)
+    {
+        points.add(points.accessLast() + randomPoint(1.0).asVector());
+    }
+
+    const LineString lineString = {points};
+
+    LineString indexedLineString = {points};
+
+    EXPECT_FALSE(indexedLineString.isIndexed());
+
+    indexedLineString.buildIndex();
+
+    EXPECT_TRUE(indexedLineString.isIndexed());
+    EXPECT_TRUE(LineString(indexedLineString).isIndexed());
+    EXPECT_EQ(lineString, indexedLineString);
+
+    EXPECT_EQ(lineString.getLength(), indexedLineString.getLength());
+
+    for (Index queryIndex = 0; queryIndex < 500; ++queryIndex)
+    {
+        const Point query = randomPoint(40.0);
+
+        EXPECT_EQ(lineString.getPointClosestTo(query), indexedLineString.getPointClosestTo(query));
+        EXPECT_EQ(lineString.projectPoint(query), indexedLineString.projectPoint(query));
+        EXPECT_EQ(lineString.distanceTo(query), indexedLineString.distanceTo(query));
+        EXPECT_EQ(lineString.contains(query), indexedLineString.contains(query));
+        EXPECT_TRUE(indexedLineString.contains(points[queryIndex]));
+    }
+
+    {
+        LineString transformedLineString = lineString;
+
+        transformedLineString.applyTransformation(Transformation::Translation({1.0, 2.0}));
+        indexedLineString.applyTransformation(Transformation::Translation({1.0, 2.0}));
+
+        EXPECT_TRUE(indexedLineString.isIndexed());
+
+        const Point query = {1.5, -2.5};
+
+        EXPECT_EQ(transformedLineString.projectPoint(query), indexedLineString.projectPoint(query));
+    }
+
+    {
+        LineString singlePointLineString = {{{1.0, 2.0}}};
+
+        singlePointLineString.buildIndex();
+
+        EXPECT_TRUE(singlePointLineString.isIndexed());
+        EXPECT_EQ(Point({1.0, 2.0}), singlePointLineString.getPointClosestTo({0.0, 0.0}));
+    }
+
+    {
+        EXPECT_ANY_THROW(LineString::Empty().buildIndex());
+        EXPECT_ANY_THROW(LineString({{0.0, 0.0}, Point::Undefined()}).buildIndex());
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_LineString, ApplyTransformation)
 {
     using ostk::mathematics::geometry::d2::object::LineString;
@@ -981,6 +981,49 @@
 
 // }
 
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_MultiPolygon, Locate)
+{
+    using ostk::core::container::Array;
+
+    using ostk::mathematics::geometry::d2::object::MultiPolygon;
+    using ostk::mathematics::geometry::d2::object::Polygon;
+    using ostk::mathematics::object::MatrixXd;
+
+    {
+        const MultiPolygon multiPolygon = {
+            {Polygon {{{0.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}, {1.0, 0.0}}},
+             Polygon {{{2.0, 0.0}, {2.0, 1.0}, {3.0, 1.0}, {3.0, 0.0}}}}
+        };
+
+        MatrixXd points(5, 2);
+        points << 0.5, 0.5, 2.5, 0.5, 3.0, 0.5, 1.5, 0.5, 10.0, 10.0;
+
+        const Array<Polygon::Location> expectedLocations = {
+            Polygon::Location::Inside,
+            Polygon::Location::Inside,
+            Polygon::Location::Boundary,
+            Polygon::Location::Outside,
+            Polygon::Location::Outside,
+        };
+
+        EXPECT_EQ(expectedLocations, multiPolygon.locate(points));
+        EXPECT_EQ(expectedLocations, multiPolygon.locate(points, 2));
+
+        for (Eigen::Index rowIndex = 0; rowIndex < points.rows(); ++rowIndex)
+        {
+            EXPECT_EQ(
+                multiPolygon.contains({points(rowIndex, 0), points(rowIndex, 1)}),
+                expectedLocations[rowIndex] != Polygon::Location::Outside
+            );
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(MultiPolygon::Undefined().locate(MatrixXd::Zero(1, 2)));
+        EXPECT_ANY_THROW(MultiPolygon::Polygon({{{0.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}}}).locate(MatrixXd::Zero(1, 3)));
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_MultiPolygon, GetConvexHull)
 {
     using ostk::mathematics::geometry::d2::object::MultiPolygon;
@@ -1209,6 +1252,110 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_MultiPolygon, GetConvexHull
 
 // }
 
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_MultiPolygon, Simplify)
+{
+    using ostk::core::container::Array;
+    using ostk::core::type::Real;
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::geometry::d2::object::MultiPolygon;
+    using ostk::mathematics::geometry::d2::object::Point;
+    using ostk::mathematics::geometry::d2::object::Polygon;
+
+    const Polygon firstPolygon = {{{0.0, 0.0}, {1.0, 0.1}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}}};
+    const Polygon secondPolygon = {{{3.0, 0.0}, {5.0, 0.0}, {5.0, 2.0}, {4.0, 1.9}, {3.0, 2.0}}};
+
+    const MultiPolygon multiPolygon = {{firstPolygon, secondPolygon}};
+
+    {
+        const MultiPolygon referenceMultiPolygon = {
+            {firstPolygon.simplify(0.5), secondPolygon.simplify(0.5)}
+        };
+
+        for (const Size threadCount : {1, 2, 4})
+        {
+            const MultiPolygon simplifiedMultiPolygon = multiPolygon.simplify(0.5, threadCount);
+
+            EXPECT_EQ(referenceMultiPolygon, simplifiedMultiPolygon);
+            EXPECT_EQ(2, simplifiedMultiPolygon.getPolygonCount());
+        }
+
+        EXPECT_EQ(multiPolygon, multiPolygon.simplify(0.05));
+    }
+
+    {
+        // Polygons sharing an edge are simplified together, and do not overlap once simplified
+
+        const Polygon leftPolygon = {{{0.0, 0.0}, {1.0, 0.0}, {1.2, 1.0}, {1.2, 2.0}, {1.0, 3.0}, {0.0, 3.0}}};
+        const Polygon rightPolygon = {{{1.0, 0.0}, {3.0, 0.0}, {3.0, 3.0}, {1.0, 3.0}, {1.2, 2.0}, {1.2, 1.0}}};
+
+        const Point point = {1.15, 1.8};
+
+        // Simplified independently, each polygon drops a different vertex of the shared edge
+
+        EXPECT_TRUE(leftPolygon.simplify(0.1).contains(point));
+        EXPECT_TRUE(rightPolygon.simplify(0.1).contains(point));
+
+        for (const Size threadCount : {1, 2})
+        {
+            const Array<Polygon> simplifiedPolygons =
+                MultiPolygon({leftPolygon, rightPolygon}).simplify(0.1, threadCount).getPolygons();
+
+            ASSERT_EQ(2, simplifiedPolygons.getSize());
+
+            EXPECT_FALSE(simplifiedPolygons[0].contains(point) && simplifiedPolygons[1].contains(point));
+            EXPECT_EQ(leftPolygon, simplifiedPolygons[0]);
+            EXPECT_EQ(rightPolygon, simplifiedPolygons[1]);
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(MultiPolygon::Undefined().simplify(1.0));
+        EXPECT_ANY_THROW(multiPolygon.simplify(Real::Undefined()));
+        EXPECT_ANY_THROW(multiPolygon.simplify(-1.0));
+        EXPECT_ANY_THROW(multiPolygon.simplify(1.0, 0));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_MultiPolygon, SimplifyTo)
+{
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::geometry::d2::object::MultiPolygon;
+    using ostk::mathematics::geometry::d2::object::Polygon;
+
+    const Polygon firstPolygon = {{{0.0, 0.0}, {1.0, 0.1}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}}};
+    const Polygon secondPolygon = {{{3.0, 0.0}, {5.0, 0.0}, {5.0, 2.0}, {4.0, 1.9}, {3.0, 2.0}}};
+
+    const MultiPolygon multiPolygon = {{firstPolygon, secondPolygon}};
+
+    {
+        // The vertex budget is shared in proportion to vertex counts
+
+        for (const Size threadCount : {1, 2, 4})
+        {
+            const MultiPolygon simplifiedMultiPolygon = multiPolygon.simplifyTo(8, threadCount);
+
+            EXPECT_EQ(2, simplifiedMultiPolygon.getPolygonCount());
+            EXPECT_EQ(
+                MultiPolygon({{firstPolygon.simplifyTo(4), secondPolygon.simplifyTo(4)}}), simplifiedMultiPolygon
+            );
+        }
+
+        // Polygons keep at least 3 vertices
+
+        EXPECT_EQ(2, multiPolygon.simplifyTo(3).getPolygonCount());
+
+        EXPECT_EQ(multiPolygon, multiPolygon.simplifyTo(20));
+    }
+
+    {
+        EXPECT_ANY_THROW(MultiPolygon::Undefined().simplifyTo(3));
+        EXPECT_ANY_THROW(multiPolygon.simplifyTo(2));
+        EXPECT_ANY_THROW(multiPolygon.simplifyTo(3, 0));
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_MultiPolygon, Undefined)
 {
     using ostk::mathematics::geometry::d2::object::MultiPolygon;
@@ -1234,3 +1381,88 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_MultiPolygon, Polygon)
         EXPECT_NO_THROW(MultiPolygon::Polygon(polygon));
     }
 }
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_MultiPolygon, Union)
+{
+    using ostk::core::container::Array;
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::geometry::d2::object::MultiPolygon;
+    using ostk::mathematics::geometry::d2::object::Polygon;
+
+    const auto square = [](const double anX, const double aY, const double aSize) -> Polygon
+    {
+        return {{{anX, aY}, {anX, aY + aSize}, {anX + aSize, aY + aSize}, {anX + aSize, aY}}};
+    };
+
+    {
+        const MultiPolygon multiPolygon = MultiPolygon::Union({square(0.0, 0.0, 2.0), square(1.0, 0.0, 2.0)});
+
+        EXPECT_EQ(1, multiPolygon.getPolygonCount());
+        EXPECT_EQ(MultiPolygon::Polygon({{{0.0, 0.0}, {0.0, 2.0}, {3.0, 2.0}, {3.0, 0.0}}}), multiPolygon);
+    }
+
+    {
+        // Overlapping grid of squares, in a shuffled order, merging into a single square
+
+        Array<Polygon> polygons = Array<Polygon>::Empty();
+
+        for (Size rowIndex = 0; rowIndex < 16; ++rowIndex)
+        {
+            for (Size columnIndex = 0; columnIndex < 16; ++columnIndex)
+            {
+                polygons.add(square(0.5 * ((columnIndex * 7) % 16), 0.5 * ((rowIndex * 5) % 16), 1.0));
+            }
+        }
+
+        const MultiPolygon expectedMultiPolygon = MultiPolygon::Polygon(square(0.0, 0.0, 8.5));
+
+        for (const Size threadCount : {1, 2, 3, 8})
+        {
+            const MultiPolygon multiPolygon = MultiPolygon::Union(polygons, threadCount);
+
+            EXPECT_EQ(1, multiPolygon.getPolygonCount());
+            EXPECT_EQ(expectedMultiPolygon, multiPolygon);
+        }
+    }
+
+    {
+        // Disjoint clusters stay separate polygons
+
+        const Array<Polygon> polygons = {
+            square(0.0, 0.0, 1.0),
+            square(10.0, 0.0, 1.0),
+            square(0.5, 0.5, 1.0),
+            square(10.5, 0.5, 1.0),
+            square(20.0, 20.0, 1.0),
+        };
+
+        for (const Size threadCount : {1, 4})
+        {
+            const MultiPolygon multiPolygon = MultiPolygon::Union(polygons, threadCount);
+
+            // Overlay vertices are only exact up to the rescaling tolerance of the underlying library
+
+            EXPECT_EQ(3, multiPolygon.getPolygonCount());
+
+            EXPECT_TRUE(multiPolygon.contains({0.25, 0.25}));
+            EXPECT_TRUE(multiPolygon.contains({1.25, 1.25}));
+            EXPECT_TRUE(multiPolygon.contains({10.75, 0.75}));
+            EXPECT_TRUE(multiPolygon.contains({20.5, 20.5}));
+
+            EXPECT_FALSE(multiPolygon.contains({0.25, 1.25}));
+            EXPECT_FALSE(multiPolygon.contains({1.25, 0.25}));
+            EXPECT_FALSE(multiPolygon.contains({5.0, 5.0}));
+        }
+    }
+
+    {
+        EXPECT_EQ(MultiPolygon::Polygon(square(0.0, 0.0, 1.0)), MultiPolygon::Union({square(0.0, 0.0, 1.0)}));
+        EXPECT_FALSE(MultiPolygon::Union(Array<Polygon>::Empty()).isDefined());
+    }
+
+    {
+        EXPECT_ANY_THROW(MultiPolygon::Union({square(0.0, 0.0, 1.0), Polygon::Undefined()}));
+        EXPECT_ANY_THROW(MultiPolygon::Union({square(0.0, 0.0, 1.0)}, 0));
+    }
+}
@@ -9,6 +9,7 @@
 
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/BoundingBox.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/MultiPolygon.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Polygon.hpp>
@@ -420,6 +421,41 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon, ContainsPointSet)
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon, Locate)
+{
+    using ostk::core::container::Array;
+
+    using ostk::mathematics::geometry::d2::object::Polygon;
+    using ostk::mathematics::object::MatrixXd;
+
+    {
+        const Polygon polygon = {{{0.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}, {1.0, 0.0}}};
+
+        MatrixXd points(4, 2);
+        points << 0.5, 0.5, 1.0, 0.5, 0.0, 0.0, 2.0, 0.5;
+
+        const Array<Polygon::Location> expectedLocations = {
+            Polygon::Location::Inside,
+            Polygon::Location::Boundary,
+            Polygon::Location::Boundary,
+            Polygon::Location::Outside,
+        };
+
+        EXPECT_EQ(expectedLocations, polygon.locate(points));
+        EXPECT_EQ(expectedLocations, polygon.locate(points, 3));
+    }
+
+    {
+        const Polygon polygon = {{{0.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}, {1.0, 0.0}}};
+
+        EXPECT_TRUE(polygon.locate(MatrixXd(0, 2)).isEmpty());
+
+        EXPECT_ANY_THROW(polygon.locate(MatrixXd::Zero(1, 3)));
+        EXPECT_ANY_THROW(polygon.locate(MatrixXd::Zero(1, 2), 0));
+        EXPECT_ANY_THROW(Polygon::Undefined().locate(MatrixXd::Zero(1, 2)));
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon, GetInnerRingCount)
 {
     using ostk::core::container::Array;
@@ -725,6 +761,86 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon, GetConvexHull)
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon, Simplify)
+{
+    using ostk::core::container::Array;
+    using ostk::core::type::Real;
+
+    using ostk::mathematics::geometry::d2::object::Point;
+    using ostk::mathematics::geometry::d2::object::Polygon;
+
+    {
+        const Polygon polygon = {{{0.0, 0.0}, {1.0, 0.1}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}}};
+
+        EXPECT_EQ(Polygon({{0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}}), polygon.simplify(0.5));
+        EXPECT_EQ(polygon, polygon.simplify(0.05));
+    }
+
+    {
+        // Rings keep at least 3 vertices
+
+        EXPECT_EQ(3, Polygon({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}}).simplify(10.0).getVertexCount());
+    }
+
+    {
+        // Inner rings stay inside the outer ring
+
+        const Array<Polygon::Vertex> outerRing = {{0.0, 0.0}, {0.0, 10.0}, {10.0, 10.0}, {10.0, 0.0}, {5.0, -1.0}};
+        const Array<Array<Polygon::Vertex>> innerRings = {{{4.5, -0.3}, {5.0, -0.6}, {5.5, -0.3}}};
+
+        const Polygon polygon = {outerRing, innerRings};
+
+        EXPECT_EQ(polygon, polygon.simplify(2.0));
+
+        const Polygon simplifiedPolygon = Polygon(outerRing).simplify(2.0);
+
+        EXPECT_EQ(4, simplifiedPolygon.getVertexCount());
+        EXPECT_FALSE(simplifiedPolygon.contains(Point(5.0, -0.5)));
+    }
+
+    {
+        EXPECT_ANY_THROW(Polygon::Undefined().simplify(1.0));
+        EXPECT_ANY_THROW(Polygon({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}}).simplify(Real::Undefined()));
+        EXPECT_ANY_THROW(Polygon({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}}).simplify(-1.0));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon, SimplifyTo)
+{
+    using ostk::core::container::Array;
+
+    using ostk::mathematics::geometry::d2::object::Point;
+    using ostk::mathematics::geometry::d2::object::Polygon;
+
+    {
+        const Polygon polygon = {{{0.0, 0.0}, {1.0, 0.1}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}}};
+
+        EXPECT_EQ(Polygon({{0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}}), polygon.simplifyTo(4));
+        EXPECT_EQ(3, polygon.simplifyTo(3).getVertexCount());
+        EXPECT_EQ(polygon, polygon.simplifyTo(10));
+    }
+
+    {
+        // Outer ring vertices needed to enclose the inner ring are kept
+
+        const Array<Polygon::Vertex> outerRing = {{0.0, 0.0}, {0.0, 10.0}, {10.0, 10.0}, {10.0, 0.0}, {5.0, -1.0}};
+        const Array<Array<Polygon::Vertex>> innerRings = {{{4.5, -0.3}, {5.0, -0.6}, {5.5, -0.3}}};
+
+        const Polygon polygon = {outerRing, innerRings};
+
+        const Polygon simplifiedPolygon = polygon.simplifyTo(3);
+
+        EXPECT_EQ(6, simplifiedPolygon.getVertexCount());
+        EXPECT_EQ(1, simplifiedPolygon.getInnerRingCount());
+        EXPECT_TRUE(simplifiedPolygon.contains(Point(5.0, -0.2)));
+    }
+
+    {
+        EXPECT_ANY_THROW(Polygon::Undefined().simplifyTo(3));
+        EXPECT_ANY_THROW(Polygon({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}}).simplifyTo(2));
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon, IntersectionWith)
 {
     using ostk::mathematics::geometry::d2::Intersection;
@@ -1077,6 +1193,110 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon, UnionWith)
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon, ClipTo)
+{
+    using ostk::core::container::Array;
+
+    using ostk::mathematics::geometry::d2::BoundingBox;
+    using ostk::mathematics::geometry::d2::object::Point;
+    using ostk::mathematics::geometry::d2::object::Polygon;
+
+    const Polygon square = {{{-1.0, -1.0}, {1.0, -1.0}, {1.0, 1.0}, {-1.0, 1.0}}};
+
+    {
+        EXPECT_ANY_THROW(Polygon::Undefined().clipTo(BoundingBox({0.0, 0.0}, {1.0, 1.0})));
+        EXPECT_ANY_THROW(square.clipTo(BoundingBox::Undefined()));
+        EXPECT_ANY_THROW(Polygon::Undefined().clipTo(square));
+        EXPECT_ANY_THROW(square.clipTo(Polygon::Undefined()));
+    }
+
+    // Box clipping
+
+    {
+        const Array<Polygon> polygons = square.clipTo(BoundingBox({0.0, 0.0}, {2.0, 2.0}));
+
+        ASSERT_EQ(1, polygons.getSize());
+        EXPECT_EQ(Polygon({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}}), polygons[0]);
+    }
+
+    {
+        const Array<Polygon> polygons = square.clipTo(BoundingBox({-2.0, -2.0}, {2.0, 2.0}));
+
+        ASSERT_EQ(1, polygons.getSize());
+        EXPECT_EQ(square, polygons[0]);
+    }
+
+    {
+        EXPECT_TRUE(square.clipTo(BoundingBox({2.0, 2.0}, {3.0, 3.0})).isEmpty());
+        EXPECT_TRUE(square.clipTo(BoundingBox({1.0, -1.0}, {2.0, 1.0})).isEmpty());
+    }
+
+    // Concave polygon split into several polygons
+
+    {
+        const Polygon arch = {
+            {{0.0, 0.0}, {0.0, 3.0}, {3.0, 3.0}, {3.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {1.0, 2.0}, {1.0, 0.0}}
+        };
+
+        const Array<Polygon> polygons = arch.clipTo(BoundingBox({0.0, 0.0}, {3.0, 1.0}));
+
+        ASSERT_EQ(2, polygons.getSize());
+
+        EXPECT_EQ(4, polygons[0].getVertexCount());
+        EXPECT_EQ(4, polygons[1].getVertexCount());
+        EXPECT_TRUE(
+            (polygons[0].contains(Point(0.5, 0.5)) && polygons[1].contains(Point(2.5, 0.5))) ||
+            (polygons[0].contains(Point(2.5, 0.5)) && polygons[1].contains(Point(0.5, 0.5)))
+        );
+    }
+
+    // Inner rings
+
+    {
+        const Polygon polygon = {
+            {{-2.0, -2.0}, {2.0, -2.0}, {2.0, 2.0}, {-2.0, 2.0}}, {{{-0.5, -0.5}, {0.5, -0.5}, {0.5, 0.5}, {-0.5, 0.5}}}
+        };
+
+        const Array<Polygon> insidePolygons = polygon.clipTo(BoundingBox({-1.0, -1.0}, {3.0, 3.0}));
+
+        ASSERT_EQ(1, insidePolygons.getSize());
+        EXPECT_EQ(1, insidePolygons[0].getInnerRingCount());
+        EXPECT_FALSE(insidePolygons[0].contains(Point(0.0, 0.0)));
+        EXPECT_TRUE(insidePolygons[0].contains(Point(1.5, 1.5)));
+
+        const Array<Polygon> crossingPolygons = polygon.clipTo(BoundingBox({0.0, 0.0}, {3.0, 3.0}));
+
+        ASSERT_EQ(1, crossingPolygons.getSize());
+        EXPECT_EQ(0, crossingPolygons[0].getInnerRingCount());
+        EXPECT_FALSE(crossingPolygons[0].contains(Point(0.25, 0.25)));
+        EXPECT_TRUE(crossingPolygons[0].contains(Point(1.5, 1.5)));
+
+        EXPECT_TRUE(polygon.clipTo(BoundingBox({-0.25, -0.25}, {0.25, 0.25})).isEmpty());
+    }
+
+    // Convex clip polygon
+
+    {
+        const Polygon triangle = {{{0.0, 0.0}, {2.0, 0.0}, {0.0, 2.0}}};
+
+        const Array<Polygon> polygons = square.clipTo(triangle);
+
+        ASSERT_EQ(1, polygons.getSize());
+        EXPECT_EQ(Polygon({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}}), polygons[0]);
+    }
+
+    // Non convex clip polygon
+
+    {
+        const Polygon arch = {
+            {{0.0, 0.0}, {0.0, 3.0}, {3.0, 3.0}, {3.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {1.0, 2.0}, {1.0, 0.0}}
+        };
+        const Polygon band = {{{0.0, 0.0}, {3.0, 0.0}, {3.0, 1.0}, {0.0, 1.0}}};
+
+        EXPECT_EQ(2, band.clipTo(arch).getSize());
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Polygon, ToString)
 {
     using ostk::core::container::Array;
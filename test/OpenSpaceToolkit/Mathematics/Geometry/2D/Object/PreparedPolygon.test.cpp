@@ -0,0 +1,233 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/LineString.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/PreparedPolygon.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d2::Intersection;
+using ostk::mathematics::geometry::d2::object::LineString;
+using ostk::mathematics::geometry::d2::object::Point;
+using ostk::mathematics::geometry::d2::object::PointSet;
+using ostk::mathematics::geometry::d2::object::Polygon;
+using ostk::mathematics::geometry::d2::object::PreparedPolygon;
+using ostk::mathematics::object::MatrixXd;
+
+class OpenSpaceToolkit_Mathematics_Geometry_2D_Object_PreparedPolygon : public ::testing::Test
+{
+   protected:
+    // Concave polygon (U shape) with a square hole in its base
+
+    const Polygon polygon_ = {
+        {{0.0, 0.0}, {6.0, 0.0}, {6.0, 6.0}, {4.0, 6.0}, {4.0, 2.0}, {2.0, 2.0}, {2.0, 6.0}, {0.0, 6.0}},
+        {{{0.5, 0.5}, {1.5, 0.5}, {1.5, 1.5}, {0.5, 1.5}}}
+    };
+
+    const PreparedPolygon preparedPolygon_ = PreparedPolygon(polygon_);
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_PreparedPolygon, Constructor)
+{
+    {
+        EXPECT_NO_THROW(PreparedPolygon preparedPolygon(polygon_));
+    }
+
+    {
+        EXPECT_ANY_THROW(PreparedPolygon preparedPolygon(Polygon::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_PreparedPolygon, IsValid)
+{
+    {
+        EXPECT_TRUE(preparedPolygon_.isValid());
+    }
+
+    {
+        const Polygon selfIntersectingPolygon = {{{0.0, 0.0}, {2.0, 2.0}, {2.0, 0.0}, {0.0, 2.0}}};
+
+        EXPECT_FALSE(PreparedPolygon(selfIntersectingPolygon).isValid());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_PreparedPolygon, AccessPolygon)
+{
+    {
+        EXPECT_EQ(polygon_, preparedPolygon_.accessPolygon());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_PreparedPolygon, Intersects)
+{
+    {
+        EXPECT_TRUE(preparedPolygon_.intersects(Polygon({{1.0, 1.0}, {3.0, 1.0}, {3.0, 3.0}, {1.0, 3.0}})));
+        EXPECT_TRUE(preparedPolygon_.intersects(Polygon({{-1.0, -1.0}, {7.0, -1.0}, {7.0, 7.0}, {-1.0, 7.0}})));
+        EXPECT_TRUE(preparedPolygon_.intersects(Polygon({{6.0, 0.0}, {7.0, 0.0}, {7.0, 1.0}, {6.0, 1.0}})));
+
+        EXPECT_FALSE(preparedPolygon_.intersects(Polygon({{2.5, 3.0}, {3.5, 3.0}, {3.5, 5.0}, {2.5, 5.0}})));
+        EXPECT_FALSE(preparedPolygon_.intersects(Polygon({{0.7, 0.7}, {1.3, 0.7}, {1.3, 1.3}, {0.7, 1.3}})));
+        EXPECT_FALSE(preparedPolygon_.intersects(Polygon({{10.0, 10.0}, {11.0, 10.0}, {11.0, 11.0}, {10.0, 11.0}})));
+    }
+
+    {
+        EXPECT_ANY_THROW(preparedPolygon_.intersects(Polygon::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_PreparedPolygon, Contains_Point)
+{
+    {
+        EXPECT_TRUE(preparedPolygon_.contains(Point(1.0, 0.25)));
+        EXPECT_TRUE(preparedPolygon_.contains(Point(5.0, 5.0)));
+        EXPECT_TRUE(preparedPolygon_.contains(Point(0.0, 0.0)));
+        EXPECT_TRUE(preparedPolygon_.contains(Point(3.0, 2.0)));
+        EXPECT_TRUE(preparedPolygon_.contains(Point(1.0, 0.5)));
+
+        EXPECT_FALSE(preparedPolygon_.contains(Point(1.0, 1.0)));
+        EXPECT_FALSE(preparedPolygon_.contains(Point(3.0, 4.0)));
+        EXPECT_FALSE(preparedPolygon_.contains(Point(-1.0, 3.0)));
+        EXPECT_FALSE(preparedPolygon_.contains(Point(3.0, 6.0)));
+    }
+
+    {
+        for (double x = -0.5; x <= 6.5; x += 0.25)
+        {
+            for (double y = -0.5; y <= 6.5; y += 0.25)
+            {
+                const Point point = {x, y};
+
+                EXPECT_EQ(polygon_.contains(point), preparedPolygon_.contains(point)) << point.toString();
+            }
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(preparedPolygon_.contains(Point::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_PreparedPolygon, Contains_PointSet)
+{
+    {
+        EXPECT_TRUE(preparedPolygon_.contains(PointSet({{1.0, 0.25}, {5.0, 5.0}, {0.0, 6.0}})));
+
+        EXPECT_FALSE(preparedPolygon_.contains(PointSet({{1.0, 0.25}, {3.0, 4.0}})));
+    }
+
+    {
+        EXPECT_ANY_THROW(preparedPolygon_.contains(PointSet::Empty()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_PreparedPolygon, Contains_LineString)
+{
+    {
+        EXPECT_TRUE(preparedPolygon_.contains(LineString({{0.0, 0.0}, {6.0, 0.0}, {5.0, 5.0}})));
+
+        EXPECT_FALSE(preparedPolygon_.contains(LineString({{1.0, 5.0}, {5.0, 5.0}})));
+        EXPECT_FALSE(preparedPolygon_.contains(LineString({{0.25, 1.0}, {1.75, 1.0}})));
+        EXPECT_FALSE(preparedPolygon_.contains(LineString({{1.0, 0.25}, {7.0, 0.25}})));
+    }
+
+    {
+        EXPECT_ANY_THROW(preparedPolygon_.contains(LineString::Empty()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_PreparedPolygon, Locate)
+{
+    {
+        EXPECT_EQ(Polygon::Location::Inside, preparedPolygon_.locate(Point(5.0, 5.0)));
+        EXPECT_EQ(Polygon::Location::Boundary, preparedPolygon_.locate(Point(3.0, 2.0)));
+        EXPECT_EQ(Polygon::Location::Boundary, preparedPolygon_.locate(Point(1.5, 1.0)));
+        EXPECT_EQ(Polygon::Location::Outside, preparedPolygon_.locate(Point(1.0, 1.0)));
+        EXPECT_EQ(Polygon::Location::Outside, preparedPolygon_.locate(Point(3.0, 4.0)));
+    }
+
+    {
+        MatrixXd points(29 * 29, 2);
+
+        for (Index i = 0; i < 29; ++i)
+        {
+            for (Index j = 0; j < 29; ++j)
+            {
+                points.row(i * 29 + j) << -0.5 + 0.25 * i, -0.5 + 0.25 * j;
+            }
+        }
+
+        const Array<Polygon::Location> locations = preparedPolygon_.locate(points);
+
+        ASSERT_EQ(Size(points.rows()), locations.getSize());
+
+        for (Index i = 0; i < locations.getSize(); ++i)
+        {
+            EXPECT_EQ(preparedPolygon_.locate(Point(points(i, 0), points(i, 1))), locations[i]);
+        }
+
+        EXPECT_EQ(locations, preparedPolygon_.locate(points, 4));
+        EXPECT_EQ(locations, preparedPolygon_.locate(points, 10000));
+    }
+
+    {
+        EXPECT_ANY_THROW(preparedPolygon_.locate(Point::Undefined()));
+        EXPECT_ANY_THROW(preparedPolygon_.locate(MatrixXd::Zero(2, 3)));
+        EXPECT_ANY_THROW(preparedPolygon_.locate(MatrixXd::Zero(2, 2), 0));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_PreparedPolygon, IntersectionWith)
+{
+    {
+        const Polygon polygon = {{{3.0, 1.0}, {7.0, 1.0}, {7.0, 3.0}, {3.0, 3.0}}};
+
+        EXPECT_EQ(polygon_.intersectionWith(polygon), preparedPolygon_.intersectionWith(polygon));
+    }
+
+    {
+        const Polygon polygon = {{{10.0, 10.0}, {11.0, 10.0}, {11.0, 11.0}, {10.0, 11.0}}};
+
+        EXPECT_TRUE(preparedPolygon_.intersectionWith(polygon).isEmpty());
+    }
+
+    {
+        const Polygon selfIntersectingPolygon = {{{0.0, 0.0}, {2.0, 2.0}, {2.0, 0.0}, {0.0, 2.0}}};
+
+        EXPECT_ANY_THROW(PreparedPolygon(selfIntersectingPolygon).intersectionWith(polygon_));
+        EXPECT_ANY_THROW(preparedPolygon_.intersectionWith(selfIntersectingPolygon));
+        EXPECT_ANY_THROW(preparedPolygon_.intersectionWith(Polygon::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_PreparedPolygon, DifferenceWith)
+{
+    {
+        const Polygon polygon = {{{3.0, 1.0}, {7.0, 1.0}, {7.0, 3.0}, {3.0, 3.0}}};
+
+        EXPECT_EQ(polygon_.differenceWith(polygon), preparedPolygon_.differenceWith(polygon));
+    }
+
+    {
+        const Polygon polygon = {{{10.0, 10.0}, {11.0, 10.0}, {11.0, 11.0}, {10.0, 11.0}}};
+
+        const Intersection difference = preparedPolygon_.differenceWith(polygon);
+
+        ASSERT_TRUE(difference.is<Polygon>());
+        EXPECT_EQ(polygon_, difference.as<Polygon>());
+    }
+
+    {
+        EXPECT_ANY_THROW(preparedPolygon_.differenceWith(Polygon::Undefined()));
+    }
+}
@@ -1,5 +1,9 @@
 /// Apache License 2.0
 
+#include <random>
+#include <set>
+#include <utility>
+
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/PointSet.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object/Segment.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Transformation.hpp>
@@ -314,3 +318,155 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Segment, Undefined)
         EXPECT_FALSE(Segment::Undefined().isDefined());
     }
 }
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Object_Segment, IntersectionPoints)
+{
+    using ostk::core::container::Array;
+    using ostk::core::type::Index;
+
+    using ostk::mathematics::geometry::d2::object::Point;
+    using ostk::mathematics::geometry::d2::object::Segment;
+
+    {
+        EXPECT_TRUE(Segment::IntersectionPoints(Array<Segment>::Empty()).isEmpty());
+        EXPECT_ANY_THROW(Segment::IntersectionPoints({Segment({0.0, 0.0}, {1.0, 1.0}), Segment::Undefined()}));
+    }
+
+    {
+        const Array<Segment::IntersectionPoint> intersectionPoints =
+            Segment::IntersectionPoints({Segment({0.0, 0.0}, {2.0, 2.0}), Segment({0.0, 2.0}, {2.0, 0.0})});
+
+        ASSERT_EQ(1, intersectionPoints.getSize());
+
+        EXPECT_EQ(0, std::get<0>(intersectionPoints[0]));
+        EXPECT_EQ(1, std::get<1>(intersectionPoints[0]));
+        EXPECT_TRUE(std::get<2>(intersectionPoints[0]).isNear(Point(1.0, 1.0), 1e-15));
+    }
+
+    {
+        const Array<Segment::IntersectionPoint> intersectionPoints =
+            Segment::IntersectionPoints({Segment({0.0, 0.0}, {1.0, 0.0}), Segment({0.0, 1.0}, {1.0, 1.0})});
+
+        EXPECT_TRUE(intersectionPoints.isEmpty());
+    }
+
+    // Touching segments, vertical segment, degenerate segment
+
+    {
+        const Array<Segment::IntersectionPoint> intersectionPoints = Segment::IntersectionPoints({
+            Segment({0.0, 0.0}, {1.0, 0.0}),
+            Segment({1.0, 0.0}, {1.0, 1.0}),
+            Segment({0.5, 0.5}, {0.5, 0.5}),
+            Segment({0.5, 0.0}, {0.5, -1.0}),
+        });
+
+        ASSERT_EQ(2, intersectionPoints.getSize());
+
+        EXPECT_EQ(0, std::get<0>(intersectionPoints[0]));
+        EXPECT_EQ(1, std::get<1>(intersectionPoints[0]));
+        EXPECT_EQ(Point(1.0, 0.0), std::get<2>(intersectionPoints[0]));
+
+        EXPECT_EQ(0, std::get<0>(intersectionPoints[1]));
+        EXPECT_EQ(3, std::get<1>(intersectionPoints[1]));
+        EXPECT_EQ(Point(0.5, 0.0), std::get<2>(intersectionPoints[1]));
+    }
+
+    // Collinear overlap, crossed by a third segment
+
+    {
+        const Array<Segment::IntersectionPoint> intersectionPoints = Segment::IntersectionPoints({
+            Segment({0.0, 0.0}, {2.0, 0.0}),
+            Segment({3.0, 0.0}, {1.0, 0.0}),
+            Segment({1.5, -1.0}, {1.5, 1.0}),
+        });
+
+        ASSERT_EQ(4, intersectionPoints.getSize());
+
+        EXPECT_EQ(Point(1.0, 0.0), std::get<2>(intersectionPoints[0]));
+        EXPECT_EQ(Point(2.0, 0.0), std::get<2>(intersectionPoints[1]));
+
+        EXPECT_EQ(0, std::get<0>(intersectionPoints[2]));
+        EXPECT_EQ(2, std::get<1>(intersectionPoints[2]));
+        EXPECT_EQ(Point(1.5, 0.0), std::get<2>(intersectionPoints[2]));
+
+        EXPECT_EQ(1, std::get<0>(intersectionPoints[3]));
+        EXPECT_EQ(2, std::get<1>(intersectionPoints[3]));
+        EXPECT_EQ(Point(1.5, 0.0), std::get<2>(intersectionPoints[3]));
+    }
+
+    // Concurrent segments
+
+    {
+        const Array<Segment::IntersectionPoint> intersectionPoints = Segment::IntersectionPoints({
+            Segment({-1.0, 0.0}, {1.0, 0.0}),
+            Segment({0.0, -1.0}, {0.0, 1.0}),
+            Segment({-1.0, -1.0}, {1.0, 1.0}),
+            Segment({-1.0, 1.0}, {1.0, -1.0}),
+        });
+
+        ASSERT_EQ(6, intersectionPoints.getSize());
+
+        for (const auto& intersectionPoint : intersectionPoints)
+        {
+            EXPECT_EQ(Point(0.0, 0.0), std::get<2>(intersectionPoint));
+        }
+    }
+
+    // Same pairs as all-pairs testing, on random segments
+
+    {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+        Array<Segment> segments = Array<Segment>::Empty();
+
+        for (Index segmentIndex = 0; segmentIndex < 200; ++segmentIndex)
+        {
+            const Point firstPoint = {distribution(generator), distribution(generator)};
+            const Point secondPoint = {
+                firstPoint.x() + 0.2 * distribution(generator), firstPoint.y() + 0.2 * distribution(generator)
+            };
+
+            segments.add(Segment(firstPoint, secondPoint));
+        }
+
+        const auto side = [](const Point& A, const Point& B, const Point& C) -> double
+        {
+            return (B.x() - A.x()) * (C.y() - A.y()) - (B.y() - A.y()) * (C.x() - A.x());
+        };
+
+        std::set<std::pair<Index, Index>> expectedPairs;
+
+        for (Index firstIndex = 0; firstIndex < segments.getSize(); ++firstIndex)
+        {
+            for (Index secondIndex = firstIndex + 1; secondIndex < segments.getSize(); ++secondIndex)
+            {
+                const Segment& first = segments[firstIndex];
+                const Segment& second = segments[secondIndex];
+
+                if ((side(first.getFirstPoint(), first.getSecondPoint(), second.getFirstPoint()) *
+                         side(first.getFirstPoint(), first.getSecondPoint(), second.getSecondPoint()) <
+                     0.0) &&
+                    (side(second.getFirstPoint(), second.getSecondPoint(), first.getFirstPoint()) *
+                         side(second.getFirstPoint(), second.getSecondPoint(), first.getSecondPoint()) <
+                     0.0))
+                {
+                    expectedPairs.insert({firstIndex, secondIndex});
+                }
+            }
+        }
+
+        std::set<std::pair<Index, Index>> pairs;
+
+        for (const auto& intersectionPoint : Segment::IntersectionPoints(segments))
+        {
+            pairs.insert({std::get<0>(intersectionPoint), std::get<1>(intersectionPoint)});
+
+            EXPECT_GT(1e-12, segments[std::get<0>(intersectionPoint)].distanceTo(std::get<2>(intersectionPoint)));
+            EXPECT_GT(1e-12, segments[std::get<1>(intersectionPoint)].distanceTo(std::get<2>(intersectionPoint)));
+        }
+
+        EXPECT_FALSE(expectedPairs.empty());
+        EXPECT_EQ(expectedPairs, pairs);
+    }
+}
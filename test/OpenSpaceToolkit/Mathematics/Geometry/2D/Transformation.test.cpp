@@ -150,6 +150,105 @@
 
 // }
 
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Transformation, ApplyToPoints)
+{
+    using ostk::mathematics::geometry::Angle;
+    using ostk::mathematics::geometry::d2::object::Point;
+    using ostk::mathematics::geometry::d2::Transformation;
+    using ostk::mathematics::object::MatrixXd;
+    using ostk::mathematics::object::Vector2d;
+
+    const MatrixXd points = MatrixXd::Random(2, 100);
+
+    {
+        for (const Transformation& transformation :
+             {Transformation::Identity(), Transformation::Translation({1.0, 2.0}), Transformation::RotationAround({1.0, 2.0}, Angle::Degrees(30.0))})
+        {
+            MatrixXd pointMatrix = points;
+
+            transformation.applyToPoints(pointMatrix);
+
+            for (Eigen::Index pointIndex = 0; pointIndex < points.cols(); ++pointIndex)
+            {
+                const Vector2d point_ref = transformation.applyTo(Point::Vector(points.col(pointIndex))).asVector();
+
+                EXPECT_TRUE(pointMatrix.col(pointIndex).isApprox(point_ref, 1e-12));
+            }
+        }
+    }
+
+    {
+        MatrixXd pointMatrix = points;
+
+        Transformation::Translation({1.0, 2.0}).applyToPoints(pointMatrix.middleCols(10, 5));
+
+        EXPECT_TRUE(pointMatrix.leftCols(10).isApprox(points.leftCols(10)));
+        EXPECT_TRUE(pointMatrix.col(10).isApprox(Vector2d(points.col(10)) + Vector2d(1.0, 2.0)));
+        EXPECT_TRUE(pointMatrix.rightCols(85).isApprox(points.rightCols(85)));
+    }
+
+    {
+        MatrixXd pointMatrix = MatrixXd::Zero(2, 0);
+
+        EXPECT_NO_THROW(Transformation::Identity().applyToPoints(pointMatrix));
+    }
+
+    {
+        MatrixXd pointMatrix = MatrixXd::Zero(3, 10);
+
+        EXPECT_ANY_THROW(Transformation::Identity().applyToPoints(pointMatrix));
+
+        MatrixXd validPointMatrix = points;
+
+        EXPECT_ANY_THROW(Transformation::Undefined().applyToPoints(validPointMatrix));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_2D_Transformation, ApplyToVectors)
+{
+    using ostk::mathematics::geometry::Angle;
+    using ostk::mathematics::geometry::d2::Transformation;
+    using ostk::mathematics::object::MatrixXd;
+    using ostk::mathematics::object::Vector2d;
+
+    const MatrixXd vectors = MatrixXd::Random(2, 100);
+
+    {
+        for (const Transformation& transformation :
+             {Transformation::Identity(), Transformation::Translation({1.0, 2.0}), Transformation::RotationAround({1.0, 2.0}, Angle::Degrees(30.0))})
+        {
+            MatrixXd vectorMatrix = vectors;
+
+            transformation.applyToVectors(vectorMatrix);
+
+            for (Eigen::Index vectorIndex = 0; vectorIndex < vectors.cols(); ++vectorIndex)
+            {
+                const Vector2d vector_ref = transformation.applyTo(Vector2d(vectors.col(vectorIndex)));
+
+                EXPECT_TRUE(vectorMatrix.col(vectorIndex).isApprox(vector_ref, 1e-12));
+            }
+        }
+    }
+
+    {
+        MatrixXd vectorMatrix = vectors;
+
+        Transformation::Translation({1.0, 2.0}).applyToVectors(vectorMatrix);
+
+        EXPECT_TRUE(vectorMatrix.isApprox(vectors));
+    }
+
+    {
+        MatrixXd vectorMatrix = MatrixXd::Zero(3, 10);
+
+        EXPECT_ANY_THROW(Transformation::Identity().applyToVectors(vectorMatrix));
+
+        MatrixXd validVectorMatrix = vectors;
+
+        EXPECT_ANY_THROW(Transformation::Undefined().applyToVectors(validVectorMatrix));
+    }
+}
+
 // TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Transformation, Undefined)
 // {
 
@@ -0,0 +1,273 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/BoundingBox.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Line.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/LineString.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Segment.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+
+#include <Global.test.hpp>
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_BoundingBox, Constructor)
+{
+    using ostk::mathematics::geometry::d3::BoundingBox;
+    using ostk::mathematics::geometry::d3::object::Point;
+
+    {
+        EXPECT_NO_THROW(BoundingBox({0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}));
+        EXPECT_NO_THROW(BoundingBox({1.0, 2.0, 3.0}, {1.0, 2.0, 3.0}));
+        EXPECT_NO_THROW(BoundingBox(Point::Undefined(), Point::Undefined()));
+    }
+
+    {
+        EXPECT_ANY_THROW(BoundingBox({1.0, 0.0, 0.0}, {0.0, 1.0, 1.0}));
+        EXPECT_ANY_THROW(BoundingBox({0.0, 0.0, 2.0}, {1.0, 1.0, 1.0}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_BoundingBox, EqualToOperator)
+{
+    using ostk::mathematics::geometry::d3::BoundingBox;
+
+    {
+        EXPECT_TRUE(BoundingBox({0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}) == BoundingBox({0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}));
+        EXPECT_FALSE(BoundingBox({0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}) == BoundingBox({0.0, 0.0, 0.0}, {1.0, 2.0, 4.0}));
+        EXPECT_FALSE(BoundingBox({0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}) == BoundingBox::Undefined());
+        EXPECT_FALSE(BoundingBox::Undefined() == BoundingBox::Undefined());
+    }
+
+    {
+        EXPECT_TRUE(BoundingBox({0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}) != BoundingBox({0.0, 0.0, 0.0}, {1.0, 2.0, 4.0}));
+        EXPECT_TRUE(BoundingBox::Undefined() != BoundingBox::Undefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_BoundingBox, IsDefined)
+{
+    using ostk::mathematics::geometry::d3::BoundingBox;
+
+    {
+        EXPECT_TRUE(BoundingBox({0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}).isDefined());
+        EXPECT_FALSE(BoundingBox::Undefined().isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_BoundingBox, Intersects)
+{
+    using ostk::mathematics::geometry::d3::BoundingBox;
+
+    {
+        const BoundingBox boundingBox = {{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}};
+
+        EXPECT_TRUE(boundingBox.intersects(boundingBox));
+        EXPECT_TRUE(boundingBox.intersects({{0.5, 0.5, 0.5}, {2.0, 2.0, 2.0}}));
+        EXPECT_TRUE(boundingBox.intersects({{0.2, 0.2, 0.2}, {0.8, 0.8, 0.8}}));
+        EXPECT_TRUE(boundingBox.intersects({{1.0, 0.0, 0.0}, {2.0, 1.0, 1.0}}));
+        EXPECT_TRUE(boundingBox.intersects({{1.0, 1.0, 1.0}, {2.0, 2.0, 2.0}}));
+
+        EXPECT_FALSE(boundingBox.intersects({{1.5, 0.0, 0.0}, {2.0, 1.0, 1.0}}));
+        EXPECT_FALSE(boundingBox.intersects({{0.0, 0.0, -2.0}, {1.0, 1.0, -0.5}}));
+    }
+
+    {
+        EXPECT_ANY_THROW(BoundingBox::Undefined().intersects({{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}}));
+        EXPECT_ANY_THROW(BoundingBox({0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}).intersects(BoundingBox::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_BoundingBox, Contains)
+{
+    using ostk::mathematics::geometry::d3::BoundingBox;
+    using ostk::mathematics::geometry::d3::object::Point;
+
+    {
+        const BoundingBox boundingBox = {{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}};
+
+        EXPECT_TRUE(boundingBox.contains(Point(0.5, 0.5, 0.5)));
+        EXPECT_TRUE(boundingBox.contains(Point(1.0, 1.0, 1.0)));
+        EXPECT_FALSE(boundingBox.contains(Point(0.5, 0.5, 1.5)));
+
+        EXPECT_TRUE(boundingBox.contains(boundingBox));
+        EXPECT_TRUE(boundingBox.contains(BoundingBox({0.2, 0.2, 0.2}, {0.8, 1.0, 0.8})));
+        EXPECT_FALSE(boundingBox.contains(BoundingBox({0.5, 0.5, 0.5}, {2.0, 2.0, 2.0})));
+    }
+
+    {
+        EXPECT_ANY_THROW(BoundingBox::Undefined().contains(Point(0.0, 0.0, 0.0)));
+        EXPECT_ANY_THROW(BoundingBox({0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}).contains(Point::Undefined()));
+        EXPECT_ANY_THROW(BoundingBox({0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}).contains(BoundingBox::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_BoundingBox, Getters)
+{
+    using ostk::mathematics::geometry::d3::BoundingBox;
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::object::Vector3d;
+
+    {
+        const BoundingBox boundingBox = {{0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}};
+
+        EXPECT_EQ(Point(0.0, 0.0, 0.0), boundingBox.getLowerBound());
+        EXPECT_EQ(Point(1.0, 2.0, 3.0), boundingBox.getUpperBound());
+        EXPECT_EQ(Point(0.5, 1.0, 1.5), boundingBox.getCenter());
+        EXPECT_EQ(Vector3d(1.0, 2.0, 3.0), boundingBox.getSize());
+    }
+
+    {
+        EXPECT_ANY_THROW(BoundingBox::Undefined().getLowerBound());
+        EXPECT_ANY_THROW(BoundingBox::Undefined().getUpperBound());
+        EXPECT_ANY_THROW(BoundingBox::Undefined().getCenter());
+        EXPECT_ANY_THROW(BoundingBox::Undefined().getSize());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_BoundingBox, UnionWith)
+{
+    using ostk::mathematics::geometry::d3::BoundingBox;
+
+    {
+        EXPECT_EQ(
+            BoundingBox({-1.0, 0.0, 0.0}, {1.0, 2.0, 3.0}),
+            BoundingBox({0.0, 0.0, 0.0}, {1.0, 2.0, 1.0}).unionWith({{-1.0, 1.0, 0.0}, {0.0, 1.0, 3.0}})
+        );
+    }
+
+    {
+        EXPECT_FALSE(BoundingBox({0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}).unionWith(BoundingBox::Undefined()).isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_BoundingBox, Points)
+{
+    using ostk::core::container::Array;
+
+    using ostk::mathematics::geometry::d3::BoundingBox;
+    using ostk::mathematics::geometry::d3::object::Point;
+
+    {
+        EXPECT_EQ(
+            BoundingBox({-1.0, 0.0, -3.0}, {2.0, 5.0, 1.0}),
+            BoundingBox::Points({{0.0, 0.0, 0.0}, {-1.0, 5.0, 1.0}, {2.0, 1.0, -3.0}})
+        );
+    }
+
+    {
+        EXPECT_FALSE(BoundingBox::Points(Array<Point>::Empty()).isDefined());
+        EXPECT_ANY_THROW(BoundingBox::Points({{0.0, 0.0, 0.0}, Point::Undefined()}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_BoundingBox, GetBoundingBox)
+{
+    using ostk::mathematics::geometry::d3::BoundingBox;
+    using ostk::mathematics::geometry::d3::object::Composite;
+    using ostk::mathematics::geometry::d3::object::Line;
+    using ostk::mathematics::geometry::d3::object::LineString;
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::PointSet;
+    using ostk::mathematics::geometry::d3::object::Segment;
+    using ostk::mathematics::geometry::d3::Transformation;
+    using ostk::mathematics::object::Vector3d;
+
+    {
+        EXPECT_EQ(BoundingBox({1.0, 2.0, 3.0}, {1.0, 2.0, 3.0}), Point(1.0, 2.0, 3.0).getBoundingBox());
+        EXPECT_EQ(
+            BoundingBox({0.0, -2.0, 0.0}, {1.0, 2.0, 3.0}), Segment({1.0, -2.0, 3.0}, {0.0, 2.0, 0.0}).getBoundingBox()
+        );
+        EXPECT_EQ(
+            BoundingBox({0.0, 0.0, -1.0}, {2.0, 1.0, 0.0}),
+            LineString({{0.0, 0.0, 0.0}, {2.0, 1.0, 0.0}, {1.0, 1.0, -1.0}}).getBoundingBox()
+        );
+        EXPECT_FALSE(Line({0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}).getBoundingBox().isDefined());
+    }
+
+    {
+        PointSet pointSet = {{{0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}}};
+
+        EXPECT_EQ(BoundingBox({0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}), pointSet.getBoundingBox());
+
+        pointSet.applyTransformation(Transformation::Translation(Vector3d(1.0, 0.0, 0.0)));
+
+        EXPECT_EQ(BoundingBox({1.0, 0.0, 0.0}, {2.0, 2.0, 3.0}), pointSet.getBoundingBox());
+    }
+
+    {
+        Composite composite = Composite(Point(0.0, 0.0, 0.0)) + Composite(Segment({1.0, 1.0, 1.0}, {2.0, -1.0, 0.5}));
+
+        EXPECT_EQ(BoundingBox({0.0, -1.0, 0.0}, {2.0, 1.0, 1.0}), composite.getBoundingBox());
+
+        composite += Composite(Line({0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}));
+
+        EXPECT_FALSE(composite.getBoundingBox().isDefined());
+        EXPECT_FALSE(Composite::Empty().getBoundingBox().isDefined());
+    }
+
+    {
+        EXPECT_ANY_THROW(Point::Undefined().getBoundingBox());
+        EXPECT_ANY_THROW(Segment::Undefined().getBoundingBox());
+        EXPECT_ANY_THROW(LineString::Empty().getBoundingBox());
+        EXPECT_ANY_THROW(PointSet::Empty().getBoundingBox());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_BoundingBox, EarlyReject)
+{
+    using ostk::mathematics::geometry::d3::Object;
+    using ostk::mathematics::geometry::d3::object::Cuboid;
+    using ostk::mathematics::geometry::d3::object::Ellipsoid;
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::Segment;
+    using ostk::mathematics::geometry::d3::object::Sphere;
+    using ostk::mathematics::object::Vector3d;
+
+    {
+        const Segment segment = {{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}};
+        const Sphere sphere = {{3.0, 3.0, 3.0}, 1.0};
+        const Ellipsoid ellipsoid = {{3.0, 3.0, 3.0}, 1.0, 0.5, 0.5};
+
+        const Object& object = segment;
+        const Object& sphereObject = sphere;
+        const Object& ellipsoidObject = ellipsoid;
+
+        // Supported pairs with disjoint bounding boxes do not intersect
+
+        EXPECT_FALSE(object.intersects(sphere));
+        EXPECT_FALSE(object.intersects(ellipsoid));
+        EXPECT_FALSE(sphereObject.intersects(segment));
+        EXPECT_FALSE(ellipsoidObject.intersects(segment));
+
+        // Supported pairs with overlapping bounding boxes fall through to the exact routine
+
+        EXPECT_TRUE(object.intersects(Sphere({1.0, 1.0, 1.0}, 0.5)));
+        EXPECT_FALSE(object.intersects(Sphere({1.0, 0.0, 0.0}, 0.5)));
+    }
+
+    {
+        // Unsupported pairs keep throwing, whether or not their bounding boxes are disjoint
+
+        const Ellipsoid ellipsoid = {{0.0, 0.0, 0.0}, 1.0, 1.0, 1.0};
+        const Cuboid cuboid = {
+            {0.0, 0.0, 0.0}, {Vector3d::UnitX(), Vector3d::UnitY(), Vector3d::UnitZ()}, {1.0, 1.0, 1.0}
+        };
+        const Segment segment = {{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}};
+
+        const Object& ellipsoidObject = ellipsoid;
+        const Object& cuboidObject = cuboid;
+        const Object& segmentObject = segment;
+
+        EXPECT_ANY_THROW(ellipsoidObject.intersects(Ellipsoid({10.0, 0.0, 0.0}, 1.0, 1.0, 1.0)));
+        EXPECT_ANY_THROW(ellipsoidObject.intersects(Ellipsoid({0.5, 0.0, 0.0}, 1.0, 1.0, 1.0)));
+        EXPECT_ANY_THROW(ellipsoidObject.intersects(Point(10.0, 0.0, 0.0)));
+        EXPECT_ANY_THROW(cuboidObject.intersects(Sphere({10.0, 0.0, 0.0}, 1.0)));
+        EXPECT_ANY_THROW(segmentObject.intersects(Segment({2.0, 2.0, 2.0}, {3.0, 3.0, 3.0})));
+        EXPECT_ANY_THROW(segmentObject.intersects(Segment({0.5, 0.5, 0.5}, {3.0, 3.0, 3.0})));
+        EXPECT_ANY_THROW(segmentObject.contains(Segment({0.5, 0.5, 0.5}, {2.0, 2.0, 2.0})));
+    }
+}
@@ -2,9 +2,12 @@
 
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Composite.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ellipsoid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Line.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Plane.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
@@ -13,6 +16,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ray.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Segment.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationMatrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationVector.hpp>
 
@@ -967,6 +971,185 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Composite, ConstIterator)
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Composite, BuildIndex)
+{
+    using ostk::core::container::Array;
+    using ostk::core::type::Real;
+    using ostk::core::type::Unique;
+
+    using ostk::mathematics::geometry::Angle;
+    using ostk::mathematics::geometry::d3::Object;
+    using ostk::mathematics::geometry::d3::object::Composite;
+    using ostk::mathematics::geometry::d3::object::Ellipsoid;
+    using ostk::mathematics::geometry::d3::object::Plane;
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::Ray;
+    using ostk::mathematics::geometry::d3::Transformation;
+    using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+    using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
+    using ostk::mathematics::object::Vector3d;
+
+    // Grid of small ellipsoids, and a plane far away (unbounded, never culled)
+
+    const auto makeComposite = []() -> Composite
+    {
+        Array<Unique<Object>> objects = Array<Unique<Object>>::Empty();
+
+        for (int i = 0; i < 8; ++i)
+        {
+            for (int j = 0; j < 8; ++j)
+            {
+                for (int k = 0; k < 8; ++k)
+                {
+                    const Quaternion orientation =
+                        Quaternion::RotationVector(RotationVector({1.0, 0.0, 0.0}, Angle::Degrees(10.0 * (i + j + k))));
+
+                    objects.emplace_back(std::make_unique<Ellipsoid>(
+                        Point {4.0 * i, 4.0 * j, 4.0 * k}, 0.5 + 0.1 * i, 0.5 + 0.1 * j, 0.3, orientation
+                    ));
+                }
+            }
+        }
+
+        objects.emplace_back(std::make_unique<Plane>(Point {0.0, 0.0, 1000.0}, Vector3d {0.0, 0.0, 1.0}));
+
+        return Composite {std::move(objects)};
+    };
+
+    const auto makeRays = []() -> Array<Ray>
+    {
+        Array<Ray> rays = Array<Ray>::Empty();
+
+        for (int index = 0; index < 500; ++index)
+        {
+            const Point origin = {
+                -10.0 + std::fmod(index * 7.31, 50.0),
+                -10.0 + std::fmod(index * 3.17, 50.0),
+                std::fmod(index * 5.71, 30.0),
+            };
+            const Vector3d direction =
+                Vector3d {std::cos(index * 0.37), std::sin(index * 0.37), std::sin(index * 0.11) - 0.5}.normalized();
+
+            rays.add(Ray {origin, direction});
+        }
+
+        return rays;
+    };
+
+    {
+        const Composite composite = makeComposite();
+
+        Composite indexedComposite = makeComposite();
+
+        EXPECT_FALSE(indexedComposite.isIndexed());
+
+        indexedComposite.buildIndex();
+
+        EXPECT_TRUE(indexedComposite.isIndexed());
+
+        for (const auto& ray : makeRays())
+        {
+            EXPECT_EQ(composite.intersects(ray), indexedComposite.intersects(ray));
+        }
+
+        const Composite copiedComposite = indexedComposite;
+
+        EXPECT_TRUE(copiedComposite.isIndexed());
+
+        for (const auto& ray : makeRays())
+        {
+            EXPECT_EQ(composite.intersects(ray), copiedComposite.intersects(ray));
+        }
+    }
+
+    {
+        const Composite composite = makeComposite();
+
+        Composite indexedComposite = makeComposite();
+
+        indexedComposite.buildIndex();
+
+        EXPECT_TRUE(indexedComposite.intersects(Ray({0.2, -10.0, 0.0}, {0.0, 1.0, 0.0})));
+        EXPECT_FALSE(indexedComposite.intersects(Ray({2.0, -10.0, 2.0}, {0.0, 1.0, 0.0})));
+        EXPECT_FALSE(indexedComposite.intersects(Ray({-10.0, -10.0, 0.0}, {-1.0, 0.0, 0.0})));
+        EXPECT_TRUE(indexedComposite.intersects(Ray({-10.0, -10.0, 0.0}, {0.0, 0.0, 1.0})));
+
+        EXPECT_FALSE(indexedComposite.contains(Point {100.0, 100.0, 100.0}));
+    }
+
+    {
+        const Transformation transformation = Transformation::Translation({1.5, -2.0, 3.0});
+
+        Composite composite = makeComposite();
+
+        Composite indexedComposite = makeComposite();
+
+        indexedComposite.buildIndex();
+
+        composite.applyTransformation(transformation);
+        indexedComposite.applyTransformation(transformation);
+
+        EXPECT_TRUE(indexedComposite.isIndexed());
+
+        for (const auto& ray : makeRays())
+        {
+            EXPECT_EQ(composite.intersects(ray), indexedComposite.intersects(ray));
+        }
+
+        indexedComposite += makeComposite();
+        composite += makeComposite();
+
+        EXPECT_TRUE(indexedComposite.isIndexed());
+
+        for (const auto& ray : makeRays())
+        {
+            EXPECT_EQ(composite.intersects(ray), indexedComposite.intersects(ray));
+        }
+    }
+
+    {
+        const Transformation transformation = Transformation::Translation({-20.0, 5.0, 0.5});
+
+        Composite shiftedComposite = makeComposite();
+
+        shiftedComposite.applyTransformation(transformation);
+
+        Composite indexedComposite = makeComposite();
+
+        indexedComposite.buildIndex();
+
+        const Composite composite = makeComposite() + shiftedComposite;
+        const Composite leftIndexedComposite = indexedComposite + shiftedComposite;
+        const Composite rightIndexedComposite = shiftedComposite + indexedComposite;
+
+        EXPECT_FALSE(composite.isIndexed());
+        EXPECT_TRUE(leftIndexedComposite.isIndexed());
+        EXPECT_TRUE(rightIndexedComposite.isIndexed());
+
+        for (const auto& ray : makeRays())
+        {
+            EXPECT_EQ(composite.intersects(ray), leftIndexedComposite.intersects(ray));
+            EXPECT_EQ(composite.intersects(ray), rightIndexedComposite.intersects(ray));
+        }
+
+        EXPECT_TRUE(leftIndexedComposite.intersects(Ray({-19.8, -10.0, 0.5}, {0.0, 1.0, 0.0})));
+        EXPECT_TRUE(rightIndexedComposite.intersects(Ray({-19.8, -10.0, 0.5}, {0.0, 1.0, 0.0})));
+    }
+
+    {
+        Composite composite = Composite::Empty();
+
+        EXPECT_NO_THROW(composite.buildIndex());
+
+        EXPECT_FALSE(composite.intersects(Ray({0.0, 0.0, 0.0}, {0.0, 0.0, 1.0})));
+    }
+
+    {
+        EXPECT_ANY_THROW(Composite::Undefined().buildIndex());
+        EXPECT_ANY_THROW(Composite::Undefined().isIndexed());
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Composite, ApplyTransformation)
 {
     using ostk::core::container::Array;
@@ -255,10 +255,15 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cone, Intersects_Sphere)
 
 TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cone, Intersects_Ellipsoid)
 {
+    using ostk::core::container::Array;
+    using ostk::core::type::Index;
+    using ostk::core::type::Size;
+
     using ostk::mathematics::geometry::Angle;
     using ostk::mathematics::geometry::d3::object::Cone;
     using ostk::mathematics::geometry::d3::object::Ellipsoid;
     using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::Ray;
     using ostk::mathematics::object::Vector3d;
 
     {
@@ -273,6 +278,44 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cone, Intersects_Ellipsoid)
         EXPECT_TRUE(cone.intersects(ellipsoid));
     }
 
+    {
+        const Point apex = {0.0, 0.0, 0.0};
+        const Vector3d axis = Vector3d::Z();
+        const Angle angle = Angle::Degrees(10.0);
+
+        const Cone cone = {apex, axis, angle};
+
+        EXPECT_FALSE(cone.intersects(Ellipsoid({0.0, 0.0, -10.0}, 5.0, 5.0, 5.0)));
+        EXPECT_FALSE(cone.intersects(Ellipsoid({10.0, 0.0, 10.0}, 1.0, 2.0, 3.0)));
+        EXPECT_FALSE(cone.intersects(Ellipsoid({0.0, 0.0, 10.0}, 0.1, 0.1, 0.1)));
+
+        EXPECT_TRUE(cone.intersects(Ellipsoid({1.75, 0.0, 10.0}, 0.5, 0.5, 0.5)));
+        EXPECT_TRUE(cone.intersects(Ellipsoid({0.0, 0.0, 0.0}, 1.0, 1.0, 1.0)));
+
+        for (double x = -3.0; x <= 3.0; x += 1.5)
+        {
+            for (double z = -5.0; z <= 15.0; z += 5.0)
+            {
+                const Ellipsoid ellipsoid = {{x, 0.5, z}, 1.0, 0.5, 0.25};
+
+                const Array<Ray> rays = cone.getRaysOfLateralSurface(40);
+
+                const bool rayIntersects = std::any_of(
+                    rays.begin(),
+                    rays.end(),
+                    [&ellipsoid](const Ray& aRay) -> bool
+                    {
+                        return aRay.intersects(ellipsoid);
+                    }
+                );
+
+                EXPECT_EQ(rayIntersects, cone.intersects(ellipsoid, 40)) << ellipsoid.getCenter().toString();
+            }
+        }
+
+        EXPECT_ANY_THROW(cone.intersects(Ellipsoid({0.0, 0.0, 10.0}, 5.0, 5.0, 5.0), 0));
+    }
+
     {
         EXPECT_ANY_THROW(Cone::Undefined().intersects(Ellipsoid::Undefined()));
     }
@@ -307,6 +350,49 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cone, Contains_Point)
         EXPECT_FALSE(cone.contains({+10.0, 0.0, 14.0}));
     }
 
+    {
+        const Point apex = {0.0, 0.0, 0.0};
+        const Vector3d axis = {0.0, 0.0, 2.0};
+        const Angle angle = Angle::Degrees(45.0);
+
+        const Cone cone = {apex, axis, angle};
+
+        EXPECT_TRUE(cone.contains({0.0, 0.0, 1.0}));
+        EXPECT_TRUE(cone.contains({0.9, 0.0, 1.0}));
+        EXPECT_TRUE(cone.contains({0.0, -0.9, 1.0}));
+
+        EXPECT_FALSE(cone.contains({1.1, 0.0, 1.0}));
+        EXPECT_FALSE(cone.contains({0.0, 0.0, -1.0}));
+    }
+
+    {
+        const Point apex = {0.0, 0.0, 0.0};
+        const Vector3d axis = Vector3d::Z();
+        const Angle angle = Angle::Degrees(120.0);
+
+        const Cone cone = {apex, axis, angle};
+
+        EXPECT_TRUE(cone.contains({0.0, 0.0, 1.0}));
+        EXPECT_TRUE(cone.contains({10.0, 0.0, 1.0}));
+        EXPECT_TRUE(cone.contains({10.0, 0.0, 0.0}));
+
+        EXPECT_FALSE(cone.contains({10.0, 0.0, -1.0}));
+    }
+
+    {
+        using ostk::mathematics::geometry::d3::Transformation;
+
+        Cone cone = {{0.0, 0.0, 0.0}, Vector3d::X(), Angle::Degrees(10.0)};
+
+        cone.applyTransformation(Transformation::Translation({0.0, 0.0, 5.0}));
+
+        EXPECT_TRUE(cone.contains({10.0, 0.0, 5.0}));
+        EXPECT_TRUE(cone.contains({10.0, 1.0, 5.0}));
+
+        EXPECT_FALSE(cone.contains({10.0, 0.0, 0.0}));
+        EXPECT_FALSE(cone.contains({-10.0, 0.0, 5.0}));
+    }
+
     {
         EXPECT_ANY_THROW(Cone::Undefined().contains(Point::Undefined()));
         EXPECT_ANY_THROW(Cone::Undefined().contains({0.0, 0.0, 0.0}));
@@ -367,6 +453,53 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cone, Contains_Segment)
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cone, Contains_PointMatrix)
+{
+    using ostk::core::container::Array;
+
+    using ostk::mathematics::geometry::Angle;
+    using ostk::mathematics::geometry::d3::object::Cone;
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::object::MatrixXd;
+    using ostk::mathematics::object::Vector3d;
+
+    {
+        const Point apex = {-10.0, 0.0, 10.0};
+        const Vector3d axis = Vector3d::X();
+        const Angle angle = Angle::Degrees(10.0);
+
+        const Cone cone = {apex, axis, angle};
+
+        MatrixXd points(6, 3);
+        points << -10.0, 0.0, 10.0, +5.0, 0.0, 10.0, +10.0, 0.0, 9.0, -15.0, 0.0, 10.0, +10.0, 0.0, 6.0, +10.0, 0.0,
+            14.0;
+
+        const Array<bool> expectedContainments = {true, true, true, false, false, false};
+
+        for (const Size threadCount : {1, 2, 4, 8})
+        {
+            EXPECT_EQ(expectedContainments, cone.contains(points, threadCount));
+        }
+
+        for (Index rowIndex = 0; rowIndex < static_cast<Index>(points.rows()); ++rowIndex)
+        {
+            EXPECT_EQ(
+                cone.contains(Point(points(rowIndex, 0), points(rowIndex, 1), points(rowIndex, 2))),
+                expectedContainments[rowIndex]
+            );
+        }
+
+        EXPECT_TRUE(cone.contains(MatrixXd(0, 3)).isEmpty());
+
+        EXPECT_ANY_THROW(cone.contains(MatrixXd::Zero(2, 2)));
+        EXPECT_ANY_THROW(cone.contains(points, 0));
+    }
+
+    {
+        EXPECT_ANY_THROW(Cone::Undefined().contains(MatrixXd::Zero(2, 3)));
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cone, Contains_Ray)
 {
     // TBI
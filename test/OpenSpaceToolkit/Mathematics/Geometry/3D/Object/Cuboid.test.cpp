@@ -8,6 +8,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Pyramid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ray.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Segment.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Sphere.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationMatrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationVector.hpp>
@@ -1084,6 +1085,10 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cuboid, ApplyTransformation
         const Cuboid referenceCuboid = {{1.0, 0.0, 2.0}, axes, {1.0, 3.0, 2.0}};
 
         EXPECT_TRUE(cuboid.isNear(referenceCuboid, Real::Epsilon())) << referenceCuboid << cuboid;
+
+        EXPECT_TRUE(cuboid.contains(Point(1.0, 0.0, 4.0)));
+        EXPECT_TRUE(cuboid.contains(Point(1.0, 3.0, 2.0)));
+        EXPECT_FALSE(cuboid.contains(Point(1.0, 0.0, 5.0)));
     }
 
     {
@@ -1125,3 +1130,175 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cuboid, Cube)
         EXPECT_EQ(Point(0.0, 0.0, 0.0), cube.getCenter());
     }
 }
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cuboid, IntersectingPairs_Cuboid)
+{
+    using ostk::core::container::Array;
+    using ostk::core::container::Pair;
+    using ostk::core::type::Index;
+    using ostk::core::type::Real;
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::geometry::Angle;
+    using ostk::mathematics::geometry::d3::object::Cuboid;
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::Transformation;
+    using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
+    using ostk::mathematics::object::Vector3d;
+
+    {
+        Array<Cuboid> firstCuboids = Array<Cuboid>::Empty();
+        Array<Cuboid> secondCuboids = Array<Cuboid>::Empty();
+
+        const Vector3d firstRotationAxis = Vector3d(1.0, 2.0, 3.0).normalized();
+        const Vector3d secondRotationAxis = Vector3d(3.0, -1.0, 2.0).normalized();
+
+        for (Index cuboidIndex = 0; cuboidIndex < 60; ++cuboidIndex)
+        {
+            const double index = static_cast<double>(cuboidIndex);
+
+            Cuboid firstCuboid = {
+                {0.0, 0.0, 0.0},
+                {Vector3d {1.0, 0.0, 0.0}, Vector3d {0.0, 1.0, 0.0}, Vector3d {0.0, 0.0, 1.0}},
+                {0.2 + 0.1 * (cuboidIndex % 4), 0.3, 0.1 + 0.05 * (cuboidIndex % 3)}
+            };
+
+            firstCuboid.applyTransformation(
+                Transformation::Rotation(RotationVector(firstRotationAxis, Angle::Degrees(7.0 * index)))
+            );
+            firstCuboid.applyTransformation(
+                Transformation::Translation({0.7 * (cuboidIndex % 8), 0.9 * (cuboidIndex / 8), 0.1 * std::sin(index)})
+            );
+
+            firstCuboids.add(firstCuboid);
+
+            Cuboid secondCuboid = {
+                {0.0, 0.0, 0.0},
+                {Vector3d {1.0, 0.0, 0.0}, Vector3d {0.0, 1.0, 0.0}, Vector3d {0.0, 0.0, 1.0}},
+                {0.4, 0.1 + 0.1 * (cuboidIndex % 5), 0.25}
+            };
+
+            secondCuboid.applyTransformation(
+                Transformation::Rotation(RotationVector(secondRotationAxis, Angle::Degrees(11.0 * index)))
+            );
+            secondCuboid.applyTransformation(Transformation::Translation(
+                {0.35 + 0.6 * (cuboidIndex % 10), 0.4 + 0.8 * (cuboidIndex / 10), 0.2 * std::cos(index)}
+            ));
+
+            secondCuboids.add(secondCuboid);
+        }
+
+        Array<Pair<Index, Index>> referencePairs = Array<Pair<Index, Index>>::Empty();
+
+        for (Index firstIndex = 0; firstIndex < firstCuboids.getSize(); ++firstIndex)
+        {
+            for (Index secondIndex = 0; secondIndex < secondCuboids.getSize(); ++secondIndex)
+            {
+                if (firstCuboids[firstIndex].intersects(secondCuboids[secondIndex]))
+                {
+                    referencePairs.add({firstIndex, secondIndex});
+                }
+            }
+        }
+
+        ASSERT_FALSE(referencePairs.isEmpty());
+
+        for (const Size threadCount : {1, 4})
+        {
+            EXPECT_TRUE(referencePairs == Cuboid::IntersectingPairs(firstCuboids, secondCuboids, threadCount));
+        }
+    }
+
+    {
+        const Array<Cuboid> firstCuboids = {
+            Cuboid::Cube({0.0, 0.0, 0.0}, 1.0), Cuboid::Cube({10.0, 0.0, 0.0}, 1.0), Cuboid::Cube({0.0, 5.0, 0.0}, 1.0)
+        };
+
+        // Rotated by 45 degrees about z, the corner of the second cuboid reaches 2.3 - sqrt(2) along x and overlaps the
+        // first cube, which its axis-aligned copy does not
+
+        const Real halfSqrt2 = std::sqrt(2.0) / 2.0;
+
+        const Array<Cuboid> secondCuboids = {
+            Cuboid::Cube({2.3, 0.0, 0.0}, 1.0),
+            Cuboid(
+                {2.3, 0.0, 0.0},
+                {Vector3d {halfSqrt2, halfSqrt2, 0.0}, Vector3d {-halfSqrt2, halfSqrt2, 0.0}, Vector3d {0.0, 0.0, 1.0}},
+                {1.0, 1.0, 1.0}
+            ),
+            Cuboid::Cube({10.5, 0.5, 0.5}, 1.0)
+        };
+
+        const Array<Pair<Index, Index>> referencePairs = {{0, 1}, {1, 2}};
+        const Array<Pair<Index, Index>> referenceSelfPairs = {{0, 0}, {1, 1}, {2, 2}};
+
+        EXPECT_TRUE(referencePairs == Cuboid::IntersectingPairs(firstCuboids, secondCuboids));
+        EXPECT_TRUE(referenceSelfPairs == Cuboid::IntersectingPairs(firstCuboids, firstCuboids));
+
+        EXPECT_TRUE(Cuboid::IntersectingPairs(Array<Cuboid>::Empty(), secondCuboids).isEmpty());
+        EXPECT_TRUE(Cuboid::IntersectingPairs(firstCuboids, Array<Cuboid>::Empty()).isEmpty());
+    }
+
+    {
+        const Array<Cuboid> cuboids = {Cuboid::Cube({0.0, 0.0, 0.0}, 1.0)};
+
+        EXPECT_ANY_THROW(Cuboid::IntersectingPairs(cuboids, {Cuboid::Undefined()}));
+        EXPECT_ANY_THROW(Cuboid::IntersectingPairs(cuboids, cuboids, 0));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Cuboid, IntersectingPairs_Sphere)
+{
+    using ostk::core::container::Array;
+    using ostk::core::container::Pair;
+    using ostk::core::type::Index;
+    using ostk::core::type::Real;
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::geometry::d3::object::Cuboid;
+    using ostk::mathematics::geometry::d3::object::Sphere;
+    using ostk::mathematics::object::Vector3d;
+
+    {
+        const Real halfSqrt2 = std::sqrt(2.0) / 2.0;
+
+        const Array<Cuboid> cuboids = {
+            Cuboid::Cube({0.0, 0.0, 0.0}, 1.0),
+            Cuboid(
+                {5.0, 0.0, 0.0},
+                {Vector3d {halfSqrt2, halfSqrt2, 0.0}, Vector3d {-halfSqrt2, halfSqrt2, 0.0}, Vector3d {0.0, 0.0, 1.0}},
+                {1.0, 1.0, 1.0}
+            )
+        };
+
+        // The second sphere touches a face of the first cube, the third one misses its corner, the fourth one reaches
+        // the corner of the rotated cuboid along x, which lies at 5 - sqrt(2)
+
+        const Array<Sphere> spheres = {
+            Sphere({0.0, 0.0, 0.0}, 0.1),
+            Sphere({0.0, 0.0, 2.0}, 1.0),
+            Sphere({1.5, 1.5, 1.5}, 0.8),
+            Sphere({3.0, 0.0, 0.0}, 0.6),
+            Sphere({2.5, 0.0, 0.0}, 2.0),
+            Sphere({0.0, 10.0, 0.0}, 1.0)
+        };
+
+        const Array<Pair<Index, Index>> referencePairs = {{0, 0}, {1, 0}, {3, 1}, {4, 0}, {4, 1}};
+
+        for (const Size threadCount : {1, 4})
+        {
+            EXPECT_TRUE(referencePairs == Cuboid::IntersectingPairs(spheres, cuboids, threadCount));
+        }
+
+        EXPECT_TRUE(Cuboid::IntersectingPairs(Array<Sphere>::Empty(), cuboids).isEmpty());
+    }
+
+    {
+        const Array<Cuboid> cuboids = {Cuboid::Cube({0.0, 0.0, 0.0}, 1.0)};
+        const Array<Sphere> spheres = {Sphere({0.0, 0.0, 0.0}, 1.0)};
+
+        EXPECT_ANY_THROW(Cuboid::IntersectingPairs({Sphere::Undefined()}, cuboids));
+        EXPECT_ANY_THROW(Cuboid::IntersectingPairs(spheres, {Cuboid::Undefined()}));
+        EXPECT_ANY_THROW(Cuboid::IntersectingPairs(spheres, cuboids, 0));
+    }
+}
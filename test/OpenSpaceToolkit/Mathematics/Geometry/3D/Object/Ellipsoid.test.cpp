@@ -717,8 +717,11 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid, Intersects_Pyram
 
 TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid, Contains_Point)
 {
+    using ostk::mathematics::geometry::Angle;
     using ostk::mathematics::geometry::d3::object::Ellipsoid;
     using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+    using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
 
     {
         ASSERT_TRUE(Ellipsoid({1.0, 2.0, 3.0}, 4.0, 5.0, 6.0).contains(Point(+5.0, +2.0, +3.0)));
@@ -731,6 +734,33 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid, Contains_Point)
         ASSERT_TRUE(Ellipsoid({1.0, 2.0, 3.0}, 4.0, 5.0, 6.0).contains(Point(+1.0, +2.0, -3.0)));
     }
 
+    {
+        // Rotated by 45 deg about z, the first axis is (1, 1, 0) / sqrt(2) and the second one (-1, 1, 0) / sqrt(2)
+        // (see GetFirstAxis), hence surface points at 4 and 5 along them. In the mirrored orientation, the same points
+        // lie at (x/a)^2 + (y/b)^2 = 0.64 and 1.5625.
+
+        const Ellipsoid ellipsoid = {
+            {1.0, 2.0, 3.0},
+            4.0,
+            5.0,
+            6.0,
+            Quaternion::RotationVector(RotationVector({0.0, 0.0, 1.0}, Angle::Degrees(45.0)))
+        };
+
+        const double halfSqrtTwo = std::sqrt(2.0) / 2.0;
+
+        ASSERT_TRUE(ellipsoid.contains(Point(1.0 + 4.0 * halfSqrtTwo, 2.0 + 4.0 * halfSqrtTwo, 3.0)));
+        ASSERT_TRUE(ellipsoid.contains(Point(1.0 - 4.0 * halfSqrtTwo, 2.0 - 4.0 * halfSqrtTwo, 3.0)));
+
+        ASSERT_TRUE(ellipsoid.contains(Point(1.0 - 5.0 * halfSqrtTwo, 2.0 + 5.0 * halfSqrtTwo, 3.0)));
+        ASSERT_TRUE(ellipsoid.contains(Point(1.0 + 5.0 * halfSqrtTwo, 2.0 - 5.0 * halfSqrtTwo, 3.0)));
+
+        ASSERT_TRUE(ellipsoid.contains(Point(1.0, 2.0, 9.0)));
+
+        ASSERT_FALSE(ellipsoid.contains(Point(1.0 + 4.0 * halfSqrtTwo, 2.0 - 4.0 * halfSqrtTwo, 3.0)));
+        ASSERT_FALSE(ellipsoid.contains(Point(1.0 + 5.0 * halfSqrtTwo, 2.0 + 5.0 * halfSqrtTwo, 3.0)));
+    }
+
     {
         ASSERT_FALSE(Ellipsoid(Point::Origin(), 4.0, 5.0, 6.0).contains(Point::Origin()));
     }
@@ -782,6 +812,189 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid, Contains_PointSe
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid, DistanceTo)
+{
+    using ostk::mathematics::geometry::d3::object::Ellipsoid;
+    using ostk::mathematics::geometry::d3::object::Point;
+
+    {
+        const Ellipsoid ellipsoid = {{1.0, 2.0, 3.0}, 4.0, 5.0, 6.0};
+
+        EXPECT_NEAR(3.0, ellipsoid.distanceTo({8.0, 2.0, 3.0}), 1e-12);
+        EXPECT_NEAR(2.0, ellipsoid.distanceTo({1.0, 2.0, 11.0}), 1e-12);
+        EXPECT_NEAR(4.0, ellipsoid.distanceTo({1.0, 2.0, 3.0}), 1e-12);
+        EXPECT_NEAR(0.0, ellipsoid.distanceTo({1.0, 7.0, 3.0}), 1e-12);
+    }
+
+    {
+        EXPECT_ANY_THROW(Ellipsoid::Undefined().distanceTo(Point::Origin()));
+        EXPECT_ANY_THROW(Ellipsoid(Point::Origin(), 4.0, 5.0, 6.0).distanceTo(Point::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid, ProjectPoint)
+{
+    using ostk::mathematics::geometry::Angle;
+    using ostk::mathematics::geometry::d3::object::Ellipsoid;
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+    using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
+    using ostk::mathematics::object::Vector3d;
+
+    {
+        const Ellipsoid ellipsoid = {Point::Origin(), 1.0, 2.0, 3.0};
+
+        const auto [surfacePoint, normal, distance] = ellipsoid.projectPoint({0.0, 0.0, 5.0});
+
+        EXPECT_TRUE(surfacePoint.isNear({0.0, 0.0, 3.0}, 1e-12));
+        EXPECT_TRUE(normal.isNear(Vector3d(0.0, 0.0, 1.0), 1e-12));
+        EXPECT_NEAR(2.0, distance, 1e-12);
+    }
+
+    {
+        // Inside: the closest surface point lies along the smallest semi-axis
+
+        const Ellipsoid ellipsoid = {Point::Origin(), 1.0, 2.0, 3.0};
+
+        const auto [surfacePoint, normal, distance] = ellipsoid.projectPoint(Point::Origin());
+
+        EXPECT_NEAR(1.0, std::abs(surfacePoint.x()), 1e-12);
+        EXPECT_NEAR(1.0, std::abs(normal.x()), 1e-12);
+        EXPECT_NEAR(-1.0, distance, 1e-12);
+    }
+
+    {
+        // Sphere
+
+        const Point center = {1.0, 2.0, 3.0};
+        const Ellipsoid sphere = {center, 2.0, 2.0, 2.0};
+
+        const Point point = {4.0, -1.0, 5.0};
+
+        const Vector3d direction = (point - center).normalized();
+
+        const auto [surfacePoint, normal, distance] = sphere.projectPoint(point);
+
+        EXPECT_TRUE(surfacePoint.isNear(center + (2.0 * direction), 1e-12));
+        EXPECT_TRUE(normal.isNear(direction, 1e-12));
+        EXPECT_NEAR((point - center).norm() - 2.0, distance, 1e-12);
+    }
+
+    {
+        // Rotated and translated tri-axial ellipsoid: the surface point lies on the ellipsoid, the offset to the point
+        // is along the normal, and no sampled surface point is closer
+
+        const Point center = {1.0, -2.0, 0.5};
+        const Quaternion orientation = Quaternion::RotationVector(
+            RotationVector(Vector3d(1.0, 2.0, 3.0).normalized(), Angle::Degrees(40.0))
+        );
+
+        const Ellipsoid ellipsoid = {center, 6.0, 4.0, 1.5, orientation};
+
+        const Vector3d firstAxis = ellipsoid.getFirstAxis();
+        const Vector3d secondAxis = ellipsoid.getSecondAxis();
+        const Vector3d thirdAxis = ellipsoid.getThirdAxis();
+
+        for (int pointIndex = 0; pointIndex < 64; ++pointIndex)
+        {
+            // Scaled surface points: inside for even indices, outside for odd ones
+
+            const double scale = (pointIndex % 2 == 0) ? 0.5 : 2.0;
+            const double pointLatitude = 1.4 * std::sin(0.7 * pointIndex);
+            const double pointLongitude = 1.3 * pointIndex;
+
+            const Vector3d offset = (6.0 * std::cos(pointLatitude) * std::cos(pointLongitude) * firstAxis) +
+                                    (4.0 * std::cos(pointLatitude) * std::sin(pointLongitude) * secondAxis) +
+                                    (1.5 * std::sin(pointLatitude) * thirdAxis);
+
+            const Point point = center + (scale * offset);
+
+            const auto [surfacePoint, normal, distance] = ellipsoid.projectPoint(point);
+
+            const Vector3d principalPoint = {
+                (surfacePoint - center).dot(firstAxis) / 6.0,
+                (surfacePoint - center).dot(secondAxis) / 4.0,
+                (surfacePoint - center).dot(thirdAxis) / 1.5,
+            };
+
+            EXPECT_NEAR(1.0, principalPoint.norm(), 1e-12);
+            EXPECT_NEAR(1.0, normal.norm(), 1e-12);
+            EXPECT_TRUE(Vector3d((point - surfacePoint) - (distance * normal)).isNear(Vector3d::Zero(), 1e-9));
+            EXPECT_EQ(scale < 1.0, distance < 0.0);
+
+            for (int latitudeIndex = 0; latitudeIndex <= 32; ++latitudeIndex)
+            {
+                for (int longitudeIndex = 0; longitudeIndex < 64; ++longitudeIndex)
+                {
+                    const double latitude = M_PI * ((latitudeIndex / 32.0) - 0.5);
+                    const double longitude = 2.0 * M_PI * (longitudeIndex / 64.0);
+
+                    const Point samplePoint = center + (6.0 * std::cos(latitude) * std::cos(longitude) * firstAxis) +
+                                              (4.0 * std::cos(latitude) * std::sin(longitude) * secondAxis) +
+                                              (1.5 * std::sin(latitude) * thirdAxis);
+
+                    EXPECT_LE(std::abs(distance), (point - samplePoint).norm() + 1e-12);
+                }
+            }
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(Ellipsoid::Undefined().projectPoint(Point::Origin()));
+        EXPECT_ANY_THROW(Ellipsoid(Point::Origin(), 4.0, 5.0, 6.0).projectPoint(Point::Undefined()));
+        EXPECT_ANY_THROW(Ellipsoid(Point::Origin(), 4.0, 0.0, 6.0).projectPoint(Point::Origin()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid, ProjectPoints)
+{
+    using ostk::core::container::Array;
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::geometry::Angle;
+    using ostk::mathematics::geometry::d3::object::Ellipsoid;
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+    using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
+    using ostk::mathematics::object::MatrixXd;
+
+    {
+        const Ellipsoid ellipsoid = {
+            {1.0, 2.0, 3.0},
+            6.0,
+            4.0,
+            1.5,
+            Quaternion::RotationVector(RotationVector({0.0, 0.0, 1.0}, Angle::Degrees(30.0)))
+        };
+
+        const MatrixXd points = 10.0 * MatrixXd::Random(3, 101);
+
+        for (const Size threadCount : {1, 4})
+        {
+            const Array<Ellipsoid::Projection> projections = ellipsoid.projectPoints(points, threadCount);
+
+            ASSERT_EQ(points.cols(), projections.size());
+
+            for (Eigen::Index columnIndex = 0; columnIndex < points.cols(); ++columnIndex)
+            {
+                const Ellipsoid::Projection projection = ellipsoid.projectPoint(Point::Vector(points.col(columnIndex)));
+
+                EXPECT_EQ(std::get<0>(projection), std::get<0>(projections[columnIndex]));
+                EXPECT_EQ(std::get<1>(projection), std::get<1>(projections[columnIndex]));
+                EXPECT_EQ(std::get<2>(projection), std::get<2>(projections[columnIndex]));
+            }
+        }
+
+        EXPECT_TRUE(ellipsoid.projectPoints(MatrixXd::Zero(3, 0)).isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(Ellipsoid::Undefined().projectPoints(MatrixXd::Zero(3, 1)));
+        EXPECT_ANY_THROW(Ellipsoid(Point::Origin(), 4.0, 5.0, 6.0).projectPoints(MatrixXd::Zero(2, 1)));
+        EXPECT_ANY_THROW(Ellipsoid(Point::Origin(), 4.0, 5.0, 6.0).projectPoints(MatrixXd::Zero(3, 1), 0));
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid, GetCenter)
 {
     using ostk::mathematics::geometry::d3::object::Ellipsoid;
@@ -1559,6 +1772,7 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid, ApplyTransformat
 
     using ostk::mathematics::geometry::Angle;
     using ostk::mathematics::geometry::d3::object::Ellipsoid;
+    using ostk::mathematics::geometry::d3::object::Point;
     using ostk::mathematics::geometry::d3::Transformation;
     using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
     using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
@@ -1587,6 +1801,15 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Ellipsoid, ApplyTransformat
             << referenceEllipsoid.getCenter().toString() << ellipsoid.getCenter().toString();
         ASSERT_TRUE(ellipsoid.getMatrix().isNear(referenceEllipsoid.getMatrix(), Real::Epsilon()))
             << referenceEllipsoid.getMatrix().toString() << ellipsoid.getMatrix().toString();
+
+        // Queries in the principal frame follow the transformation
+
+        ASSERT_TRUE(ellipsoid.contains(Point(1.0, 0.0, 8.0)));
+        ASSERT_TRUE(ellipsoid.contains(Point(1.0, 6.0, 3.0)));
+        ASSERT_FALSE(ellipsoid.contains(Point(1.0, 5.0, 3.0)));
+
+        EXPECT_NEAR(2.0, ellipsoid.distanceTo({1.0, 0.0, 10.0}), 1e-12);
+        EXPECT_NEAR(1.0, ellipsoid.distanceTo({6.0, 0.0, 3.0}), 1e-12);
     }
 
     {
@@ -0,0 +1,388 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/PointCloud.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+
+// Brute-force reference: indices sorted by (squared distance, index)
+
+Array<Index> PointCloudTestSortedIndices(const MatrixXd& aPointMatrix, const MatrixXd::ConstRowXpr& aQuery)
+{
+    Array<Index> indices(aPointMatrix.rows(), 0);
+    std::iota(indices.begin(), indices.end(), 0);
+
+    std::stable_sort(
+        indices.begin(),
+        indices.end(),
+        [&aPointMatrix, &aQuery](const Index& aFirstIndex, const Index& aSecondIndex) -> bool
+        {
+            return (aPointMatrix.row(aFirstIndex) - aQuery).squaredNorm() <
+                   (aPointMatrix.row(aSecondIndex) - aQuery).squaredNorm();
+        }
+    );
+
+    return indices;
+}
+
+MatrixXd PointCloudTestRandomPoints(const Size aCount, const unsigned int aSeed)
+{
+    std::mt19937 generator(aSeed);
+    std::uniform_real_distribution<double> distribution(-10.0, 10.0);
+
+    MatrixXd pointMatrix(aCount, 3);
+
+    for (Index rowIndex = 0; rowIndex < aCount; ++rowIndex)
+    {
+        pointMatrix.row(rowIndex) << distribution(generator), distribution(generator), distribution(generator);
+    }
+
+    return pointMatrix;
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud, Constructor)
+{
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+
+    {
+        EXPECT_NO_THROW(PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, 2.0}}));
+    }
+
+    {
+        EXPECT_NO_THROW(PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}}));
+    }
+
+    {
+        EXPECT_NO_THROW(PointCloud(Array<ostk::mathematics::geometry::d3::object::Point>::Empty()));
+    }
+
+    {
+        using ostk::mathematics::geometry::d3::object::Point;
+
+        EXPECT_ANY_THROW(PointCloud({{0.0, 0.0, 0.0}, Point::Undefined()}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud, Clone)
+{
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+
+    {
+        EXPECT_NO_THROW(const PointCloud* pointCloudPtr =
+                            PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, 2.0}}).clone();
+                        delete pointCloudPtr;);
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud, EqualToOperator)
+{
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+
+    {
+        EXPECT_TRUE(
+            PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, 2.0}}) ==
+            PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, 2.0}})
+        );
+    }
+
+    {
+        EXPECT_FALSE(
+            PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, 2.0}}) ==
+            PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 2.0}, {0.0, 0.0, 1.0}})
+        );
+        EXPECT_FALSE(
+            PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}}) ==
+            PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, 2.0}})
+        );
+        EXPECT_FALSE(PointCloud::Empty() == PointCloud::Empty());
+    }
+
+    {
+        EXPECT_TRUE(
+            PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}}) != PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 2.0}})
+        );
+        EXPECT_FALSE(
+            PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}}) != PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}})
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud, IsDefined)
+{
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+
+    {
+        EXPECT_TRUE(PointCloud({{0.0, 0.0, 0.0}}).isDefined());
+        EXPECT_FALSE(PointCloud::Empty().isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud, GetSize)
+{
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+
+    {
+        EXPECT_EQ(3, PointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, 2.0}}).getSize());
+        EXPECT_EQ(0, PointCloud::Empty().getSize());
+        EXPECT_TRUE(PointCloud::Empty().isEmpty());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud, GetPoints)
+{
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+
+    {
+        const MatrixXd pointMatrix = PointCloudTestRandomPoints(1000, 1);
+
+        const PointCloud pointCloud = PointCloud::Matrix(pointMatrix);
+
+        EXPECT_EQ(pointMatrix, pointCloud.getPoints());
+
+        for (Index pointIndex = 0; pointIndex < pointCloud.getSize(); ++pointIndex)
+        {
+            EXPECT_EQ(Point::Vector(pointMatrix.row(pointIndex).transpose()), pointCloud.getPointAt(pointIndex));
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(PointCloud({{0.0, 0.0, 0.0}}).getPointAt(1));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud, GetBoundingBox)
+{
+    using ostk::mathematics::geometry::d3::BoundingBox;
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+
+    {
+        EXPECT_EQ(
+            BoundingBox({-1.0, 0.0, -3.0}, {2.0, 5.0, 3.0}),
+            PointCloud({{-1.0, 0.0, 3.0}, {2.0, 5.0, -3.0}, {0.0, 1.0, 0.0}}).getBoundingBox()
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(PointCloud::Empty().getBoundingBox());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud, FindNearestNeighbor)
+{
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+
+    {
+        const PointCloud pointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, 2.0}});
+
+        EXPECT_EQ(0, pointCloud.findNearestNeighbor(Point(0.0, 0.0, -1.0)));
+        EXPECT_EQ(1, pointCloud.findNearestNeighbor(Point(0.0, 1.0, 1.1)));
+        EXPECT_EQ(2, pointCloud.findNearestNeighbor(Point(0.0, 0.0, 10.0)));
+    }
+
+    {
+        const PointCloud pointCloud({{1.0, 0.0, 0.0}, {-1.0, 0.0, 0.0}, {1.0, 0.0, 0.0}});
+
+        EXPECT_EQ(0, pointCloud.findNearestNeighbor(Point(0.0, 0.0, 0.0)));
+        EXPECT_EQ(0, pointCloud.findNearestNeighbor(Point(1.0, 0.0, 0.0)));
+    }
+
+    {
+        const MatrixXd pointMatrix = PointCloudTestRandomPoints(2000, 2);
+        const MatrixXd queryMatrix = PointCloudTestRandomPoints(200, 3);
+
+        const PointCloud pointCloud = PointCloud::Matrix(pointMatrix);
+
+        const Array<Index> indices = pointCloud.findNearestNeighbor(queryMatrix, 4);
+
+        ASSERT_EQ(queryMatrix.rows(), indices.getSize());
+
+        for (Index queryIndex = 0; queryIndex < Size(queryMatrix.rows()); ++queryIndex)
+        {
+            const Index expectedIndex = PointCloudTestSortedIndices(pointMatrix, queryMatrix.row(queryIndex))[0];
+
+            EXPECT_EQ(expectedIndex, indices[queryIndex]);
+            EXPECT_EQ(
+                expectedIndex, pointCloud.findNearestNeighbor(Point::Vector(queryMatrix.row(queryIndex).transpose()))
+            );
+        }
+
+        EXPECT_EQ(indices, pointCloud.findNearestNeighbor(queryMatrix, 1));
+    }
+
+    {
+        const PointCloud pointCloud({{0.0, 0.0, 0.0}});
+
+        EXPECT_ANY_THROW(pointCloud.findNearestNeighbor(Point::Undefined()));
+        EXPECT_ANY_THROW(PointCloud::Empty().findNearestNeighbor(Point(0.0, 0.0, 0.0)));
+        EXPECT_ANY_THROW(pointCloud.findNearestNeighbor(MatrixXd::Zero(2, 2)));
+        EXPECT_ANY_THROW(pointCloud.findNearestNeighbor(MatrixXd::Zero(2, 3), 0));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud, FindNearestNeighbors)
+{
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+
+    {
+        const PointCloud pointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, 2.0}});
+
+        EXPECT_EQ(Array<Index>({2, 1}), pointCloud.findNearestNeighbors(Point(0.0, 0.0, 3.0), 2));
+        EXPECT_EQ(Array<Index>({0, 1, 2}), pointCloud.findNearestNeighbors(Point(0.0, 0.0, -1.0), 10));
+        EXPECT_TRUE(pointCloud.findNearestNeighbors(Point(0.0, 0.0, 0.0), 0).isEmpty());
+    }
+
+    {
+        const MatrixXd pointMatrix = PointCloudTestRandomPoints(2000, 4);
+        const MatrixXd queryMatrix = PointCloudTestRandomPoints(100, 5);
+
+        const PointCloud pointCloud = PointCloud::Matrix(pointMatrix);
+
+        const Array<Array<Index>> indices = pointCloud.findNearestNeighbors(queryMatrix, 25, 3);
+
+        ASSERT_EQ(queryMatrix.rows(), indices.getSize());
+
+        for (Index queryIndex = 0; queryIndex < Size(queryMatrix.rows()); ++queryIndex)
+        {
+            const Array<Index> sortedIndices = PointCloudTestSortedIndices(pointMatrix, queryMatrix.row(queryIndex));
+
+            const Array<Index> expectedIndices(sortedIndices.begin(), sortedIndices.begin() + 25);
+
+            EXPECT_EQ(expectedIndices, indices[queryIndex]);
+            EXPECT_EQ(
+                expectedIndices,
+                pointCloud.findNearestNeighbors(Point::Vector(queryMatrix.row(queryIndex).transpose()), 25)
+            );
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(PointCloud({{0.0, 0.0, 0.0}}).findNearestNeighbors(Point::Undefined(), 1));
+        EXPECT_ANY_THROW(PointCloud::Empty().findNearestNeighbors(Point(0.0, 0.0, 0.0), 1));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud, FindNeighborsWithinRadius)
+{
+    using ostk::core::type::Real;
+
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+
+    {
+        const PointCloud pointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, 2.0}});
+
+        EXPECT_EQ(Array<Index>({1, 0, 2}), pointCloud.findNeighborsWithinRadius(Point(0.0, 0.0, 0.9), 1.5));
+        EXPECT_EQ(Array<Index>({2, 1}), pointCloud.findNeighborsWithinRadius(Point(0.0, 0.0, 2.0), 1.0));
+        EXPECT_TRUE(pointCloud.findNeighborsWithinRadius(Point(5.0, 0.0, 0.0), 1.0).isEmpty());
+    }
+
+    {
+        const MatrixXd pointMatrix = PointCloudTestRandomPoints(2000, 6);
+        const MatrixXd queryMatrix = PointCloudTestRandomPoints(100, 7);
+
+        const PointCloud pointCloud = PointCloud::Matrix(pointMatrix);
+
+        const Real radius = 2.5;
+
+        const Array<Array<Index>> indices = pointCloud.findNeighborsWithinRadius(queryMatrix, radius, 2);
+
+        ASSERT_EQ(queryMatrix.rows(), indices.getSize());
+
+        for (Index queryIndex = 0; queryIndex < Size(queryMatrix.rows()); ++queryIndex)
+        {
+            Array<Index> expectedIndices = Array<Index>::Empty();
+
+            for (const auto& pointIndex : PointCloudTestSortedIndices(pointMatrix, queryMatrix.row(queryIndex)))
+            {
+                if ((pointMatrix.row(pointIndex) - queryMatrix.row(queryIndex)).norm() > radius)
+                {
+                    break;
+                }
+
+                expectedIndices.add(pointIndex);
+            }
+
+            EXPECT_EQ(expectedIndices, indices[queryIndex]);
+        }
+    }
+
+    {
+        const PointCloud pointCloud({{0.0, 0.0, 0.0}});
+
+        EXPECT_ANY_THROW(pointCloud.findNeighborsWithinRadius(Point::Undefined(), 1.0));
+        EXPECT_ANY_THROW(pointCloud.findNeighborsWithinRadius(Point(0.0, 0.0, 0.0), Real::Undefined()));
+        EXPECT_ANY_THROW(pointCloud.findNeighborsWithinRadius(Point(0.0, 0.0, 0.0), -1.0));
+        EXPECT_ANY_THROW(PointCloud::Empty().findNeighborsWithinRadius(Point(0.0, 0.0, 0.0), 1.0));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud, DistanceTo)
+{
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+
+    {
+        const PointCloud pointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, 2.0}});
+
+        EXPECT_DOUBLE_EQ(1.0, pointCloud.distanceTo({0.0, 0.0, 3.0}));
+        EXPECT_DOUBLE_EQ(0.0, pointCloud.distanceTo({0.0, 0.0, 1.0}));
+        EXPECT_EQ(Point(0.0, 0.0, 2.0), pointCloud.getPointClosestTo({0.0, 0.0, 3.0}));
+    }
+
+    {
+        EXPECT_ANY_THROW(PointCloud({{0.0, 0.0, 0.0}}).distanceTo(Point::Undefined()));
+        EXPECT_ANY_THROW(PointCloud::Empty().distanceTo({0.0, 0.0, 0.0}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud, ApplyTransformation)
+{
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+    using ostk::mathematics::geometry::d3::Transformation;
+
+    {
+        PointCloud pointCloud({{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, 2.0}});
+
+        pointCloud.applyTransformation(Transformation::Translation({4.0, 5.0, 6.0}));
+
+        EXPECT_EQ(PointCloud({{4.0, 5.0, 6.0}, {4.0, 5.0, 7.0}, {4.0, 5.0, 8.0}}), pointCloud);
+        EXPECT_EQ(2, pointCloud.findNearestNeighbor(Point(4.0, 5.0, 10.0)));
+    }
+
+    {
+        EXPECT_ANY_THROW(PointCloud({{0.0, 0.0, 0.0}}).applyTransformation(Transformation::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_PointCloud, Matrix)
+{
+    using ostk::mathematics::geometry::d3::object::PointCloud;
+
+    {
+        EXPECT_EQ(
+            PointCloud({{0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}}),
+            PointCloud::Matrix((MatrixXd(2, 3) << 0.0, 0.0, 0.0, 1.0, 2.0, 3.0).finished())
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(PointCloud::Matrix(MatrixXd::Zero(2, 2)));
+        EXPECT_ANY_THROW(PointCloud::Matrix(
+            (MatrixXd(1, 3) << 0.0, std::numeric_limits<double>::quiet_NaN(), 0.0).finished()
+        ));
+    }
+}
@@ -150,10 +150,15 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Pyramid, IsDefined)
 
 TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Pyramid, Intersects_Ellipsoid)
 {
+    using ostk::core::container::Array;
+    using ostk::core::type::Index;
+    using ostk::core::type::Size;
+
     using ostk::mathematics::geometry::d3::object::Ellipsoid;
     using ostk::mathematics::geometry::d3::object::Point;
     using ostk::mathematics::geometry::d3::object::Polygon;
     using ostk::mathematics::geometry::d3::object::Pyramid;
+    using ostk::mathematics::geometry::d3::object::Ray;
     using ostk::mathematics::object::Vector3d;
 
     {
@@ -172,6 +177,48 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Pyramid, Intersects_Ellipso
         EXPECT_TRUE(pyramid.intersects(ellipsoid));
     }
 
+    {
+        const Polygon base = {
+            {{{-0.1, -0.1}, {+0.1, -0.1}, {+0.1, +0.1}, {-0.1, +0.1}}},
+            {0.0, 0.0, 1.0},
+            {1.0, 0.0, 0.0},
+            {0.0, 1.0, 0.0}
+        };
+        const Point apex = {0.0, 0.0, 0.0};
+
+        const Pyramid pyramid = {base, apex};
+
+        EXPECT_FALSE(pyramid.intersects(Ellipsoid({0.0, 0.0, -10.0}, 5.0, 5.0, 5.0)));
+        EXPECT_FALSE(pyramid.intersects(Ellipsoid({10.0, 0.0, 10.0}, 1.0, 2.0, 3.0)));
+        EXPECT_FALSE(pyramid.intersects(Ellipsoid({0.0, 0.0, 10.0}, 0.1, 0.1, 0.1)));
+
+        EXPECT_TRUE(pyramid.intersects(Ellipsoid({1.0, 0.0, 10.0}, 0.5, 0.5, 0.5)));
+        EXPECT_TRUE(pyramid.intersects(Ellipsoid({0.0, 0.0, 0.0}, 1.0, 1.0, 1.0)));
+
+        for (double x = -3.0; x <= 3.0; x += 1.5)
+        {
+            for (double z = -5.0; z <= 15.0; z += 5.0)
+            {
+                const Ellipsoid ellipsoid = {{x, 0.5, z}, 1.0, 0.5, 0.25};
+
+                const Array<Ray> rays = pyramid.getRaysOfLateralFaces(40);
+
+                const bool rayIntersects = std::any_of(
+                    rays.begin(),
+                    rays.end(),
+                    [&ellipsoid](const Ray& aRay) -> bool
+                    {
+                        return aRay.intersects(ellipsoid);
+                    }
+                );
+
+                EXPECT_EQ(rayIntersects, pyramid.intersects(ellipsoid, 40)) << ellipsoid.getCenter().toString();
+            }
+        }
+
+        EXPECT_ANY_THROW(pyramid.intersects(Ellipsoid({0.0, 0.0, 10.0}, 5.0, 5.0, 5.0), 3));
+    }
+
     {
         EXPECT_ANY_THROW(Pyramid::Undefined().intersects(Ellipsoid::Undefined()));
     }
@@ -292,6 +339,78 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Pyramid, Contains_Point)
         EXPECT_FALSE(pyramid.contains(Point {1.0, 2.0, 0.0}));
     }
 
+    {
+        const Polygon base = {
+            {{{-0.1, -0.1}, {+0.1, -0.1}, {+0.1, +0.1}, {-0.1, +0.1}}},
+            {0.0, 0.0, 1.0},
+            {1.0, 0.0, 0.0},
+            {0.0, 1.0, 0.0}
+        };
+        const Point apex = {0.0, 0.0, 0.0};
+
+        const Pyramid pyramid = {base, apex};
+
+        for (const double z : {-1.0, 0.75, 1.25, 2.25})
+        {
+            for (double x = -0.35; x <= 0.35; x += 0.1)
+            {
+                for (double y = -0.35; y <= 0.35; y += 0.1)
+                {
+                    const Point point = {x, y, z};
+
+                    const bool isContained = (z > 0.0) && (std::abs(x) <= 0.1 * z) && (std::abs(y) <= 0.1 * z);
+
+                    EXPECT_EQ(isContained, pyramid.contains(point)) << point.toString();
+                }
+            }
+        }
+    }
+
+    {
+        const Polygon base = {
+            {{{0.0, 0.0}, {2.0, 0.0}, {2.0, 1.0}, {1.0, 1.0}, {1.0, 2.0}, {0.0, 2.0}}},
+            {0.0, 0.0, 1.0},
+            {1.0, 0.0, 0.0},
+            {0.0, 1.0, 0.0}
+        };
+        const Point apex = {0.0, 0.0, 0.0};
+
+        const Pyramid pyramid = {base, apex};
+
+        EXPECT_TRUE(pyramid.contains(Point {0.5, 0.5, 1.0}));
+        EXPECT_TRUE(pyramid.contains(Point {1.5, 0.5, 1.0}));
+        EXPECT_TRUE(pyramid.contains(Point {0.5, 1.5, 1.0}));
+        EXPECT_TRUE(pyramid.contains(Point {3.0, 1.0, 2.0}));
+
+        EXPECT_FALSE(pyramid.contains(Point {1.5, 1.5, 1.0}));
+        EXPECT_FALSE(pyramid.contains(Point {3.0, 3.0, 2.0}));
+        EXPECT_FALSE(pyramid.contains(Point {0.5, 0.5, -1.0}));
+    }
+
+    {
+        using ostk::mathematics::geometry::d3::Transformation;
+
+        const Polygon base = {
+            {{{-0.1, -0.1}, {+0.1, -0.1}, {+0.1, +0.1}, {-0.1, +0.1}}},
+            {0.0, 0.0, 1.0},
+            {1.0, 0.0, 0.0},
+            {0.0, 1.0, 0.0}
+        };
+        const Point apex = {0.0, 0.0, 0.0};
+
+        Pyramid pyramid = {base, apex};
+
+        pyramid.applyTransformation(Transformation::Translation({1.0, 2.0, 3.0}));
+
+        EXPECT_TRUE(pyramid.contains(Point {1.0, 2.0, 3.0}));
+        EXPECT_TRUE(pyramid.contains(Point {1.0, 2.0, 5.0}));
+        EXPECT_TRUE(pyramid.contains(Point {1.15, 2.15, 5.0}));
+
+        EXPECT_FALSE(pyramid.contains(Point {0.0, 0.0, 2.0}));
+        EXPECT_FALSE(pyramid.contains(Point {1.0, 2.0, 1.0}));
+        EXPECT_FALSE(pyramid.contains(Point {1.3, 2.0, 5.0}));
+    }
+
     {
         EXPECT_ANY_THROW(Pyramid::Undefined().contains(Point::Undefined()));
     }
@@ -361,6 +480,56 @@ TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Pyramid, Contains_Segment)
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Pyramid, Contains_PointMatrix)
+{
+    using ostk::core::container::Array;
+
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::Polygon;
+    using ostk::mathematics::geometry::d3::object::Pyramid;
+    using ostk::mathematics::object::MatrixXd;
+
+    {
+        const Polygon base = {
+            {{{-0.1, -0.1}, {+0.1, -0.1}, {+0.1, +0.1}, {-0.1, +0.1}}},
+            {0.0, 0.0, 1.0},
+            {1.0, 0.0, 0.0},
+            {0.0, 1.0, 0.0}
+        };
+        const Point apex = {0.0, 0.0, 0.0};
+
+        const Pyramid pyramid = {base, apex};
+
+        MatrixXd points(7, 3);
+        points << 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.15, 0.15, 2.0, 0.0, 0.0, -1.0, 1.0, 0.0, 0.0, 0.0, -1.0, 0.0, 2.0,
+            2.0, 1.0;
+
+        const Array<bool> expectedContainments = {true, true, true, false, false, false, false};
+
+        for (const Size threadCount : {1, 2, 4, 8})
+        {
+            EXPECT_EQ(expectedContainments, pyramid.contains(points, threadCount));
+        }
+
+        for (Index rowIndex = 0; rowIndex < static_cast<Index>(points.rows()); ++rowIndex)
+        {
+            EXPECT_EQ(
+                pyramid.contains(Point(points(rowIndex, 0), points(rowIndex, 1), points(rowIndex, 2))),
+                expectedContainments[rowIndex]
+            );
+        }
+
+        EXPECT_TRUE(pyramid.contains(MatrixXd(0, 3)).isEmpty());
+
+        EXPECT_ANY_THROW(pyramid.contains(MatrixXd::Zero(2, 2)));
+        EXPECT_ANY_THROW(pyramid.contains(points, 0));
+    }
+
+    {
+        EXPECT_ANY_THROW(Pyramid::Undefined().contains(MatrixXd::Zero(2, 3)));
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Pyramid, GetBase)
 {
     using ostk::mathematics::geometry::d3::object::Point;
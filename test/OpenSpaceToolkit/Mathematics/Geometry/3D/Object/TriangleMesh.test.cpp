@@ -0,0 +1,417 @@
+/// Apache License 2.0
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/TriangleMesh.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::MatrixXi;
+using ostk::mathematics::object::Vector3d;
+
+// Cube [-1, 1]^3, two triangles per face
+
+MatrixXd TriangleMeshTestCubeVertices()
+{
+    MatrixXd vertexMatrix(8, 3);
+
+    vertexMatrix << -1.0, -1.0, -1.0, 1.0, -1.0, -1.0, 1.0, 1.0, -1.0, -1.0, 1.0, -1.0, -1.0, -1.0, 1.0, 1.0, -1.0, 1.0,
+        1.0, 1.0, 1.0, -1.0, 1.0, 1.0;
+
+    return vertexMatrix;
+}
+
+MatrixXi TriangleMeshTestCubeTriangles()
+{
+    MatrixXi triangleMatrix(12, 3);
+
+    triangleMatrix << 0, 2, 1, 0, 3, 2, 4, 5, 6, 4, 6, 7, 0, 1, 5, 0, 5, 4, 3, 7, 6, 3, 6, 2, 0, 4, 7, 0, 7, 3, 1, 2, 6,
+        1, 6, 5;
+
+    return triangleMatrix;
+}
+
+// Random triangle soup in [-10, 10]^3, with small triangles so that rays hit a few of them
+
+void TriangleMeshTestRandomSoup(
+    const Size aTriangleCount, const unsigned int aSeed, MatrixXd& aVertexMatrix, MatrixXi& aTriangleMatrix
+)
+{
+    std::mt19937 generator(aSeed);
+    std::uniform_real_distribution<double> centerDistribution(-10.0, 10.0);
+    std::uniform_real_distribution<double> offsetDistribution(-1.5, 1.5);
+
+    aVertexMatrix.resize(3 * aTriangleCount, 3);
+    aTriangleMatrix.resize(aTriangleCount, 3);
+
+    for (Index triangleIndex = 0; triangleIndex < aTriangleCount; ++triangleIndex)
+    {
+        const Vector3d center = {
+            centerDistribution(generator), centerDistribution(generator), centerDistribution(generator)
+        };
+
+        for (Index vertexIndex = 0; vertexIndex < 3; ++vertexIndex)
+        {
+            const Vector3d offset = {
+                offsetDistribution(generator), offsetDistribution(generator), offsetDistribution(generator)
+            };
+
+            aVertexMatrix.row((3 * triangleIndex) + vertexIndex) = (center + offset).transpose();
+            aTriangleMatrix(triangleIndex, vertexIndex) = (3 * triangleIndex) + vertexIndex;
+        }
+    }
+}
+
+// Brute-force reference: intersect the supporting plane of every triangle, then check barycentric coordinates
+
+void TriangleMeshTestCast(
+    const MatrixXd& aVertexMatrix,
+    const MatrixXi& aTriangleMatrix,
+    const Vector3d& anOrigin,
+    const Vector3d& aDirection,
+    Index& aTriangleIndex,
+    double& aDistance
+)
+{
+    aTriangleIndex = aTriangleMatrix.rows();
+    aDistance = std::numeric_limits<double>::infinity();
+
+    for (Index triangleIndex = 0; triangleIndex < Size(aTriangleMatrix.rows()); ++triangleIndex)
+    {
+        const Vector3d a = aVertexMatrix.row(aTriangleMatrix(triangleIndex, 0)).transpose();
+        const Vector3d b = aVertexMatrix.row(aTriangleMatrix(triangleIndex, 1)).transpose();
+        const Vector3d c = aVertexMatrix.row(aTriangleMatrix(triangleIndex, 2)).transpose();
+
+        const Vector3d normal = (b - a).cross(c - a);
+
+        if (std::abs(normal.dot(aDirection)) < 1e-12)
+        {
+            continue;
+        }
+
+        const double distance = normal.dot(a - anOrigin) / normal.dot(aDirection);
+
+        if ((distance < 0.0) || (distance >= aDistance))
+        {
+            continue;
+        }
+
+        const Vector3d point = anOrigin + (distance * aDirection);
+
+        if (((b - a).cross(point - a).dot(normal) >= 0.0) && ((c - b).cross(point - b).dot(normal) >= 0.0) &&
+            ((a - c).cross(point - c).dot(normal) >= 0.0))
+        {
+            aTriangleIndex = triangleIndex;
+            aDistance = distance;
+        }
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh, Constructor)
+{
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
+
+    {
+        EXPECT_NO_THROW(TriangleMesh(TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()));
+    }
+
+    {
+        EXPECT_NO_THROW(TriangleMesh(MatrixXd::Zero(0, 3), MatrixXi::Zero(0, 3)));
+    }
+
+    {
+        EXPECT_ANY_THROW(TriangleMesh(MatrixXd::Zero(8, 2), TriangleMeshTestCubeTriangles()));
+        EXPECT_ANY_THROW(TriangleMesh(TriangleMeshTestCubeVertices(), MatrixXi::Zero(12, 2)));
+        EXPECT_ANY_THROW(TriangleMesh(TriangleMeshTestCubeVertices(), MatrixXi::Constant(1, 3, 8)));
+        EXPECT_ANY_THROW(TriangleMesh(TriangleMeshTestCubeVertices(), MatrixXi::Constant(1, 3, -1)));
+    }
+
+    {
+        MatrixXd vertexMatrix = TriangleMeshTestCubeVertices();
+        vertexMatrix(0, 0) = std::numeric_limits<double>::quiet_NaN();
+
+        EXPECT_ANY_THROW(TriangleMesh(vertexMatrix, TriangleMeshTestCubeTriangles()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh, EqualToOperator)
+{
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
+
+    {
+        const TriangleMesh mesh = {TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()};
+
+        EXPECT_TRUE(mesh == TriangleMesh(TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()));
+        EXPECT_FALSE(mesh != TriangleMesh(TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()));
+        EXPECT_FALSE(mesh == TriangleMesh(TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles().topRows(6)));
+        EXPECT_FALSE(mesh == TriangleMesh(2.0 * TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()));
+        EXPECT_FALSE(mesh == TriangleMesh::Undefined());
+        EXPECT_FALSE(TriangleMesh::Undefined() == TriangleMesh::Undefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh, IsDefined)
+{
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
+
+    {
+        EXPECT_TRUE(TriangleMesh(TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()).isDefined());
+        EXPECT_FALSE(TriangleMesh(TriangleMeshTestCubeVertices(), MatrixXi::Zero(0, 3)).isDefined());
+        EXPECT_FALSE(TriangleMesh::Undefined().isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh, Getters)
+{
+    using ostk::mathematics::geometry::d3::BoundingBox;
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
+
+    {
+        const TriangleMesh mesh = {TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()};
+
+        EXPECT_EQ(8, mesh.getVertexCount());
+        EXPECT_EQ(12, mesh.getTriangleCount());
+        EXPECT_EQ(TriangleMeshTestCubeVertices(), mesh.getVertices());
+        EXPECT_EQ(TriangleMeshTestCubeTriangles(), mesh.getTriangles());
+        EXPECT_EQ(BoundingBox({-1.0, -1.0, -1.0}, {1.0, 1.0, 1.0}), mesh.getBoundingBox());
+    }
+
+    {
+        EXPECT_ANY_THROW(TriangleMesh::Undefined().getBoundingBox());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh, CastRay)
+{
+    using ostk::core::type::Real;
+
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::Ray;
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
+
+    {
+        const TriangleMesh mesh = {TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()};
+
+        const auto [triangleIndex, distance, point] = mesh.castRay(Ray({0.2, 0.3, 10.0}, {0.0, 0.0, -2.0}));
+
+        EXPECT_TRUE((triangleIndex == 2) || (triangleIndex == 3));
+        EXPECT_NEAR(9.0, distance, 1e-12);
+        EXPECT_TRUE(point.isNear(Point(0.2, 0.3, 1.0), 1e-12));
+    }
+
+    {
+        const TriangleMesh mesh = {TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()};
+
+        // Triangles are two-sided, and a ray starting inside the mesh hits the face in front of it
+
+        const auto [triangleIndex, distance, point] = mesh.castRay(Ray({0.5, 0.0, 0.0}, {1.0, 0.0, 0.0}));
+
+        EXPECT_TRUE((triangleIndex == 10) || (triangleIndex == 11));
+        EXPECT_NEAR(0.5, distance, 1e-12);
+        EXPECT_TRUE(point.isNear(Point(1.0, 0.0, 0.0), 1e-12));
+    }
+
+    {
+        const TriangleMesh mesh = {TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()};
+
+        const auto [triangleIndex, distance, point] = mesh.castRay(Ray({0.0, 0.0, 10.0}, {0.0, 0.0, 1.0}));
+
+        EXPECT_EQ(12, triangleIndex);
+        EXPECT_FALSE(distance.isDefined());
+        EXPECT_FALSE(point.isDefined());
+    }
+
+    {
+        MatrixXd vertexMatrix;
+        MatrixXi triangleMatrix;
+
+        TriangleMeshTestRandomSoup(2000, 1, vertexMatrix, triangleMatrix);
+
+        const TriangleMesh mesh = {vertexMatrix, triangleMatrix};
+
+        std::mt19937 generator(2);
+        std::uniform_real_distribution<double> distribution(-12.0, 12.0);
+
+        Size hitCount = 0;
+
+        for (Index rayIndex = 0; rayIndex < 500; ++rayIndex)
+        {
+            const Vector3d origin = {distribution(generator), distribution(generator), distribution(generator)};
+            const Vector3d direction =
+                Vector3d(distribution(generator), distribution(generator), distribution(generator)).normalized();
+
+            Index expectedTriangleIndex = 0;
+            double expectedDistance = 0.0;
+
+            TriangleMeshTestCast(
+                vertexMatrix, triangleMatrix, origin, direction, expectedTriangleIndex, expectedDistance
+            );
+
+            const Ray ray = {Point::Vector(origin), direction};
+
+            const auto [triangleIndex, distance, point] = mesh.castRay(ray);
+
+            EXPECT_EQ(expectedTriangleIndex, triangleIndex);
+            EXPECT_EQ(expectedTriangleIndex < mesh.getTriangleCount(), mesh.intersects(ray));
+
+            if (expectedTriangleIndex < mesh.getTriangleCount())
+            {
+                EXPECT_NEAR(expectedDistance, distance, 1e-9);
+                EXPECT_TRUE(point.isNear(Point::Vector(origin + (expectedDistance * direction)), 1e-9));
+
+                ++hitCount;
+            }
+        }
+
+        EXPECT_LT(50, hitCount);
+    }
+
+    {
+        EXPECT_ANY_THROW(TriangleMesh::Undefined().castRay(Ray({0.0, 0.0, 0.0}, {0.0, 0.0, 1.0})));
+        EXPECT_ANY_THROW(
+            TriangleMesh(TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()).castRay(Ray::Undefined())
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh, CastRays)
+{
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::Ray;
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
+
+    {
+        MatrixXd vertexMatrix;
+        MatrixXi triangleMatrix;
+
+        TriangleMeshTestRandomSoup(1000, 3, vertexMatrix, triangleMatrix);
+
+        const TriangleMesh mesh = {vertexMatrix, triangleMatrix};
+
+        const MatrixXd originMatrix = 12.0 * MatrixXd::Random(300, 3);
+        const MatrixXd directionMatrix = 5.0 * MatrixXd::Random(300, 3);
+
+        const Array<TriangleMesh::Hit> hits = mesh.castRays(originMatrix, directionMatrix, 4);
+        const Array<bool> intersections = mesh.intersects(originMatrix, directionMatrix, 4);
+        const Array<TriangleMesh::Hit> singleThreadHits = mesh.castRays(originMatrix, directionMatrix, 1);
+
+        ASSERT_EQ(300, hits.getSize());
+        ASSERT_EQ(300, intersections.getSize());
+
+        for (Index rayIndex = 0; rayIndex < 300; ++rayIndex)
+        {
+            const Ray ray = {
+                Point::Vector(originMatrix.row(rayIndex).transpose()), directionMatrix.row(rayIndex).transpose()
+            };
+
+            const auto [expectedTriangleIndex, expectedDistance, expectedPoint] = mesh.castRay(ray);
+            const auto [triangleIndex, distance, point] = hits[rayIndex];
+
+            EXPECT_EQ(expectedTriangleIndex, triangleIndex);
+            EXPECT_EQ(expectedTriangleIndex, std::get<0>(singleThreadHits[rayIndex]));
+            EXPECT_EQ(expectedDistance.isDefined(), distance.isDefined());
+            EXPECT_EQ(mesh.intersects(ray), intersections[rayIndex]);
+            EXPECT_EQ(expectedTriangleIndex < mesh.getTriangleCount(), intersections[rayIndex]);
+
+            if (expectedDistance.isDefined())
+            {
+                EXPECT_EQ(expectedDistance, distance);
+                EXPECT_EQ(expectedPoint, point);
+            }
+        }
+
+        EXPECT_TRUE(intersections == mesh.intersects(originMatrix, directionMatrix, 1));
+    }
+
+    {
+        const TriangleMesh mesh = {TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()};
+
+        EXPECT_EQ(0, mesh.castRays(MatrixXd::Zero(0, 3), MatrixXd::Zero(0, 3)).getSize());
+
+        EXPECT_ANY_THROW(mesh.castRays(MatrixXd::Zero(2, 2), MatrixXd::Ones(2, 2)));
+        EXPECT_ANY_THROW(mesh.castRays(MatrixXd::Zero(2, 3), MatrixXd::Ones(3, 3)));
+        EXPECT_ANY_THROW(mesh.castRays(MatrixXd::Zero(2, 3), MatrixXd::Zero(2, 3)));
+        EXPECT_ANY_THROW(mesh.castRays(MatrixXd::Zero(2, 3), MatrixXd::Ones(2, 3), 0));
+        EXPECT_ANY_THROW(mesh.intersects(MatrixXd::Zero(2, 3), MatrixXd::Zero(2, 3)));
+        EXPECT_ANY_THROW(mesh.intersects(MatrixXd::Zero(2, 3), MatrixXd::Ones(2, 3), 0));
+        EXPECT_ANY_THROW(TriangleMesh::Undefined().castRays(MatrixXd::Zero(2, 3), MatrixXd::Ones(2, 3)));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh, IntersectionWith)
+{
+    using ostk::mathematics::geometry::d3::Intersection;
+    using ostk::mathematics::geometry::d3::Object;
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::Ray;
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
+
+    {
+        const TriangleMesh mesh = {TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()};
+        const Ray ray = {{10.0, 0.2, 0.3}, {-1.0, 0.0, 0.0}};
+
+        EXPECT_EQ(Intersection::Point(Point(1.0, 0.2, 0.3)), mesh.intersectionWith(ray));
+        EXPECT_EQ(Intersection::Point(Point(1.0, 0.2, 0.3)), static_cast<const Object&>(mesh).intersectionWith(ray));
+        EXPECT_EQ(Intersection::Point(Point(1.0, 0.2, 0.3)), static_cast<const Object&>(ray).intersectionWith(mesh));
+
+        EXPECT_TRUE(static_cast<const Object&>(mesh).intersects(ray));
+        EXPECT_TRUE(static_cast<const Object&>(ray).intersects(mesh));
+    }
+
+    {
+        const TriangleMesh mesh = {TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()};
+        const Ray ray = {{10.0, 0.2, 0.3}, {1.0, 0.0, 0.0}};
+
+        EXPECT_TRUE(mesh.intersectionWith(ray).isEmpty());
+        EXPECT_FALSE(static_cast<const Object&>(mesh).intersects(ray));
+        EXPECT_FALSE(static_cast<const Object&>(ray).intersects(mesh));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh, ApplyTransformation)
+{
+    using ostk::mathematics::geometry::d3::object::Point;
+    using ostk::mathematics::geometry::d3::object::Ray;
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
+    using ostk::mathematics::geometry::d3::Transformation;
+
+    {
+        TriangleMesh mesh = {TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()};
+
+        mesh.applyTransformation(Transformation::Translation({4.0, 5.0, 6.0}));
+
+        const MatrixXd vertexMatrix = TriangleMeshTestCubeVertices().rowwise() + Vector3d(4.0, 5.0, 6.0).transpose();
+
+        EXPECT_EQ(TriangleMesh(vertexMatrix, TriangleMeshTestCubeTriangles()), mesh);
+        EXPECT_FALSE(mesh.intersects(Ray({0.0, 0.0, 10.0}, {0.0, 0.0, -1.0})));
+        EXPECT_TRUE(
+            std::get<2>(mesh.castRay(Ray({4.0, 5.0, 10.0}, {0.0, 0.0, -1.0}))).isNear(Point(4.0, 5.0, 7.0), 1e-12)
+        );
+    }
+
+    {
+        TriangleMesh mesh = {TriangleMeshTestCubeVertices(), TriangleMeshTestCubeTriangles()};
+
+        EXPECT_ANY_THROW(mesh.applyTransformation(Transformation::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Object_TriangleMesh, Undefined)
+{
+    using ostk::mathematics::geometry::d3::object::TriangleMesh;
+
+    {
+        EXPECT_NO_THROW(TriangleMesh::Undefined());
+        EXPECT_FALSE(TriangleMesh::Undefined().isDefined());
+    }
+}
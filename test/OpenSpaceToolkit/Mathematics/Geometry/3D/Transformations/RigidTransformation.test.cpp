@@ -0,0 +1,330 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/RigidTransformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationVector.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Real;
+
+using ostk::mathematics::geometry::Angle;
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::geometry::d3::Transformation;
+using ostk::mathematics::geometry::d3::transformation::RigidTransformation;
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+
+// Rotations about skewed axes, followed by translations
+
+static RigidTransformation FirstRigidTransformation()
+{
+    return {
+        Quaternion::RotationVector(RotationVector(Vector3d(1.0, 2.0, 3.0).normalized(), Angle::Degrees(30.0))),
+        Vector3d(1.0, -2.0, 0.5)
+    };
+}
+
+static RigidTransformation SecondRigidTransformation()
+{
+    return {
+        Quaternion::RotationVector(RotationVector(Vector3d(-1.0, 0.0, 1.0).normalized(), Angle::Degrees(-75.0))),
+        Vector3d(0.0, 3.0, -1.0)
+    };
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, Constructor)
+{
+    {
+        EXPECT_NO_THROW(RigidTransformation(Quaternion::Unit(), Vector3d(1.0, 2.0, 3.0)));
+        EXPECT_TRUE(RigidTransformation(Quaternion::Unit(), Vector3d(1.0, 2.0, 3.0)).isDefined());
+    }
+
+    {
+        const RigidTransformation rigidTransformation = {Quaternion::XYZS(0.0, 0.0, 0.0, 2.0), Vector3d::Zero()};
+
+        EXPECT_TRUE(rigidTransformation.getRotation().isUnitary());
+    }
+
+    {
+        EXPECT_FALSE(RigidTransformation(Quaternion::Undefined(), Vector3d::Zero()).isDefined());
+        EXPECT_FALSE(RigidTransformation(Quaternion::Unit(), Vector3d::Undefined()).isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, EqualToOperator)
+{
+    {
+        EXPECT_TRUE(FirstRigidTransformation() == FirstRigidTransformation());
+        EXPECT_FALSE(FirstRigidTransformation() == SecondRigidTransformation());
+        EXPECT_FALSE(FirstRigidTransformation() != FirstRigidTransformation());
+        EXPECT_TRUE(FirstRigidTransformation() != SecondRigidTransformation());
+    }
+
+    {
+        EXPECT_FALSE(RigidTransformation::Undefined() == RigidTransformation::Undefined());
+        EXPECT_TRUE(RigidTransformation::Undefined() != RigidTransformation::Identity());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, MultiplicationOperator)
+{
+    const Point point = {0.3, -1.2, 2.5};
+
+    {
+        const RigidTransformation composition = FirstRigidTransformation() * SecondRigidTransformation();
+
+        EXPECT_TRUE(composition.applyTo(point).isNear(
+            FirstRigidTransformation().applyTo(SecondRigidTransformation().applyTo(point)), 1e-12
+        ));
+        EXPECT_TRUE(composition.getRotation().isUnitary());
+    }
+
+    {
+        RigidTransformation composition = RigidTransformation::Identity();
+
+        for (int stepIndex = 0; stepIndex < 1000; ++stepIndex)
+        {
+            composition *= (stepIndex % 2 == 0) ? FirstRigidTransformation() : SecondRigidTransformation();
+        }
+
+        EXPECT_TRUE(composition.getRotation().isUnitary(1e-12));
+    }
+
+    {
+        EXPECT_ANY_THROW(RigidTransformation::Undefined() * FirstRigidTransformation());
+        EXPECT_ANY_THROW(FirstRigidTransformation() * RigidTransformation::Undefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, IsNear)
+{
+    {
+        EXPECT_TRUE(FirstRigidTransformation().isNear(FirstRigidTransformation(), Angle::Radians(1e-12), 1e-12));
+        EXPECT_FALSE(FirstRigidTransformation().isNear(SecondRigidTransformation(), Angle::Degrees(1.0), 1.0));
+        EXPECT_FALSE(FirstRigidTransformation().isNear(
+            FirstRigidTransformation() * RigidTransformation::Translation({0.0, 0.0, 1e-3}),
+            Angle::Radians(1e-12),
+            1e-6
+        ));
+    }
+
+    {
+        EXPECT_ANY_THROW(
+            RigidTransformation::Undefined().isNear(FirstRigidTransformation(), Angle::Degrees(1.0), 1.0)
+        );
+        EXPECT_ANY_THROW(
+            FirstRigidTransformation().isNear(FirstRigidTransformation(), Angle::Degrees(1.0), Real::Undefined())
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, GetInverse)
+{
+    {
+        const RigidTransformation rigidTransformation = FirstRigidTransformation();
+
+        EXPECT_TRUE((rigidTransformation * rigidTransformation.getInverse())
+                        .isNear(RigidTransformation::Identity(), Angle::Radians(1e-12), 1e-12));
+        EXPECT_TRUE((rigidTransformation.getInverse() * rigidTransformation)
+                        .isNear(RigidTransformation::Identity(), Angle::Radians(1e-12), 1e-12));
+    }
+
+    {
+        EXPECT_ANY_THROW(RigidTransformation::Undefined().getInverse());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, ApplyTo)
+{
+    {
+        const RigidTransformation rigidTransformation = FirstRigidTransformation();
+
+        const Vector3d vector = {0.3, -1.2, 2.5};
+
+        const Vector3d rotatedVector_ref = rigidTransformation.getRotation().rotateVector(vector);
+
+        EXPECT_TRUE(rigidTransformation.applyTo(vector).isApprox(rotatedVector_ref, 1e-12));
+        EXPECT_TRUE(rigidTransformation.applyTo(Point::Vector(vector))
+                        .isNear(Point::Vector(rotatedVector_ref + rigidTransformation.getTranslation()), 1e-12));
+    }
+
+    {
+        EXPECT_EQ(
+            Point(2.0, 4.0, 6.0), RigidTransformation::Translation({1.0, 2.0, 3.0}).applyTo(Point(1.0, 2.0, 3.0))
+        );
+        EXPECT_EQ(
+            Vector3d(1.0, 2.0, 3.0),
+            RigidTransformation::Translation({1.0, 2.0, 3.0}).applyTo(Vector3d(1.0, 2.0, 3.0))
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(RigidTransformation::Undefined().applyTo(Point(1.0, 2.0, 3.0)));
+        EXPECT_ANY_THROW(RigidTransformation::Identity().applyTo(Point::Undefined()));
+        EXPECT_ANY_THROW(RigidTransformation::Identity().applyTo(Vector3d::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, ApplyToPoints)
+{
+    {
+        const RigidTransformation rigidTransformation = FirstRigidTransformation();
+
+        const MatrixXd points = MatrixXd::Random(3, 100);
+
+        MatrixXd pointMatrix = points;
+
+        rigidTransformation.applyToPoints(pointMatrix);
+
+        for (Eigen::Index pointIndex = 0; pointIndex < points.cols(); ++pointIndex)
+        {
+            const Vector3d point_ref =
+                rigidTransformation.applyTo(Point::Vector(points.col(pointIndex))).asVector();
+
+            EXPECT_TRUE(pointMatrix.col(pointIndex).isApprox(point_ref, 1e-12));
+        }
+    }
+
+    {
+        MatrixXd pointMatrix = MatrixXd::Zero(2, 10);
+
+        EXPECT_ANY_THROW(RigidTransformation::Identity().applyToPoints(pointMatrix));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, ToTransformation)
+{
+    const Point point = {0.3, -1.2, 2.5};
+
+    {
+        for (const RigidTransformation& rigidTransformation :
+             {FirstRigidTransformation(),
+              SecondRigidTransformation(),
+              RigidTransformation::Rotation(FirstRigidTransformation().getRotation())})
+        {
+            const Transformation transformation = rigidTransformation.toTransformation();
+
+            EXPECT_TRUE(transformation.isRigid());
+            EXPECT_TRUE(transformation.applyTo(point).isNear(rigidTransformation.applyTo(point), 1e-12));
+        }
+    }
+
+    {
+        EXPECT_EQ(Transformation::Type::Identity, RigidTransformation::Identity().toTransformation().getType());
+        EXPECT_EQ(
+            Transformation::Type::Translation,
+            RigidTransformation::Translation({1.0, 2.0, 3.0}).toTransformation().getType()
+        );
+        EXPECT_EQ(
+            Transformation::Type::Rotation,
+            RigidTransformation::Rotation(FirstRigidTransformation().getRotation()).toTransformation().getType()
+        );
+        EXPECT_FALSE(RigidTransformation::Undefined().toTransformation().isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, Transformation)
+{
+    const Point point = {0.3, -1.2, 2.5};
+
+    {
+        const Transformation transformation = Transformation::RotationAround(
+            {1.0, 2.0, 3.0}, RotationVector(Vector3d(0.0, 1.0, 1.0).normalized(), Angle::Degrees(60.0))
+        );
+
+        const RigidTransformation rigidTransformation = RigidTransformation::Transformation(transformation);
+
+        EXPECT_TRUE(rigidTransformation.applyTo(point).isNear(transformation.applyTo(point), 1e-12));
+        EXPECT_TRUE(RigidTransformation::Transformation(rigidTransformation.toTransformation())
+                        .isNear(rigidTransformation, Angle::Radians(1e-12), 1e-12));
+    }
+
+    {
+        EXPECT_EQ(RigidTransformation::Identity(), RigidTransformation::Transformation(Transformation::Identity()));
+    }
+
+    {
+        EXPECT_ANY_THROW(RigidTransformation::Transformation(Transformation::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, Interpolate)
+{
+    {
+        const RigidTransformation firstRigidTransformation = FirstRigidTransformation();
+        const RigidTransformation secondRigidTransformation = SecondRigidTransformation();
+
+        EXPECT_TRUE(RigidTransformation::Interpolate(firstRigidTransformation, secondRigidTransformation, 0.0)
+                        .isNear(firstRigidTransformation, Angle::Radians(1e-12), 1e-12));
+        EXPECT_TRUE(RigidTransformation::Interpolate(firstRigidTransformation, secondRigidTransformation, 1.0)
+                        .isNear(secondRigidTransformation, Angle::Radians(1e-12), 1e-12));
+
+        const RigidTransformation halfway =
+            RigidTransformation::Interpolate(firstRigidTransformation, secondRigidTransformation, 0.5);
+
+        EXPECT_TRUE(halfway.getTranslation().isApprox(
+            0.5 * (firstRigidTransformation.getTranslation() + secondRigidTransformation.getTranslation()), 1e-12
+        ));
+        EXPECT_NEAR(
+            halfway.getRotation().angularDifferenceWith(firstRigidTransformation.getRotation()).inRadians(),
+            halfway.getRotation().angularDifferenceWith(secondRigidTransformation.getRotation()).inRadians(),
+            1e-12
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(RigidTransformation::Interpolate(FirstRigidTransformation(), SecondRigidTransformation(), 1.5)
+        );
+        EXPECT_ANY_THROW(
+            RigidTransformation::Interpolate(RigidTransformation::Undefined(), SecondRigidTransformation(), 0.5)
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, Undefined)
+{
+    {
+        EXPECT_NO_THROW(RigidTransformation::Undefined());
+        EXPECT_FALSE(RigidTransformation::Undefined().isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, Identity)
+{
+    {
+        EXPECT_TRUE(RigidTransformation::Identity().isDefined());
+        EXPECT_EQ(Point(1.0, 2.0, 3.0), RigidTransformation::Identity().applyTo(Point(1.0, 2.0, 3.0)));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, Translation)
+{
+    {
+        EXPECT_EQ(Vector3d(1.0, 2.0, 3.0), RigidTransformation::Translation({1.0, 2.0, 3.0}).getTranslation());
+        EXPECT_EQ(Quaternion::Unit(), RigidTransformation::Translation({1.0, 2.0, 3.0}).getRotation());
+    }
+
+    {
+        EXPECT_ANY_THROW(RigidTransformation::Translation(Vector3d::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_3D_Transformation_RigidTransformation, Rotation)
+{
+    {
+        const Quaternion rotation = FirstRigidTransformation().getRotation();
+
+        EXPECT_EQ(rotation, RigidTransformation::Rotation(rotation).getRotation());
+        EXPECT_EQ(Vector3d::Zero(), RigidTransformation::Rotation(rotation).getTranslation());
+    }
+
+    {
+        EXPECT_ANY_THROW(RigidTransformation::Rotation(Quaternion::Undefined()));
+    }
+}
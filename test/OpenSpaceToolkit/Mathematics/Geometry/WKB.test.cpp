@@ -0,0 +1,241 @@
+/// Apache License 2.0
+
+#include <filesystem>
+#include <fstream>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/WKB.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+
+using ostk::mathematics::geometry::WKB;
+
+using Point2d = ostk::mathematics::geometry::d2::object::Point;
+using PointSet2d = ostk::mathematics::geometry::d2::object::PointSet;
+using LineString2d = ostk::mathematics::geometry::d2::object::LineString;
+using Polygon2d = ostk::mathematics::geometry::d2::object::Polygon;
+using MultiPolygon2d = ostk::mathematics::geometry::d2::object::MultiPolygon;
+using Point3d = ostk::mathematics::geometry::d3::object::Point;
+using PointSet3d = ostk::mathematics::geometry::d3::object::PointSet;
+using LineString3d = ostk::mathematics::geometry::d3::object::LineString;
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_WKB, Encode)
+{
+    {
+        // POINT (1 2)
+
+        const WKB::Buffer littleEndianBuffer = {1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 0, 64};
+        const WKB::Buffer bigEndianBuffer = {0, 0, 0, 0, 1, 63, 240, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0};
+
+        EXPECT_EQ(littleEndianBuffer, WKB::Encode(Point2d(1.0, 2.0)));
+        EXPECT_EQ(bigEndianBuffer, WKB::Encode(Point2d(1.0, 2.0), WKB::ByteOrder::BigEndian));
+    }
+
+    {
+        // Header, count and 3 points of 2 coordinates
+
+        EXPECT_EQ(
+            1 + 4 + 4 + (3 * 2 * 8), WKB::Encode(LineString2d({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}})).getSize()
+        );
+
+        // Header, ring count, then point count and 4 points (closing point included)
+
+        EXPECT_EQ(
+            1 + 4 + 4 + 4 + (4 * 2 * 8), WKB::Encode(Polygon2d({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}})).getSize()
+        );
+
+        EXPECT_EQ(1 + 4 + (3 * 8), WKB::Encode(Point3d(1.0, 2.0, 3.0)).getSize());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_WKB, Decode)
+{
+    const Point2d point = {1.0, 2.0};
+    const PointSet2d pointSet = {{{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}}};
+    const LineString2d lineString = {{{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}}};
+    const Array<Point2d> outerRing = {{0.0, 0.0}, {10.0, 0.0}, {10.0, 10.0}, {0.0, 10.0}};
+    const Array<Array<Point2d>> innerRings = {{{1.0, 1.0}, {2.0, 1.0}, {2.0, 2.0}, {1.0, 2.0}}};
+    const Polygon2d polygon = {outerRing, innerRings};
+    const MultiPolygon2d multiPolygon = {{polygon, Polygon2d({{20.0, 20.0}, {30.0, 20.0}, {30.0, 30.0}})}};
+    const Point3d point3d = {1.0, 2.0, 3.0};
+    const PointSet3d pointSet3d = {{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}}};
+    const LineString3d lineString3d = {{{0.0, 0.0, 0.0}, {1.0, 0.0, 1.0}, {1.0, 1.0, 2.0}}};
+
+    for (const WKB::ByteOrder byteOrder : {WKB::ByteOrder::LittleEndian, WKB::ByteOrder::BigEndian})
+    {
+        EXPECT_EQ(point, WKB::Reader(WKB::Encode(point, byteOrder)).readPoint2d());
+        EXPECT_EQ(pointSet, WKB::Reader(WKB::Encode(pointSet, byteOrder)).readPointSet2d());
+        EXPECT_EQ(lineString, WKB::Reader(WKB::Encode(lineString, byteOrder)).readLineString2d());
+        EXPECT_EQ(polygon, WKB::Reader(WKB::Encode(polygon, byteOrder)).readPolygon2d());
+        EXPECT_EQ(multiPolygon, WKB::Reader(WKB::Encode(multiPolygon, byteOrder)).readMultiPolygon2d());
+        EXPECT_EQ(point3d, WKB::Reader(WKB::Encode(point3d, byteOrder)).readPoint3d());
+        EXPECT_EQ(pointSet3d, WKB::Reader(WKB::Encode(pointSet3d, byteOrder)).readPointSet3d());
+        EXPECT_EQ(lineString3d, WKB::Reader(WKB::Encode(lineString3d, byteOrder)).readLineString3d());
+
+        // Polygons are read as multi-polygons
+
+        EXPECT_EQ(MultiPolygon2d::Polygon(polygon), WKB::Reader(WKB::Encode(polygon, byteOrder)).readMultiPolygon2d());
+    }
+
+    {
+        // Undefined and empty geometries
+
+        EXPECT_FALSE(WKB::Reader(WKB::Encode(Point2d::Undefined())).readPoint2d().isDefined());
+        EXPECT_FALSE(WKB::Reader(WKB::Encode(Point3d::Undefined())).readPoint3d().isDefined());
+        EXPECT_TRUE(WKB::Reader(WKB::Encode(PointSet2d::Empty())).readPointSet2d().isEmpty());
+        EXPECT_TRUE(WKB::Reader(WKB::Encode(LineString2d::Empty())).readLineString2d().isEmpty());
+        EXPECT_FALSE(WKB::Reader(WKB::Encode(Polygon2d::Undefined())).readPolygon2d().isDefined());
+        EXPECT_FALSE(WKB::Reader(WKB::Encode(MultiPolygon2d::Undefined())).readMultiPolygon2d().isDefined());
+    }
+
+    {
+        // Extended (EWKB) Z point
+
+        const WKB::Buffer buffer = {1, 1, 0, 0, 128, 0, 0, 0, 0, 0, 0, 240, 63,
+                                    0, 0, 0, 0, 0, 0, 0, 64,  0, 0, 0, 0, 0, 0, 8, 64};
+
+        EXPECT_EQ(point3d, WKB::Reader(buffer).readPoint3d());
+    }
+
+    {
+        // Wrong type or dimension, truncated or corrupted data
+
+        EXPECT_ANY_THROW(WKB::Reader(WKB::Encode(point)).readLineString2d());
+        EXPECT_ANY_THROW(WKB::Reader(WKB::Encode(point)).readPoint3d());
+        EXPECT_ANY_THROW(WKB::Reader(WKB::Buffer::Empty()).readPoint2d());
+
+        WKB::Buffer truncatedBuffer = WKB::Encode(lineString);
+
+        truncatedBuffer.pop_back();
+
+        EXPECT_ANY_THROW(WKB::Reader(truncatedBuffer).readLineString2d());
+
+        WKB::Buffer wrongCountBuffer = WKB::Encode(lineString);
+
+        wrongCountBuffer[8] = 127;
+
+        EXPECT_ANY_THROW(WKB::Reader(wrongCountBuffer).readLineString2d());
+
+        WKB::Buffer wrongByteOrderBuffer = WKB::Encode(point);
+
+        wrongByteOrderBuffer[0] = 2;
+
+        EXPECT_ANY_THROW(WKB::Reader(wrongByteOrderBuffer).readPoint2d());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_WKB, Writer)
+{
+    const Point2d point = {1.0, 2.0};
+    const Polygon2d polygon = Polygon2d({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}});
+    const Point3d point3d = {1.0, 2.0, 3.0};
+
+    WKB::Writer writer = {WKB::ByteOrder::BigEndian};
+
+    writer.write(point);
+    writer.write(polygon);
+    writer.write(point3d);
+
+    EXPECT_EQ(
+        WKB::Encode(point, WKB::ByteOrder::BigEndian).getSize() + WKB::Encode(polygon).getSize() +
+            WKB::Encode(point3d).getSize(),
+        writer.accessBuffer().getSize()
+    );
+
+    WKB::Reader reader = {writer.accessBuffer()};
+
+    EXPECT_EQ(WKB::Type::Point, reader.getNextType());
+    EXPECT_EQ(2, reader.getNextDimension());
+    EXPECT_EQ(point, reader.readPoint2d());
+
+    EXPECT_EQ(WKB::Type::Polygon, reader.getNextType());
+    EXPECT_EQ(polygon, reader.readPolygon2d());
+
+    EXPECT_EQ(WKB::Type::Point, reader.getNextType());
+    EXPECT_EQ(3, reader.getNextDimension());
+    EXPECT_EQ(point3d, reader.readPoint3d());
+
+    EXPECT_TRUE(reader.isEnd());
+    EXPECT_EQ(writer.accessBuffer().getSize(), reader.getOffset());
+
+    writer.clear();
+
+    EXPECT_TRUE(writer.accessBuffer().isEmpty());
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_WKB, Reader)
+{
+    const LineString2d lineString = {{{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}}};
+    const MultiPolygon2d multiPolygon = {{Polygon2d({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}})}};
+    const PointSet3d pointSet3d = {{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}}};
+
+    WKB::Writer writer;
+
+    writer.write(multiPolygon);
+    writer.write(pointSet3d);
+    writer.write(lineString);
+
+    {
+        WKB::Reader reader = {writer.getBuffer()};
+
+        reader.skip();
+        reader.skip();
+
+        EXPECT_EQ(lineString, reader.readLineString2d());
+        EXPECT_TRUE(reader.isEnd());
+
+        reader.rewind();
+
+        EXPECT_EQ(0, reader.getOffset());
+        EXPECT_EQ(multiPolygon, reader.readMultiPolygon2d());
+    }
+
+    {
+        WKB::Reader reader = {writer.accessBuffer().data(), writer.accessBuffer().getSize()};
+
+        EXPECT_EQ(writer.accessBuffer().getSize(), reader.getByteCount());
+        EXPECT_EQ(WKB::Type::MultiPolygon, reader.getNextType());
+    }
+
+    {
+        const std::filesystem::path filePath = std::filesystem::temp_directory_path() / "ostk-mathematics-wkb.test";
+
+        {
+            std::ofstream fileStream(filePath, std::ios::binary);
+
+            fileStream.write(
+                reinterpret_cast<const char*>(writer.accessBuffer().data()), writer.accessBuffer().getSize()
+            );
+        }
+
+        WKB::Reader reader = WKB::Reader::Map(File::Path(Path::Parse(filePath.string())));
+
+        EXPECT_EQ(writer.accessBuffer().getSize(), reader.getByteCount());
+        EXPECT_EQ(multiPolygon, reader.readMultiPolygon2d());
+        EXPECT_EQ(pointSet3d, reader.readPointSet3d());
+        EXPECT_EQ(lineString, reader.readLineString2d());
+        EXPECT_TRUE(reader.isEnd());
+
+        std::filesystem::remove(filePath);
+
+        EXPECT_ANY_THROW(WKB::Reader::Map(File::Path(Path::Parse(filePath.string()))));
+        EXPECT_ANY_THROW(WKB::Reader::Map(File::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Geometry_WKB, StringFromType)
+{
+    EXPECT_EQ("Undefined", WKB::StringFromType(WKB::Type::Undefined));
+    EXPECT_EQ("Point", WKB::StringFromType(WKB::Type::Point));
+    EXPECT_EQ("LineString", WKB::StringFromType(WKB::Type::LineString));
+    EXPECT_EQ("Polygon", WKB::StringFromType(WKB::Type::Polygon));
+    EXPECT_EQ("MultiPoint", WKB::StringFromType(WKB::Type::MultiPoint));
+    EXPECT_EQ("MultiPolygon", WKB::StringFromType(WKB::Type::MultiPolygon));
+}
@@ -1993,6 +1993,98 @@ TEST(OpenSpaceToolkit_Mathematics_Object_Interval, GenerateArrayWithSize)
     }
 }
 
+TEST(OpenSpaceToolkit_Mathematics_Object_Interval, GenerateRangeWithStep)
+{
+    using ostk::core::container::Array;
+    using ostk::core::type::Real;
+    using ostk::mathematics::object::Interval;
+
+    {
+        const Array<Interval<Real>> intervals = {
+            Interval<Real>::Closed(0.0, 1.0),
+            Interval<Real>::Open(0.0, 1.0),
+            Interval<Real>::HalfOpenLeft(0.0, 1.0),
+            Interval<Real>::HalfOpenRight(0.0, 1.0),
+            Interval<Real>::Closed(1.0, 1.0),
+        };
+
+        const Array<Real> steps = {0.5, -0.5, 0.3, -0.3, 2.0, -2.0, 1.0, -1.0};
+
+        for (const auto& interval : intervals)
+        {
+            for (const auto& step : steps)
+            {
+                Array<Real> values = Array<Real>::Empty();
+
+                for (const Real& value : interval.generateRangeWithStep(step))
+                {
+                    values.add(value);
+                }
+
+                EXPECT_EQ(interval.generateArrayWithStep(step), values) << interval.toString() << " / " << step;
+            }
+        }
+    }
+
+    {
+        const Interval<Real>::StepRange<Real> range = Interval<Real>::Closed(0.0, 1.0).generateRangeWithStep(Real(0.25));
+
+        EXPECT_EQ(5, std::distance(range.begin(), range.end()));
+        EXPECT_EQ(Real(0.0), *range.begin());
+        EXPECT_EQ(range.end(), range.end());
+        EXPECT_NE(range.begin(), range.end());
+    }
+
+    {
+        const Interval<Real>::StepRange<Real> range = Interval<Real>::Open(0.0, 1.0).generateRangeWithStep(Real(2.0));
+
+        EXPECT_EQ(range.begin(), range.end());
+    }
+
+    {
+        EXPECT_ANY_THROW(Interval<Real>::Undefined().generateRangeWithStep(Real(1.0)));
+        EXPECT_ANY_THROW(Interval<Real>::Closed(0.0, 1.0).generateRangeWithStep(Real::Undefined()));
+        EXPECT_ANY_THROW(Interval<Real>::Closed(0.0, 1.0).generateRangeWithStep(Real(0.0)));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_Interval, GenerateRangeWithSize)
+{
+    using ostk::core::container::Array;
+    using ostk::core::type::Real;
+    using ostk::core::type::Size;
+    using ostk::mathematics::object::Interval;
+
+    {
+        const Array<Interval<Real>> intervals = {
+            Interval<Real>::Closed(0.0, 1.0),
+            Interval<Real>::Open(0.0, 1.0),
+            Interval<Real>::HalfOpenLeft(0.0, 1.0),
+            Interval<Real>::HalfOpenRight(0.0, 1.0),
+        };
+
+        for (const auto& interval : intervals)
+        {
+            for (Size size = 2; size < 10; ++size)
+            {
+                const Interval<Real>::SizeRange range = interval.generateRangeWithSize(size);
+
+                EXPECT_EQ(size, range.getSize());
+
+                const Array<Real> values = {range.begin(), range.end()};
+
+                EXPECT_EQ(interval.generateArrayWithSize(size), values) << interval.toString() << " / " << size;
+            }
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(Interval<Real>::Closed(0.0, 1.0).generateRangeWithSize(0));
+        EXPECT_ANY_THROW(Interval<Real>::Closed(0.0, 1.0).generateRangeWithSize(1));
+        EXPECT_ANY_THROW(Interval<Real>::Undefined().generateRangeWithSize(2));
+    }
+}
+
 TEST(OpenSpaceToolkit_Mathematics_Object_Interval, ToString)
 {
     using ostk::core::type::Real;
@@ -0,0 +1,382 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/IntervalSet.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Real;
+using ostk::mathematics::object::Interval;
+using ostk::mathematics::object::IntervalSet;
+namespace ctnr = ostk::core::container;
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, Constructor)
+{
+    {
+        EXPECT_NO_THROW(IntervalSet<Real>({}));
+        EXPECT_NO_THROW(IntervalSet<Real>({Interval<Real>::Closed(0.0, 1.0)}));
+
+        EXPECT_ANY_THROW(IntervalSet<Real>({Interval<Real>::Undefined()}));
+        EXPECT_ANY_THROW(IntervalSet<Real>({Interval<Real>::Closed(0.0, 1.0), Interval<Real>::Undefined()}));
+    }
+
+    {
+        const IntervalSet<Real> intervalSet = {
+            Interval<Real>::Closed(0.0, 3.0),
+            Interval<Real>::Open(0.0, 2.0),
+            Interval<Real>::HalfOpenLeft(4.0, 5.0),
+            Interval<Real>::Closed(0.5, 1.0),
+            Interval<Real>::HalfOpenRight(3.0, 3.5)
+        };
+
+        const ctnr::Array<Interval<Real>> intervals = {
+            Interval<Real>::HalfOpenRight(0.0, 3.5), Interval<Real>::HalfOpenLeft(4.0, 5.0)
+        };
+
+        EXPECT_EQ(intervals, intervalSet.accessIntervals());
+    }
+
+    {
+        const IntervalSet<Real> intervalSet = {
+            Interval<Real>::Open(1.0, 2.0), Interval<Real>::HalfOpenRight(0.0, 1.0), Interval<Real>::Open(2.0, 3.0)
+        };
+
+        EXPECT_EQ(3, intervalSet.getSize());
+        EXPECT_EQ(Interval<Real>::HalfOpenRight(0.0, 1.0), intervalSet.accessIntervals()[0]);
+    }
+
+    {
+        const IntervalSet<Real> intervalSet = {
+            Interval<Real>::HalfOpenRight(0.0, 1.0), Interval<Real>::Closed(1.0, 1.0), Interval<Real>::Open(1.0, 2.0)
+        };
+
+        EXPECT_EQ(ctnr::Array<Interval<Real>>({Interval<Real>::HalfOpenRight(0.0, 2.0)}), intervalSet.getIntervals());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, EqualToOperator)
+{
+    {
+        EXPECT_TRUE(
+            IntervalSet<Real>({Interval<Real>::Closed(0.0, 1.0), Interval<Real>::Closed(1.0, 2.0)}) ==
+            IntervalSet<Real>({Interval<Real>::Closed(0.0, 2.0)})
+        );
+        EXPECT_TRUE(IntervalSet<Real>::Empty() == IntervalSet<Real>({}));
+    }
+
+    {
+        EXPECT_FALSE(
+            IntervalSet<Real>({Interval<Real>::Closed(0.0, 1.0)}) == IntervalSet<Real>({Interval<Real>::Open(0.0, 1.0)})
+        );
+        EXPECT_TRUE(
+            IntervalSet<Real>({Interval<Real>::Closed(0.0, 1.0)}) != IntervalSet<Real>({Interval<Real>::Open(0.0, 1.0)})
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, IsEmpty)
+{
+    {
+        EXPECT_TRUE(IntervalSet<Real>::Empty().isEmpty());
+        EXPECT_FALSE(IntervalSet<Real>({Interval<Real>::Closed(0.0, 1.0)}).isEmpty());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, ContainsValue)
+{
+    const IntervalSet<Real> intervalSet = {
+        Interval<Real>::Closed(0.0, 1.0),
+        Interval<Real>::Open(2.0, 3.0),
+        Interval<Real>::HalfOpenLeft(4.0, 5.0),
+        Interval<Real>::HalfOpenRight(6.0, 7.0)
+    };
+
+    {
+        EXPECT_TRUE(intervalSet.contains(0.0));
+        EXPECT_TRUE(intervalSet.contains(1.0));
+        EXPECT_TRUE(intervalSet.contains(2.5));
+        EXPECT_TRUE(intervalSet.contains(5.0));
+        EXPECT_TRUE(intervalSet.contains(6.0));
+
+        EXPECT_FALSE(intervalSet.contains(-1.0));
+        EXPECT_FALSE(intervalSet.contains(1.5));
+        EXPECT_FALSE(intervalSet.contains(2.0));
+        EXPECT_FALSE(intervalSet.contains(3.0));
+        EXPECT_FALSE(intervalSet.contains(4.0));
+        EXPECT_FALSE(intervalSet.contains(7.0));
+        EXPECT_FALSE(intervalSet.contains(8.0));
+
+        EXPECT_FALSE(IntervalSet<Real>::Empty().contains(0.0));
+    }
+
+    {
+        EXPECT_ANY_THROW(intervalSet.contains(Real::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, ContainsInterval)
+{
+    const IntervalSet<Real> intervalSet = {Interval<Real>::Closed(0.0, 1.0), Interval<Real>::Open(2.0, 3.0)};
+
+    {
+        EXPECT_TRUE(intervalSet.contains(Interval<Real>::Closed(0.0, 1.0)));
+        EXPECT_TRUE(intervalSet.contains(Interval<Real>::Open(0.2, 0.8)));
+        EXPECT_TRUE(intervalSet.contains(Interval<Real>::Open(2.0, 3.0)));
+        EXPECT_TRUE(intervalSet.contains(Interval<Real>::Closed(2.5, 2.5)));
+
+        EXPECT_FALSE(intervalSet.contains(Interval<Real>::Closed(0.5, 2.5)));
+        EXPECT_FALSE(intervalSet.contains(Interval<Real>::Closed(2.0, 2.5)));
+        EXPECT_FALSE(intervalSet.contains(Interval<Real>::Closed(-1.0, 0.5)));
+    }
+
+    {
+        EXPECT_ANY_THROW(intervalSet.contains(Interval<Real>::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, Intersects)
+{
+    const IntervalSet<Real> intervalSet = {Interval<Real>::HalfOpenRight(0.0, 1.0), Interval<Real>::Open(2.0, 3.0)};
+
+    {
+        EXPECT_TRUE(intervalSet.intersects(Interval<Real>::Closed(0.5, 1.5)));
+        EXPECT_TRUE(intervalSet.intersects(Interval<Real>::Closed(1.0, 2.5)));
+        EXPECT_TRUE(intervalSet.intersects(Interval<Real>::Closed(-5.0, 5.0)));
+
+        EXPECT_FALSE(intervalSet.intersects(Interval<Real>::Closed(1.0, 2.0)));
+        EXPECT_FALSE(intervalSet.intersects(Interval<Real>::Closed(3.0, 4.0)));
+        EXPECT_FALSE(intervalSet.intersects(Interval<Real>::Open(-1.0, 0.0)));
+    }
+
+    {
+        EXPECT_ANY_THROW(intervalSet.intersects(Interval<Real>::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, FindIndexOf)
+{
+    const IntervalSet<Real> intervalSet = {Interval<Real>::Closed(0.0, 1.0), Interval<Real>::Closed(2.0, 3.0)};
+
+    {
+        EXPECT_EQ(0, intervalSet.findIndexOf(0.5));
+        EXPECT_EQ(1, intervalSet.findIndexOf(2.5));
+        EXPECT_EQ(2, intervalSet.findIndexOf(1.5));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, GetSpan)
+{
+    {
+        EXPECT_EQ(
+            Interval<Real>::HalfOpenRight(0.0, 3.0),
+            IntervalSet<Real>({Interval<Real>::Closed(0.0, 1.0), Interval<Real>::Open(2.0, 3.0)}).getSpan()
+        );
+
+        EXPECT_FALSE(IntervalSet<Real>::Empty().getSpan().isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, GetIntersectionWithInterval)
+{
+    {
+        const IntervalSet<Real> intervalSet = {
+            Interval<Real>::Open(1.0, 2.0), Interval<Real>::Closed(3.0, 4.0), Interval<Real>::Closed(5.0, 6.0)
+        };
+
+        const IntervalSet<Real> intersection = {
+            Interval<Real>::HalfOpenRight(1.5, 2.0), Interval<Real>::Closed(3.0, 4.0)
+        };
+
+        EXPECT_EQ(intersection, intervalSet.getIntersectionWith(Interval<Real>::HalfOpenRight(1.5, 5.0)));
+    }
+
+    {
+        EXPECT_ANY_THROW(IntervalSet<Real>::Empty().getIntersectionWith(Interval<Real>::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, GetUnionWith)
+{
+    {
+        const IntervalSet<Real> intervalSet = {
+            Interval<Real>::Closed(2.0, 3.0),
+            Interval<Real>::Open(0.0, 3.0),
+            Interval<Real>::HalfOpenLeft(6.0, 7.0),
+            Interval<Real>::Open(8.0, 9.0),
+            Interval<Real>::HalfOpenLeft(4.0, 5.0)
+        };
+
+        const IntervalSet<Real> anotherIntervalSet = {
+            Interval<Real>::HalfOpenLeft(10.0, 11.0),
+            Interval<Real>::HalfOpenRight(-1.0, 2.0),
+            Interval<Real>::Open(5.0, 7.5)
+        };
+
+        const IntervalSet<Real> unionSet = {
+            Interval<Real>::Closed(-1.0, 3.0),
+            Interval<Real>::Open(4.0, 7.5),
+            Interval<Real>::Open(8.0, 9.0),
+            Interval<Real>::HalfOpenLeft(10.0, 11.0)
+        };
+
+        EXPECT_EQ(unionSet, intervalSet.getUnionWith(anotherIntervalSet));
+        EXPECT_EQ(unionSet, anotherIntervalSet.getUnionWith(intervalSet));
+        EXPECT_EQ(intervalSet, intervalSet.getUnionWith(IntervalSet<Real>::Empty()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, GetIntersectionWith)
+{
+    {
+        const IntervalSet<Real> intervalSet = {
+            Interval<Real>::Closed(2.0, 3.0),
+            Interval<Real>::Open(0.0, 3.0),
+            Interval<Real>::HalfOpenLeft(6.0, 7.0),
+            Interval<Real>::Open(8.0, 9.0),
+            Interval<Real>::HalfOpenLeft(4.0, 5.0)
+        };
+
+        const IntervalSet<Real> anotherIntervalSet = {
+            Interval<Real>::HalfOpenLeft(10.0, 11.0),
+            Interval<Real>::HalfOpenRight(-1.0, 2.0),
+            Interval<Real>::Open(5.0, 7.5)
+        };
+
+        const IntervalSet<Real> intersection = {Interval<Real>::Open(0.0, 2.0), Interval<Real>::HalfOpenLeft(6.0, 7.0)};
+
+        EXPECT_EQ(intersection, intervalSet.getIntersectionWith(anotherIntervalSet));
+        EXPECT_EQ(intersection, anotherIntervalSet.getIntersectionWith(intervalSet));
+        EXPECT_TRUE(intervalSet.getIntersectionWith(IntervalSet<Real>::Empty()).isEmpty());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, GetDifferenceWith)
+{
+    {
+        const IntervalSet<Real> intervalSet = {Interval<Real>::Closed(0.0, 4.0), Interval<Real>::Closed(6.0, 8.0)};
+
+        const IntervalSet<Real> anotherIntervalSet = {
+            Interval<Real>::Open(1.0, 2.0), Interval<Real>::Closed(3.0, 7.0)
+        };
+
+        const IntervalSet<Real> difference = {
+            Interval<Real>::Closed(0.0, 1.0),
+            Interval<Real>::HalfOpenRight(2.0, 3.0),
+            Interval<Real>::HalfOpenLeft(7.0, 8.0),
+        };
+
+        EXPECT_EQ(difference, intervalSet.getDifferenceWith(anotherIntervalSet));
+        EXPECT_EQ(intervalSet, intervalSet.getDifferenceWith(IntervalSet<Real>::Empty()));
+        EXPECT_TRUE(IntervalSet<Real>::Empty().getDifferenceWith(intervalSet).isEmpty());
+        EXPECT_TRUE(intervalSet.getDifferenceWith(intervalSet).isEmpty());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, GetGaps)
+{
+    const IntervalSet<Real> intervalSet = {
+        Interval<Real>::Closed(2.0, 3.0),
+        Interval<Real>::Open(0.0, 1.0),
+        Interval<Real>::HalfOpenLeft(6.0, 7.0),
+        Interval<Real>::HalfOpenRight(4.0, 5.0),
+        Interval<Real>::Open(8.0, 9.0)
+    };
+
+    {
+        const IntervalSet<Real> gaps = {
+            Interval<Real>::HalfOpenRight(1.0, 2.0),
+            Interval<Real>::Open(3.0, 4.0),
+            Interval<Real>::Closed(5.0, 6.0),
+            Interval<Real>::HalfOpenLeft(7.0, 8.0)
+        };
+
+        EXPECT_EQ(gaps, intervalSet.getGaps());
+    }
+
+    {
+        const IntervalSet<Real> gaps = {
+            Interval<Real>::HalfOpenLeft(-1.0, 0.0),
+            Interval<Real>::HalfOpenRight(1.0, 2.0),
+            Interval<Real>::Open(3.0, 4.0),
+            Interval<Real>::Closed(5.0, 6.0),
+            Interval<Real>::HalfOpenLeft(7.0, 8.0),
+            Interval<Real>::Closed(9.0, 10.0),
+        };
+
+        EXPECT_EQ(gaps, intervalSet.getGaps(Interval<Real>::HalfOpenLeft(-1.0, 10.0)));
+    }
+
+    {
+        const IntervalSet<Real> gaps = {Interval<Real>::Closed(0.0, 0.0), Interval<Real>::Closed(9.0, 9.0)};
+
+        EXPECT_EQ(
+            gaps,
+            IntervalSet<Real>({Interval<Real>::Open(0.0, 9.0)}).getGaps(Interval<Real>::Closed(0.0, 9.0))
+        );
+    }
+
+    {
+        EXPECT_TRUE(IntervalSet<Real>::Empty().getGaps().isEmpty());
+        EXPECT_EQ(
+            IntervalSet<Real>({Interval<Real>::Closed(0.0, 1.0)}),
+            IntervalSet<Real>::Empty().getGaps(Interval<Real>::Closed(0.0, 1.0))
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, Insert)
+{
+    {
+        IntervalSet<Real> intervalSet = IntervalSet<Real>::Empty();
+
+        intervalSet.insert(Interval<Real>::Closed(4.0, 5.0));
+        intervalSet.insert(Interval<Real>::Closed(0.0, 1.0));
+        intervalSet.insert(Interval<Real>::Open(8.0, 9.0));
+
+        EXPECT_EQ(3, intervalSet.getSize());
+
+        intervalSet.insert(Interval<Real>::HalfOpenLeft(1.0, 2.0));
+
+        EXPECT_EQ(
+            IntervalSet<Real>(
+                {Interval<Real>::Closed(0.0, 2.0), Interval<Real>::Closed(4.0, 5.0), Interval<Real>::Open(8.0, 9.0)}
+            ),
+            intervalSet
+        );
+
+        intervalSet.insert(Interval<Real>::Open(3.0, 8.0));
+
+        EXPECT_EQ(
+            IntervalSet<Real>(
+                {Interval<Real>::Closed(0.0, 2.0), Interval<Real>::Open(3.0, 8.0), Interval<Real>::Open(8.0, 9.0)}
+            ),
+            intervalSet
+        );
+
+        intervalSet.insert(Interval<Real>::Closed(8.0, 8.0));
+
+        EXPECT_EQ(
+            IntervalSet<Real>({Interval<Real>::Closed(0.0, 2.0), Interval<Real>::Open(3.0, 9.0)}), intervalSet
+        );
+
+        intervalSet.insert(Interval<Real>::Closed(-1.0, 10.0));
+
+        EXPECT_EQ(IntervalSet<Real>({Interval<Real>::Closed(-1.0, 10.0)}), intervalSet);
+    }
+
+    {
+        IntervalSet<Real> intervalSet = IntervalSet<Real>::Empty();
+
+        EXPECT_ANY_THROW(intervalSet.insert(Interval<Real>::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Object_IntervalSet, Empty)
+{
+    {
+        EXPECT_NO_THROW(IntervalSet<Real>::Empty());
+        EXPECT_EQ(0, IntervalSet<Real>::Empty().getSize());
+    }
+}
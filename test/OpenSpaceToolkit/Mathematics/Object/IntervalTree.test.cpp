@@ -0,0 +1,185 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/IntervalTree.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::mathematics::object::Interval;
+using ostk::mathematics::object::IntervalTree;
+namespace ctnr = ostk::core::container;
+
+class OpenSpaceToolkit_Mathematics_Object_IntervalTree : public ::testing::Test
+{
+   protected:
+    const ctnr::Array<Interval<Real>> intervals_ = {
+        Interval<Real>::Closed(4.0, 5.0),
+        Interval<Real>::Closed(0.0, 2.0),
+        Interval<Real>::Open(1.0, 3.0),
+        Interval<Real>::HalfOpenRight(2.0, 2.5),
+        Interval<Real>::Closed(0.0, 10.0),
+        Interval<Real>::HalfOpenLeft(6.0, 7.0),
+    };
+
+    const IntervalTree<Real> intervalTree_ = IntervalTree<Real>(intervals_);
+
+    ctnr::Array<Index> bruteForceContaining(const Real& aValue) const
+    {
+        ctnr::Array<Index> indices;
+
+        for (Index index = 0; index < intervals_.getSize(); ++index)
+        {
+            if (intervals_[index].contains(aValue))
+            {
+                indices.add(index);
+            }
+        }
+
+        std::sort(
+            indices.begin(),
+            indices.end(),
+            [this](const Index& anIndex, const Index& anotherIndex)
+            {
+                if (intervals_[anIndex].accessLowerBound() == intervals_[anotherIndex].accessLowerBound())
+                {
+                    return anIndex < anotherIndex;
+                }
+
+                return intervals_[anIndex].accessLowerBound() < intervals_[anotherIndex].accessLowerBound();
+            }
+        );
+
+        return indices;
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_Object_IntervalTree, Constructor)
+{
+    {
+        EXPECT_NO_THROW(IntervalTree<Real>(ctnr::Array<Interval<Real>>::Empty()));
+        EXPECT_NO_THROW(IntervalTree<Real> intervalTree(intervals_));
+    }
+
+    {
+        EXPECT_ANY_THROW(IntervalTree<Real>({Interval<Real>::Closed(0.0, 1.0), Interval<Real>::Undefined()}));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Object_IntervalTree, IsEmpty)
+{
+    {
+        EXPECT_TRUE(IntervalTree<Real>(ctnr::Array<Interval<Real>>::Empty()).isEmpty());
+        EXPECT_FALSE(intervalTree_.isEmpty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Object_IntervalTree, Contains)
+{
+    {
+        EXPECT_TRUE(intervalTree_.contains(0.0));
+        EXPECT_TRUE(intervalTree_.contains(10.0));
+
+        EXPECT_FALSE(intervalTree_.contains(-1.0));
+        EXPECT_FALSE(intervalTree_.contains(11.0));
+        EXPECT_FALSE(IntervalTree<Real>(ctnr::Array<Interval<Real>>::Empty()).contains(0.0));
+    }
+
+    {
+        EXPECT_ANY_THROW(intervalTree_.contains(Real::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Object_IntervalTree, Intersects)
+{
+    {
+        const IntervalTree<Real> intervalTree = {Interval<Real>::Closed(0.0, 1.0), Interval<Real>::Open(2.0, 3.0)};
+
+        EXPECT_TRUE(intervalTree.intersects(Interval<Real>::Closed(1.0, 2.0)));
+        EXPECT_TRUE(intervalTree.intersects(Interval<Real>::Closed(2.5, 5.0)));
+
+        EXPECT_FALSE(intervalTree.intersects(Interval<Real>::Open(1.0, 2.0)));
+        EXPECT_FALSE(intervalTree.intersects(Interval<Real>::Closed(3.0, 4.0)));
+    }
+
+    {
+        EXPECT_ANY_THROW(intervalTree_.intersects(Interval<Real>::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Object_IntervalTree, AccessIntervalAt)
+{
+    {
+        EXPECT_EQ(intervals_[0], intervalTree_.accessIntervalAt(0));
+        EXPECT_EQ(intervals_[5], intervalTree_.accessIntervalAt(5));
+    }
+
+    {
+        EXPECT_ANY_THROW(intervalTree_.accessIntervalAt(6));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Object_IntervalTree, GetIndicesContaining)
+{
+    {
+        EXPECT_EQ(ctnr::Array<Index>({1, 4}), intervalTree_.getIndicesContaining(0.0));
+        EXPECT_EQ(ctnr::Array<Index>({1, 4, 2}), intervalTree_.getIndicesContaining(1.5));
+        EXPECT_EQ(ctnr::Array<Index>({1, 4, 2, 3}), intervalTree_.getIndicesContaining(2.0));
+        EXPECT_EQ(ctnr::Array<Index>({4}), intervalTree_.getIndicesContaining(6.0));
+        EXPECT_EQ(ctnr::Array<Index>(), intervalTree_.getIndicesContaining(-1.0));
+    }
+
+    {
+        for (Real value = -1.0; value <= 11.0; value += 0.25)
+        {
+            EXPECT_EQ(bruteForceContaining(value), intervalTree_.getIndicesContaining(value)) << value;
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Object_IntervalTree, GetIndicesIntersecting)
+{
+    {
+        EXPECT_EQ(ctnr::Array<Index>({4, 0}), intervalTree_.getIndicesIntersecting(Interval<Real>::Closed(3.0, 4.0)));
+        EXPECT_EQ(ctnr::Array<Index>({4}), intervalTree_.getIndicesIntersecting(Interval<Real>::Open(5.0, 6.0)));
+        EXPECT_EQ(ctnr::Array<Index>(), intervalTree_.getIndicesIntersecting(Interval<Real>::Open(10.0, 11.0)));
+    }
+
+    {
+        EXPECT_ANY_THROW(intervalTree_.getIndicesIntersecting(Interval<Real>::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Object_IntervalTree, GetIndicesContainingBatch)
+{
+    {
+        ctnr::Array<Real> values;
+
+        for (Real value = -1.0; value <= 11.0; value += 0.25)
+        {
+            values.add(value);
+        }
+
+        const ctnr::Array<ctnr::Array<Index>> indicesArray = intervalTree_.getIndicesContaining(values);
+
+        ASSERT_EQ(values.getSize(), indicesArray.getSize());
+
+        for (Index i = 0; i < values.getSize(); ++i)
+        {
+            EXPECT_EQ(bruteForceContaining(values[i]), indicesArray[i]) << values[i];
+        }
+    }
+
+    {
+        EXPECT_TRUE(intervalTree_.getIndicesContaining(ctnr::Array<Real>::Empty()).isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(intervalTree_.getIndicesContaining(ctnr::Array<Real>({1.0, 0.0})));
+        EXPECT_ANY_THROW(intervalTree_.getIndicesContaining(ctnr::Array<Real>({0.0, Real::Undefined()})));
+    }
+}